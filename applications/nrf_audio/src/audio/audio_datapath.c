@@ -66,9 +66,6 @@ LOG_MODULE_REGISTER(audio_datapath, CONFIG_AUDIO_DATAPATH_LOG_LEVEL);
 #define BLK_MONO_SIZE_OCTETS	   (BLK_MONO_NUM_SAMPS * CONFIG_AUDIO_BIT_DEPTH_OCTETS)
 #define BLK_MULTI_CHAN_SIZE_OCTETS (BLK_MULTI_CHAN_NUM_SAMPS * CONFIG_AUDIO_BIT_DEPTH_OCTETS)
 
-/* Number of decoder buffers. */
-#define FIFO_NUM_BUFS 2
-
 /* How many function calls before moving on with drift compensation */
 #define DRIFT_COMP_WAITING_CNT (DRIFT_MEAS_PERIOD_US / BLK_PERIOD_US)
 /* How much data to be collected before moving on with presentation compensation */
@@ -96,8 +93,6 @@ LOG_MODULE_REGISTER(audio_datapath, CONFIG_AUDIO_DATAPATH_LOG_LEVEL);
 NET_BUF_POOL_FIXED_DEFINE(pool_i2s_rx, FIFO_NUM_BLKS / CONFIG_FIFO_FRAME_SPLIT_NUM,
 			  (BLK_MULTI_CHAN_SIZE_OCTETS * CONFIG_FIFO_FRAME_SPLIT_NUM),
 			  sizeof(struct audio_metadata), NULL);
-NET_BUF_POOL_FIXED_DEFINE(audio_pcm_pool, FIFO_NUM_BUFS, PCM_NUM_BYTES_MULTI_CHAN,
-			  sizeof(struct audio_metadata), NULL);
 
 static atomic_t drop_next_block;
 
@@ -149,6 +144,10 @@ static struct {
 		uint32_t prod_blk_ts[FIFO_NUM_BLKS];
 		/* Statistics */
 		uint32_t total_blk_underruns;
+		uint32_t frame_time_cyc_last; /* Decode and FIFO write time of the last frame */
+		uint32_t frame_time_cyc_max;
+		uint64_t frame_time_cyc_total;
+		uint32_t frame_time_num;
 	} out;
 
 	uint32_t prev_drift_sdu_ref_us;
@@ -172,6 +171,9 @@ static struct {
 	} pres_comp;
 } ctrl_blk;
 
+/* Keeps the frame time statistics consistent, as the 64-bit total is not updated atomically */
+static struct k_spinlock frame_time_lock;
+
 /**
  * @brief	Get the current number of blocks in the output buffer.
  */
@@ -1055,71 +1057,65 @@ void audio_datapath_stream_out(struct net_buf *audio_frame_in)
 							 sdu_ref_not_consecutive);
 	}
 
-	/*** Decode ***/
+	/*** Check free space in FIFO buffer ***/
+	uint32_t num_blks_in_fifo = filled_blocks_get();
 
-	int ret;
-	struct net_buf *audio_frame_out = net_buf_alloc(&audio_pcm_pool, K_NO_WAIT);
+	if ((num_blks_in_fifo + NUM_BLKS_IN_FRAME) > FIFO_NUM_BLKS) {
+		LOG_WRN("Output audio stream overrun - Discarding audio frame");
 
-	if (audio_frame_out == NULL) {
-		LOG_ERR("Out of I2S PCM TX buffers.");
+		/* Discard frame to allow consumer to catch up */
 		return;
 	}
 
+	/*** Decode directly into the free blocks of the FIFO buffer ***/
+	int ret;
+	size_t size_written = 0;
+	uint32_t frame_time_cyc;
+	uint32_t frame_start_cyc = k_cycle_get_32();
+	uint32_t out_blk_idx = ctrl_blk.out.prod_blk_idx;
+	uint32_t num_blks_to_end = MIN(NUM_BLKS_IN_FRAME, FIFO_NUM_BLKS - out_blk_idx);
+	struct sw_codec_pcm_sg pcm_out = {
+		.seg[0] = {.data = &ctrl_blk.out.fifo[out_blk_idx * BLK_MULTI_CHAN_NUM_SAMPS],
+			   .size = num_blks_to_end * BLK_MULTI_CHAN_SIZE_OCTETS},
+		/* Part of the frame wrapping around the end of the FIFO */
+		.seg[1] = {.data = &ctrl_blk.out.fifo[0],
+			   .size = (NUM_BLKS_IN_FRAME - num_blks_to_end) *
+				   BLK_MULTI_CHAN_SIZE_OCTETS},
+		.num_segs = (num_blks_to_end < NUM_BLKS_IN_FRAME) ? 2 : 1,
+	};
+
 	/* Output I2S related metadata */
-	struct audio_metadata *meta_out = net_buf_user_data(audio_frame_out);
-	*meta_out = i2s_meta;
-	meta_out->data_len_us = meta_in->data_len_us;
-	meta_out->ref_ts_us = meta_in->ref_ts_us;
-	meta_out->data_rx_ts_us = meta_in->data_rx_ts_us;
-	meta_out->bad_data = meta_in->bad_data;
-
-	ret = sw_codec_decode(audio_frame_in, audio_frame_out);
+	struct audio_metadata meta_out = i2s_meta;
+
+	meta_out.data_len_us = meta_in->data_len_us;
+	meta_out.ref_ts_us = meta_in->ref_ts_us;
+	meta_out.data_rx_ts_us = meta_in->data_rx_ts_us;
+	meta_out.bad_data = meta_in->bad_data;
+
+	/* The blocks are outside the filled part of the FIFO, so the consumer will not
+	 * touch them until the producer index is moved below.
+	 */
+	ret = sw_codec_decode_sg(audio_frame_in, &meta_out, &pcm_out, &size_written);
 	if (ret) {
-		net_buf_unref(audio_frame_out);
 		LOG_WRN("SW codec decode error: %d", ret);
 		return;
 	}
 
-	if (IS_ENABLED(CONFIG_SD_CARD_PLAYBACK)) {
-		if (sd_card_playback_is_active()) {
-			sd_card_playback_mix_with_stream((void *const)audio_frame_out->data,
-							 audio_frame_out->len);
-		}
-	}
-
-	if (audio_frame_out->len != PCM_NUM_BYTES_MONO * CONFIG_AUDIO_OUTPUT_CHANNELS) {
-		LOG_WRN("Decoded audio has wrong size: %d. Expected: %d", audio_frame_out->len,
+	if (size_written != PCM_NUM_BYTES_MONO * CONFIG_AUDIO_OUTPUT_CHANNELS) {
+		LOG_WRN("Decoded audio has wrong size: %zu. Expected: %d", size_written,
 			PCM_NUM_BYTES_MONO * CONFIG_AUDIO_OUTPUT_CHANNELS);
 		/* Discard frame */
-		net_buf_unref(audio_frame_out);
 		return;
 	}
 
-	/*** Add audio data to FIFO buffer ***/
-	uint32_t num_blks_in_fifo = filled_blocks_get();
-
-	if ((num_blks_in_fifo + NUM_BLKS_IN_FRAME) > FIFO_NUM_BLKS) {
-		LOG_WRN("Output audio stream overrun - Discarding audio frame");
-
-		/* Discard frame to allow consumer to catch up */
-		net_buf_unref(audio_frame_out);
-		return;
+	if (IS_ENABLED(CONFIG_SD_CARD_PLAYBACK)) {
+		if (sd_card_playback_is_active()) {
+			sd_card_playback_mix_with_stream_sg(&pcm_out);
+		}
 	}
 
-	uint32_t out_blk_idx = ctrl_blk.out.prod_blk_idx;
-
+	/*** Commit audio data to FIFO buffer ***/
 	for (uint32_t i = 0; i < NUM_BLKS_IN_FRAME; i++) {
-		if (IS_ENABLED(CONFIG_AUDIO_BIT_DEPTH_16)) {
-			memcpy(&ctrl_blk.out.fifo[out_blk_idx * BLK_MULTI_CHAN_NUM_SAMPS],
-			       (int16_t *)audio_frame_out->data, BLK_MULTI_CHAN_SIZE_OCTETS);
-		} else if (IS_ENABLED(CONFIG_AUDIO_BIT_DEPTH_32)) {
-			memcpy(&ctrl_blk.out.fifo[out_blk_idx * BLK_MULTI_CHAN_NUM_SAMPS],
-			       (int32_t *)audio_frame_out->data, BLK_MULTI_CHAN_SIZE_OCTETS);
-		}
-
-		/* Remove consumed data from net buffer */
-		net_buf_pull(audio_frame_out, BLK_MULTI_CHAN_SIZE_OCTETS);
-
 		/* Record producer block start reference */
 		ctrl_blk.out.prod_blk_ts[out_blk_idx] =
 			meta_in->data_rx_ts_us + (i * BLK_PERIOD_US);
@@ -1129,7 +1125,15 @@ void audio_datapath_stream_out(struct net_buf *audio_frame_in)
 
 	ctrl_blk.out.prod_blk_idx = out_blk_idx;
 
-	net_buf_unref(audio_frame_out);
+	frame_time_cyc = k_cycle_get_32() - frame_start_cyc;
+
+	K_SPINLOCK(&frame_time_lock) {
+		ctrl_blk.out.frame_time_cyc_last = frame_time_cyc;
+		ctrl_blk.out.frame_time_cyc_max =
+			MAX(ctrl_blk.out.frame_time_cyc_max, frame_time_cyc);
+		ctrl_blk.out.frame_time_cyc_total += frame_time_cyc;
+		ctrl_blk.out.frame_time_num++;
+	}
 }
 
 int audio_datapath_start(struct k_msgq *audio_q_rx)
@@ -1321,6 +1325,35 @@ static int cmd_audio_pres_comp_disable(const struct shell *shell, size_t argc, c
 	return 0;
 }
 
+static int cmd_audio_frame_time(const struct shell *shell, size_t argc, const char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	uint32_t num;
+	uint32_t last;
+	uint32_t max;
+	uint64_t total;
+
+	K_SPINLOCK(&frame_time_lock) {
+		num = ctrl_blk.out.frame_time_num;
+		last = ctrl_blk.out.frame_time_cyc_last;
+		max = ctrl_blk.out.frame_time_cyc_max;
+		total = ctrl_blk.out.frame_time_cyc_total;
+	}
+
+	if (num == 0) {
+		shell_print(shell, "No audio frames received");
+		return 0;
+	}
+
+	shell_print(shell, "Decode to FIFO time over %d frames: last %d us, avg %d us, max %d us",
+		    num, k_cyc_to_us_floor32(last), (uint32_t)k_cyc_to_us_floor64(total / num),
+		    k_cyc_to_us_floor32(max));
+
+	return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(test_cmd,
 			       SHELL_COND_CMD(CONFIG_SHELL, nrf_tone_start, NULL,
 					      "Start local tone from nRF5340", cmd_i2s_tone_play),
@@ -1338,6 +1371,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(test_cmd,
 			       SHELL_COND_CMD(CONFIG_SHELL, pll_pres_comp_disable, NULL,
 					      "Disable audio presentation compensation",
 					      cmd_audio_pres_comp_disable),
+			       SHELL_COND_CMD(CONFIG_SHELL, audio_frame_time, NULL,
+					      "Show time spent decoding audio frames into the FIFO",
+					      cmd_audio_frame_time),
 			       SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(test, &test_cmd, "Test mode commands", NULL);
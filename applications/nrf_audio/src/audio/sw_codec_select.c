@@ -234,10 +234,53 @@ int sw_codec_encode(struct net_buf *audio_frame_in, struct net_buf *audio_frame_
 	return 0;
 }
 
-int sw_codec_decode(struct net_buf const *const audio_frame_in,
-		    struct net_buf *const audio_frame_out)
+#if (CONFIG_SW_CODEC_LC3)
+/**
+ * @brief	Interleave one decoded channel into a possibly scattered PCM region.
+ *
+ * @note	Every segment holds whole multi-channel sample frames, so the input is split
+ *		at the same sample frame boundary as the output.
+ */
+static int pcm_sg_interleave(uint8_t const *input, size_t input_size, uint8_t channel,
+			     uint8_t pcm_bit_depth, struct sw_codec_pcm_sg const *const pcm_out,
+			     uint8_t output_channels)
 {
-	if (audio_frame_in == NULL || audio_frame_out == NULL) {
+	int ret;
+	size_t seg_in_size;
+
+	for (uint8_t i = 0; i < pcm_out->num_segs && input_size > 0; i++) {
+		seg_in_size = MIN(input_size, pcm_out->seg[i].size / output_channels);
+
+		ret = pscm_interleave(input, seg_in_size, channel, pcm_bit_depth,
+				      pcm_out->seg[i].data, pcm_out->seg[i].size, output_channels);
+		if (ret) {
+			return ret;
+		}
+
+		input += seg_in_size;
+		input_size -= seg_in_size;
+	}
+
+	if (input_size > 0) {
+		LOG_ERR("Decoder output region too small, %zu bytes left", input_size);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+#endif /* (CONFIG_SW_CODEC_LC3) */
+
+int sw_codec_decode_sg(struct net_buf const *const audio_frame_in,
+		       struct audio_metadata *const meta_out,
+		       struct sw_codec_pcm_sg const *const pcm_out, size_t *size_written)
+{
+	if (audio_frame_in == NULL || meta_out == NULL || pcm_out == NULL ||
+	    size_written == NULL) {
+		return -EINVAL;
+	}
+
+	if (pcm_out->num_segs == 0 || pcm_out->num_segs > SW_CODEC_PCM_SEGS_MAX) {
+		LOG_ERR("Invalid number of output segments: %d", pcm_out->num_segs);
 		return -EINVAL;
 	}
 
@@ -248,7 +291,6 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 
 	int ret;
 	struct audio_metadata *meta_in = net_buf_user_data(audio_frame_in);
-	struct audio_metadata *meta_out = net_buf_user_data(audio_frame_out);
 
 	switch (m_config.sw_codec) {
 	case SW_CODEC_LC3: {
@@ -265,6 +307,7 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 		uint32_t loc_in, loc_out;
 		uint32_t bad_data_mask;
 		size_t inter_in_size = 0;
+		size_t pcm_out_size = 0;
 
 		if (meta_in->data_coding != LC3 || meta_out->data_coding != PCM) {
 			LOG_ERR("LC3 decoder module has incorrect input or output data type: in = "
@@ -281,11 +324,20 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 			return -EINVAL;
 		}
 
+		for (uint8_t i = 0; i < pcm_out->num_segs; i++) {
+			pcm_out_size += pcm_out->seg[i].size;
+		}
+
 		chans_out_num = audio_metadata_num_loc_get(meta_out);
-		if (audio_frame_out->size < meta_out->bytes_per_location * chans_out_num) {
-			LOG_ERR("Decoder output buffer too small: %d (<%d for %d channel(s))",
-				audio_frame_out->size,
-				(meta_out->bytes_per_location * chans_out_num), chans_out_num);
+		if (pcm_out_size < meta_out->bytes_per_location * chans_out_num) {
+			LOG_ERR("Decoder output buffer too small: %zu (<%d for %d channel(s))",
+				pcm_out_size, (meta_out->bytes_per_location * chans_out_num),
+				chans_out_num);
+			return -EINVAL;
+		}
+
+		if (!meta_out->interleaved && pcm_out->num_segs > 1) {
+			LOG_ERR("Decoder output must be interleaved to be split");
 			return -EINVAL;
 		}
 
@@ -312,14 +364,16 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 		if (!meta_out->interleaved) {
 			if (IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER) &&
 			    meta_in->sample_rate_hz != meta_out->sample_rate_hz) {
-				src_out = (uint8_t *)audio_frame_out->data;
+				src_out = (uint8_t *)pcm_out->seg[0].data;
 			} else {
-				dec_out = (uint8_t *)audio_frame_out->data;
+				dec_out = (uint8_t *)pcm_out->seg[0].data;
 			}
 		}
 
 		/* Clear all output channels to ensure any unused are zero */
-		memset(audio_frame_out->data, 0, audio_frame_out->size);
+		for (uint8_t i = 0; i < pcm_out->num_segs; i++) {
+			memset(pcm_out->seg[i].data, 0, pcm_out->seg[i].size);
+		}
 
 		chan_in = 0;
 		chan_out = 0;
@@ -336,7 +390,7 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 					  (meta_in->bytes_per_location * chan_in);
 
 				ret = sw_codec_lc3_dec_run(data_in, meta_in->bytes_per_location,
-							   audio_frame_out->size, chan_in, dec_out,
+							   pcm_out_size, chan_in, dec_out,
 							   &bytes_written,
 							   (meta_in->bad_data & bad_data_mask));
 				ERR_CHK_MSG(ret, "Decode failed");
@@ -348,10 +402,9 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 				ERR_CHK_MSG(ret, "Decode: Sample rate converter failed");
 
 				if (meta_out->interleaved) {
-					ret = pscm_interleave(inter_in, inter_in_size, chan_out,
-							      meta_out->carried_bits_per_sample,
-							      audio_frame_out->data,
-							      audio_frame_out->size, chans_out_num);
+					ret = pcm_sg_interleave(inter_in, inter_in_size, chan_out,
+								meta_out->carried_bits_per_sample,
+								pcm_out, chans_out_num);
 					ERR_CHK_MSG(ret, "Decode: Interleave failed");
 				} else {
 					if (IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER) &&
@@ -373,8 +426,7 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 		}
 
 		meta_out->bytes_per_location = inter_in_size;
-		net_buf_add(audio_frame_out,
-			    meta_out->bytes_per_location * audio_metadata_num_loc_get(meta_out));
+		*size_written = meta_out->bytes_per_location * audio_metadata_num_loc_get(meta_out);
 
 #endif /* (CONFIG_SW_CODEC_LC3) */
 		break;
@@ -387,6 +439,32 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 	return 0;
 }
 
+int sw_codec_decode(struct net_buf const *const audio_frame_in,
+		    struct net_buf *const audio_frame_out)
+{
+	int ret;
+	size_t size_written = 0;
+	struct sw_codec_pcm_sg pcm_out;
+
+	if (audio_frame_in == NULL || audio_frame_out == NULL) {
+		return -EINVAL;
+	}
+
+	pcm_out.seg[0].data = audio_frame_out->data;
+	pcm_out.seg[0].size = audio_frame_out->size;
+	pcm_out.num_segs = 1;
+
+	ret = sw_codec_decode_sg(audio_frame_in, net_buf_user_data(audio_frame_out), &pcm_out,
+				 &size_written);
+	if (ret) {
+		return ret;
+	}
+
+	net_buf_add(audio_frame_out, size_written);
+
+	return 0;
+}
+
 int sw_codec_uninit(struct sw_codec_config sw_codec_cfg)
 {
 	int ret;
@@ -22,6 +22,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/net_buf.h>
+#include <audio_defines.h>
 #include "device_location.h"
 
 #if (CONFIG_SW_CODEC_LC3)
@@ -49,6 +50,25 @@
 #define PCM_NUM_BYTES_MULTI_CHAN                                                                   \
 	(PCM_NUM_BYTES_MONO * MAX(CONFIG_AUDIO_DECODE_CHANNELS_MAX, CONFIG_AUDIO_OUTPUT_CHANNELS))
 
+/* A PCM region wrapping around the end of a ring buffer is split in two segments */
+#define SW_CODEC_PCM_SEGS_MAX 2
+
+/**
+ * @brief Scatter descriptor for a decoded PCM output region.
+ *
+ * @note Each segment must hold a whole number of multi-channel sample frames.
+ */
+struct sw_codec_pcm_sg {
+	struct {
+		/** Start of the segment, must be 32-bit aligned. */
+		void *data;
+		/** Size of the segment in bytes. */
+		size_t size;
+	} seg[SW_CODEC_PCM_SEGS_MAX];
+	/** Number of segments in use. */
+	uint8_t num_segs;
+};
+
 /**
  * @brief Software codec selection enumeration.
  */
@@ -141,6 +161,24 @@ int sw_codec_encode(struct net_buf *audio_frame_in, struct net_buf *audio_frame_
 int sw_codec_decode(struct net_buf const *const audio_frame_in,
 		    struct net_buf *const audio_frame_out);
 
+/**
+ * @brief	Decode encoded data and output PCM data directly into a scattered region.
+ *
+ * @note	Used to decode straight into the free part of a ring buffer without an
+ *		intermediate PCM buffer. The output must be interleaved if the region is
+ *		split in more than one segment.
+ *
+ * @param[in]	audio_frame_in	Pointer to the audio input buffer.
+ * @param[in,out] meta_out	Metadata describing the requested PCM output.
+ * @param[in]	pcm_out		Region to write the decoded PCM data into.
+ * @param[out]	size_written	Number of bytes written, summed over all segments.
+ *
+ * @return	0 if success, error codes depends on sw_codec selected.
+ */
+int sw_codec_decode_sg(struct net_buf const *const audio_frame_in,
+		       struct audio_metadata *const meta_out,
+		       struct sw_codec_pcm_sg const *const pcm_out, size_t *size_written);
+
 /**
  * @brief	Uninitialize the software codec and free the allocated space.
  *
@@ -435,11 +435,14 @@ int sd_card_playback_lc3(char *filename)
 	return 0;
 }
 
-int sd_card_playback_mix_with_stream(void *const pcm_a, size_t pcm_a_size)
+int sd_card_playback_mix_with_stream_sg(struct sw_codec_pcm_sg const *const pcm_a)
 {
 	int ret;
 	uint8_t pcm_b[pcm_frame_size];
 	size_t read_size = pcm_frame_size;
+	size_t pcm_a_size = 0;
+	size_t offset_b = 0;
+	size_t seg_size_b;
 
 	if (!sd_card_playback_active) {
 		LOG_ERR("SD card playback is not active");
@@ -452,19 +455,47 @@ int sd_card_playback_mix_with_stream(void *const pcm_a, size_t pcm_a_size)
 		return ret;
 	}
 
-	if (read_size > 0) {
-		ret = pcm_mix(pcm_a, pcm_a_size, pcm_b, read_size, B_MONO_INTO_A_STEREO_L);
+	if (read_size == 0) {
+		LOG_WRN("Size read from ringbuffer: %d. Skipping", read_size);
+		return 0;
+	}
+
+	for (uint8_t i = 0; i < pcm_a->num_segs; i++) {
+		pcm_a_size += pcm_a->seg[i].size;
+	}
+
+	for (uint8_t i = 0; i < pcm_a->num_segs && offset_b < read_size; i++) {
+		/* Split on a mono sample boundary, the last segment takes the remainder */
+		if (i == pcm_a->num_segs - 1) {
+			seg_size_b = read_size - offset_b;
+		} else {
+			seg_size_b = ROUND_DOWN(read_size * pcm_a->seg[i].size / pcm_a_size,
+						sizeof(uint16_t));
+		}
+
+		ret = pcm_mix(pcm_a->seg[i].data, pcm_a->seg[i].size, &pcm_b[offset_b],
+			      seg_size_b, B_MONO_INTO_A_STEREO_L);
 		if (ret) {
 			LOG_ERR("Pcm mix err: %d", ret);
 			return ret;
 		}
-	} else {
-		LOG_WRN("Size read from ringbuffer: %d. Skipping", read_size);
+
+		offset_b += seg_size_b;
 	}
 
 	return 0;
 }
 
+int sd_card_playback_mix_with_stream(void *const pcm_a, size_t pcm_a_size)
+{
+	struct sw_codec_pcm_sg pcm_out = {
+		.seg[0] = {.data = pcm_a, .size = pcm_a_size},
+		.num_segs = 1,
+	};
+
+	return sd_card_playback_mix_with_stream_sg(&pcm_out);
+}
+
 int sd_card_playback_init(void)
 {
 	int ret;
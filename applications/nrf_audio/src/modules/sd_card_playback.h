@@ -19,6 +19,8 @@
 
 #include <zephyr/kernel.h>
 
+#include "sw_codec_select.h"
+
 /**
  * @brief	Check whether or not the SD card playback module is active.
  *
@@ -65,6 +67,19 @@ int sd_card_playback_lc3(char *filename);
  */
 int sd_card_playback_mix_with_stream(void *const pcm_a, size_t pcm_a_size);
 
+/**
+ * @brief	Mix the PCM data from the SD card playback module with a scattered audio stream out.
+ *
+ * @note	One SD card frame is read and split over the segments in proportion to their size.
+ *
+ * @param[in, out]	pcm_a	Region into which to mix PCM data from the LC3 module.
+ *
+ * @retval	0       Success.
+ * @retval      -EACCES SD card playback is not active.
+ * @retval      Otherwise, error from underlying drivers.
+ */
+int sd_card_playback_mix_with_stream_sg(struct sw_codec_pcm_sg const *const pcm_a);
+
 /**
  * @brief	Initialize the SD card playback module. Create the SD card playback thread.
  *
@@ -28,6 +28,8 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_HID_REPORT_PROVIDER_CONSUMER_CTRL_LOG
 
 struct report_data {
 	struct hid_eventq eventq;
+	struct hid_eventq_event
+		eventq_buf[CONFIG_DESKTOP_HID_REPORT_PROVIDER_CONSUMER_CTRL_EVENT_QUEUE_SIZE];
 	struct keys_state keys_state;
 	bool update_needed;
 };
@@ -70,6 +72,10 @@ static bool key_update(struct keys_state *ks, uint16_t usage_id, bool pressed)
 
 	if (err == -ENOENT) {
 		/* Press of the released key was not recorded by the utility. Ignore. */
+	} else if (err == -EINVAL) {
+		/* Usage ID cannot be tracked by the utility. Ignore. */
+		LOG_WRN("Usage ID 0x%" PRIx16 " out of keys state range. Keypress dropped",
+			usage_id);
 	} else if (err == -ENOBUFS) {
 		/* Number of pressed keys exceeds the limit. Ignore. */
 		LOG_WRN("Number of pressed keys exceeds the limit. Keypress dropped");
@@ -251,8 +257,8 @@ static bool handle_button_event(const struct button_event *event)
 
 static void init(void)
 {
-	hid_eventq_init(&report_data.eventq,
-			CONFIG_DESKTOP_HID_REPORT_PROVIDER_CONSUMER_CTRL_EVENT_QUEUE_SIZE);
+	hid_eventq_init(&report_data.eventq, report_data.eventq_buf,
+			ARRAY_SIZE(report_data.eventq_buf));
 	keys_state_init(&report_data.keys_state, CONSUMER_CTRL_REPORT_KEY_COUNT_MAX);
 
 	static const struct hid_report_provider_api provider_api_consumer_ctrl = {
@@ -7,21 +7,26 @@
 #include "hid_eventq.h"
 
 #include <zephyr/types.h>
-#include <zephyr/sys/slist.h>
 #include <zephyr/kernel.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(hid_eventq, CONFIG_DESKTOP_HID_EVENTQ_LOG_LEVEL);
 
-struct hid_eventq_data {
+/* Maximum number of keys with a key press waiting for the matching key release that can be
+ * tracked while looking for removable events. If more keys are pressed at the same time, fewer
+ * events are removed.
+ */
+#define OPEN_KEYS_MAX	16
+
+struct open_key {
 	uint16_t key_id;
-	bool pressed;
+	uint16_t press_cnt;
 };
 
-struct hid_eventq_event {
-	sys_snode_t node;
-	struct hid_eventq_data data;
-	int64_t timestamp;
+/* Keys that were pressed and not yet released. */
+struct open_keys {
+	struct open_key keys[OPEN_KEYS_MAX];
+	uint8_t cnt;
 };
 
 
@@ -32,15 +37,17 @@ static bool hid_eventq_is_initialized(const struct hid_eventq *q)
 	return (q->cnt_max != 0);
 }
 
-void hid_eventq_init(struct hid_eventq *q, uint16_t max_queued)
+void hid_eventq_init(struct hid_eventq *q, struct hid_eventq_event *buf, uint16_t max_queued)
 {
 	LOG_DBG("q:%p, max_queued:%" PRIu16, (void *)q, max_queued);
 
 	ARG_UNUSED(hid_eventq_is_initialized);
 	__ASSERT_NO_MSG(!hid_eventq_is_initialized(q));
+	__ASSERT_NO_MSG(buf);
 	__ASSERT_NO_MSG(max_queued > 0);
 
-	sys_slist_init(&q->root);
+	q->buf = buf;
+	q->head = 0;
 	q->cnt = 0;
 	q->cnt_max = max_queued;
 }
@@ -61,29 +68,127 @@ bool hid_eventq_is_empty(const struct hid_eventq *q)
 	return (q->cnt == 0);
 }
 
-static void drop_oldest_hid_events(struct hid_eventq *q)
+/* Get event at the given position, counting from the oldest enqueued event. */
+static struct hid_eventq_event *event_get(const struct hid_eventq *q, uint16_t pos)
 {
-	LOG_DBG("q:%p", (void *)q);
+	__ASSERT_NO_MSG(pos < q->cnt_max);
 
-	__ASSERT_NO_MSG(hid_eventq_is_full(q));
+	uint32_t idx = (uint32_t)q->head + pos;
+
+	if (idx >= q->cnt_max) {
+		idx -= q->cnt_max;
+	}
+
+	return &q->buf[idx];
+}
+
+static void events_drop(struct hid_eventq *q, uint16_t drop_cnt)
+{
+	__ASSERT_NO_MSG(q->cnt >= drop_cnt);
+
+	if (drop_cnt == 0) {
+		return;
+	}
+
+	q->head = ((uint32_t)q->head + drop_cnt) % q->cnt_max;
+	q->cnt -= drop_cnt;
+
+	LOG_WRN("%u stale events removed from the queue %p", drop_cnt, (void *)q);
+}
+
+static bool open_keys_press(struct open_keys *ok, uint16_t key_id)
+{
+	for (size_t i = 0; i < ok->cnt; i++) {
+		if (ok->keys[i].key_id == key_id) {
+			ok->keys[i].press_cnt++;
+			return true;
+		}
+	}
+
+	if (ok->cnt == ARRAY_SIZE(ok->keys)) {
+		return false;
+	}
+
+	ok->keys[ok->cnt].key_id = key_id;
+	ok->keys[ok->cnt].press_cnt = 1;
+	ok->cnt++;
+
+	return true;
+}
+
+static void open_keys_release(struct open_keys *ok, uint16_t key_id)
+{
+	for (size_t i = 0; i < ok->cnt; i++) {
+		if (ok->keys[i].key_id == key_id) {
+			ok->keys[i].press_cnt--;
+
+			if (ok->keys[i].press_cnt == 0) {
+				ok->cnt--;
+				ok->keys[i] = ok->keys[ok->cnt];
+			}
 
-	sys_snode_t *i;
+			return;
+		}
+	}
+
+	/* Key release of a key pressed before the oldest enqueued event. */
+}
+
+/* Get number of the oldest events with a timestamp lower than min_timestamp that can be removed,
+ * that is, the longest sequence of the oldest events that contains the matching key release for
+ * every contained key press. The events are checked in a single pass.
+ *
+ * If first_only is set, the search stops at the end of the first group of events with the same
+ * timestamp that allows to remove any event.
+ */
+static uint16_t removable_cnt_get(const struct hid_eventq *q, int64_t min_timestamp,
+				  bool first_only)
+{
+	struct open_keys ok;
+	uint16_t removable_cnt = 0;
+	int64_t prev_timestamp = 0;
 
-	SYS_SLIST_FOR_EACH_NODE(&q->root, i) {
-		/* Try to remove events but only if key release was generated for each removed key
-		 * press.
-		 */
-		int64_t node_timestamp = CONTAINER_OF(i, struct hid_eventq_event, node)->timestamp;
+	ok.cnt = 0;
 
-		/* Use incremented event timestamp to drop the event. */
-		hid_eventq_cleanup(q, node_timestamp + 1);
-		if (!hid_eventq_is_full(q)) {
-			/* At least one element was removed from the queue.
-			 * Do not continue list traverse, content was modified!
-			 */
+	for (uint16_t pos = 0; pos < q->cnt; pos++) {
+		const struct hid_eventq_event *evt = event_get(q, pos);
+
+		if (evt->timestamp >= min_timestamp) {
 			break;
 		}
+
+		if (first_only && (removable_cnt > 0) && (evt->timestamp != prev_timestamp)) {
+			break;
+		}
+
+		if (evt->pressed) {
+			if (!open_keys_press(&ok, evt->key_id)) {
+				break;
+			}
+		} else {
+			open_keys_release(&ok, evt->key_id);
+		}
+
+		if (ok.cnt == 0) {
+			removable_cnt = pos + 1;
+		}
+
+		prev_timestamp = evt->timestamp;
 	}
+
+	return removable_cnt;
+}
+
+static void drop_oldest_hid_events(struct hid_eventq *q)
+{
+	LOG_DBG("q:%p", (void *)q);
+
+	__ASSERT_NO_MSG(hid_eventq_is_full(q));
+
+	/* Remove the oldest events but only if key release was generated for each removed key
+	 * press.
+	 */
+	events_drop(q, removable_cnt_get(q, INT64_MAX, true));
 }
 
 int hid_eventq_keypress_enqueue(struct hid_eventq *q, uint16_t id, bool pressed, bool drop_oldest)
@@ -100,22 +205,16 @@ int hid_eventq_keypress_enqueue(struct hid_eventq *q, uint16_t id, bool pressed,
 		}
 	}
 
-	struct hid_eventq_event *evt = k_malloc(sizeof(*evt));
-
-	if (!evt) {
-		LOG_ERR("hid_eventq_event allocation failed");
-		return -ENOMEM;
-	}
+	struct hid_eventq_event *evt = event_get(q, q->cnt);
 
 	evt->timestamp = k_uptime_get();
-	evt->data.key_id = id;
-	evt->data.pressed = pressed;
+	evt->key_id = id;
+	evt->pressed = pressed;
 
 	LOG_DBG("q:%p, ts:%" PRId64 ", id:%" PRIu16 ", %s",
 		(void *)q, evt->timestamp, id, pressed ? "press" : "release");
 
 	/* Add a new event to the queue. */
-	sys_slist_append(&q->root, &evt->node);
 	q->cnt++;
 
 	return 0;
@@ -127,111 +226,36 @@ int hid_eventq_keypress_dequeue(struct hid_eventq *q, uint16_t *id, bool *presse
 	__ASSERT_NO_MSG(id);
 	__ASSERT_NO_MSG(pressed);
 
-	sys_snode_t *n = sys_slist_get(&q->root);
-
-	if (!n) {
+	if (hid_eventq_is_empty(q)) {
 		return -ENOENT;
 	}
 
-	struct hid_eventq_event *evt = CONTAINER_OF(n, struct hid_eventq_event, node);
+	const struct hid_eventq_event *evt = event_get(q, 0);
 
-	*id = evt->data.key_id;
-	*pressed = evt->data.pressed;
+	*id = evt->key_id;
+	*pressed = evt->pressed;
 
 	LOG_DBG("q:%p, ts:%" PRId64 ", id:%" PRIu16 ", %s",
 		(void *)q, evt->timestamp, *id, *pressed ? "press" : "release");
 
-	k_free(evt);
+	q->head++;
+	if (q->head == q->cnt_max) {
+		q->head = 0;
+	}
 	q->cnt--;
 
 	return 0;
 }
 
-static void hid_eventq_region_purge(struct hid_eventq *q, sys_snode_t *last_to_purge)
-{
-	sys_snode_t *tmp;
-	sys_snode_t *tmp_safe;
-	size_t removed_cnt = 0;
-
-	SYS_SLIST_FOR_EACH_NODE_SAFE(&q->root, tmp, tmp_safe) {
-		__ASSERT_NO_MSG(tmp);
-
-		sys_slist_remove(&q->root, NULL, tmp);
-		k_free(CONTAINER_OF(tmp, struct hid_eventq_event, node));
-		removed_cnt++;
-
-		if (tmp == last_to_purge) {
-			break;
-		}
-	}
-
-	__ASSERT_NO_MSG(q->cnt >= removed_cnt);
-	q->cnt -= removed_cnt;
-
-	if (removed_cnt > 0) {
-		LOG_WRN("%u stale events removed from the queue %p", removed_cnt, (void *)q);
-	}
-}
-
 void hid_eventq_reset(struct hid_eventq *q)
 {
 	__ASSERT_NO_MSG(hid_eventq_is_initialized(q));
 
 	LOG_DBG("q:%p", (void *)q);
 
-	hid_eventq_region_purge(q, NULL);
+	events_drop(q, q->cnt);
 
 	__ASSERT_NO_MSG(q->cnt == 0);
-	__ASSERT_NO_MSG(sys_slist_is_empty(&q->root));
-}
-
-static sys_snode_t *get_first_valid_node(struct hid_eventq *q, int64_t min_timestamp)
-{
-	sys_snode_t *i;
-
-	SYS_SLIST_FOR_EACH_NODE(&q->root, i) {
-		struct hid_eventq_event *evt = CONTAINER_OF(i, struct hid_eventq_event, node);
-
-		if (evt->timestamp >= min_timestamp) {
-			return i;
-		}
-	}
-
-	return NULL;
-}
-
-static sys_snode_t *get_keypress_release_node(struct hid_eventq *q, struct hid_eventq_event *evt,
-					      int *evt_pos, sys_snode_t *limit)
-{
-	__ASSERT_NO_MSG(evt->data.pressed);
-
-	size_t hit_count = 1;
-	size_t pos_shift = 0;
-	sys_snode_t *i = &evt->node;
-
-	SYS_SLIST_ITERATE_FROM_NODE(&q->root, i) {
-		pos_shift++;
-
-		if (i == limit) {
-			break;
-		}
-
-		const struct hid_eventq_event *cur = CONTAINER_OF(i, struct hid_eventq_event, node);
-
-		if (cur->data.key_id == evt->data.key_id) {
-			hit_count += cur->data.pressed ? (1) : (-1);
-
-			if (hit_count == 0) {
-				*evt_pos += pos_shift;
-
-				/* Found matching keypress releases. */
-				return i;
-			}
-		}
-	}
-
-	/* Not found. */
-	return NULL;
 }
 
 void hid_eventq_cleanup(struct hid_eventq *q, int64_t min_timestamp)
@@ -240,52 +264,6 @@ void hid_eventq_cleanup(struct hid_eventq *q, int64_t min_timestamp)
 
 	LOG_DBG("q:%p, min_timestamp:%" PRId64, (void *)q, min_timestamp);
 
-	sys_snode_t *first_valid = get_first_valid_node(q, min_timestamp);
-
-	sys_snode_t *max_node = NULL;
-	int max_pos = -1;
-
-	sys_snode_t *cur_node;
-	int cur_pos = 0;
-
-	sys_snode_t *tmp_safe;
-
 	/* Remove events but only if key release was generated for each removed key press. */
-	SYS_SLIST_FOR_EACH_NODE_SAFE(&q->root, cur_node, tmp_safe) {
-		if (cur_node == first_valid) {
-			break;
-		}
-
-		struct hid_eventq_event *cur_evt =
-			CONTAINER_OF(cur_node, struct hid_eventq_event, node);
-
-		if (cur_evt->data.pressed) {
-			int release_pos = cur_pos;
-			sys_snode_t *release_node = get_keypress_release_node(q, cur_evt,
-									      &release_pos,
-									      first_valid);
-
-			if (release_node) {
-				if (release_pos > max_pos) {
-					max_node = release_node;
-					max_pos = release_pos;
-				}
-			} else {
-				/* Node not found. Abort cleanup. */
-				break;
-			}
-		} else {
-			if (cur_pos > max_pos) {
-				max_node = cur_node;
-				max_pos = cur_pos;
-			}
-		}
-
-		if (cur_node == max_node) {
-			/* All keypresses up to this point have pairs and can be deleted. */
-			hid_eventq_region_purge(q, max_node);
-		}
-
-		cur_pos++;
-	}
+	events_drop(q, removable_cnt_get(q, min_timestamp, false));
 }
@@ -22,11 +22,19 @@
 extern "C" {
 #endif
 
-#include <zephyr/sys/slist.h>
+#include <zephyr/types.h>
+
+/**@brief Enqueued HID event. The structure is used only as storage of the queue. */
+struct hid_eventq_event {
+	int64_t timestamp;
+	uint16_t key_id;
+	bool pressed;
+};
 
 /**@brief Event queue structure. */
 struct hid_eventq {
-	sys_slist_t root;
+	struct hid_eventq_event *buf;
+	uint16_t head;
 	uint16_t cnt;
 	uint16_t cnt_max;
 };
@@ -36,10 +44,15 @@ struct hid_eventq {
  *
  * A HID event queue object instance must be initialized before used.
  *
+ * The queue is a ring buffer of fixed capacity that stores the events in the provided buffer.
+ * The buffer must stay valid as long as the queue is in use.
+ *
  * @param[in] q			HID event queue object.
- * @param[in] max_queued	Limit of enqueued HID events for the queue.
+ * @param[in] buf		Buffer for the enqueued HID events.
+ * @param[in] max_queued	Limit of enqueued HID events for the queue, that is, number of
+ *				elements of the buffer.
  */
-void hid_eventq_init(struct hid_eventq *q, uint16_t max_queued);
+void hid_eventq_init(struct hid_eventq *q, struct hid_eventq_event *buf, uint16_t max_queued);
 
 /**
  * @brief Check if a HID event queue is full
@@ -80,7 +93,6 @@ bool hid_eventq_is_empty(const struct hid_eventq *q);
  *
  * @retval 0 when successful.
  * @retval -ENOBUFS if reached limit of enqueued HID events.
- * @retval -ENOMEM if internal memory allocation failed.
  */
 int hid_eventq_keypress_enqueue(struct hid_eventq *q, uint16_t id, bool pressed, bool drop_oldest);
 
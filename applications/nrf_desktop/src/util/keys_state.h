@@ -24,6 +24,18 @@ extern "C" {
 
 #define KEYS_MAX_CNT	CONFIG_DESKTOP_KEYS_STATE_KEY_CNT_MAX
 
+#ifdef CONFIG_DESKTOP_KEYS_STATE_BACKEND_BITMAP
+#define KEYS_STATE_KEY_ID_CNT	(CONFIG_DESKTOP_KEYS_STATE_BITMAP_KEY_ID_MAX + 1)
+#define KEYS_STATE_BITMAP_WORDS	((KEYS_STATE_KEY_ID_CNT + 31) / 32)
+
+/**@brief Keys state structure. */
+struct keys_state {
+	uint32_t bitmap[KEYS_STATE_BITMAP_WORDS]; /**< Bitmap of active key IDs. */
+	uint8_t press_cnt[KEYS_STATE_KEY_ID_CNT]; /**< Keypress counters indexed by key ID. */
+	uint8_t cnt; /**< Current number of active keys. */
+	uint8_t cnt_max; /**< Maximum number of active keys. */
+};
+#else
 /** @brief Structure used to track an active key. */
 struct active_key {
 	uint16_t id; /**< Key ID. */
@@ -36,6 +48,7 @@ struct keys_state {
 	uint8_t cnt; /**< Current number of active keys. */
 	uint8_t cnt_max; /**< Maximum number of active keys. */
 };
+#endif /* CONFIG_DESKTOP_KEYS_STATE_BACKEND_BITMAP */
 
 /**
  * @brief Initialize a keys state object.
@@ -64,6 +77,7 @@ void keys_state_init(struct keys_state *ks, uint8_t key_cnt_max);
  * @retval 0 when successful.
  * @retval -ENOENT if key is released, but related key press was not recorded by the utility.
  * @retval -ENOBUFS if key is pressed and number of active keys exceeds the limit.
+ * @retval -EINVAL if key ID exceeds the range supported by the bitmap backend.
  */
 int keys_state_key_update(struct keys_state *ks, uint16_t key_id, bool pressed, bool *ks_changed);
 
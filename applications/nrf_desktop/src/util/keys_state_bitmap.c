@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "keys_state.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(keys_state, CONFIG_DESKTOP_KEYS_STATE_LOG_LEVEL);
+
+#define BITMAP_WORD_BITS	32
+
+BUILD_ASSERT(KEYS_MAX_CNT <= UINT8_MAX);
+
+
+static bool keys_state_is_initialized(const struct keys_state *ks)
+{
+	return (ks->cnt_max > 0);
+}
+
+void keys_state_init(struct keys_state *ks, uint8_t key_cnt_max)
+{
+	LOG_DBG("ks:%p, key_cnt_max:%" PRIu8, (void *)ks, key_cnt_max);
+
+	ARG_UNUSED(keys_state_is_initialized);
+
+	__ASSERT_NO_MSG(!keys_state_is_initialized(ks));
+	__ASSERT_NO_MSG((key_cnt_max > 0) && (key_cnt_max <= KEYS_MAX_CNT));
+
+	ks->cnt_max = key_cnt_max;
+	keys_state_clear(ks);
+}
+
+static void key_bit_set(struct keys_state *ks, uint16_t key_id, bool active)
+{
+	uint32_t mask = BIT(key_id % BITMAP_WORD_BITS);
+
+	if (active) {
+		ks->bitmap[key_id / BITMAP_WORD_BITS] |= mask;
+	} else {
+		ks->bitmap[key_id / BITMAP_WORD_BITS] &= ~mask;
+	}
+}
+
+int keys_state_key_update(struct keys_state *ks, uint16_t key_id, bool pressed, bool *ks_changed)
+{
+	LOG_DBG("ks:%p, key ID:0x%" PRIx16 " %s",
+		(void *)ks, key_id, pressed ? "press" : "release");
+
+	__ASSERT_NO_MSG(ks_changed);
+	__ASSERT_NO_MSG(keys_state_is_initialized(ks));
+
+	*ks_changed = false;
+
+	if (key_id >= KEYS_STATE_KEY_ID_CNT) {
+		LOG_WRN("Key ID:0x%" PRIx16 " out of bitmap range", key_id);
+		return -EINVAL;
+	}
+
+	uint8_t *press_cnt = &ks->press_cnt[key_id];
+
+	if (pressed) {
+		if (*press_cnt == UINT8_MAX) {
+			/* Cannot record more presses of the key. */
+			return -ENOBUFS;
+		}
+
+		if (*press_cnt == 0) {
+			__ASSERT_NO_MSG(ks->cnt <= ks->cnt_max);
+
+			if (ks->cnt == ks->cnt_max) {
+				/* Cannot allocate new active key. */
+				return -ENOBUFS;
+			}
+
+			key_bit_set(ks, key_id, true);
+			ks->cnt++;
+			*ks_changed = true;
+		}
+
+		(*press_cnt)++;
+	} else {
+		if (*press_cnt == 0) {
+			/* Released key not active. */
+			return -ENOENT;
+		}
+
+		(*press_cnt)--;
+
+		if (*press_cnt == 0) {
+			/* Key no longer active. */
+			key_bit_set(ks, key_id, false);
+			ks->cnt--;
+			*ks_changed = true;
+		}
+	}
+
+	return 0;
+}
+
+void keys_state_clear(struct keys_state *ks)
+{
+	LOG_DBG("ks:%p", (void *)ks);
+
+	__ASSERT_NO_MSG(keys_state_is_initialized(ks));
+
+	memset(ks->bitmap, 0, sizeof(ks->bitmap));
+	memset(ks->press_cnt, 0, sizeof(ks->press_cnt));
+	ks->cnt = 0;
+}
+
+size_t keys_state_keys_get(const struct keys_state *ks, uint16_t *res, size_t res_size)
+{
+	LOG_DBG("ks:%p", (void *)ks);
+
+	__ASSERT_NO_MSG(ks->cnt <= ks->cnt_max);
+	__ASSERT_NO_MSG(res_size >= ks->cnt_max);
+	ARG_UNUSED(res_size);
+
+	__ASSERT_NO_MSG(keys_state_is_initialized(ks));
+
+	size_t cnt = 0;
+
+	/* Iterate over bitmap words to get active key IDs in ascending order. Stop as soon as all
+	 * of the active keys are found.
+	 */
+	for (size_t i = 0; (i < ARRAY_SIZE(ks->bitmap)) && (cnt < ks->cnt); i++) {
+		uint32_t word = ks->bitmap[i];
+
+		while (word) {
+			uint32_t bit = u32_count_trailing_zeros(word);
+
+			res[cnt++] = (i * BITMAP_WORD_BITS) + bit;
+			word &= word - 1;
+		}
+	}
+
+	__ASSERT_NO_MSG(cnt == ks->cnt);
+
+	return cnt;
+}
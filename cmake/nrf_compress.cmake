@@ -0,0 +1,46 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+set(NRF_COMPRESS_LZ4_SCRIPT ${ZEPHYR_NRF_MODULE_DIR}/scripts/nrf_compress/lz4_compress.py)
+
+#
+# Compress a file for the LZ4 implementation of the nRF compression library.
+#
+# Usage:
+#   nrf_compress_lz4_file(INPUT <file> OUTPUT <file> [WINDOW_SIZE <size>])
+#
+# INPUT:       File to compress.
+# OUTPUT:      Compressed file, to be used as a dependency of other build steps.
+# WINDOW_SIZE: Window size in bytes, defaults to CONFIG_NRF_COMPRESS_LZ4_WINDOW_SIZE.
+#              It must not be larger than the window size of the decompressing image.
+#
+function(nrf_compress_lz4_file)
+  cmake_parse_arguments(LZ4 "" "INPUT;OUTPUT;WINDOW_SIZE" "" ${ARGN})
+  check_arguments_required_all(nrf_compress_lz4_file LZ4 INPUT OUTPUT)
+
+  if(NOT DEFINED LZ4_WINDOW_SIZE)
+    set(LZ4_WINDOW_SIZE ${CONFIG_NRF_COMPRESS_LZ4_WINDOW_SIZE})
+  endif()
+
+  add_custom_command(
+    OUTPUT ${LZ4_OUTPUT}
+    COMMAND ${PYTHON_EXECUTABLE} ${NRF_COMPRESS_LZ4_SCRIPT}
+            --window-size ${LZ4_WINDOW_SIZE} ${LZ4_INPUT} ${LZ4_OUTPUT}
+    DEPENDS ${LZ4_INPUT} ${NRF_COMPRESS_LZ4_SCRIPT}
+    COMMENT "Compressing ${LZ4_INPUT} with LZ4"
+  )
+endfunction()
+
+if(CONFIG_NRF_COMPRESS_LZ4_IMAGE)
+  set(lz4_image ${ZEPHYR_BINARY_DIR}/${KERNEL_BIN_NAME}.lz4)
+
+  set_property(GLOBAL APPEND PROPERTY extra_post_build_commands
+    COMMAND ${PYTHON_EXECUTABLE} ${NRF_COMPRESS_LZ4_SCRIPT}
+            --window-size ${CONFIG_NRF_COMPRESS_LZ4_WINDOW_SIZE}
+            ${ZEPHYR_BINARY_DIR}/${KERNEL_BIN_NAME} ${lz4_image}
+  )
+  set_property(GLOBAL APPEND PROPERTY extra_post_build_byproducts ${lz4_image})
+endif()
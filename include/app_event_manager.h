@@ -91,6 +91,17 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 #define APP_EVENT_LISTENER(lname, cb_fn) _APP_EVENT_LISTENER(lname, cb_fn)
 
 
+/** @brief Get the listener object.
+ *
+ * The listener object is defined in the file that uses @ref APP_EVENT_LISTENER
+ * and can be referenced only from the same file.
+ *
+ * @param lname  Module name.
+ * @return Pointer to struct event_listener.
+ */
+#define APP_EVENT_LISTENER_ID(lname) (&_CONCAT(__event_listener_, lname))
+
+
 /** @brief Subscribe a listener to an event type as first module that is
  *  being notified.
  *
@@ -168,14 +179,53 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
  * - cast_<i>%event_type</i> - Casts the application event header that is provided
  *                            as argument to an event of the given type.
  *
+ * Optional event type options can be provided after the flags, for example
+ * @ref APP_EVENT_PRIO_CLASS and @ref APP_EVENT_COALESCE.
+ *
  * @param ename     	   Name of the event.
  * @param log_fn  	   Function to stringify an event of this type.
  * @param ev_info_struct   Data structure describing the event type.
  * @param app_event_type_flags Event type flags.
  *                         You should use APP_EVENT_FLAGS_CREATE to define them.
+ * @param ...              Optional comma-separated list of event type options.
  */
-#define APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags) \
-	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags)
+#define APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags, ...)	\
+	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags,	\
+			       __VA_ARGS__)
+
+
+/** @brief Event type option selecting the priority class of the event type.
+ *
+ * Events of priority class 0 are processed by the system workqueue. Events of every higher
+ * priority class are processed by a dedicated work queue thread of a higher priority.
+ * Event types defined without this option belong to priority class 0.
+ *
+ * Listeners are called from the thread that processes the event, so a listener subscribed
+ * to event types of different priority classes is called from different threads, and one
+ * call can preempt another. Such a listener must protect the state that it shares between
+ * the calls. The order of events is preserved only within a priority class.
+ *
+ * The option is ignored if @kconfig{CONFIG_APP_EVENT_MANAGER_PRIO_CLASS_COUNT} is set to 1.
+ * Otherwise, a class out of range causes a build error.
+ *
+ * @param class_id Priority class, lower than @kconfig{CONFIG_APP_EVENT_MANAGER_PRIO_CLASS_COUNT}.
+ */
+#define APP_EVENT_PRIO_CLASS(class_id) _APP_EVENT_TYPE_OPT_PRIO_CLASS(class_id)
+
+
+/** @brief Event type option enabling coalescing of pending events.
+ *
+ * When an event of this type is submitted while an earlier event of the same type is still
+ * waiting in the queue, the coalescing function is called with both events. If the function
+ * returns true, the submitted event has been merged into the pending one and it is freed
+ * without being delivered. The pending event keeps its position in the queue.
+ * The function is called under the queue lock and must not block.
+ *
+ * The option is ignored if @kconfig{CONFIG_APP_EVENT_MANAGER_COALESCE} is disabled.
+ *
+ * @param coalesce_fn Function of type @ref app_event_coalesce_fn.
+ */
+#define APP_EVENT_COALESCE(coalesce_fn) _APP_EVENT_TYPE_OPT_COALESCE(coalesce_fn)
 
 
 /** @brief Verify if an event ID is valid.
@@ -403,6 +453,56 @@ void *app_event_manager_alloc(size_t size);
 void app_event_manager_free(void *addr);
 
 
+/** @brief Enable or disable a listener.
+ *
+ * A disabled listener is not notified about any event until it is enabled again.
+ * The events are delivered to the remaining subscribers as if the disabled listener
+ * did not consume them.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_LISTENER_CONTROL} option needs to be enabled.
+ *
+ * @param el      Pointer to the listener, see @ref APP_EVENT_LISTENER_ID.
+ * @param enable  True to enable the listener, false to disable it.
+ */
+void app_event_manager_listener_enable(const struct event_listener *el, bool enable);
+
+/** @brief Check if a listener is enabled.
+ *
+ * @param el  Pointer to the listener, see @ref APP_EVENT_LISTENER_ID.
+ * @retval True if the listener is notified about events, false otherwise.
+ */
+bool app_event_manager_listener_is_enabled(const struct event_listener *el);
+
+/** @brief Listener handler time statistics. */
+struct app_event_listener_stats {
+	/** Number of notification function calls. */
+	uint32_t call_cnt;
+
+	/** Longest notification function call in cycles. */
+	uint32_t max_cycles;
+
+	/** Total time spent in the notification function in cycles. */
+	uint64_t total_cycles;
+};
+
+/** @brief Get handler time statistics of a listener.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_LISTENER_STATS} option needs to be enabled.
+ *
+ * @param el     Pointer to the listener.
+ * @param stats  Pointer to the structure to be filled with the statistics.
+ */
+void app_event_manager_listener_stats_get(const struct event_listener *el,
+					  struct app_event_listener_stats *stats);
+
+/** @brief Reset handler time statistics of all listeners. */
+void app_event_manager_listener_stats_reset(void);
+
+
 /** @brief Log event.
  *
  * This helper macro simplifies event logging.
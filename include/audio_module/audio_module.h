@@ -283,6 +283,8 @@ struct audio_module_parameters {
 	struct audio_module_thread_configuration thread;
 };
 
+struct audio_module_graph;
+
 /**
  * @brief Private module handle.
  */
@@ -314,8 +316,10 @@ struct audio_module_handle {
 	/* Number of destination modules. */
 	uint8_t dest_count;
 
-	/* Semaphore to count messages between modules and on a module's TX FIFO. */
-	struct k_sem sem;
+	/* Reference count for each block of the data slab, i.e. the number of receivers
+	 * (connected modules and the TX FIFO) still holding the audio data in that block.
+	 */
+	atomic_t data_refs[CONFIG_AUDIO_MODULE_DATA_BLOCKS_MAX];
 
 	/* Mutex to make the above destinations list thread safe. */
 	struct k_mutex dest_mutex;
@@ -323,6 +327,9 @@ struct audio_module_handle {
 	/* Module's thread configuration. */
 	struct audio_module_thread_configuration thread;
 
+	/* Graph the module is run in without its own thread, NULL for a threaded module. */
+	struct audio_module_graph *graph;
+
 	/* Private context for the module. */
 	struct audio_module_context *context;
 };
@@ -341,6 +348,33 @@ struct audio_module_message {
 	audio_module_response_cb response_cb;
 };
 
+#if defined(CONFIG_AUDIO_MODULE_GRAPH) || defined(__DOXYGEN__)
+/**
+ * @brief Graph of audio modules run in a single context.
+ *
+ * @details The modules of a graph have no threads or RX FIFOs. A call to
+ *          audio_module_graph_process() runs all of them in topological order by direct
+ *          function calls, handing each module's output audio data straight to the modules
+ *          connected to it.
+ */
+struct audio_module_graph {
+	/* The modules in the graph, in topological order after audio_module_graph_start(). */
+	struct audio_module_handle *modules[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX];
+
+	/* Index of the module feeding each module, or -1 if fed by the graph input. */
+	int8_t source[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX];
+
+	/* Output audio data of each module while processing a frame. */
+	struct audio_data data[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX];
+
+	/* Number of modules in the graph. */
+	uint8_t num_modules;
+
+	/* Flag to indicate the modules have been ordered and started. */
+	bool started;
+};
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
+
 /**
  * @brief Open an audio module.
  *
@@ -361,6 +395,8 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 /**
  * @brief Close an opened audio module.
  *
+ * @note A module in a graph is removed from the graph. The graph must be stopped.
+ *
  * @param handle  [in/out]  The handle to the module instance.
  *
  * @return 0 if successful, error otherwise.
@@ -392,7 +428,8 @@ int audio_module_configuration_get(struct audio_module_handle const *const handl
 /**
  * @brief Connect two audio modules together or connect to the module's TX FIFO.
  *
- * @note The function should be called once for every individual connection.
+ * @note The function should be called once for every individual connection. The
+ *       connections of a started graph cannot be changed.
  *
  * @param handle_from       [in/out]  The handle for the module for output.
  * @param handle_to         [in/out]  The handle of the module for input, should be NULL if
@@ -410,6 +447,8 @@ int audio_module_connect(struct audio_module_handle *handle_from,
  * @brief Disconnect audio modules from each other or disconnect the module's TX FIFO. The function
  * should be called for all individual disconnections.
  *
+ * @note The connections of a started graph cannot be changed.
+ *
  * @param handle               [in/out]  The handle for the module.
  * @param handle_disconnect    [in/out]  The handle of the module to disconnect, should be NULL if
  *                                       disconnect_external flag is true.
@@ -537,6 +576,67 @@ int audio_module_state_get(struct audio_module_handle const *const handle,
  */
 int audio_module_number_channels_calculate(uint32_t locations, int8_t *number_channels);
 
+#if defined(CONFIG_AUDIO_MODULE_GRAPH) || defined(__DOXYGEN__)
+/**
+ * @brief Open an audio module as a member of a graph.
+ *
+ * @note The module gets no thread, so the thread stack, priority and FIFOs of the parameters
+ *       are not used, apart from the TX FIFO if the module is connected externally. The
+ *       module is connected with audio_module_connect() and closed with audio_module_close().
+ *
+ * @param graph          [in/out]  Pointer to the graph, zero initialized before the first call.
+ * @param parameters     [in]      Pointer to the module set-up parameters.
+ * @param configuration  [in]      Pointer to the module's configuration.
+ * @param name           [in]      A NULL terminated string giving a unique name for this module
+ *                                 instance.
+ * @param context        [in/out]  Pointer to the private context for the module.
+ * @param handle         [out]     Pointer to the module's private handle.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_add(struct audio_module_graph *graph,
+			   struct audio_module_parameters const *const parameters,
+			   struct audio_module_configuration const *const configuration,
+			   char const *const name, struct audio_module_context *context,
+			   struct audio_module_handle *handle);
+
+/**
+ * @brief Order the modules of a graph and start them.
+ *
+ * @note Each module can be fed by at most one other module. The connections must not be
+ *       changed while the graph is started.
+ *
+ * @param graph  [in/out]  Pointer to the graph.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_start(struct audio_module_graph *graph);
+
+/**
+ * @brief Stop all the modules of a graph.
+ *
+ * @param graph  [in/out]  Pointer to the graph.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_stop(struct audio_module_graph *graph);
+
+/**
+ * @brief Run one frame through all the modules of a graph in the calling context.
+ *
+ * @note This can be called from any thread or work item, but not concurrently for the same
+ *       graph. Output of externally connected modules is read with audio_module_data_rx().
+ *
+ * @param graph          [in/out]  Pointer to the graph.
+ * @param audio_data_in  [in]      Pointer to the audio data for the modules not fed by another
+ *                                 module, can be NULL if those are all input modules.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_process(struct audio_module_graph *graph,
+			       struct audio_data const *const audio_data_in);
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
+
 #ifdef __cplusplus
 }
 #endif
@@ -36,6 +36,8 @@ struct data_fifo {
 	char *slab_buffer;
 	struct k_mem_slab mem_slab;
 	struct k_msgq msgq;
+	/* Keeps the msgq and slab reads of this FIFO in sync */
+	struct k_spinlock lock;
 	uint32_t elements_max;
 	size_t block_size_max;
 	bool initialized;
@@ -182,6 +184,122 @@ int data_fifo_init(struct data_fifo *data_fifo);
  */
 bool data_fifo_state(struct data_fifo *data_fifo);
 
+/**
+ * @brief Single-producer single-consumer data FIFO.
+ *
+ * The blocks are used in order as a ring, indexed by a free-running head written only by the
+ * producer and a tail written only by the consumer. The head and tail are kept in separate
+ * cache lines and no lock is taken, so one producer (for example an ISR) and one consumer can
+ * use the FIFO concurrently. Blocks are written and read in place and must be released in the
+ * order they were committed.
+ */
+struct data_fifo_spsc {
+	char *slab_buffer;
+	size_t *size_buffer;
+	uint32_t elements_max;
+	size_t block_size_max;
+	bool initialized;
+
+	/* Number of blocks committed, written by the producer only */
+	atomic_t head __aligned(CONFIG_DATA_FIFO_SPSC_ALIGN);
+
+	/* Number of blocks released, written by the consumer only */
+	atomic_t tail __aligned(CONFIG_DATA_FIFO_SPSC_ALIGN);
+	/* Set by the consumer while it waits for a block to be committed */
+	atomic_t consumer_waiting;
+	struct k_sem filled;
+};
+
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	BUILD_ASSERT(IS_POWER_OF_TWO(elements_max_in),                                             \
+		     "Number of SPSC data FIFO elements must be a power of two");                  \
+	char __aligned(WB_UP(1))                                                                   \
+		_spsc_slab_buffer_##name[(elements_max_in) * (block_size_max_in)] = {0};           \
+	size_t _spsc_size_buffer_##name[elements_max_in] = {0};                                   \
+	struct data_fifo_spsc name = {.slab_buffer = _spsc_slab_buffer_##name,                     \
+				      .size_buffer = _spsc_size_buffer_##name,                     \
+				      .block_size_max = block_size_max_in,                         \
+				      .elements_max = elements_max_in,                             \
+				      .initialized = false}
+
+/**
+ * @brief Reserve the next vacant block of an SPSC data FIFO for writing.
+ *
+ * Only the producer may call this. Reserving again before committing returns the same block.
+ *
+ * @param data_fifo Pointer to the data_fifo_spsc structure.
+ * @param data Double pointer to the block. If this function returns with
+ *	success, the caller is now able to write up to the block size max
+ *	given to DATA_FIFO_SPSC_DEFINE to this memory block.
+ *
+ * @retval 0		Block reserved.
+ * @retval -ENOMEM	All blocks are in use.
+ */
+int data_fifo_spsc_reserve(struct data_fifo_spsc *data_fifo, void **data);
+
+/**
+ * @brief Commit the block last reserved, making it available to the consumer.
+ *
+ * Only the producer may call this.
+ *
+ * @param data_fifo Pointer to the data_fifo_spsc structure.
+ * @param size Number of bytes written. Must be equal to or smaller
+ *		than the block size max.
+ *
+ * @retval 0		Block committed.
+ * @retval -ENOMEM	The size parameter is larger than the block size max,
+ *			or no block has been reserved.
+ * @retval -EINVAL	The supplied size is zero.
+ */
+int data_fifo_spsc_commit(struct data_fifo_spsc *data_fifo, size_t size);
+
+/**
+ * @brief Get the oldest committed block of an SPSC data FIFO for reading.
+ *
+ * Only the consumer may call this. The block stays in the FIFO until released with
+ * data_fifo_spsc_release.
+ *
+ * @param data_fifo Pointer to the data_fifo_spsc structure.
+ * @param data Double pointer to the block. If this functions returns with
+ *	success, the caller is now able to read from this memory block.
+ * @param size Actual size in bytes of the stored data.
+ * @param timeout Waiting period for a block to be committed. Use K_NO_WAIT to
+ *	return without waiting, or K_FOREVER to wait as long as necessary.
+ *	Must be K_NO_WAIT when called from an ISR.
+ *
+ * @retval 0		Block retrieved.
+ * @retval -EAGAIN	No block was committed before the timeout.
+ */
+int data_fifo_spsc_peek(struct data_fifo_spsc *data_fifo, void **data, size_t *size,
+			k_timeout_t timeout);
+
+/**
+ * @brief Release the oldest committed block after reading, making it vacant.
+ *
+ * Only the consumer may call this.
+ *
+ * @param data_fifo Pointer to the data_fifo_spsc structure.
+ */
+void data_fifo_spsc_release(struct data_fifo_spsc *data_fifo);
+
+/**
+ * @brief See how many blocks are committed and not yet released.
+ *
+ * @param data_fifo Pointer to the data_fifo_spsc structure.
+ *
+ * @return Number of used blocks.
+ */
+uint32_t data_fifo_spsc_num_used_get(struct data_fifo_spsc *data_fifo);
+
+/**
+ * @brief Initialize, or empty, an SPSC data FIFO.
+ *
+ * @note Neither the producer nor the consumer may use the FIFO during this call.
+ *
+ * @param data_fifo Pointer to the data_fifo_spsc structure.
+ */
+void data_fifo_spsc_init(struct data_fifo_spsc *data_fifo);
+
 /**
  * @}
  */
@@ -14,6 +14,7 @@
 #ifndef EMDS_H__
 #define EMDS_H__
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <sys/types.h>
 #include <zephyr/sys/util.h>
@@ -29,12 +30,18 @@ extern "C" {
  * Information about entries used to store data in the emergency data storage.
  */
 struct emds_entry {
-	/** Unique ID for each static and dynamic entry. */
+	/** Unique ID for each static and dynamic entry. The ID 0xFFFF is reserved. */
 	uint16_t id;
 	/** Pointer to data that will be stored. */
 	uint8_t *data;
 	/** Length of data that will be stored. */
 	size_t len;
+#if defined(CONFIG_EMDS_INCREMENTAL) || defined(__DOXYGEN__)
+	/** Pointer to the flag telling if data changed since the last snapshot, or NULL
+	 *  if data is stored in every snapshot. Used only with incremental snapshots.
+	 */
+	bool *dirty;
+#endif
 };
 
 /**
@@ -66,6 +73,36 @@ struct emds_dynamic_entry {
 		.len = _len,                                                   \
 	}
 
+/**
+ * @brief Define a static entry with tracking of data changes.
+ *
+ * Works like @ref EMDS_STATIC_ENTRY_DEFINE, but with incremental snapshots
+ * (@kconfig{CONFIG_EMDS_INCREMENTAL}) the entry is stored only in a full
+ * snapshot or if it was marked using @ref emds_entry_dirty_set since the last
+ * snapshot. Without incremental snapshots, the macro is equal to
+ * @ref EMDS_STATIC_ENTRY_DEFINE.
+ *
+ * @param _name The entry name.
+ * @param _id Unique ID for the entry.
+ * @param _data Data pointer to be stored at emergency data store.
+ * @param _len Length of data to be stored at emergency data store.
+ *
+ * This creates a variable _name prepended by emds_.
+ */
+#if defined(CONFIG_EMDS_INCREMENTAL)
+#define EMDS_STATIC_TRACKED_ENTRY_DEFINE(_name, _id, _data, _len)              \
+	static bool emds_##_name##_dirty = true;                               \
+	static const STRUCT_SECTION_ITERABLE(emds_entry, emds_##_name) = {     \
+		.id = _id,                                                     \
+		.data = (uint8_t *)_data,                                      \
+		.len = _len,                                                   \
+		.dirty = &emds_##_name##_dirty,                                \
+	}
+#else
+#define EMDS_STATIC_TRACKED_ENTRY_DEFINE(_name, _id, _data, _len)              \
+	EMDS_STATIC_ENTRY_DEFINE(_name, _id, _data, _len)
+#endif
+
 /**
  * @typedef emds_store_cb_t
  * @brief Callback for application commands when storing has been executed.
@@ -110,6 +147,31 @@ int emds_init(emds_store_cb_t cb);
  */
 int emds_entry_add(struct emds_dynamic_entry *entry);
 
+/**
+ * @brief Mark data of an entry as changed since the last snapshot.
+ *
+ * With incremental snapshots (@kconfig{CONFIG_EMDS_INCREMENTAL}), an entry
+ * with a dirty flag is stored only in a full snapshot or if this function was
+ * called for it since the last snapshot. The application must call the
+ * function every time data of such entry is changed. The function does
+ * nothing for entries without a dirty flag or if incremental snapshots are
+ * disabled.
+ *
+ * The function can be called from any context.
+ *
+ * @param entry Entry whose data has changed.
+ */
+static inline void emds_entry_dirty_set(const struct emds_entry *entry)
+{
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	if (entry->dirty) {
+		*entry->dirty = true;
+	}
+#else
+	ARG_UNUSED(entry);
+#endif
+}
+
 /**
  * @brief Start the emergency data storage process.
  *
@@ -186,6 +248,11 @@ int emds_prepare(void);
  * registered in the entries. This value is dependent on the chip used, and
  * should be checked against the chip datasheet.
  *
+ * With incremental snapshots (@kconfig{CONFIG_EMDS_INCREMENTAL}), if EMDS is
+ * ready to store an incremental snapshot, the estimate covers only the
+ * entries that would be stored at the moment of the call. Otherwise, the
+ * estimate covers all the entries, which is the worst case.
+ *
  * @param store_time_us Pointer to a variable where the estimated time (in microseconds)
  *                      will be stored.
  *
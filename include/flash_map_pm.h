@@ -28,6 +28,7 @@
 #define slot5_partition mcuboot_secondary_2
 #define image_scratch mcuboot_scratch
 #define image_scratch mcuboot_scratch
+#define sb_fingerprint_partition sb_fingerprint
 
 #if (CONFIG_SETTINGS_FCB || CONFIG_SETTINGS_NVS || defined(PM_SETTINGS_STORAGE_ID) ||\
 	CONFIG_SETTINGS_ZMS || CONFIG_SETTINGS_ZMS_LEGACY)
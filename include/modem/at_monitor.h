@@ -46,6 +46,10 @@ struct at_monitor_entry {
 		uint8_t paused : 1; /* Monitor is paused. */
 		uint8_t direct : 1; /* Dispatch in ISR. */
 	} flags;
+	/* Length of the command prefix in the filter, zero if matched by substring. */
+	uint8_t key_len;
+	/* Next monitor in the same dispatch list. */
+	struct at_monitor_entry *next;
 };
 
 /** Wildcard. Match any notifications. */
@@ -60,7 +64,10 @@ struct at_monitor_entry {
  *
  * @param name The monitor name.
  * @param _filter The filter for AT notification the monitor should receive,
- *		  or @c ANY to receive all notifications.
+ *		  or @c ANY to receive all notifications. A filter that starts with
+ *		  a command prefix, such as "+CEREG", only matches notifications that
+ *		  start with the same command prefix. Other filters match notifications
+ *		  that contain them.
  * @param _handler The monitor callback.
  * @param ... Optional monitor initial state (@c PAUSED or @c ACTIVE).
  *	      The default initial state of a monitor is active.
@@ -79,7 +86,10 @@ struct at_monitor_entry {
  *
  * @param name The monitor name.
  * @param _filter The filter for AT notification the monitor should receive,
- *		  or @c ANY to receive all notifications.
+ *		  or @c ANY to receive all notifications. A filter that starts with
+ *		  a command prefix, such as "+CEREG", only matches notifications that
+ *		  start with the same command prefix. Other filters match notifications
+ *		  that contain them.
  * @param _handler The monitor callback.
  * @param ... Optional monitor initial state (@c PAUSED or @c ACTIVE).
  *	      The default initial state of a monitor is active.
@@ -117,6 +127,27 @@ static inline void at_monitor_resume(struct at_monitor_entry *mon)
 	mon->flags.paused = false;
 }
 
+/**
+ * @brief Hold a notification received in the system workqueue thread.
+ *
+ * Keeps the notification passed to an @ref AT_MONITOR handler valid after the handler
+ * returns, so that it can be processed later without copying it.
+ * Notifications received by @ref AT_MONITOR_ISR handlers cannot be held.
+ *
+ * @param notif The AT notification, as passed to the monitor callback.
+ */
+void at_monitor_notif_hold(const char *notif);
+
+/**
+ * @brief Release a notification previously held with @ref at_monitor_notif_hold.
+ *
+ * The notification must not be accessed after it has been released.
+ * This function can be called from an ISR.
+ *
+ * @param notif The AT notification.
+ */
+void at_monitor_notif_release(const char *notif);
+
 /** @} */
 
 #ifdef __cplusplus
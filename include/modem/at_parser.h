@@ -36,6 +36,51 @@ enum at_parser_cmd_type {
 	AT_PARSER_CMD_TYPE_TEST
 };
 
+/** @brief Identifies the type of a value in an AT parser token index. */
+enum at_parser_token_type {
+	/** AT command prefix or notification. */
+	AT_PARSER_TOKEN_TYPE_CMD,
+	/** Integer value. */
+	AT_PARSER_TOKEN_TYPE_INT,
+	/** Quoted or non-quoted string value. */
+	AT_PARSER_TOKEN_TYPE_STRING,
+	/** Array value. */
+	AT_PARSER_TOKEN_TYPE_ARRAY,
+	/** Empty value. */
+	AT_PARSER_TOKEN_TYPE_EMPTY,
+};
+
+/**
+ * @brief Entry of an AT parser token index.
+ *
+ * Locates one value in the indexed AT command line.
+ */
+struct at_parser_token {
+	/* Offset of the value from the start of the indexed AT command line. */
+	uint16_t offset;
+	/* Length of the value. */
+	uint16_t len;
+	/* Type of the value, see @ref at_parser_token_type. */
+	uint8_t type;
+};
+
+/**
+ * @brief AT parser token index
+ *
+ * Holds the location of every value of one AT command line, so that values can be read in any
+ * order without parsing the line again.
+ */
+struct at_parser_index {
+	/* Pointer to the indexed AT command line. */
+	const char *at;
+	/* Caller supplied token storage. */
+	struct at_parser_token *tokens;
+	/* Number of entries in @p tokens. */
+	size_t tokens_max;
+	/* Number of values in the indexed AT command line. */
+	size_t count;
+};
+
 /**
  * @brief AT parser
  *
@@ -347,6 +392,157 @@ int at_parser_string_get(struct at_parser *parser, size_t index, char *str, size
 int at_parser_string_ptr_get(struct at_parser *parser, size_t index, const char **str_ptr,
 			     size_t *len);
 
+/**
+ * @brief Type-generic macro for getting an integer value from an AT parser token index.
+ *
+ * @param[in]  index AT parser token index.
+ * @param[in]  i     Value index in the indexed AT command line.
+ * @param[out] value Value.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL     One or more of the supplied parameters are invalid.
+ * @retval -EOPNOTSUPP Operation not supported for the type of value at the given index.
+ * @retval -ENODATA    The value at the given index is empty.
+ * @retval -ERANGE     Parsed integer value is out of range for the expected type.
+ * @retval -EIO        @p i is greater than the maximum index of the indexed AT command line.
+ */
+#define at_parser_index_num_get(index, i, value)         \
+	_Generic((value),                                 \
+		int16_t * : at_parser_index_int16_get,    \
+		uint16_t * : at_parser_index_uint16_get,  \
+		int32_t * : at_parser_index_int32_get,    \
+		uint32_t * : at_parser_index_uint32_get,  \
+		int64_t * : at_parser_index_int64_get,    \
+		uint64_t * : at_parser_index_uint64_get   \
+	)(index, i, value)
+
+/**
+ * @brief Tokenize the current AT command line of an AT parser into a token index.
+ *
+ * The line is parsed once, after which every value can be read in constant time with the
+ * @c at_parser_index_ functions, in any order and any number of times.
+ * The index refers to the AT command string configured in @p parser, which must stay valid for
+ * as long as the index is used.
+ * The parser can be moved to its next line with @ref at_parser_cmd_next afterwards.
+ *
+ * @param[in]  parser     A pointer to the AT parser.
+ * @param[out] index      A pointer to the token index to build.
+ * @param[in]  tokens     Token storage for the index.
+ * @param[in]  tokens_max Number of entries in @p tokens.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL  One or more of the supplied parameters are invalid.
+ * @retval -EPERM   @p parser has not been initialized.
+ * @retval -ENOMEM  The line has more values than @p tokens_max, or is too long to be indexed.
+ * @retval -EBADMSG The AT command string is malformed.
+ */
+int at_parser_index_build(struct at_parser *parser, struct at_parser_index *index,
+			  struct at_parser_token *tokens, size_t tokens_max);
+
+/**
+ * @brief Get the type of a value in an AT parser token index.
+ *
+ * @param[in]  index AT parser token index.
+ * @param[in]  i     Value index in the indexed AT command line.
+ * @param[out] type  Type of the value.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL One or more of the supplied parameters are invalid.
+ * @retval -EIO    @p i is greater than the maximum index of the indexed AT command line.
+ */
+int at_parser_index_type_get(const struct at_parser_index *index, size_t i,
+			     enum at_parser_token_type *type);
+
+/**
+ * @brief Get a signed 16-bit integer value from an AT parser token index.
+ *
+ * See @ref at_parser_index_num_get for the parameters and return values.
+ */
+int at_parser_index_int16_get(const struct at_parser_index *index, size_t i, int16_t *value);
+
+/**
+ * @brief Get an unsigned 16-bit integer value from an AT parser token index.
+ *
+ * See @ref at_parser_index_num_get for the parameters and return values.
+ */
+int at_parser_index_uint16_get(const struct at_parser_index *index, size_t i, uint16_t *value);
+
+/**
+ * @brief Get a signed 32-bit integer value from an AT parser token index.
+ *
+ * See @ref at_parser_index_num_get for the parameters and return values.
+ */
+int at_parser_index_int32_get(const struct at_parser_index *index, size_t i, int32_t *value);
+
+/**
+ * @brief Get an unsigned 32-bit integer value from an AT parser token index.
+ *
+ * See @ref at_parser_index_num_get for the parameters and return values.
+ */
+int at_parser_index_uint32_get(const struct at_parser_index *index, size_t i, uint32_t *value);
+
+/**
+ * @brief Get a signed 64-bit integer value from an AT parser token index.
+ *
+ * See @ref at_parser_index_num_get for the parameters and return values.
+ */
+int at_parser_index_int64_get(const struct at_parser_index *index, size_t i, int64_t *value);
+
+/**
+ * @brief Get an unsigned 64-bit integer value from an AT parser token index.
+ *
+ * See @ref at_parser_index_num_get for the parameters and return values.
+ */
+int at_parser_index_uint64_get(const struct at_parser_index *index, size_t i, uint64_t *value);
+
+/**
+ * @brief Get a string value from an AT parser token index.
+ *
+ * The data type must be a string (quoted or non-quoted), an AT command prefix, or an array,
+ * otherwise an error is returned.
+ * The string value is copied to the buffer and null-terminated.
+ * @p len must be at least string length plus one, or an error is returned.
+ *
+ * @param[in]     index AT parser token index.
+ * @param[in]     i     Value index in the indexed AT command line.
+ * @param[in]     str   Pointer to the buffer where to copy the value.
+ * @param[in,out] len   Available space in @p str, returns the length of the copied string.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL     One or more of the supplied parameters are invalid.
+ * @retval -EOPNOTSUPP Operation not supported for the type of value at the given index.
+ * @retval -ENODATA    The value at the given index is empty.
+ * @retval -ENOMEM     @p str is smaller than the null-terminated string to be copied.
+ * @retval -EIO        @p i is greater than the maximum index of the indexed AT command line.
+ */
+int at_parser_index_string_get(const struct at_parser_index *index, size_t i, char *str,
+			       size_t *len);
+
+/**
+ * @brief Get a pointer to a string value from an AT parser token index.
+ *
+ * The data type must be a string (quoted or non-quoted), an AT command prefix, or an array,
+ * otherwise an error is returned.
+ *
+ * @param[in]  index   AT parser token index.
+ * @param[in]  i       Value index in the indexed AT command line.
+ * @param[out] str_ptr Pointer to the address of the string.
+ * @param[out] len     Length of the string.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL     One or more of the supplied parameters are invalid.
+ * @retval -EOPNOTSUPP Operation not supported for the type of value at the given index.
+ * @retval -ENODATA    The value at the given index is empty.
+ * @retval -EIO        @p i is greater than the maximum index of the indexed AT command line.
+ */
+int at_parser_index_string_ptr_get(const struct at_parser_index *index, size_t i,
+				   const char **str_ptr, size_t *len);
+
 /** @} */
 
 #ifdef __cplusplus
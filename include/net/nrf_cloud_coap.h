@@ -352,6 +352,109 @@ int nrf_cloud_coap_message_send(const char *app_id, const char *message, bool js
  */
 int nrf_cloud_coap_json_message_send(const char *message, bool bulk, bool confirmable);
 
+/**
+ * @brief Queue a preencoded JSON message to be sent to nRF Cloud in a batch.
+ *
+ *  Queued messages are collected into a JSON array, which is sent to the bulk topic
+ *  with a single CoAP request when it does not fit more messages, or when
+ *  @ref nrf_cloud_coap_queue_flush is called. The function returns without waiting for
+ *  the response to the batch, but it waits if the previous batch is still being sent.
+ *  Requires CONFIG_NRF_CLOUD_COAP_BATCH.
+ *
+ * @param[in]     message    The JSON message object to queue.
+ *
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @retval -E2BIG The message does not fit in a batch buffer.
+ * @return 0 If successful, otherwise a negative error code.
+ */
+int nrf_cloud_coap_json_message_queue(const char *message);
+
+/**
+ * @brief Queue a sensor value to be sent to nRF Cloud in a batch.
+ *
+ *  The value is encoded as the JSON message sent by @ref nrf_cloud_coap_sensor_send and queued
+ *  using @ref nrf_cloud_coap_json_message_queue.
+ *  Requires CONFIG_NRF_CLOUD_COAP_BATCH.
+ *
+ * @param[in]     app_id The app ID identifying the type of data. See the values
+ *                       that begin with NRF_CLOUD_JSON_APPID_ in nrf_cloud_defs.h. You may
+ *                       also use custom names.
+ * @param[in]     value  Sensor reading.
+ * @param[in]     ts_ms  Timestamp the data was measured, or NRF_CLOUD_NO_TIMESTAMP.
+ *
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @retval -E2BIG The message does not fit in a batch buffer.
+ * @return 0 If successful, otherwise a negative error code.
+ */
+int nrf_cloud_coap_sensor_queue(const char *app_id, double value, int64_t ts_ms);
+
+/**
+ * @brief Send the queued messages to nRF Cloud.
+ *
+ *  Sends the messages queued with @ref nrf_cloud_coap_json_message_queue and waits until
+ *  all batches are sent.
+ *  Requires CONFIG_NRF_CLOUD_COAP_BATCH.
+ *
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @return 0 If successful, nonzero if sending a batch failed since the last flush.
+ *           Negative values are device-side errors defined in errno.h.
+ *           Positive values are cloud-side errors (CoAP result codes)
+ *           defined in zephyr/net/coap.h.
+ */
+int nrf_cloud_coap_queue_flush(void);
+
+/**
+ * @brief Start a CoAP POST request without waiting for the response.
+ *
+ *  Several requests can be in progress at the same time, up to
+ *  CONFIG_COAP_CLIENT_MAX_REQUESTS. Responses are matched to the requests by their token.
+ *  If all requests are in progress, the function waits until one of them completes.
+ *  Requires CONFIG_NRF_CLOUD_COAP_ASYNC.
+ *
+ *  The transfer is complete when the callback is called with the last_block flag set,
+ *  an error result code, or a negative result code, which happens exactly once for each
+ *  request. A NON request that did not get a response within a few seconds is completed
+ *  with the -ETIMEDOUT result code. Requests cancelled by disconnecting or pausing the
+ *  connection are completed with the -ECANCELED result code.
+ *
+ *  Responses are passed to the callback from the CoAP client thread. The -ETIMEDOUT and
+ *  -ECANCELED completions are passed from the thread that detects them, which is the one
+ *  calling this function, @ref nrf_cloud_coap_async_wait, or the function that disconnects
+ *  or pauses the connection.
+ *
+ * @param[in]     resource String containing the specific CoAP endpoint to access.
+ * @param[in]     query    Optional string containing REST-style query parameters.
+ * @param[in]     buf      Optional pointer to buffer containing a payload to include with
+ *                         the request. The buffer must remain valid until the transfer is
+ *                         complete.
+ * @param[in]     len      Length of payload or 0 if none.
+ * @param[in]     fmt      CoAP content format for the Content-Format message option of the
+ *                         payload.
+ * @param[in]     reliable True to use a Confirmable message, otherwise, a Non-confirmable
+ *                         message.
+ * @param[in]     cb       Optional pointer to a callback function to receive the results.
+ * @param[in]     user     Pointer to user-specific data to be passed back to the callback.
+ *
+ * @return 0 If the request was sent, otherwise a negative error code.
+ */
+int nrf_cloud_coap_post_async(const char *resource, const char *query,
+			      const uint8_t *buf, size_t len,
+			      enum coap_content_format fmt, bool reliable,
+			      coap_client_response_cb_t cb, void *user);
+
+/**
+ * @brief Wait until all requests started with @ref nrf_cloud_coap_post_async are complete.
+ *
+ *  NON requests that did not get a response in time are completed while waiting.
+ *  Requires CONFIG_NRF_CLOUD_COAP_ASYNC.
+ *
+ * @param[in]     timeout Maximum time to wait.
+ *
+ * @retval 0 All requests are complete.
+ * @retval -EAGAIN Requests are still in progress after the timeout.
+ */
+int nrf_cloud_coap_async_wait(k_timeout_t timeout);
+
 /**
  * @brief Send the device location in the @ref nrf_cloud_gnss_data PVT field to nRF Cloud.
  *
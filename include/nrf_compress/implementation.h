@@ -141,6 +141,9 @@ enum nrf_compress_types {
 	/** ARM thumb filter */
 	NRF_COMPRESS_TYPE_ARM_THUMB,
 
+	/** LZ4 sequences, see scripts/nrf_compress/lz4_compress.py */
+	NRF_COMPRESS_TYPE_LZ4,
+
 	/** Marks end/count of nRF supported filters */
 	NRF_COMPRESS_TYPE_COUNT,
 
@@ -310,6 +310,19 @@ static inline void nrf_profiler_log_send(struct log_event_buf *buf,
 				     uint16_t event_type_id) {}
 #endif
 
+/** @brief Get the number of dropped events.
+ *
+ * If the event buffer is enabled, events that do not fit in the buffer are dropped
+ * instead of stopping the system.
+ *
+ * @return Number of events dropped since the Profiler was initialized.
+ */
+#ifdef CONFIG_NRF_PROFILER
+uint32_t nrf_profiler_dropped_events_get(void);
+#else
+static inline uint32_t nrf_profiler_dropped_events_get(void) {return 0; }
+#endif
+
 
 /**
  * @}
@@ -44,6 +44,29 @@ extern "C" {
  */
 extern void nrf_rpc_uart_initialized_hook(const struct device *uart_dev);
 
+/**
+ * @brief Notifies that nRF RPC UART transport dropped a packet.
+ *
+ * This function is called by the nRF RPC UART transport implementation when
+ * CONFIG_NRF_RPC_UART_TX_WINDOW is greater than one and a packet is not acknowledged after
+ * CONFIG_NRF_RPC_UART_TX_ATTEMPTS transmission attempts. In this mode, the send function
+ * returns before the packet is acknowledged, so the drop is reported through this function
+ * and not to the caller that passed the packet. All packets waiting for acknowledgment at
+ * that moment are dropped, and this function is called for each of them.
+ *
+ * The function is called with the transport TX lock held, from either the thread that sends
+ * a packet or the system work queue, so it must not send nRF RPC packets nor block.
+ *
+ * @note The nRF RPC transport implementation provides an empty, weak definition of this
+ *       function, which the application can override if needed.
+ *
+ * @param uart_dev The UART device of the transport that dropped the packet.
+ * @param packet   The dropped nRF RPC packet. It is freed when this function returns.
+ * @param len      Length of the dropped packet.
+ */
+extern void nrf_rpc_uart_tx_dropped_hook(const struct device *uart_dev, const uint8_t *packet,
+					 size_t len);
+
 /**
  * @}
  */
@@ -53,6 +76,10 @@ extern void nrf_rpc_uart_initialized_hook(const struct device *uart_dev);
 
 DT_FOREACH_STATUS_OKAY(nordic_nrf_uarte, _NRF_RPC_UART_TRANSPORT_DECLARE);
 
+#if CONFIG_UART_EMUL
+DT_FOREACH_STATUS_OKAY(zephyr_uart_emul, _NRF_RPC_UART_TRANSPORT_DECLARE);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
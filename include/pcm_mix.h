@@ -29,10 +29,43 @@ enum pcm_mix_mode {
 	B_MONO_INTO_A_STEREO_R,
 };
 
+/** @brief Maximum number of interleaved channels supported by pcm_mix_ext(). */
+#define PCM_MIX_CHANNELS_MAX (32)
+
+/** @brief Unity gain in the Q15 format used by struct pcm_mix_cfg. */
+#define PCM_MIX_GAIN_UNITY (0x8000)
+
+/**
+ * @brief Configuration of a generic mix operation.
+ */
+struct pcm_mix_cfg {
+	/** Bit depth of the PCM samples (16, 24 or 32). 24-bit samples are packed in 3 bytes. */
+	uint8_t pcm_bit_depth;
+
+	/** Number of interleaved channels in buffer A. */
+	uint8_t num_ch_a;
+
+	/**
+	 * Number of interleaved channels in buffer B. Must be either 1, in which case the
+	 * mono signal is mixed into every channel selected by @p ch_mask, or equal to
+	 * @p num_ch_a.
+	 */
+	uint8_t num_ch_b;
+
+	/** Bitmask of the channels in buffer A to mix into. Bit n selects channel n. */
+	uint32_t ch_mask;
+
+	/** Gain applied to buffer A in unsigned Q15 format, @ref PCM_MIX_GAIN_UNITY is 1.0. */
+	uint16_t gain_a;
+
+	/** Gain applied to buffer B in unsigned Q15 format, @ref PCM_MIX_GAIN_UNITY is 1.0. */
+	uint16_t gain_b;
+};
+
 /**
  * @brief Mixes two buffers of PCM data.
  *
- * @note Uses simple addition with hard clip protection.
+ * @note Uses saturating addition.
  * Input can be mono or stereo as long as the inputs match.
  * By selecting the mix mode, mono can also be mixed into a stereo buffer.
  * Hard coded for the signed 16-bit PCM.
@@ -52,6 +85,26 @@ enum pcm_mix_mode {
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode);
 
+/**
+ * @brief Mixes two buffers of interleaved PCM data with saturation.
+ *
+ * @note The number of frames mixed is given by @p size_b. Samples that overflow are
+ * saturated to the range of the bit depth. When both gains are unity, 16-bit mixing uses
+ * packed two-lane saturating additions (DSP instructions when available).
+ *
+ * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
+ * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
+ * @param pcm_b         [in]     Pointer to the PCM data buffer B.
+ * @param size_b        [in]     Size of the PCM data buffer B (in bytes).
+ * @param cfg           [in]     Mixing configuration.
+ *
+ * @retval 0            Success. Result stored in pcm_a.
+ * @retval -EINVAL      pcm_a or cfg is NULL, size_a = 0, or the configuration is invalid.
+ * @retval -EPERM       Buffer A is too small to hold the frames in buffer B.
+ */
+int pcm_mix_ext(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		const struct pcm_mix_cfg *cfg);
+
 /**
  * @}
  */
@@ -125,6 +125,47 @@ struct sample_rate_converter_ctx {
 #endif
 };
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/** Number of past input samples per channel kept by the polyphase converter */
+#define SAMPLE_RATE_CONVERTER_POLY_HISTORY_SIZE                                                    \
+	(CONFIG_SAMPLE_RATE_CONVERTER_POLY_TAPS_PER_PHASE - 1)
+
+/** Context for the polyphase sample rate conversion */
+struct sample_rate_converter_poly_ctx {
+	/* Input and output sample rate to be used for the conversion. */
+	uint32_t sample_rate_input;
+	uint32_t sample_rate_output;
+
+	/* Number of interleaved channels in the stream. */
+	uint8_t num_channels;
+
+	/* Interpolation (L) and decimation (M) factors of the reduced conversion ratio L/M. */
+	uint16_t interpolation;
+	uint16_t decimation;
+
+	/* Filter phase and index, relative to the start of the next input block, of the newest
+	 * input sample used for the next output sample.
+	 */
+	uint16_t phase;
+	uint32_t next_index;
+
+	/* Q15 filter coefficients ordered by phase. Within a phase, the first coefficient is
+	 * applied to the newest input sample.
+	 */
+	int16_t coeffs[CONFIG_SAMPLE_RATE_CONVERTER_POLY_PHASES_MAX *
+		       CONFIG_SAMPLE_RATE_CONVERTER_POLY_TAPS_PER_PHASE];
+
+	/* The last input samples of each channel from the previous process call, oldest first. */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	int16_t history_16[CONFIG_SAMPLE_RATE_CONVERTER_POLY_CHANNELS_MAX]
+			  [SAMPLE_RATE_CONVERTER_POLY_HISTORY_SIZE];
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	int32_t history_32[CONFIG_SAMPLE_RATE_CONVERTER_POLY_CHANNELS_MAX]
+			  [SAMPLE_RATE_CONVERTER_POLY_HISTORY_SIZE];
+#endif
+};
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 /**
  * @brief	Open the sample rate converter for a new context.
  *
@@ -172,6 +213,63 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  size_t output_size, size_t *output_written,
 				  uint32_t output_sample_rate);
 
+/**
+ * @brief	Initialize a polyphase sample rate conversion context.
+ *
+ * @details	Reduces the conversion ratio and designs the polyphase filter for it. The filter
+ *		is only redesigned if the reduced ratio differs from the one the context was last
+ *		initialized with, so switching between streams with the same ratio is cheap. The
+ *		stream history is always cleared. The context must be zeroed, for example by
+ *		declaring it static, before it is initialized for the first time.
+ *
+ * @param[out]	ctx			Pointer to the polyphase conversion context.
+ * @param[in]	sample_rate_input	Sample rate of the input samples.
+ * @param[in]	sample_rate_output	Sample rate of the output samples.
+ * @param[in]	num_channels		Number of interleaved channels.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters, or the interpolation factor of the reduced
+ *			ratio exceeds CONFIG_SAMPLE_RATE_CONVERTER_POLY_PHASES_MAX.
+ */
+int sample_rate_converter_poly_init(struct sample_rate_converter_poly_ctx *ctx,
+				    uint32_t sample_rate_input, uint32_t sample_rate_output,
+				    uint8_t num_channels);
+
+/**
+ * @brief	Get the number of bytes the next process call will produce.
+ *
+ * @param[in]	ctx		Pointer to the polyphase conversion context.
+ * @param[in]	input_size	Size of the input in bytes.
+ *
+ * @return	Number of output bytes, or 0 if the context is not initialized.
+ */
+size_t sample_rate_converter_poly_output_size_get(struct sample_rate_converter_poly_ctx const *ctx,
+						  size_t input_size);
+
+/**
+ * @brief	Convert a block of interleaved samples with the polyphase converter.
+ *
+ * @details	Samples are read directly from @p input and the result is written directly to
+ *		@p output without any intermediate copies. Any number of frames can be given per
+ *		call; the number of output frames follows the fractional conversion ratio and
+ *		may vary by one between calls.
+ *
+ * @param[in,out]	ctx		Pointer to the polyphase conversion context.
+ * @param[in]		input		Pointer to interleaved samples to process.
+ * @param[in]		input_size	Size of the input in bytes.
+ * @param[out]		output		Array that interleaved output will be written
+ *					to. Must not overlap @p input.
+ * @param[in]		output_size	Size of the output array in bytes.
+ * @param[out]		output_written	Number of bytes written to output.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters, or the output array is too small.
+ */
+int sample_rate_converter_poly_process(struct sample_rate_converter_poly_ctx *ctx,
+				       void const *const input, size_t input_size,
+				       void *const output, size_t output_size,
+				       size_t *output_written);
+
 /**
  * @}
  */
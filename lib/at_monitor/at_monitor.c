@@ -15,8 +15,16 @@
 
 LOG_MODULE_REGISTER(at_monitor, CONFIG_AT_MONITOR_LOG_LEVEL);
 
+#define BUCKETS CONFIG_AT_MONITOR_DISPATCH_BUCKETS
+
+BUILD_ASSERT(IS_POWER_OF_TWO(BUCKETS), "Number of dispatch buckets must be a power of two");
+
 struct at_notif_fifo {
 	void *fifo_reserved;
+	atomic_t ref;
+	/* Dispatch bucket and command prefix length, resolved in the ISR. */
+	uint8_t bucket;
+	uint8_t key_len;
 	char data[]; /* Null-terminated AT notification string */
 };
 
@@ -26,6 +34,12 @@ static K_FIFO_DEFINE(at_monitor_fifo);
 static K_HEAP_DEFINE(at_monitor_heap, CONFIG_AT_MONITOR_HEAP_SIZE);
 static K_WORK_DEFINE(at_monitor_work, at_monitor_task);
 
+/* Monitors hashed on the command prefix of their filter, in section order. */
+static struct at_monitor_entry *bucket_list[BUCKETS];
+/* Monitors matching any notification or matched by substring, in section order. */
+static struct at_monitor_entry *generic_list;
+static bool table_ready;
+
 static bool is_paused(const struct at_monitor_entry *mon)
 {
 	return mon->flags.paused;
@@ -36,9 +50,110 @@ static bool is_direct(const struct at_monitor_entry *mon)
 	return mon->flags.direct;
 }
 
-static bool has_match(const struct at_monitor_entry *mon, const char *notif)
+/* Length of the command prefix of a string, such as "+CEREG" in "+CEREG: 1",
+ * or zero if the string does not start with a command prefix.
+ */
+static size_t key_len_get(const char *str)
+{
+	size_t len;
+
+	if (str[0] != '+' && str[0] != '%') {
+		return 0;
+	}
+
+	for (len = 1; str[len] != '\0'; len++) {
+		if (str[len] == ':' || str[len] == ' ' || str[len] == '\r' || str[len] == '\n') {
+			break;
+		}
+	}
+
+	return len;
+}
+
+static uint8_t key_hash(const char *key, size_t len)
+{
+	/* FNV-1a */
+	uint32_t hash = 2166136261u;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ (uint8_t)key[i]) * 16777619u;
+	}
+
+	return hash & (BUCKETS - 1);
+}
+
+static bool has_match(const struct at_monitor_entry *mon, const char *notif, size_t key_len)
+{
+	if (mon->filter == ANY) {
+		return true;
+	}
+
+	if (mon->key_len == 0) {
+		return strstr(notif, mon->filter);
+	}
+
+	/* Same command prefix, and the rest of the filter if any */
+	return mon->key_len == key_len && strncmp(notif, mon->filter, strlen(mon->filter)) == 0;
+}
+
+static void list_append(struct at_monitor_entry **list, struct at_monitor_entry *mon)
+{
+	while (*list) {
+		list = &(*list)->next;
+	}
+
+	*list = mon;
+}
+
+static void table_build(void)
+{
+	size_t key_len;
+
+	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
+		e->next = NULL;
+		key_len = (e->filter == ANY) ? 0 : key_len_get(e->filter);
+
+		if (key_len == 0 || key_len > UINT8_MAX) {
+			e->key_len = 0;
+			list_append(&generic_list, e);
+		} else {
+			e->key_len = key_len;
+			list_append(&bucket_list[key_hash(e->filter, key_len)], e);
+		}
+	}
+
+	table_ready = true;
+}
+
+/* Return the next monitor in section order out of the two lists being walked. */
+static struct at_monitor_entry *next_candidate(struct at_monitor_entry **a,
+					       struct at_monitor_entry **b)
 {
-	return (mon->filter == ANY || strstr(notif, mon->filter));
+	struct at_monitor_entry **first;
+	struct at_monitor_entry *mon;
+
+	if (*a == NULL && *b == NULL) {
+		return NULL;
+	} else if (*a == NULL) {
+		first = b;
+	} else if (*b == NULL) {
+		first = a;
+	} else {
+		/* Section order is address order */
+		first = (*a < *b) ? a : b;
+	}
+
+	mon = *first;
+	*first = mon->next;
+
+	return mon;
+}
+
+static void at_notif_unref(struct at_notif_fifo *at_notif)
+{
+	if (atomic_dec(&at_notif->ref) == 1) {
+		k_heap_free(&at_monitor_heap, at_notif);
+	}
 }
 
 /* Dispatch AT notifications immediately, or schedules a workqueue task to do that.
@@ -49,13 +164,24 @@ void at_monitor_dispatch(const char *notif)
 {
 	bool monitored;
 	struct at_notif_fifo *at_notif;
+	struct at_monitor_entry *keyed;
+	struct at_monitor_entry *generic;
 	size_t sz_needed;
+	size_t key_len;
+	uint8_t bucket;
 
 	__ASSERT_NO_MSG(notif != NULL);
+	__ASSERT(table_ready, "Notification dispatched before initialization");
+
+	key_len = MIN(key_len_get(notif), UINT8_MAX);
+	bucket = key_hash(notif, key_len);
+	keyed = (key_len > 0) ? bucket_list[bucket] : NULL;
+	generic = generic_list;
 
 	monitored = false;
-	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-		if (!is_paused(e) && has_match(e, notif)) {
+	for (struct at_monitor_entry *e = next_candidate(&keyed, &generic); e;
+	     e = next_candidate(&keyed, &generic)) {
+		if (!is_paused(e) && has_match(e, notif, key_len)) {
 			if (is_direct(e)) {
 				LOG_DBG("Dispatching to %p (ISR)", e->handler);
 				e->handler(notif);
@@ -81,6 +207,9 @@ void at_monitor_dispatch(const char *notif)
 	}
 
 	strcpy(at_notif->data, notif);
+	atomic_set(&at_notif->ref, 1);
+	at_notif->bucket = bucket;
+	at_notif->key_len = key_len;
 
 	k_fifo_put(&at_monitor_fifo, at_notif);
 	k_work_submit(&at_monitor_work);
@@ -89,24 +218,52 @@ void at_monitor_dispatch(const char *notif)
 static void at_monitor_task(struct k_work *work)
 {
 	struct at_notif_fifo *at_notif;
+	struct at_monitor_entry *keyed;
+	struct at_monitor_entry *generic;
 
 	while ((at_notif = k_fifo_get(&at_monitor_fifo, K_NO_WAIT))) {
-		/* Match notification with all monitors */
+		/* Match notification with the monitors found by the ISR lookup */
 		LOG_DBG("AT notif: %.*s", strlen(at_notif->data) - strlen("\r\n"), at_notif->data);
-		STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-			if (!is_paused(e) && !is_direct(e) && has_match(e, at_notif->data)) {
+		keyed = (at_notif->key_len > 0) ? bucket_list[at_notif->bucket] : NULL;
+		generic = generic_list;
+
+		for (struct at_monitor_entry *e = next_candidate(&keyed, &generic); e;
+		     e = next_candidate(&keyed, &generic)) {
+			if (!is_paused(e) && !is_direct(e) &&
+			    has_match(e, at_notif->data, at_notif->key_len)) {
 				LOG_DBG("Dispatching to %p", e->handler);
 				e->handler(at_notif->data);
 			}
 		}
-		k_heap_free(&at_monitor_heap, at_notif);
+
+		/* Freed here unless a monitor holds it */
+		at_notif_unref(at_notif);
 	}
 }
 
+void at_monitor_notif_hold(const char *notif)
+{
+	struct at_notif_fifo *at_notif = CONTAINER_OF(notif, struct at_notif_fifo, data);
+
+	__ASSERT_NO_MSG(notif != NULL);
+	__ASSERT(!k_is_in_isr(), "Notifications received in ISR cannot be held");
+
+	atomic_inc(&at_notif->ref);
+}
+
+void at_monitor_notif_release(const char *notif)
+{
+	__ASSERT_NO_MSG(notif != NULL);
+
+	at_notif_unref(CONTAINER_OF(notif, struct at_notif_fifo, data));
+}
+
 static int at_monitor_sys_init(void)
 {
 	int err;
 
+	table_build();
+
 	err = nrf_modem_at_notif_handler_set(at_monitor_dispatch);
 	if (err) {
 		LOG_ERR("Failed to hook the dispatch function, err %d", err);
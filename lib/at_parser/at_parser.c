@@ -350,46 +350,19 @@ int at_parser_cmd_count_get(struct at_parser *parser, size_t *count)
 	return (err == -EIO || err == -EAGAIN) ? 0 : err;
 }
 
-static int at_parser_num_get_impl(struct at_parser *parser, size_t index, void *value,
-				  enum at_num_type type)
+/* Convert the integer value starting at @p start to the requested type. */
+static int at_num_convert(const char *start, void *value, enum at_num_type type)
 {
-	int err;
-	struct at_token token = {0};
-
-	if (!value) {
-		return -EINVAL;
-	}
-
-	err = at_parser_check(parser);
-	if (err) {
-		return err;
-	}
-
-	err = at_parser_seek(parser, index, &token);
-	if (err) {
-		return err;
-	}
-
-	switch (token.type) {
-	/* Acceptable types. */
-	case AT_TOKEN_TYPE_INT:
-		break;
-	case AT_TOKEN_TYPE_EMPTY:
-		return -ENODATA;
-	default:
-		return -EOPNOTSUPP;
-	}
-
 	/* Must be set to 0 before calling `strtoull` or `strtoll`. */
 	errno = 0;
 
 	/* Check unsigned 64-bit integer first, using its own parsing function. */
 	if (type == AT_NUM_TYPE_UINT64) {
-		if (token.start[0] == MINUS_SIGN) {
+		if (start[0] == MINUS_SIGN) {
 			return -ERANGE;
 		}
 
-		uint64_t val = strtoull(token.start, NULL, 10);
+		uint64_t val = strtoull(start, NULL, 10);
 
 		if (errno == ERANGE) {
 			return -ERANGE;
@@ -400,7 +373,7 @@ static int at_parser_num_get_impl(struct at_parser *parser, size_t index, void *
 		return 0;
 	}
 
-	int64_t val = strtoll(token.start, NULL, 10);
+	int64_t val = strtoll(start, NULL, 10);
 
 	switch (type) {
 	case AT_NUM_TYPE_INT16:
@@ -439,6 +412,64 @@ static int at_parser_num_get_impl(struct at_parser *parser, size_t index, void *
 	return 0;
 }
 
+/* Copy a string value and null-terminate it, or return a pointer to it. */
+static int at_str_copy(const char *start, size_t token_len, void *ptr, size_t *len,
+		       bool is_ptr_get)
+{
+	if (is_ptr_get) {
+		*((const char **)ptr) = start;
+		*len = token_len;
+	} else {
+		/* Check if there is enough memory. */
+		if (*len < token_len + 1) {
+			return -ENOMEM;
+		}
+
+		memcpy((char *)ptr, start, token_len);
+
+		/* Null-terminate the string. */
+		((char *)ptr)[token_len] = '\0';
+
+		/* Update the length to reflect the copied string length. */
+		*len = token_len;
+	}
+
+	return 0;
+}
+
+static int at_parser_num_get_impl(struct at_parser *parser, size_t index, void *value,
+				  enum at_num_type type)
+{
+	int err;
+	struct at_token token = {0};
+
+	if (!value) {
+		return -EINVAL;
+	}
+
+	err = at_parser_check(parser);
+	if (err) {
+		return err;
+	}
+
+	err = at_parser_seek(parser, index, &token);
+	if (err) {
+		return err;
+	}
+
+	switch (token.type) {
+	/* Acceptable types. */
+	case AT_TOKEN_TYPE_INT:
+		break;
+	case AT_TOKEN_TYPE_EMPTY:
+		return -ENODATA;
+	default:
+		return -EOPNOTSUPP;
+	}
+
+	return at_num_convert(token.start, value, type);
+}
+
 int at_parser_int16_get(struct at_parser *parser, size_t index, int16_t *value)
 {
 	return at_parser_num_get_impl(parser, index, value, AT_NUM_TYPE_INT16);
@@ -505,34 +536,216 @@ static int at_parser_string_common_get_impl(struct at_parser *parser, size_t ind
 		return -EOPNOTSUPP;
 	}
 
-	if (is_ptr_get) {
-		*((const char **)ptr) = token.start;
-		*len = token.len;
-	} else {
-		/* Check if there is enough memory. */
-		if (*len < token.len + 1) {
+	return at_str_copy(token.start, token.len, ptr, len, is_ptr_get);
+}
+
+int at_parser_string_get(struct at_parser *parser, size_t index, char *str, size_t *len)
+{
+	return at_parser_string_common_get_impl(parser, index, (void *)str, len, false);
+}
+
+int at_parser_string_ptr_get(struct at_parser *parser, size_t index, const char **str_ptr,
+			     size_t *len)
+{
+	return at_parser_string_common_get_impl(parser, index, (void *)str_ptr, len, true);
+}
+
+static enum at_parser_token_type at_token_index_type(const struct at_token *token)
+{
+	switch (token->type) {
+	case AT_TOKEN_TYPE_INT:
+		return AT_PARSER_TOKEN_TYPE_INT;
+	case AT_TOKEN_TYPE_QUOTED_STRING:
+	case AT_TOKEN_TYPE_STRING:
+		return AT_PARSER_TOKEN_TYPE_STRING;
+	case AT_TOKEN_TYPE_ARRAY:
+		return AT_PARSER_TOKEN_TYPE_ARRAY;
+	case AT_TOKEN_TYPE_EMPTY:
+		return AT_PARSER_TOKEN_TYPE_EMPTY;
+	default:
+		return AT_PARSER_TOKEN_TYPE_CMD;
+	}
+}
+
+int at_parser_index_build(struct at_parser *parser, struct at_parser_index *index,
+			  struct at_parser_token *tokens, size_t tokens_max)
+{
+	int err;
+	size_t offset;
+	struct at_token token = {0};
+
+	if (!index || !tokens || tokens_max == 0) {
+		return -EINVAL;
+	}
+
+	err = at_parser_check(parser);
+	if (err) {
+		return err;
+	}
+
+	/* Rewind parser to the start of the current line. */
+	parser->cursor = parser->at;
+	parser->count = 0;
+	parser->is_next_empty = false;
+
+	index->at = parser->at;
+	index->tokens = tokens;
+	index->tokens_max = tokens_max;
+	index->count = 0;
+
+	while (true) {
+		err = at_parser_tok(parser, &token);
+		if (err) {
+			break;
+		}
+
+		offset = token.start - index->at;
+
+		if (index->count == tokens_max || offset > UINT16_MAX || token.len > UINT16_MAX) {
 			return -ENOMEM;
 		}
 
-		memcpy((char *)ptr, token.start, token.len);
+		tokens[index->count].offset = offset;
+		tokens[index->count].len = token.len;
+		tokens[index->count].type = at_token_index_type(&token);
+		index->count++;
+	}
 
-		/* Null-terminate the string. */
-		((char *)ptr)[token.len] = '\0';
+	return (err == -EIO || err == -EAGAIN) ? 0 : err;
+}
 
-		/* Update the length to reflect the copied string length. */
-		*len = token.len;
+static int at_parser_index_token_get(const struct at_parser_index *index, size_t i,
+				     const struct at_parser_token **token)
+{
+	if (!index || !index->at || !index->tokens) {
+		return -EINVAL;
+	}
+
+	if (i >= index->count) {
+		return -EIO;
 	}
 
+	*token = &index->tokens[i];
+
 	return 0;
 }
 
-int at_parser_string_get(struct at_parser *parser, size_t index, char *str, size_t *len)
+int at_parser_index_type_get(const struct at_parser_index *index, size_t i,
+			     enum at_parser_token_type *type)
 {
-	return at_parser_string_common_get_impl(parser, index, (void *)str, len, false);
+	int err;
+	const struct at_parser_token *token;
+
+	if (!type) {
+		return -EINVAL;
+	}
+
+	err = at_parser_index_token_get(index, i, &token);
+	if (err) {
+		return err;
+	}
+
+	*type = token->type;
+
+	return 0;
 }
 
-int at_parser_string_ptr_get(struct at_parser *parser, size_t index, const char **str_ptr,
-			     size_t *len)
+static int at_parser_index_num_get_impl(const struct at_parser_index *index, size_t i,
+					void *value, enum at_num_type type)
 {
-	return at_parser_string_common_get_impl(parser, index, (void *)str_ptr, len, true);
+	int err;
+	const struct at_parser_token *token;
+
+	if (!value) {
+		return -EINVAL;
+	}
+
+	err = at_parser_index_token_get(index, i, &token);
+	if (err) {
+		return err;
+	}
+
+	switch (token->type) {
+	/* Acceptable types. */
+	case AT_PARSER_TOKEN_TYPE_INT:
+		break;
+	case AT_PARSER_TOKEN_TYPE_EMPTY:
+		return -ENODATA;
+	default:
+		return -EOPNOTSUPP;
+	}
+
+	return at_num_convert(index->at + token->offset, value, type);
+}
+
+int at_parser_index_int16_get(const struct at_parser_index *index, size_t i, int16_t *value)
+{
+	return at_parser_index_num_get_impl(index, i, value, AT_NUM_TYPE_INT16);
+}
+
+int at_parser_index_uint16_get(const struct at_parser_index *index, size_t i, uint16_t *value)
+{
+	return at_parser_index_num_get_impl(index, i, value, AT_NUM_TYPE_UINT16);
+}
+
+int at_parser_index_int32_get(const struct at_parser_index *index, size_t i, int32_t *value)
+{
+	return at_parser_index_num_get_impl(index, i, value, AT_NUM_TYPE_INT32);
+}
+
+int at_parser_index_uint32_get(const struct at_parser_index *index, size_t i, uint32_t *value)
+{
+	return at_parser_index_num_get_impl(index, i, value, AT_NUM_TYPE_UINT32);
+}
+
+int at_parser_index_int64_get(const struct at_parser_index *index, size_t i, int64_t *value)
+{
+	return at_parser_index_num_get_impl(index, i, value, AT_NUM_TYPE_INT64);
+}
+
+int at_parser_index_uint64_get(const struct at_parser_index *index, size_t i, uint64_t *value)
+{
+	return at_parser_index_num_get_impl(index, i, value, AT_NUM_TYPE_UINT64);
+}
+
+static int at_parser_index_string_common_get_impl(const struct at_parser_index *index, size_t i,
+						  void *ptr, size_t *len, bool is_ptr_get)
+{
+	int err;
+	const struct at_parser_token *token;
+
+	if (!ptr || !len) {
+		return -EINVAL;
+	}
+
+	err = at_parser_index_token_get(index, i, &token);
+	if (err) {
+		return err;
+	}
+
+	switch (token->type) {
+	/* Acceptable types. */
+	case AT_PARSER_TOKEN_TYPE_CMD:
+	case AT_PARSER_TOKEN_TYPE_STRING:
+	case AT_PARSER_TOKEN_TYPE_ARRAY:
+		break;
+	case AT_PARSER_TOKEN_TYPE_EMPTY:
+		return -ENODATA;
+	default:
+		return -EOPNOTSUPP;
+	}
+
+	return at_str_copy(index->at + token->offset, token->len, ptr, len, is_ptr_get);
+}
+
+int at_parser_index_string_get(const struct at_parser_index *index, size_t i, char *str,
+			       size_t *len)
+{
+	return at_parser_index_string_common_get_impl(index, i, (void *)str, len, false);
+}
+
+int at_parser_index_string_ptr_get(const struct at_parser_index *index, size_t i,
+				   const char **str_ptr, size_t *len)
+{
+	return at_parser_index_string_common_get_impl(index, i, (void *)str_ptr, len, true);
 }
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <data_fifo.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(data_fifo, CONFIG_DATA_FIFO_LOG_LEVEL);
+
+/* The head and tail run freely, elements_max is a power of two so they can be masked */
+static inline uint32_t spsc_index(struct data_fifo_spsc const *data_fifo, uint32_t count)
+{
+	return count & (data_fifo->elements_max - 1);
+}
+
+static inline void *spsc_block(struct data_fifo_spsc const *data_fifo, uint32_t count)
+{
+	return &data_fifo->slab_buffer[spsc_index(data_fifo, count) * data_fifo->block_size_max];
+}
+
+int data_fifo_spsc_reserve(struct data_fifo_spsc *data_fifo, void **data)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+	__ASSERT_NO_MSG(data_fifo->initialized);
+
+	uint32_t head = (uint32_t)atomic_get(&data_fifo->head);
+
+	if (head - (uint32_t)atomic_get(&data_fifo->tail) >= data_fifo->elements_max) {
+		return -ENOMEM;
+	}
+
+	*data = spsc_block(data_fifo, head);
+
+	return 0;
+}
+
+int data_fifo_spsc_commit(struct data_fifo_spsc *data_fifo, size_t size)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+	__ASSERT_NO_MSG(data_fifo->initialized);
+
+	uint32_t head = (uint32_t)atomic_get(&data_fifo->head);
+
+	if (size > data_fifo->block_size_max) {
+		LOG_ERR("Size %zu too big, max: %zu", size, data_fifo->block_size_max);
+		return -ENOMEM;
+	} else if (size == 0) {
+		LOG_ERR("Size is zero");
+		return -EINVAL;
+	}
+
+	if (head - (uint32_t)atomic_get(&data_fifo->tail) >= data_fifo->elements_max) {
+		LOG_ERR("No block reserved");
+		return -ENOMEM;
+	}
+
+	data_fifo->size_buffer[spsc_index(data_fifo, head)] = size;
+
+	/* Publish the block, the store to head orders the block and size writes before it */
+	atomic_set(&data_fifo->head, (atomic_val_t)(head + 1));
+
+	/* Only wake the consumer if it is waiting, so the fast path takes no lock */
+	if (atomic_cas(&data_fifo->consumer_waiting, 1, 0)) {
+		k_sem_give(&data_fifo->filled);
+	}
+
+	return 0;
+}
+
+int data_fifo_spsc_peek(struct data_fifo_spsc *data_fifo, void **data, size_t *size,
+			k_timeout_t timeout)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+	__ASSERT_NO_MSG(data_fifo->initialized);
+	int ret;
+
+	uint32_t tail = (uint32_t)atomic_get(&data_fifo->tail);
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	while ((uint32_t)atomic_get(&data_fifo->head) == tail) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -EAGAIN;
+		}
+
+		/* Announce the wait before checking again, so a commit in between either is
+		 * seen here or sees the flag and wakes us.
+		 */
+		atomic_set(&data_fifo->consumer_waiting, 1);
+
+		if ((uint32_t)atomic_get(&data_fifo->head) != tail) {
+			atomic_set(&data_fifo->consumer_waiting, 0);
+			break;
+		}
+
+		ret = k_sem_take(&data_fifo->filled, sys_timepoint_timeout(end));
+		if (ret) {
+			atomic_set(&data_fifo->consumer_waiting, 0);
+			return -EAGAIN;
+		}
+	}
+
+	*data = spsc_block(data_fifo, tail);
+	*size = data_fifo->size_buffer[spsc_index(data_fifo, tail)];
+
+	return 0;
+}
+
+void data_fifo_spsc_release(struct data_fifo_spsc *data_fifo)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+	__ASSERT_NO_MSG(data_fifo->initialized);
+
+	uint32_t tail = (uint32_t)atomic_get(&data_fifo->tail);
+
+	__ASSERT((uint32_t)atomic_get(&data_fifo->head) != tail, "No block to release");
+
+	atomic_set(&data_fifo->tail, (atomic_val_t)(tail + 1));
+}
+
+uint32_t data_fifo_spsc_num_used_get(struct data_fifo_spsc *data_fifo)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+
+	return (uint32_t)atomic_get(&data_fifo->head) - (uint32_t)atomic_get(&data_fifo->tail);
+}
+
+void data_fifo_spsc_init(struct data_fifo_spsc *data_fifo)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+	__ASSERT_NO_MSG(IS_POWER_OF_TWO(data_fifo->elements_max));
+	__ASSERT_NO_MSG(data_fifo->block_size_max != 0);
+	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
+
+	atomic_set(&data_fifo->head, 0);
+	atomic_set(&data_fifo->tail, 0);
+	atomic_set(&data_fifo->consumer_waiting, 0);
+	k_sem_init(&data_fifo->filled, 0, 1);
+
+	data_fifo->initialized = true;
+}
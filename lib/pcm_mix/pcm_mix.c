@@ -6,90 +6,281 @@
 
 #include <pcm_mix.h>
 
+#include <string.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#if defined(CONFIG_PCM_MIX_DSP)
+#include <cmsis_core.h>
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
 
+#define INT24_MAX (0x7FFFFF)
+#define INT24_MIN (-0x800000)
+
 /* Clip signal if amplitude is outside legal range */
-static void hard_limiter(int32_t *const pcm)
+static inline int16_t sat16(int32_t pcm)
+{
+#if defined(CONFIG_PCM_MIX_DSP)
+	return (int16_t)__SSAT(pcm, 16);
+#else
+	return (int16_t)CLAMP(pcm, INT16_MIN, INT16_MAX);
+#endif
+}
+
+static inline int32_t sat24(int64_t pcm)
+{
+	return (int32_t)CLAMP(pcm, INT24_MIN, INT24_MAX);
+}
+
+static inline int32_t sat32(int64_t pcm)
+{
+	return (int32_t)CLAMP(pcm, INT32_MIN, INT32_MAX);
+}
+
+/* Saturating addition of two pairs of signed 16-bit values packed in 32-bit words */
+static inline uint32_t qadd16(uint32_t a, uint32_t b)
+{
+#if defined(CONFIG_PCM_MIX_DSP)
+	return __QADD16(a, b);
+#else
+	/* Add the lower 15 bits of each lane, then fix up the sign bits so no carry
+	 * propagates from the lower lane into the upper one.
+	 */
+	uint32_t sum = ((a & 0x7FFF7FFF) + (b & 0x7FFF7FFF)) ^ ((a ^ b) & 0x80008000);
+	/* A lane overflows when both operands have the same sign and the result does not */
+	uint32_t ovf = ~(a ^ b) & (a ^ sum) & 0x80008000;
+	uint32_t ovf_mask = (ovf >> 15) * 0xFFFF;
+	/* 0x7FFF for lanes where a is positive, 0x8000 where a is negative */
+	uint32_t sat = 0x7FFF7FFF + ((a >> 15) & 0x00010001);
+
+	return (sum & ~ovf_mask) | (sat & ovf_mask);
+#endif
+}
+
+static inline uint32_t load32(void const *const p)
+{
+	uint32_t val;
+
+	memcpy(&val, p, sizeof(val));
+
+	return val;
+}
+
+static inline void store32(void *const p, uint32_t val)
+{
+	memcpy(p, &val, sizeof(val));
+}
+
+/* Mix buffers of equal layout, two samples at a time */
+static void pcm_mix_s16_identical(int16_t *pcm_a, int16_t const *pcm_b, size_t num_samples)
 {
-	if (*pcm < INT16_MIN) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MIN;
-	} else if (*pcm > INT16_MAX) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MAX;
+	size_t i;
+
+	for (i = 0; i + 1 < num_samples; i += 2) {
+		store32(&pcm_a[i], qadd16(load32(&pcm_a[i]), load32(&pcm_b[i])));
+	}
+
+	if (i < num_samples) {
+		pcm_a[i] = sat16((int32_t)pcm_a[i] + pcm_b[i]);
+	}
+}
+
+/* Convert a left/right channel mask to a mask over the packed 16-bit lanes of a stereo frame */
+static inline uint32_t stereo_lane_mask_get(uint32_t ch_mask)
+{
+	return ((ch_mask & BIT(0)) ? 0x0000FFFF : 0) | ((ch_mask & BIT(1)) ? 0xFFFF0000 : 0);
+}
+
+/* Mix mono into a stereo buffer. lane_mask selects which of the L/R lanes are mixed into */
+static void pcm_mix_s16_mono_into_stereo(int16_t *pcm_a, int16_t const *pcm_b, size_t num_frames,
+					 uint32_t lane_mask)
+{
+	for (size_t i = 0; i < num_frames; i++) {
+		uint32_t b = (uint16_t)pcm_b[i];
+
+		b = (b | (b << 16)) & lane_mask;
+		store32(&pcm_a[i * 2], qadd16(load32(&pcm_a[i * 2]), b));
 	}
 }
 
-/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
-static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
-			      size_t size_b)
+/* Generic layout and gain. The offset into B advances by one frame of either A or B */
+static void pcm_mix_s16_generic(int16_t *pcm_a, int16_t const *pcm_b, size_t num_frames,
+				struct pcm_mix_cfg const *const cfg)
 {
-	int32_t res;
+	uint8_t b_ch_step = (cfg->num_ch_b == 1) ? 0 : 1;
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
+	for (size_t f = 0; f < num_frames; f++) {
+		int16_t *a = &pcm_a[f * cfg->num_ch_a];
+		int16_t const *b = &pcm_b[f * cfg->num_ch_b];
 
-		hard_limiter(&res);
+		for (uint8_t ch = 0; ch < cfg->num_ch_a; ch++) {
+			if (cfg->ch_mask & BIT(ch)) {
+				int64_t res = ((int64_t)a[ch] * cfg->gain_a +
+					       (int64_t)b[ch * b_ch_step] * cfg->gain_b) >> 15;
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+				a[ch] = (int16_t)CLAMP(res, INT16_MIN, INT16_MAX);
+			}
+		}
 	}
 }
 
-/* Mix mono into both channels of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
-					    void const *const pcm_b, size_t size_b)
+static void pcm_mix_s24_generic(uint8_t *pcm_a, uint8_t const *pcm_b, size_t num_frames,
+				struct pcm_mix_cfg const *const cfg)
 {
-	int32_t res;
+	uint8_t b_ch_step = (cfg->num_ch_b == 1) ? 0 : 1;
 
-	/* Use size_b as this is the length of the mono sample.
-	 * This must be *2 to traverse the stereo sample and /2 since
-	 * the sample is two bytes in size.
-	 */
-	for (uint32_t i = 0; i < size_b; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
+	for (size_t f = 0; f < num_frames; f++) {
+		uint8_t *a = &pcm_a[f * cfg->num_ch_a * 3];
+		uint8_t const *b = &pcm_b[f * cfg->num_ch_b * 3];
 
-		hard_limiter(&res);
+		for (uint8_t ch = 0; ch < cfg->num_ch_a; ch++) {
+			if (cfg->ch_mask & BIT(ch)) {
+				/* Sign extend the packed samples */
+				int32_t a_val = (int32_t)(sys_get_le24(&a[ch * 3]) << 8) >> 8;
+				int32_t b_val =
+					(int32_t)(sys_get_le24(&b[ch * b_ch_step * 3]) << 8) >> 8;
+				int64_t res = ((int64_t)a_val * cfg->gain_a +
+					       (int64_t)b_val * cfg->gain_b) >> 15;
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+				sys_put_le24((uint32_t)sat24(res), &a[ch * 3]);
+			}
+		}
 	}
 }
 
-/* Mix mono into left channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_l(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+static void pcm_mix_s32_generic(int32_t *pcm_a, int32_t const *pcm_b, size_t num_frames,
+				struct pcm_mix_cfg const *const cfg)
 {
-	int32_t res;
+	uint8_t b_ch_step = (cfg->num_ch_b == 1) ? 0 : 1;
+	bool unity = (cfg->gain_a == PCM_MIX_GAIN_UNITY) && (cfg->gain_b == PCM_MIX_GAIN_UNITY);
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2] + ((int16_t *)pcm_b)[i];
+	for (size_t f = 0; f < num_frames; f++) {
+		int32_t *a = &pcm_a[f * cfg->num_ch_a];
+		int32_t const *b = &pcm_b[f * cfg->num_ch_b];
 
-		hard_limiter(&res);
+		for (uint8_t ch = 0; ch < cfg->num_ch_a; ch++) {
+			if (!(cfg->ch_mask & BIT(ch))) {
+				continue;
+			}
 
-		((int16_t *)pcm_a)[i * 2] = (int16_t)res;
+			if (unity) {
+#if defined(CONFIG_PCM_MIX_DSP)
+				a[ch] = __QADD(a[ch], b[ch * b_ch_step]);
+#else
+				a[ch] = sat32((int64_t)a[ch] + b[ch * b_ch_step]);
+#endif
+			} else {
+				a[ch] = sat32(((int64_t)a[ch] * cfg->gain_a +
+					       (int64_t)b[ch * b_ch_step] * cfg->gain_b) >> 15);
+			}
+		}
 	}
 }
 
-/* Mix mono into right channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+static int pcm_mix_cfg_validate(size_t size_a, size_t size_b, struct pcm_mix_cfg const *const cfg,
+				size_t *num_frames)
 {
-	int32_t res;
+	uint8_t bytes_per_sample;
+	size_t frame_size_b;
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2 + 1] + ((int16_t *)pcm_b)[i];
+	if (cfg->pcm_bit_depth != 16 && cfg->pcm_bit_depth != 24 && cfg->pcm_bit_depth != 32) {
+		LOG_ERR("Invalid bit depth: %d", cfg->pcm_bit_depth);
+		return -EINVAL;
+	}
 
-		hard_limiter(&res);
+	if (cfg->num_ch_a == 0 || cfg->num_ch_a > PCM_MIX_CHANNELS_MAX) {
+		LOG_ERR("Invalid number of channels in A: %d", cfg->num_ch_a);
+		return -EINVAL;
+	}
 
-		((int16_t *)pcm_a)[i * 2 + 1] = (int16_t)res;
+	if (cfg->num_ch_b != 1 && cfg->num_ch_b != cfg->num_ch_a) {
+		LOG_ERR("Invalid number of channels in B: %d", cfg->num_ch_b);
+		return -EINVAL;
+	}
+
+	if (cfg->ch_mask == 0 ||
+	    (cfg->num_ch_a < PCM_MIX_CHANNELS_MAX && (cfg->ch_mask >> cfg->num_ch_a) != 0)) {
+		LOG_ERR("Invalid channel mask: 0x%x", cfg->ch_mask);
+		return -EINVAL;
 	}
+
+	bytes_per_sample = cfg->pcm_bit_depth / 8;
+	frame_size_b = (size_t)bytes_per_sample * cfg->num_ch_b;
+
+	if (size_b % frame_size_b != 0) {
+		LOG_ERR("Size b: %zu is not a whole number of frames", size_b);
+		return -EINVAL;
+	}
+
+	*num_frames = size_b / frame_size_b;
+
+	if (*num_frames * bytes_per_sample * cfg->num_ch_a > size_a) {
+		return -EPERM;
+	}
+
+	return 0;
+}
+
+int pcm_mix_ext(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		struct pcm_mix_cfg const *const cfg)
+{
+	int ret;
+	size_t num_frames;
+
+	if (pcm_a == NULL || size_a == 0 || cfg == NULL) {
+		return -EINVAL;
+	}
+
+	if (pcm_b == NULL || size_b == 0) {
+		/* Nothing to mix, returning */
+		return 0;
+	}
+
+	ret = pcm_mix_cfg_validate(size_a, size_b, cfg, &num_frames);
+	if (ret) {
+		return ret;
+	}
+
+	switch (cfg->pcm_bit_depth) {
+	case 16: {
+		bool unity = (cfg->gain_a == PCM_MIX_GAIN_UNITY) &&
+			     (cfg->gain_b == PCM_MIX_GAIN_UNITY);
+		uint32_t all_ch = (cfg->num_ch_a == PCM_MIX_CHANNELS_MAX)
+					  ? UINT32_MAX
+					  : (uint32_t)BIT_MASK(cfg->num_ch_a);
+
+		if (unity && cfg->num_ch_a == cfg->num_ch_b && cfg->ch_mask == all_ch) {
+			pcm_mix_s16_identical(pcm_a, pcm_b, num_frames * cfg->num_ch_a);
+		} else if (unity && cfg->num_ch_a == 2 && cfg->num_ch_b == 1) {
+			pcm_mix_s16_mono_into_stereo(pcm_a, pcm_b, num_frames,
+						     stereo_lane_mask_get(cfg->ch_mask));
+		} else {
+			pcm_mix_s16_generic(pcm_a, pcm_b, num_frames, cfg);
+		}
+		break;
+	}
+	case 24:
+		pcm_mix_s24_generic(pcm_a, pcm_b, num_frames, cfg);
+		break;
+	case 32:
+		pcm_mix_s32_generic(pcm_a, pcm_b, num_frames, cfg);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
 }
 
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode)
 {
+	uint32_t ch_mask;
+
 	if (pcm_a == NULL || size_a == 0) {
 		return -EINVAL;
 	}
@@ -106,30 +297,28 @@ int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t si
 		if (size_b > size_a) {
 			return -EPERM;
 		}
-		pcm_mix_identical(pcm_a, size_a, pcm_b, size_b);
-		break;
+		pcm_mix_s16_identical(pcm_a, pcm_b, size_b / sizeof(int16_t));
+		return 0;
 	case B_MONO_INTO_A_STEREO_LR:
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
-		}
-		pcm_mix_b_mono_into_a_stereo_lr(pcm_a, size_a, pcm_b, size_b);
+		ch_mask = BIT(0) | BIT(1);
 		break;
 	case B_MONO_INTO_A_STEREO_L:
-		pcm_mix_b_mono_into_a_stereo_l(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			LOG_ERR("size a %d size b %d", size_a, size_b);
-			return -EPERM;
-		}
+		ch_mask = BIT(0);
 		break;
 	case B_MONO_INTO_A_STEREO_R:
-		pcm_mix_b_mono_into_a_stereo_r(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
-		}
+		ch_mask = BIT(1);
 		break;
 	default:
 		return -ESRCH;
 	};
 
+	if (size_b > (size_a / 2)) {
+		LOG_ERR("size a %d size b %d", size_a, size_b);
+		return -EPERM;
+	}
+
+	pcm_mix_s16_mono_into_stereo(pcm_a, pcm_b, size_b / sizeof(int16_t),
+				     stereo_lane_mask_get(ch_mask));
+
 	return 0;
 }
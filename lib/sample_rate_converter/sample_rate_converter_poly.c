@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sample_rate_converter.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
+
+#define TAPS	     CONFIG_SAMPLE_RATE_CONVERTER_POLY_TAPS_PER_PHASE
+#define HISTORY_SIZE SAMPLE_RATE_CONVERTER_POLY_HISTORY_SIZE
+
+/* Cutoff of the anti-aliasing filter relative to the lower of the two Nyquist frequencies */
+#define CUTOFF_RELATIVE (0.9f)
+
+#define PI_F (3.14159265358979f)
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef int16_t sample_t;
+#define SAMPLE_MIN INT16_MIN
+#define SAMPLE_MAX INT16_MAX
+#define HISTORY(ctx, ch) ((ctx)->history_16[ch])
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef int32_t sample_t;
+#define SAMPLE_MIN INT32_MIN
+#define SAMPLE_MAX INT32_MAX
+#define HISTORY(ctx, ch) ((ctx)->history_32[ch])
+#endif
+
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+	while (b != 0) {
+		uint32_t t = a % b;
+
+		a = b;
+		b = t;
+	}
+
+	return a;
+}
+
+/**
+ * @brief Design a windowed-sinc low-pass prototype and store it split into polyphase branches.
+ *
+ * @details The prototype runs at L times the input rate. Each branch is normalized to unity DC
+ *	    gain, so every output sample has the same gain regardless of its phase.
+ */
+static void poly_filter_design(struct sample_rate_converter_poly_ctx *ctx)
+{
+	uint16_t l = ctx->interpolation;
+	uint32_t len = (uint32_t)l * TAPS;
+	float center = (float)(len - 1) / 2.0f;
+	/* Normalized to the rate of the prototype filter */
+	float cutoff = CUTOFF_RELATIVE * 0.5f / MAX(ctx->interpolation, ctx->decimation);
+
+	for (uint16_t p = 0; p < l; p++) {
+		float branch[TAPS];
+		float sum = 0.0f;
+
+		for (uint16_t j = 0; j < TAPS; j++) {
+			uint32_t i = p + (uint32_t)j * l;
+			float t = (float)i - center;
+			float sinc = (t == 0.0f) ? 1.0f : sinf(2.0f * PI_F * cutoff * t) /
+								  (2.0f * PI_F * cutoff * t);
+			float window = 0.42f - 0.5f * cosf(2.0f * PI_F * i / (len - 1)) +
+				       0.08f * cosf(4.0f * PI_F * i / (len - 1));
+
+			branch[j] = sinc * window;
+			sum += branch[j];
+		}
+
+		for (uint16_t j = 0; j < TAPS; j++) {
+			float coeff = roundf(branch[j] / sum * 32768.0f);
+
+			ctx->coeffs[p * TAPS + j] = (int16_t)CLAMP(coeff, INT16_MIN, INT16_MAX);
+		}
+	}
+}
+
+int sample_rate_converter_poly_init(struct sample_rate_converter_poly_ctx *ctx,
+				    uint32_t sample_rate_input, uint32_t sample_rate_output,
+				    uint8_t num_channels)
+{
+	uint32_t divisor;
+	uint32_t l;
+	uint32_t m;
+
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if (sample_rate_input == 0 || sample_rate_output == 0 ||
+	    sample_rate_input == sample_rate_output) {
+		LOG_ERR("Invalid sample rates: %d -> %d", sample_rate_input, sample_rate_output);
+		return -EINVAL;
+	}
+
+	if (num_channels == 0 || num_channels > CONFIG_SAMPLE_RATE_CONVERTER_POLY_CHANNELS_MAX) {
+		LOG_ERR("Invalid number of channels: %d", num_channels);
+		return -EINVAL;
+	}
+
+	divisor = gcd(sample_rate_input, sample_rate_output);
+	l = sample_rate_output / divisor;
+	m = sample_rate_input / divisor;
+
+	if (l > CONFIG_SAMPLE_RATE_CONVERTER_POLY_PHASES_MAX || m > UINT16_MAX) {
+		LOG_ERR("Conversion ratio %d/%d not supported", l, m);
+		return -EINVAL;
+	}
+
+	if (ctx->interpolation != l || ctx->decimation != m) {
+		ctx->interpolation = l;
+		ctx->decimation = m;
+		poly_filter_design(ctx);
+		LOG_DBG("Polyphase filter designed for ratio %d/%d", l, m);
+	}
+
+	ctx->sample_rate_input = sample_rate_input;
+	ctx->sample_rate_output = sample_rate_output;
+	ctx->num_channels = num_channels;
+	ctx->phase = 0;
+	ctx->next_index = 0;
+
+	for (uint8_t ch = 0; ch < num_channels; ch++) {
+		memset(HISTORY(ctx, ch), 0, sizeof(HISTORY(ctx, ch)));
+	}
+
+	return 0;
+}
+
+static size_t poly_output_frames_get(struct sample_rate_converter_poly_ctx const *ctx,
+				     size_t num_frames_in)
+{
+	uint64_t remaining;
+
+	if (num_frames_in <= ctx->next_index) {
+		return 0;
+	}
+
+	/* Number of k for which next_index + (phase + k * M) / L < num_frames_in */
+	remaining = (uint64_t)(num_frames_in - ctx->next_index) * ctx->interpolation - ctx->phase;
+
+	return DIV_ROUND_UP(remaining, ctx->decimation);
+}
+
+size_t sample_rate_converter_poly_output_size_get(struct sample_rate_converter_poly_ctx const *ctx,
+						  size_t input_size)
+{
+	size_t frame_size;
+
+	if (ctx == NULL || ctx->num_channels == 0) {
+		return 0;
+	}
+
+	frame_size = ctx->num_channels * sizeof(sample_t);
+
+	return poly_output_frames_get(ctx, input_size / frame_size) * frame_size;
+}
+
+static inline sample_t poly_output_saturate(int64_t acc)
+{
+	/* Round and remove the Q15 scaling of the coefficients */
+	acc = (acc + (1 << 14)) >> 15;
+
+	return (sample_t)CLAMP(acc, SAMPLE_MIN, SAMPLE_MAX);
+}
+
+/* Fetch input sample n of a channel, where negative indexes refer to the history */
+static inline sample_t poly_sample_get(sample_t const *input, sample_t const *history,
+				       int32_t n, uint8_t ch, uint8_t num_channels)
+{
+	if (n >= 0) {
+		return input[n * num_channels + ch];
+	}
+
+	return history[HISTORY_SIZE + n];
+}
+
+static void poly_channel_process(struct sample_rate_converter_poly_ctx const *ctx,
+				 sample_t const *input, size_t num_frames_in, sample_t *output,
+				 uint8_t ch)
+{
+	uint8_t num_ch = ctx->num_channels;
+	uint16_t step_int = ctx->decimation / ctx->interpolation;
+	uint16_t step_frac = ctx->decimation % ctx->interpolation;
+	uint32_t n = ctx->next_index;
+	uint16_t phase = ctx->phase;
+	sample_t const *history = HISTORY(ctx, ch);
+
+	while (n < num_frames_in) {
+		int16_t const *h = &ctx->coeffs[phase * TAPS];
+		int64_t acc = 0;
+
+		if (n >= HISTORY_SIZE) {
+			/* All taps inside the caller buffer, walk it backwards by frame */
+			sample_t const *x = &input[n * num_ch + ch];
+
+			for (uint16_t j = 0; j < TAPS; j++) {
+				acc += (int32_t)h[j] * (int64_t)x[-(int32_t)(j * num_ch)];
+			}
+		} else {
+			for (uint16_t j = 0; j < TAPS; j++) {
+				sample_t x = poly_sample_get(input, history, (int32_t)n - j, ch,
+							     num_ch);
+
+				acc += (int32_t)h[j] * (int64_t)x;
+			}
+		}
+
+		*output = poly_output_saturate(acc);
+		output += num_ch;
+
+		n += step_int;
+		phase += step_frac;
+		if (phase >= ctx->interpolation) {
+			phase -= ctx->interpolation;
+			n++;
+		}
+	}
+}
+
+/* Keep the newest input samples of each channel for the next call */
+static void poly_history_update(struct sample_rate_converter_poly_ctx *ctx, sample_t const *input,
+				size_t num_frames_in)
+{
+	uint8_t num_ch = ctx->num_channels;
+
+	for (uint8_t ch = 0; ch < num_ch; ch++) {
+		sample_t *history = HISTORY(ctx, ch);
+		size_t keep = (num_frames_in < HISTORY_SIZE) ? HISTORY_SIZE - num_frames_in : 0;
+
+		memmove(history, &history[HISTORY_SIZE - keep], keep * sizeof(sample_t));
+
+		for (size_t i = keep; i < HISTORY_SIZE; i++) {
+			history[i] = input[(num_frames_in - HISTORY_SIZE + i) * num_ch + ch];
+		}
+	}
+}
+
+int sample_rate_converter_poly_process(struct sample_rate_converter_poly_ctx *ctx,
+				       void const *const input, size_t input_size,
+				       void *const output, size_t output_size,
+				       size_t *output_written)
+{
+	size_t frame_size;
+	size_t num_frames_in;
+	size_t num_frames_out;
+	uint64_t consumed;
+	uint16_t phase;
+
+	if ((ctx == NULL) || (input == NULL) || (output == NULL) || (output_written == NULL)) {
+		LOG_ERR("Null pointer received");
+		return -EINVAL;
+	}
+
+	if (ctx->interpolation == 0) {
+		LOG_ERR("Context not initialized");
+		return -EINVAL;
+	}
+
+	frame_size = ctx->num_channels * sizeof(sample_t);
+
+	if (input_size % frame_size != 0) {
+		LOG_ERR("Size of input is not a multiple of the frame size");
+		return -EINVAL;
+	}
+
+	num_frames_in = input_size / frame_size;
+	num_frames_out = poly_output_frames_get(ctx, num_frames_in);
+
+	if (num_frames_out * frame_size > output_size) {
+		LOG_ERR("Conversion process will produce more bytes than the output buffer can "
+			"hold");
+		return -EINVAL;
+	}
+
+	for (uint8_t ch = 0; ch < ctx->num_channels; ch++) {
+		poly_channel_process(ctx, input, num_frames_in, (sample_t *)output + ch, ch);
+	}
+
+	/* Advance the position by the number of output samples produced */
+	consumed = ctx->phase + (uint64_t)num_frames_out * ctx->decimation;
+	phase = consumed % ctx->interpolation;
+	ctx->next_index = ctx->next_index + consumed / ctx->interpolation - num_frames_in;
+	ctx->phase = phase;
+
+	poly_history_update(ctx, input, num_frames_in);
+
+	*output_written = num_frames_out * frame_size;
+
+	return 0;
+}
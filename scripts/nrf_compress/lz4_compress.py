@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""
+Compress data for the LZ4 implementation of the nRF compression library.
+
+The compressed stream starts with a 4 byte header: the "NL" magic, the format
+version and the base 2 logarithm of the window size. It is followed by LZ4
+sequences, each made of a token, literals and a match. The matches can
+reference any of the preceding window size bytes, across the whole stream.
+The last sequence has no match and the stream ends with it.
+"""
+
+import argparse
+import sys
+from pathlib import Path
+
+MAGIC = b'NL'
+VERSION = 1
+HEADER_SIZE = 4
+
+MIN_MATCH = 4
+MAX_OFFSET = 0xffff
+MIN_WINDOW_SIZE = 256
+MAX_WINDOW_SIZE = 65536
+DEFAULT_WINDOW_SIZE = 16384
+
+# Number of earlier positions checked for the longest match at every position
+DEFAULT_MAX_CHAIN = 32
+
+
+def window_log(window_size: int) -> int:
+    log = window_size.bit_length() - 1
+    if window_size != 1 << log or not MIN_WINDOW_SIZE <= window_size <= MAX_WINDOW_SIZE:
+        raise ValueError(f'Window size must be a power of two between {MIN_WINDOW_SIZE} and '
+                         f'{MAX_WINDOW_SIZE}, got {window_size}')
+    return log
+
+
+def _length(out: bytearray, length: int) -> None:
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def _sequence(out: bytearray, literals: bytes, match_length: int = 0, offset: int = 0) -> None:
+    token = min(len(literals), 15) << 4
+    if match_length:
+        token |= min(match_length - MIN_MATCH, 15)
+    out.append(token)
+    if len(literals) >= 15:
+        _length(out, len(literals) - 15)
+    out += literals
+
+    if match_length:
+        out += offset.to_bytes(2, 'little')
+        if match_length - MIN_MATCH >= 15:
+            _length(out, match_length - MIN_MATCH - 15)
+
+
+def _match_length(data: bytes, candidate: int, pos: int) -> int:
+    # The first MIN_MATCH bytes are known to be equal
+    length = MIN_MATCH
+    end = len(data)
+
+    while pos + length + 8 <= end and \
+            data[candidate + length:candidate + length + 8] == data[pos + length:pos + length + 8]:
+        length += 8
+    while pos + length < end and data[candidate + length] == data[pos + length]:
+        length += 1
+
+    return length
+
+
+def compress(data: bytes, window_size: int = DEFAULT_WINDOW_SIZE,
+             max_chain: int = DEFAULT_MAX_CHAIN) -> bytes:
+    """Compress data with greedy matching over hash chains."""
+    out = bytearray(MAGIC + bytes([VERSION, window_log(window_size)]))
+    max_offset = min(window_size, MAX_OFFSET)
+    head: dict[bytes, int] = {}
+    prev = [-1] * len(data)
+    anchor = 0
+    pos = 0
+
+    def insert(i: int) -> None:
+        key = data[i:i + MIN_MATCH]
+        prev[i] = head.get(key, -1)
+        head[key] = i
+
+    while pos + MIN_MATCH <= len(data):
+        best_length = 0
+        best_offset = 0
+        candidate = head.get(data[pos:pos + MIN_MATCH], -1)
+        chain = max_chain
+
+        while candidate >= 0 and pos - candidate <= max_offset and chain > 0:
+            # A longer match must also match at the current best length
+            if best_length == 0 or (pos + best_length < len(data) and
+                                    data[candidate + best_length] == data[pos + best_length]):
+                length = _match_length(data, candidate, pos)
+                if length > best_length:
+                    best_length = length
+                    best_offset = pos - candidate
+                    if pos + length == len(data):
+                        break
+            candidate = prev[candidate]
+            chain -= 1
+
+        if best_length == 0:
+            insert(pos)
+            pos += 1
+            continue
+
+        _sequence(out, data[anchor:pos], best_length, best_offset)
+        for i in range(pos, min(pos + best_length, len(data) - MIN_MATCH + 1)):
+            insert(i)
+        pos += best_length
+        anchor = pos
+
+    _sequence(out, data[anchor:])
+
+    return bytes(out)
+
+
+def _read_length(data: bytes, pos: int, length: int) -> tuple[int, int]:
+    if length == 15:
+        while True:
+            byte = data[pos]
+            pos += 1
+            length += byte
+            if byte != 255:
+                break
+    return length, pos
+
+
+def decompress(data: bytes) -> bytes:
+    """Decompress a stream created with compress(), used to verify the output."""
+    if len(data) < HEADER_SIZE or data[:2] != MAGIC or data[2] != VERSION:
+        raise ValueError('Invalid header')
+
+    window_size = 1 << data[3]
+    out = bytearray()
+    pos = HEADER_SIZE
+
+    try:
+        while True:
+            token = data[pos]
+            pos += 1
+
+            literals, pos = _read_length(data, pos, token >> 4)
+            if pos + literals > len(data):
+                raise ValueError('Truncated literals')
+            out += data[pos:pos + literals]
+            pos += literals
+
+            if pos == len(data):
+                return bytes(out)
+
+            offset = int.from_bytes(data[pos:pos + 2], 'little')
+            pos += 2
+            if offset == 0 or offset > min(len(out), window_size):
+                raise ValueError(f'Invalid match offset {offset}')
+
+            length, pos = _read_length(data, pos, token & 0x0f)
+            length += MIN_MATCH
+
+            start = len(out) - offset
+            if offset >= length:
+                out += out[start:start + length]
+            else:
+                for i in range(length):
+                    out.append(out[start + i])
+    except IndexError:
+        raise ValueError('Truncated stream') from None
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False)
+
+    parser.add_argument(
+        '--window-size', type=lambda x: int(x, 0), default=DEFAULT_WINDOW_SIZE,
+        help='Maximum match distance in bytes, must not be larger than '
+             'CONFIG_NRF_COMPRESS_LZ4_WINDOW_SIZE of the decompressing image '
+             '(default: %(default)s)'
+    )
+    parser.add_argument(
+        '--max-chain', type=int, default=DEFAULT_MAX_CHAIN,
+        help='Number of earlier positions searched for a match, higher values improve the '
+             'ratio at the cost of compression time (default: %(default)s)'
+    )
+    parser.add_argument(
+        '--decompress', '-d', action='store_true',
+        help='Decompress the input file instead'
+    )
+    parser.add_argument('infile', type=Path, help='Input file')
+    parser.add_argument('outfile', type=Path, help='Output file')
+
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    data = args.infile.read_bytes()
+
+    if args.decompress:
+        output = decompress(data)
+    else:
+        output = compress(data, args.window_size, args.max_chain)
+        if decompress(output) != data:
+            print('Compressed data does not decompress to the input', file=sys.stderr)
+            return 1
+
+    args.outfile.write_bytes(output)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
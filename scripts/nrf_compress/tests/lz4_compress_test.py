@@ -0,0 +1,105 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+import random
+from pathlib import Path
+
+import pytest
+
+import lz4_compress
+
+SAMPLE_IMAGE = Path(__file__).parents[3] / 'tests/subsys/bootloader/bl_crypto/fw_data.bin'
+
+
+def _sequences(data: bytes):
+    """Yield (literal count, offset, match length) of every sequence of a stream."""
+    pos = lz4_compress.HEADER_SIZE
+    while True:
+        token = data[pos]
+        literals, pos = lz4_compress._read_length(data, pos + 1, token >> 4)
+        pos += literals
+        if pos == len(data):
+            yield literals, 0, 0
+            return
+        offset = int.from_bytes(data[pos:pos + 2], 'little')
+        length, pos = lz4_compress._read_length(data, pos + 2, token & 0x0f)
+        yield literals, offset, length + lz4_compress.MIN_MATCH
+
+
+@pytest.mark.parametrize('data', [
+    b'',
+    b'a',
+    b'abc',
+    b'\x00' * 10000,
+    b'abcd' * 1000 + b'tail',
+    bytes(range(256)) * 40,
+    random.Random(1).randbytes(5000),
+], ids=['empty', 'single', 'short', 'zeros', 'repeated', 'sequence', 'random'])
+def test_round_trip(data):
+    compressed = lz4_compress.compress(data)
+
+    assert compressed[:2] == lz4_compress.MAGIC
+    assert compressed[2] == lz4_compress.VERSION
+    assert lz4_compress.decompress(compressed) == data
+
+
+def test_sample_image():
+    data = SAMPLE_IMAGE.read_bytes()
+    compressed = lz4_compress.compress(data)
+
+    assert lz4_compress.decompress(compressed) == data
+    assert len(compressed) < len(data)
+
+
+@pytest.mark.parametrize('window_size', [256, 1024, 65536])
+def test_window_size(window_size):
+    rng = random.Random(window_size)
+    block = rng.randbytes(300)
+    # Repeats at distances below and above the window size
+    data = block + rng.randbytes(window_size) + block + block
+
+    compressed = lz4_compress.compress(data, window_size)
+
+    assert compressed[3] == window_size.bit_length() - 1
+    assert lz4_compress.decompress(compressed) == data
+    for _, offset, _ in _sequences(compressed):
+        assert offset <= window_size
+
+
+@pytest.mark.parametrize('window_size', [0, 128, 1000, 131072])
+def test_invalid_window_size(window_size):
+    with pytest.raises(ValueError):
+        lz4_compress.compress(b'data', window_size)
+
+
+def test_invalid_header():
+    compressed = bytearray(lz4_compress.compress(b'abcd' * 100))
+
+    with pytest.raises(ValueError):
+        lz4_compress.decompress(compressed[:lz4_compress.HEADER_SIZE - 1])
+
+    compressed[2] = lz4_compress.VERSION + 1
+    with pytest.raises(ValueError):
+        lz4_compress.decompress(compressed)
+
+
+def test_truncated_stream():
+    data = random.Random(2).randbytes(1000) * 3
+    compressed = lz4_compress.compress(data)
+
+    for size in (lz4_compress.HEADER_SIZE, len(compressed) // 2, len(compressed) - 1):
+        with pytest.raises(ValueError):
+            lz4_compress.decompress(compressed[:size])
+
+
+def test_invalid_offset():
+    header = lz4_compress.MAGIC + bytes([lz4_compress.VERSION, 14])
+    # One literal, a match two bytes back and an empty last sequence
+    compressed = header + b'\x10a' + (2).to_bytes(2, 'little') + b'\x00'
+
+    with pytest.raises(ValueError):
+        lz4_compress.decompress(compressed)
+    assert lz4_compress.decompress(header + b'\x10a' + (1).to_bytes(2, 'little') +
+                                   b'\x00') == b'a' * 5
@@ -18,10 +18,18 @@ def signal_handler(sig, frame):
     global is_waiting
     is_waiting = False
 
-def rtt2stream(stream, event, event_close, log_lvl_number):
+def rtt2stream(stream, event, event_close, log_lvl_number, args):
     signal.signal(signal.SIGINT, signal.SIG_IGN)
     try:
-        rtt2s = Rtt2Stream(stream, event_close, log_lvl=log_lvl_number)
+        if args.file is not None:
+            from file2stream import File2Stream
+            rtt2s = File2Stream(stream, event_close, args.file, log_lvl=log_lvl_number)
+        elif args.uart is not None:
+            from uart2stream import Uart2Stream
+            rtt2s = Uart2Stream(stream, event_close, args.uart, baudrate=args.baudrate,
+                                log_lvl=log_lvl_number)
+        else:
+            rtt2s = Rtt2Stream(stream, event_close, log_lvl=log_lvl_number)
         event.wait()
         rtt2s.read_and_transmit_data()
     except Exception as e:
@@ -51,6 +59,11 @@ def main():
     parser.add_argument('time', type=int, help='Time of collecting data [s]')
     parser.add_argument('dataset_name', help='Name of dataset')
     parser.add_argument('--log', help='Log level')
+    source = parser.add_mutually_exclusive_group()
+    source.add_argument('--file', metavar='PREFIX',
+                        help='Read data written by the file backend to PREFIX.info and PREFIX.data')
+    source.add_argument('--uart', metavar='PORT', help='Read data from the UART backend')
+    parser.add_argument('--baudrate', type=int, default=115200, help='UART baud rate')
     args = parser.parse_args()
 
     if args.log is not None:
@@ -68,7 +81,8 @@ def main():
 
     processes = []
     processes.append((Process(target=rtt2stream,
-                                args=(streams[0], event, event_close_rtt2stream, log_lvl_number),
+                                args=(streams[0], event, event_close_rtt2stream, log_lvl_number,
+                                      args),
                                 daemon=True),
                         event_close_rtt2stream))
     processes.append((Process(target=model_creator,
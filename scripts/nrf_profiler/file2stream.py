@@ -0,0 +1,110 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+import logging
+import os
+import sys
+import time
+
+from rtt_nordic_config import RttNordicConfig
+from stream import StreamError
+
+
+class File2Stream:
+    """Reads data written by the nrf_profiler file backend (native simulator).
+
+    The backend writes events to <prefix>.data and the system information to <prefix>.info,
+    in the same format as on the RTT channels.
+    """
+
+    def __init__(self, out_stream, event_close, prefix, config=RttNordicConfig,
+                 log_lvl=logging.INFO):
+        self.config = config
+
+        self.out_stream = out_stream
+
+        self.event_close = event_close
+
+        self.info_path = prefix + '.info'
+        self.data_path = prefix + '.data'
+        self.data_file = None
+
+        self.logger = logging.getLogger('file2stream')
+        self.logger_console = logging.StreamHandler()
+        self.logger.setLevel(log_lvl)
+        self.log_format = logging.Formatter('[%(levelname)s] %(name)s: %(message)s')
+        self.logger_console.setFormatter(self.log_format)
+        self.logger.addHandler(self.logger_console)
+
+    def _wait_for_file(self, path):
+        while not os.path.exists(path):
+            if self.event_close.is_set():
+                self.logger.info(f"Module closed before {path} was created.")
+                sys.exit()
+            time.sleep(0.1)
+
+    def _read_all_events_descriptions(self):
+        self._wait_for_file(self.info_path)
+        # Empty field is written after the system configuration
+        while True:
+            if self.event_close.is_set():
+                self.logger.info("Module closed before receiving event descriptions.")
+                sys.exit()
+
+            with open(self.info_path, 'rb') as f:
+                desc_buf = bytearray(f.read())
+
+            if desc_buf[-2:] == bytearray('\n\n', 'utf-8'):
+                return desc_buf
+            time.sleep(0.1)
+
+    def _read_bytes(self):
+        return self.data_file.read(self.config['rtt_read_chunk_size'])
+
+    def _send_remaining_data(self):
+        buf = self._read_bytes()
+        while len(buf) > 0:
+            try:
+                self.out_stream.send_ev(buf)
+            except StreamError as err:
+                self.logger.error(f"Error: {err}. Unable to send remaining data")
+                break
+            buf = self._read_bytes()
+
+    def read_and_transmit_data(self):
+        desc_buf = self._read_all_events_descriptions()
+        try:
+            self.out_stream.send_desc(desc_buf)
+        except StreamError as err:
+            self.logger.error(f"Error: {err}. Unable to send data")
+            sys.exit()
+
+        self._wait_for_file(self.data_path)
+        self.data_file = open(self.data_path, 'rb')
+        self.logger.info(f"Reading events from {self.data_path}")
+
+        while True:
+            if self.event_close.is_set():
+                self.close()
+
+            buf = self._read_bytes()
+
+            if len(buf) > 0:
+                try:
+                    self.out_stream.send_ev(buf)
+                except StreamError as err:
+                    self.logger.error(f"Error: {err}. Unable to send data")
+                    self.data_file.close()
+                    sys.exit()
+
+            if len(buf) < self.config['rtt_additional_read_thresh']:
+                time.sleep(self.config['rtt_read_sleep_time'])
+
+    def close(self):
+        self.logger.info("Real time transmission closed")
+        if self.data_file is not None:
+            self._send_remaining_data()
+            self.data_file.close()
+        sys.exit()
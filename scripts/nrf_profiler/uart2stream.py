@@ -0,0 +1,192 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+import logging
+import sys
+from enum import Enum
+
+import serial
+from rtt_nordic_config import RttNordicConfig
+from stream import StreamError
+
+
+class Command(Enum):
+    START = 1
+    STOP = 2
+    INFO = 3
+
+class Uart2Stream:
+    """Reads data sent by the nrf_profiler UART backend.
+
+    Data and information are multiplexed in frames. Each frame consists of the channel ID
+    (1 byte), the payload, and the CRC-16/CCITT of both (2 bytes, little-endian). Frames are
+    delimited by flag octets, and flag and escape octets inside a frame are escaped as in
+    HDLC. Commands are sent to the device as single bytes.
+    """
+
+    CHANNEL_DATA = 0
+    CHANNEL_INFO = 1
+
+    HDLC_FLAG = 0x7e
+    HDLC_ESCAPE = 0x7d
+    HDLC_XOR = 0x20
+    # Channel ID and checksum
+    FRAME_MIN_LEN = 3
+
+    def __init__(self, out_stream, event_close, port, baudrate=115200, config=RttNordicConfig,
+                 log_lvl=logging.INFO):
+        self.config = config
+
+        self.out_stream = out_stream
+
+        self.event_close = event_close
+
+        self.logger = logging.getLogger('uart2stream')
+        self.logger_console = logging.StreamHandler()
+        self.logger.setLevel(log_lvl)
+        self.log_format = logging.Formatter('[%(levelname)s] %(name)s: %(message)s')
+        self.logger_console.setFormatter(self.log_format)
+        self.logger.addHandler(self.logger_console)
+
+        self.rx_buf = bytearray()
+        # Data received before the first flag may be a part of a frame
+        self.rx_synced = False
+        self.channels = {
+            self.CHANNEL_DATA: bytearray(),
+            self.CHANNEL_INFO: bytearray(),
+        }
+
+        try:
+            self.serial = serial.Serial(port, baudrate, timeout=self.config['rtt_read_sleep_time'])
+        except serial.SerialException as err:
+            self.logger.error(f"Cannot open {port}: {err}")
+            sys.exit()
+
+        self.logger.info(f"Connected to device via {port}")
+
+    def _receive(self):
+        try:
+            self.rx_buf.extend(self.serial.read(self.config['rtt_read_chunk_size']))
+        except serial.SerialException:
+            self.logger.error("Problem with reading UART data")
+            self.serial.close()
+            sys.exit()
+
+        # Demultiplex complete frames
+        while True:
+            end = self.rx_buf.find(self.HDLC_FLAG)
+            if end < 0:
+                break
+
+            frame = self._unescape(self.rx_buf[:end])
+            del self.rx_buf[:end + 1]
+
+            if not self.rx_synced:
+                self.rx_synced = True
+            elif len(frame) > 0:
+                self._frame_process(frame)
+
+    @classmethod
+    def _unescape(cls, data):
+        frame = bytearray()
+        escaped = False
+        for byte in data:
+            if escaped:
+                frame.append(byte ^ cls.HDLC_XOR)
+                escaped = False
+            elif byte == cls.HDLC_ESCAPE:
+                escaped = True
+            else:
+                frame.append(byte)
+        return frame
+
+    @staticmethod
+    def _crc16(data, crc=0xffff):
+        # CRC-16/CCITT as calculated by crc16_ccitt() in Zephyr
+        for byte in data:
+            e = (crc ^ byte) & 0xff
+            f = (e ^ (e << 4)) & 0xff
+            crc = (crc >> 8) ^ (f << 8) ^ (f << 3) ^ (f >> 4)
+        return crc & 0xffff
+
+    def _frame_process(self, frame):
+        crc = int.from_bytes(frame[-2:], byteorder='little')
+        if len(frame) < self.FRAME_MIN_LEN or self._crc16(frame[:-2]) != crc:
+            self.logger.warning("Dropped corrupted frame")
+            return
+
+        channel = frame[0]
+        if channel in self.channels:
+            self.channels[channel].extend(frame[1:-2])
+        else:
+            self.logger.warning(f"Unknown channel {channel}")
+
+    def _read_bytes(self, channel):
+        self._receive()
+        buf = self.channels[channel][:self.config['rtt_read_chunk_size']]
+        del self.channels[channel][:len(buf)]
+        return buf
+
+    def _read_all_events_descriptions(self):
+        self._send_command(Command.INFO)
+        desc_buf = bytearray()
+        # Empty field is sent after last event description
+        while True:
+            if self.event_close.is_set():
+                self.logger.info("Module closed before receiving event descriptions.")
+                self.serial.close()
+                sys.exit()
+
+            desc_buf.extend(self._read_bytes(self.CHANNEL_INFO))
+            if desc_buf[-2:] == bytearray('\n\n', 'utf-8'):
+                return desc_buf
+
+    def _read_remaining_data(self):
+        self._send_command(Command.STOP)
+
+        buf = self._read_bytes(self.CHANNEL_DATA)
+        while len(buf) > 0:
+            try:
+                self.out_stream.send_ev(buf)
+            except StreamError as err:
+                self.logger.error(f"Error: {err}. Unable to send remaining data")
+                break
+            buf = self._read_bytes(self.CHANNEL_DATA)
+
+    def read_and_transmit_data(self):
+        desc_buf = self._read_all_events_descriptions()
+        try:
+            self.out_stream.send_desc(desc_buf)
+        except StreamError as err:
+            self.logger.error(f"Error: {err}. Unable to send data")
+            self.serial.close()
+            sys.exit()
+
+        self._send_command(Command.START)
+        while True:
+            if self.event_close.is_set():
+                self.close()
+
+            buf = self._read_bytes(self.CHANNEL_DATA)
+
+            if len(buf) > 0:
+                try:
+                    self.out_stream.send_ev(buf)
+                except StreamError as err:
+                    self.logger.error(f"Error: {err}. Unable to send data")
+                    self.serial.close()
+                    sys.exit()
+
+    def _send_command(self, command_type):
+        try:
+            self.serial.write(bytes([command_type.value]))
+        except serial.SerialException:
+            self.logger.error("Problem with writing UART data")
+
+    def close(self):
+        self.logger.info("Real time transmission closed")
+        self._read_remaining_data()
+        self.serial.close()
+        sys.exit()
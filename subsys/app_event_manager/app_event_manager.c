@@ -5,6 +5,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/slist.h>
@@ -15,13 +16,82 @@
 LOG_MODULE_REGISTER(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
 
+#define PRIO_CLASS_COUNT CONFIG_APP_EVENT_MANAGER_PRIO_CLASS_COUNT
+
 static void event_processor_fn(struct k_work *work);
 
 struct app_event_manager_event_display_bm _app_event_manager_event_display_bm;
 
-static K_WORK_DEFINE(event_processor, event_processor_fn);
-static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
-static struct k_spinlock lock;
+/* Queue of events of a single priority class. */
+struct event_lane {
+	sys_slist_t eventq;
+	struct k_spinlock lock;
+	struct k_work work;
+	/* Incremented every time the pending events are taken for processing. */
+	uint32_t gen;
+};
+
+#define EVENT_LANE_INITIALIZER(i, ...) { .work = Z_WORK_INITIALIZER(event_processor_fn) }
+
+static struct event_lane lanes[PRIO_CLASS_COUNT] = {
+	LISTIFY(PRIO_CLASS_COUNT, EVENT_LANE_INITIALIZER, (,))
+};
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIO_CLASSES)
+/* Priority class 0 is processed by the system workqueue. */
+static struct k_work_q class_work_q[PRIO_CLASS_COUNT - 1];
+static K_THREAD_STACK_ARRAY_DEFINE(class_work_q_stack, PRIO_CLASS_COUNT - 1,
+				   CONFIG_APP_EVENT_MANAGER_PRIO_CLASS_STACK_SIZE);
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE)
+/* Last queued event of a coalescing event type, valid as long as the generation of the lane
+ * did not change.
+ */
+struct coalesce_slot {
+	struct app_event_header *aeh;
+	uint32_t gen;
+};
+
+static struct coalesce_slot coalesce_slots[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_CONTROL)
+static ATOMIC_DEFINE(listener_disabled_bm, CONFIG_APP_EVENT_MANAGER_MAX_LISTENER_CNT);
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+static struct app_event_listener_stats listener_stats[CONFIG_APP_EVENT_MANAGER_MAX_LISTENER_CNT];
+static struct k_spinlock listener_stats_lock;
+#endif
+
+#ifdef CONFIG_APP_EVENT_MANAGER_MAX_LISTENER_CNT
+static size_t listener_idx_get(const struct event_listener *el)
+{
+	__ASSERT_NO_MSG((el >= _event_listener_list_start) && (el < _event_listener_list_end));
+
+	return el - _event_listener_list_start;
+}
+#endif
+
+static size_t event_prio_class_get(const struct event_type *et)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIO_CLASSES)
+	return et->prio_class;
+#else
+	return 0;
+#endif
+}
+
+static struct k_work_q *event_work_q_get(size_t prio_class)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIO_CLASSES)
+	if (prio_class > 0) {
+		return &class_work_q[prio_class - 1];
+	}
+#endif
+	return &k_sys_work_q;
+}
 
 static bool log_is_event_displayed(const struct event_type *et)
 {
@@ -137,21 +207,112 @@ void __weak app_event_manager_free(void *addr)
 	k_free(addr);
 }
 
+void app_event_manager_listener_enable(const struct event_listener *el, bool enable)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_CONTROL)
+	atomic_set_bit_to(listener_disabled_bm, listener_idx_get(el), !enable);
+#else
+	ARG_UNUSED(el);
+	ARG_UNUSED(enable);
+	__ASSERT(false, "Enable APP_EVENT_MANAGER_LISTENER_CONTROL before usage");
+#endif
+}
+
+bool app_event_manager_listener_is_enabled(const struct event_listener *el)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_CONTROL)
+	return !atomic_test_bit(listener_disabled_bm, listener_idx_get(el));
+#else
+	ARG_UNUSED(el);
+	return true;
+#endif
+}
+
+void app_event_manager_listener_stats_get(const struct event_listener *el,
+					  struct app_event_listener_stats *stats)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+	k_spinlock_key_t key = k_spin_lock(&listener_stats_lock);
+
+	*stats = listener_stats[listener_idx_get(el)];
+	k_spin_unlock(&listener_stats_lock, key);
+#else
+	ARG_UNUSED(el);
+	memset(stats, 0, sizeof(*stats));
+	__ASSERT(false, "Enable APP_EVENT_MANAGER_LISTENER_STATS before usage");
+#endif
+}
+
+void app_event_manager_listener_stats_reset(void)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+	k_spinlock_key_t key = k_spin_lock(&listener_stats_lock);
+
+	memset(listener_stats, 0, sizeof(listener_stats));
+	k_spin_unlock(&listener_stats_lock, key);
+#endif
+}
+
+static bool listener_notify(const struct event_listener *el, const struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+	uint32_t start = k_cycle_get_32();
+	bool consumed = el->notification(aeh);
+	uint32_t cycles = k_cycle_get_32() - start;
+	struct app_event_listener_stats *stats = &listener_stats[listener_idx_get(el)];
+	k_spinlock_key_t key = k_spin_lock(&listener_stats_lock);
+
+	stats->call_cnt++;
+	stats->total_cycles += cycles;
+	stats->max_cycles = MAX(stats->max_cycles, cycles);
+	k_spin_unlock(&listener_stats_lock, key);
+
+	return consumed;
+#else
+	return el->notification(aeh);
+#endif
+}
+
+/* Must be called with the lane lock held. */
+static bool event_coalesce(struct event_lane *lane, struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE)
+	const struct event_type *et = aeh->type_id;
+	struct coalesce_slot *slot;
+
+	if (!et->coalesce) {
+		return false;
+	}
+
+	slot = &coalesce_slots[et - _event_type_list_start];
+
+	if ((slot->aeh != NULL) && (slot->gen == lane->gen) && et->coalesce(slot->aeh, aeh)) {
+		return true;
+	}
+
+	slot->aeh = aeh;
+	slot->gen = lane->gen;
+#endif
+	return false;
+}
+
 static void event_processor_fn(struct k_work *work)
 {
+	struct event_lane *lane = CONTAINER_OF(work, struct event_lane, work);
 	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
 
 	/* Make current event list local. */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(&lane->lock);
 
-	if (sys_slist_is_empty(&eventq)) {
-		k_spin_unlock(&lock, key);
+	if (sys_slist_is_empty(&lane->eventq)) {
+		k_spin_unlock(&lane->lock, key);
 		return;
 	}
 
-	sys_slist_merge_slist(&events, &eventq);
+	sys_slist_merge_slist(&events, &lane->eventq);
+	lane->gen++;
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&lane->lock, key);
 
 	/* Traverse the list of events. */
 	sys_snode_t *node;
@@ -185,9 +346,13 @@ static void event_processor_fn(struct k_work *work)
 			__ASSERT_NO_MSG(el != NULL);
 			__ASSERT_NO_MSG(el->notification != NULL);
 
+			if (!app_event_manager_listener_is_enabled(el)) {
+				continue;
+			}
+
 			log_event_progress(et, el);
 
-			consumed = el->notification(aeh);
+			consumed = listener_notify(el, aeh);
 
 			if (consumed) {
 				log_event_consumed(et);
@@ -209,19 +374,55 @@ void _event_submit(struct app_event_header *aeh)
 	__ASSERT_NO_MSG(aeh);
 	APP_EVENT_ASSERT_ID(aeh->type_id);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	size_t prio_class = event_prio_class_get(aeh->type_id);
+
+	__ASSERT_NO_MSG(prio_class < PRIO_CLASS_COUNT);
+
+	struct event_lane *lane = &lanes[prio_class];
+	k_spinlock_key_t key = k_spin_lock(&lane->lock);
+
+	if (event_coalesce(lane, aeh)) {
+		k_spin_unlock(&lane->lock, key);
+		app_event_manager_free(aeh);
+		return;
+	}
 
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
 		STRUCT_SECTION_FOREACH(event_submit_hook, h) {
 			h->hook(aeh);
 		}
 	}
-	sys_slist_append(&eventq, &aeh->node);
-	k_spin_unlock(&lock, key);
+	sys_slist_append(&lane->eventq, &aeh->node);
+	k_spin_unlock(&lane->lock, key);
 
-	k_work_submit(&event_processor);
+	k_work_submit_to_queue(event_work_q_get(prio_class), &lane->work);
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIO_CLASSES)
+static int class_work_q_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(class_work_q); i++) {
+		char name[16];
+		struct k_work_queue_config cfg = {
+			.name = name,
+		};
+
+		(void)snprintf(name, sizeof(name), "app_evt_class%zu", i + 1);
+
+		k_work_queue_start(&class_work_q[i], class_work_q_stack[i],
+				   K_THREAD_STACK_SIZEOF(class_work_q_stack[i]),
+				   CONFIG_APP_EVENT_MANAGER_PRIO_CLASS_THREAD_PRIO - (int)i, &cfg);
+
+		/* Process events submitted before the work queue was started. */
+		(void)k_work_submit_to_queue(&class_work_q[i], &lanes[i + 1].work);
+	}
+
+	return 0;
+}
+
+SYS_INIT(class_work_q_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif
+
 int app_event_manager_init(void)
 {
 	int ret = 0;
@@ -229,6 +430,14 @@ int app_event_manager_init(void)
 	__ASSERT_NO_MSG(_event_type_list_end - _event_type_list_start <=
 			CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT);
 
+#ifdef CONFIG_APP_EVENT_MANAGER_MAX_LISTENER_CNT
+	if (_event_listener_list_end - _event_listener_list_start >
+	    CONFIG_APP_EVENT_MANAGER_MAX_LISTENER_CNT) {
+		LOG_ERR("Number of listeners exceeds CONFIG_APP_EVENT_MANAGER_MAX_LISTENER_CNT");
+		return -ENOMEM;
+	}
+#endif
+
 	log_event_init();
 
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTINIT_HOOK)) {
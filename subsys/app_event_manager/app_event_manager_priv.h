@@ -240,6 +240,10 @@ typedef	int (*log_event_data_dep)(const struct app_event_header *aeh,
 				  char *buf,
 				  size_t buf_len);
 
+/** Function to merge a submitted event into a pending event of the same type. */
+typedef bool (*app_event_coalesce_fn)(struct app_event_header *pending,
+				      const struct app_event_header *aeh);
+
 
 
 #if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_USE_DEPRECATED_LOG_FUN)
@@ -292,6 +296,16 @@ struct event_type {
 	/** The size of the event structure */
 	uint16_t struct_size;
 #endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIO_CLASSES)
+	/** Priority class that processes events of this type. */
+	uint8_t prio_class;
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE)
+	/** Function to merge an event into a pending event of this type. */
+	app_event_coalesce_fn coalesce;
+#endif
 };
 
 
@@ -299,7 +313,25 @@ extern struct event_type _event_type_list_start[];
 extern struct event_type _event_type_list_end[];
 
 
-#define _APP_EVENT_TYPE_DEFINE(ename, log_fn, trace_data_pointer, et_flags)		\
+/* Event type options - each expands to a designated initializer of struct event_type
+ * or to nothing if the related feature is disabled.
+ */
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIO_CLASSES)
+/* The option is expanded in an initializer, where BUILD_ASSERT cannot be used. */
+#define _APP_EVENT_TYPE_OPT_PRIO_CLASS(class_id)					\
+	.prio_class = (class_id) +							\
+		ZERO_OR_COMPILE_ERROR((class_id) < CONFIG_APP_EVENT_MANAGER_PRIO_CLASS_COUNT)
+#else
+#define _APP_EVENT_TYPE_OPT_PRIO_CLASS(class_id)
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE)
+#define _APP_EVENT_TYPE_OPT_COALESCE(coalesce_fn) .coalesce = (coalesce_fn)
+#else
+#define _APP_EVENT_TYPE_OPT_COALESCE(coalesce_fn)
+#endif
+
+#define _APP_EVENT_TYPE_DEFINE(ename, log_fn, trace_data_pointer, et_flags, ...)	\
 	BUILD_ASSERT(((et_flags) & ((BIT_MASK(APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START-	\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START))<<					\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START)) == 0);				\
@@ -315,6 +347,7 @@ extern struct event_type _event_type_list_end[];
 				((et_flags) | BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) :	\
 				((et_flags) & (~BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)))),\
 		_APP_EVENT_TYPE_DEFINE_SIZES(ename) /* No comma here intentionally */	\
+		FOR_EACH_NONEMPTY_TERM(IDENTITY, (,), __VA_ARGS__)			\
 	}
 
 /**
@@ -390,6 +423,10 @@ struct event_listener {
 };
 
 
+extern struct event_listener _event_listener_list_start[];
+extern struct event_listener _event_listener_list_end[];
+
+
 /** @brief Event subscriber.
  */
 struct event_subscriber {
@@ -39,12 +39,95 @@ static int show_listeners(const struct shell *shell, size_t argc,
 
 	STRUCT_SECTION_FOREACH(event_listener, el) {
 		__ASSERT_NO_MSG(el != NULL);
-		shell_fprintf(shell, SHELL_NORMAL, "|\t[L:%s]\n", el->name);
+
+		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_CONTROL)) {
+			shell_fprintf(shell, SHELL_NORMAL, "%c %zu:\t[L:%s]\n",
+				      app_event_manager_listener_is_enabled(el) ? 'E' : 'D',
+				      (size_t)(el - _event_listener_list_start), el->name);
+		} else {
+			shell_fprintf(shell, SHELL_NORMAL, "|\t[L:%s]\n", el->name);
+		}
+	}
+
+	return 0;
+}
+
+static int set_listener_enabled(const struct shell *shell, size_t argc,
+				char **argv, bool enable)
+{
+	const int listener_count = _event_listener_list_end - _event_listener_list_start;
+	int listener_indexes[argc - 1];
+
+	for (size_t i = 0; i < ARRAY_SIZE(listener_indexes); i++) {
+		char *end;
+
+		listener_indexes[i] = strtol(argv[i + 1], &end, 10);
+
+		if ((listener_indexes[i] < 0)
+		    || (listener_indexes[i] >= listener_count)
+		    || (*end != '\0')) {
+
+			shell_error(shell, "Invalid listener ID: %s", argv[i + 1]);
+			return -EINVAL;
+		}
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(listener_indexes); i++) {
+		const struct event_listener *el = _event_listener_list_start + listener_indexes[i];
+
+		app_event_manager_listener_enable(el, enable);
+		shell_fprintf(shell, SHELL_NORMAL, "Listener %s %sabled\n",
+			      el->name, enable ? "en" : "dis");
 	}
 
 	return 0;
 }
 
+static int enable_listener(const struct shell *shell, size_t argc, char **argv)
+{
+	return set_listener_enabled(shell, argc, argv, true);
+}
+
+static int disable_listener(const struct shell *shell, size_t argc, char **argv)
+{
+	return set_listener_enabled(shell, argc, argv, false);
+}
+
+static int show_listener_stats(const struct shell *shell, size_t argc,
+			       char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Listener handler time [us]:\n");
+	shell_fprintf(shell, SHELL_NORMAL, "%-24s %10s %10s %10s %12s\n",
+		      "listener", "calls", "avg", "max", "total");
+
+	STRUCT_SECTION_FOREACH(event_listener, el) {
+		struct app_event_listener_stats stats;
+
+		app_event_manager_listener_stats_get(el, &stats);
+
+		if (stats.call_cnt == 0) {
+			continue;
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL, "%-24s %10u %10llu %10llu %12llu\n",
+			      el->name, stats.call_cnt,
+			      k_cyc_to_us_floor64(stats.total_cycles / stats.call_cnt),
+			      k_cyc_to_us_floor64(stats.max_cycles),
+			      k_cyc_to_us_floor64(stats.total_cycles));
+	}
+
+	return 0;
+}
+
+static int reset_listener_stats(const struct shell *shell, size_t argc,
+				char **argv)
+{
+	app_event_manager_listener_stats_reset();
+	shell_fprintf(shell, SHELL_NORMAL, "Listener statistics reset\n");
+
+	return 0;
+}
+
 static int show_subscribers(const struct shell *shell, size_t argc,
 		char **argv)
 {
@@ -161,6 +244,18 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_event_manager,
 	SHELL_CMD_ARG(enable, NULL, "Enable displaying event with given ID",
 		      enable_event_displaying, 0,
 		      sizeof(_app_event_manager_event_display_bm) * 8 - 1),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_LISTENER_CONTROL, disable_listener, NULL,
+			   "Disable delivering events to listener with given ID",
+			   disable_listener, 2, 15),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_LISTENER_CONTROL, enable_listener, NULL,
+			   "Enable delivering events to listener with given ID",
+			   enable_listener, 2, 15),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS, show_listener_stats, NULL,
+			   "Show listener handler time statistics",
+			   show_listener_stats, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS, reset_listener_stats, NULL,
+			   "Reset listener handler time statistics",
+			   reset_listener_stats, 0, 0),
 	SHELL_SUBCMD_SET_END
 );
 
@@ -105,10 +105,12 @@ static bool has_output_type(enum audio_module_type type)
  * @brief Helper function to validate the module parameters.
  *
  * @param parameters  [in]  The module parameters.
+ * @param threaded    [in]  Flag to indicate if the module will run in its own thread.
  *
  * @return true if valid parameters, false otherwise.
  */
-static bool validate_parameters(struct audio_module_parameters const *const parameters)
+static bool validate_parameters(struct audio_module_parameters const *const parameters,
+				bool threaded)
 {
 	if (parameters == NULL) {
 		LOG_ERR("No parameters for module");
@@ -126,13 +128,62 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 		return false;
 	}
 
-	if (parameters->thread.stack == NULL || parameters->thread.stack_size == 0) {
+	if (threaded &&
+	    (parameters->thread.stack == NULL || parameters->thread.stack_size == 0)) {
+		return false;
+	}
+
+	if (parameters->thread.data_slab != NULL &&
+	    parameters->thread.data_slab->info.num_blocks > CONFIG_AUDIO_MODULE_DATA_BLOCKS_MAX) {
+		LOG_ERR("Data slab has %u blocks, the maximum is %d",
+			parameters->thread.data_slab->info.num_blocks,
+			CONFIG_AUDIO_MODULE_DATA_BLOCKS_MAX);
 		return false;
 	}
 
 	return true;
 }
 
+/**
+ * @brief Get the reference count of the data slab block holding the audio data.
+ *
+ * @param handle  [in/out]  The handle of the module owning the data slab.
+ * @param data    [in]      Pointer to the start of the audio data block.
+ *
+ * @return Pointer to the reference count of the block.
+ */
+static atomic_t *data_ref_get(struct audio_module_handle *handle, void const *const data)
+{
+	struct k_mem_slab *slab = handle->thread.data_slab;
+	size_t index = ((char const *)data - slab->buffer) / slab->info.block_size;
+
+	__ASSERT(index < ARRAY_SIZE(handle->data_refs), "Data block %p not in slab of module %s",
+		 data, handle->name);
+
+	return &handle->data_refs[index];
+}
+
+/**
+ * @brief Drop a reference to an audio data block and free the block when the last reference
+ *        has been dropped.
+ *
+ * @param handle  [in/out]  The handle of the module owning the data slab.
+ * @param data    [in]      Pointer to the start of the audio data block.
+ */
+static void data_ref_put(struct audio_module_handle *handle, void const *const data)
+{
+	atomic_val_t refs = atomic_dec(data_ref_get(handle, data));
+
+	__ASSERT(refs > 0, "Audio data released too many times in module %s", handle->name);
+
+	if (refs == 1) {
+		LOG_DBG("Audio data has been consumed in module %s", handle->name);
+
+		/* Audio data has been consumed by all modules so now can free the data memory. */
+		k_mem_slab_free(handle->thread.data_slab, (void *)data);
+	}
+}
+
 /**
  * @brief General callback for releasing the data when inter-module data
  *        passing.
@@ -143,21 +194,7 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 static void audio_data_release_cb(struct audio_module_handle_private *handle,
 				  struct audio_data const *const audio_data)
 {
-	int ret;
-	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
-
-	ret = k_sem_take(&hdl->sem, K_NO_WAIT);
-	if (ret) {
-		LOG_ERR("Failed to take semaphore for data release callback function");
-		return;
-	}
-
-	if (k_sem_count_get(&hdl->sem) == 0) {
-		LOG_DBG("Audio data has been consumed in module %s", hdl->name);
-
-		/* Audio data has been consumed by all modules so now can free the data memory. */
-		k_mem_slab_free(hdl->thread.data_slab, (void *)audio_data->data);
-	}
+	data_ref_put((struct audio_module_handle *)handle, audio_data->data);
 }
 
 /**
@@ -248,11 +285,6 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 
 		data_fifo_block_free(handle->thread.msg_tx, (void *)data_msg_tx);
 
-		ret = k_sem_take(&handle->sem, K_NO_WAIT);
-		if (ret) {
-			LOG_ERR("Failed to take semaphore for TX FIFO put");
-		}
-
 		return ret;
 	}
 
@@ -274,6 +306,7 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 {
 	int ret;
 	struct audio_module_handle *handle_to;
+	atomic_t *refs;
 
 	if (handle->dest_count == 0) {
 		LOG_WRN("Nowhere to send the audio data from module %s so releasing it",
@@ -284,63 +317,61 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 		return 0;
 	}
 
-	/* We need to ensure that all receiving modules have got the audio data.
-	 * This is so the first receiver cannot free the audio data before all receivers
-	 * have all gotten the audio data.
+	/* Each destination holds a reference to the data block. The sender holds one extra
+	 * reference until all destinations have been given the audio data, so the first receiver
+	 * cannot free the block before the last one has got it. Every block has its own count,
+	 * so several audio data items can be in flight at the same time.
 	 */
+	refs = data_ref_get(handle, audio_data->data);
+	atomic_set(refs, 1);
+
+	/* The mutex only keeps the destinations list stable while walking it. */
 	ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
 	if (ret) {
 		LOG_ERR("Failed to take MUTEX lock in time");
-		return ret;
-	}
 
-	/* Here the semaphore is used as a count of the number of audio data items out in the
-	 * connected modules.
-	 */
-	ret = k_sem_init(&handle->sem, handle->dest_count, handle->dest_count);
-	if (ret) {
-		LOG_ERR("Failed to initiate semaphore");
+		data_ref_put(handle, audio_data->data);
+
 		return ret;
 	}
 
 	/* Send to all internally connected modules. */
 	SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
+		atomic_inc(refs);
+
 		ret = data_tx(handle, handle_to, audio_data, &audio_data_release_cb);
 		if (ret) {
 			LOG_ERR("Failed to send audio data to module %s from %s, ret %d",
 				handle_to->name, handle->name, ret);
 
-			return ret;
+			atomic_dec(refs);
+			break;
 		}
 	}
 
-	ret = k_mutex_unlock(&handle->dest_mutex);
-	if (ret) {
-		LOG_ERR("Failed to release MUTEX");
-		return ret;
-	}
+	k_mutex_unlock(&handle->dest_mutex);
 
 	/* Send to this module's TX FIFO for extraction by an external
 	 * process with audio_module_rx().
 	 */
-	if (handle->use_tx_queue && handle->thread.msg_tx) {
+	if (ret == 0 && handle->use_tx_queue && handle->thread.msg_tx) {
+		atomic_inc(refs);
+
 		ret = tx_fifo_put(handle, audio_data);
 		if (ret) {
 			LOG_ERR("Failed to send audio data on module %s TX message queue",
 				handle->name);
 
-			ret = k_sem_take(&handle->sem, K_NO_WAIT);
-			if (ret) {
-				LOG_ERR("Failed to take semaphore");
-			}
-
-			return ret;
+			atomic_dec(refs);
+		} else {
+			LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
 		}
-
-		LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
 	}
 
-	return 0;
+	/* Drop the sender's reference, this frees the block if no receiver holds it. */
+	data_ref_put(handle, audio_data->data);
+
+	return ret;
 }
 
 /**
@@ -537,10 +568,65 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 	CODE_UNREACHABLE;
 }
 
-int audio_module_open(struct audio_module_parameters const *const parameters,
-		      struct audio_module_configuration const *const configuration,
-		      char const *const name, struct audio_module_context *context,
-		      struct audio_module_handle *handle)
+/**
+ * @brief Check if a module runs in a started graph.
+ *
+ * @param handle  [in]  Pointer to the module's private handle.
+ *
+ * @return True if the module's graph is started, false otherwise.
+ */
+static bool graph_started(struct audio_module_handle const *const handle)
+{
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+	return handle->graph != NULL && handle->graph->started;
+#else
+	return false;
+#endif
+}
+
+/**
+ * @brief Remove a module from a graph that is not started.
+ *
+ * @param graph   [in/out]  Pointer to the graph.
+ * @param handle  [in]      Pointer to the module's private handle.
+ */
+static void graph_remove(struct audio_module_graph *graph,
+			 struct audio_module_handle const *const handle)
+{
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+	for (int i = 0; i < graph->num_modules; i++) {
+		if (graph->modules[i] == handle) {
+			graph->num_modules--;
+			memmove(&graph->modules[i], &graph->modules[i + 1],
+				(graph->num_modules - i) * sizeof(graph->modules[0]));
+			graph->modules[graph->num_modules] = NULL;
+			return;
+		}
+	}
+#else
+	ARG_UNUSED(graph);
+	ARG_UNUSED(handle);
+#endif
+}
+
+/**
+ * @brief Open a module, either with its own thread or as a member of a graph.
+ *
+ * @param parameters     [in]      Pointer to the module set-up parameters.
+ * @param configuration  [in]      Pointer to the module's configuration.
+ * @param name           [in]      A NULL terminated string giving a unique name for this module
+ *                                 instance.
+ * @param context        [in/out]  Pointer to the private context for the module.
+ * @param handle         [out]     Pointer to the module's private handle.
+ * @param graph          [in/out]  Pointer to the graph to run the module in, or NULL to run the
+ *                                 module in its own thread.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int module_open(struct audio_module_parameters const *const parameters,
+		       struct audio_module_configuration const *const configuration,
+		       char const *const name, struct audio_module_context *context,
+		       struct audio_module_handle *handle, struct audio_module_graph *graph)
 {
 	int ret;
 	k_thread_entry_t thread_entry;
@@ -556,7 +642,7 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 		return -ECANCELED;
 	}
 
-	if (!validate_parameters(parameters)) {
+	if (!validate_parameters(parameters, graph == NULL)) {
 		LOG_ERR("Invalid parameters for module");
 		return -ECANCELED;
 	}
@@ -574,6 +660,7 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 	}
 
 	handle->description = parameters->description;
+	handle->graph = graph;
 	memcpy(&handle->thread, &parameters->thread,
 	       sizeof(struct audio_module_thread_configuration));
 
@@ -612,6 +699,11 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 		return -EINVAL;
 	}
 
+	/* A module in a graph gets its input by a direct call, so it has no RX FIFO. */
+	if (graph != NULL) {
+		handle->thread.msg_rx = NULL;
+	}
+
 	if (handle->thread.msg_rx != NULL && !data_fifo_state(handle->thread.msg_rx)) {
 		ret = data_fifo_init(handle->thread.msg_rx);
 		if (ret) {
@@ -639,6 +731,14 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 	sys_slist_init(&handle->handle_dest_list);
 	k_mutex_init(&handle->dest_mutex);
 
+	if (graph != NULL) {
+		handle->state = AUDIO_MODULE_STATE_CONFIGURED;
+
+		LOG_DBG("Module %s opened in graph", handle->name);
+
+		return 0;
+	}
+
 	handle->thread_id = k_thread_create(
 		&handle->thread_data, handle->thread.stack, handle->thread.stack_size, thread_entry,
 		(void *)handle, NULL, NULL, K_PRIO_PREEMPT(handle->thread.priority), 0, K_FOREVER);
@@ -661,6 +761,14 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 	return 0;
 }
 
+int audio_module_open(struct audio_module_parameters const *const parameters,
+		      struct audio_module_configuration const *const configuration,
+		      char const *const name, struct audio_module_context *context,
+		      struct audio_module_handle *handle)
+{
+	return module_open(parameters, configuration, name, context, handle, NULL);
+}
+
 int audio_module_close(struct audio_module_handle *handle)
 {
 	int ret;
@@ -676,6 +784,11 @@ int audio_module_close(struct audio_module_handle *handle)
 		return -ECANCELED;
 	}
 
+	if (graph_started(handle)) {
+		LOG_ERR("Cannot close module %s while its graph is started", handle->name);
+		return -EBUSY;
+	}
+
 	if (handle->description->functions->close != NULL) {
 		ret = handle->description->functions->close(
 			(struct audio_module_handle_private *)handle);
@@ -695,10 +808,14 @@ int audio_module_close(struct audio_module_handle *handle)
 
 	/*
 	 * TODO: How to return all the data to the slab items?
-	 *       Test the semaphore and wait for it to be zero.
+	 *       Wait for the data block reference counts to be zero.
 	 */
 
-	k_thread_abort(handle->thread_id);
+	if (handle->graph == NULL) {
+		k_thread_abort(handle->thread_id);
+	} else {
+		graph_remove(handle->graph, handle);
+	}
 
 	/* Ensure module handle data is fully cleared. */
 	memset(handle, 0, sizeof(struct audio_module_handle));
@@ -798,6 +915,11 @@ int audio_module_connect(struct audio_module_handle *handle_from,
 		return -ECANCELED;
 	}
 
+	if (graph_started(handle_from)) {
+		LOG_ERR("Cannot connect module %s while its graph is started", handle_from->name);
+		return -EBUSY;
+	}
+
 	if (connect_external) {
 		if (handle_to != NULL || handle_from->thread.msg_tx == NULL) {
 			LOG_ERR("Module %s has no TX FIFO or module handle to is not NULL",
@@ -819,6 +941,12 @@ int audio_module_connect(struct audio_module_handle *handle_from,
 			LOG_WRN("A module is in an invalid state for connecting");
 			return -ECANCELED;
 		}
+
+		if (handle_from->graph != handle_to->graph) {
+			LOG_ERR("Modules %s and %s do not run in the same graph", handle_from->name,
+				handle_to->name);
+			return -ECANCELED;
+		}
 	}
 
 	ret = k_mutex_lock(&handle_from->dest_mutex, LOCK_TIMEOUT_US);
@@ -889,6 +1017,11 @@ int audio_module_disconnect(struct audio_module_handle *handle,
 		return -ECANCELED;
 	}
 
+	if (graph_started(handle)) {
+		LOG_ERR("Cannot disconnect module %s while its graph is started", handle->name);
+		return -EBUSY;
+	}
+
 	if (disconnect_external) {
 		if (handle_disconnect != NULL) {
 			LOG_ERR("Module disconnect handle is not NULL");
@@ -1254,3 +1387,292 @@ int audio_module_number_channels_calculate(uint32_t locations, int8_t *number_ch
 
 	return 0;
 }
+
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+/**
+ * @brief Find the position of a module in a graph.
+ *
+ * @param graph   [in]  Pointer to the graph.
+ * @param handle  [in]  The handle to the module instance.
+ *
+ * @return Position of the module, or -1 if the module is not in the graph.
+ */
+static int graph_index_get(struct audio_module_graph const *const graph,
+			   struct audio_module_handle const *const handle)
+{
+	for (int i = 0; i < graph->num_modules; i++) {
+		if (graph->modules[i] == handle) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+int audio_module_graph_add(struct audio_module_graph *graph,
+			   struct audio_module_parameters const *const parameters,
+			   struct audio_module_configuration const *const configuration,
+			   char const *const name, struct audio_module_context *context,
+			   struct audio_module_handle *handle)
+{
+	int ret;
+
+	if (graph == NULL) {
+		LOG_ERR("Graph is NULL");
+		return -EINVAL;
+	}
+
+	if (graph->started) {
+		LOG_ERR("Cannot add modules to a started graph");
+		return -ECANCELED;
+	}
+
+	if (graph->num_modules >= ARRAY_SIZE(graph->modules)) {
+		LOG_ERR("Graph is full, the maximum is %zu modules", ARRAY_SIZE(graph->modules));
+		return -ENOMEM;
+	}
+
+	ret = module_open(parameters, configuration, name, context, handle, graph);
+	if (ret) {
+		return ret;
+	}
+
+	graph->modules[graph->num_modules] = handle;
+	graph->num_modules++;
+
+	return 0;
+}
+
+int audio_module_graph_start(struct audio_module_graph *graph)
+{
+	int ret;
+	int dest;
+	uint8_t num_ordered = 0;
+	bool progress = true;
+	int8_t source[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX];
+	int8_t position[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX];
+	struct audio_module_handle *modules[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX];
+	struct audio_module_handle *handle_to;
+
+	if (graph == NULL) {
+		LOG_ERR("Graph is NULL");
+		return -EINVAL;
+	}
+
+	if (graph->started) {
+		LOG_WRN("Graph already started");
+		return -EALREADY;
+	}
+
+	memset(source, -1, sizeof(source));
+	memset(position, -1, sizeof(position));
+
+	/* Find the module feeding each module. */
+	for (int i = 0; i < graph->num_modules; i++) {
+		if (graph->modules[i]->description->type != AUDIO_MODULE_TYPE_OUTPUT &&
+		    graph->modules[i]->thread.data_slab == NULL) {
+			LOG_ERR("Module %s has no data slab", graph->modules[i]->name);
+			return -EINVAL;
+		}
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&graph->modules[i]->handle_dest_list, handle_to,
+					     node) {
+			dest = graph_index_get(graph, handle_to);
+			if (dest < 0) {
+				LOG_ERR("Module %s is connected to %s outside the graph",
+					graph->modules[i]->name, handle_to->name);
+				return -EINVAL;
+			}
+
+			if (source[dest] >= 0) {
+				LOG_ERR("Module %s is fed by more than one module",
+					handle_to->name);
+				return -ENOTSUP;
+			}
+
+			source[dest] = i;
+		}
+	}
+
+	/* Order the modules so each module comes after the one feeding it. */
+	while (num_ordered < graph->num_modules && progress) {
+		progress = false;
+
+		for (int i = 0; i < graph->num_modules; i++) {
+			if (position[i] >= 0 || (source[i] >= 0 && position[source[i]] < 0)) {
+				continue;
+			}
+
+			position[i] = num_ordered;
+			modules[num_ordered] = graph->modules[i];
+			num_ordered++;
+			progress = true;
+		}
+	}
+
+	if (num_ordered < graph->num_modules) {
+		LOG_ERR("Graph has a loop");
+		return -EINVAL;
+	}
+
+	for (int i = 0; i < graph->num_modules; i++) {
+		graph->source[position[i]] = (source[i] < 0) ? -1 : position[source[i]];
+	}
+
+	memcpy(graph->modules, modules, graph->num_modules * sizeof(modules[0]));
+
+	for (int i = 0; i < graph->num_modules; i++) {
+		ret = audio_module_start(graph->modules[i]);
+		if (ret) {
+			LOG_ERR("Failed to start module %s in graph, ret %d",
+				graph->modules[i]->name, ret);
+
+			while (i-- > 0) {
+				audio_module_stop(graph->modules[i]);
+			}
+
+			return ret;
+		}
+	}
+
+	graph->started = true;
+
+	return 0;
+}
+
+int audio_module_graph_stop(struct audio_module_graph *graph)
+{
+	int ret;
+
+	if (graph == NULL) {
+		LOG_ERR("Graph is NULL");
+		return -EINVAL;
+	}
+
+	if (!graph->started) {
+		LOG_WRN("Graph is not running already stopped");
+		return -EALREADY;
+	}
+
+	for (int i = 0; i < graph->num_modules; i++) {
+		ret = audio_module_stop(graph->modules[i]);
+		if (ret && ret != -EALREADY) {
+			LOG_ERR("Failed to stop module %s in graph, ret %d",
+				graph->modules[i]->name, ret);
+			return ret;
+		}
+	}
+
+	graph->started = false;
+
+	return 0;
+}
+
+int audio_module_graph_process(struct audio_module_graph *graph,
+			       struct audio_data const *const audio_data_in)
+{
+	int ret;
+	int result = 0;
+	bool has_output[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX] = {0};
+	struct audio_module_handle *handle;
+	struct audio_data const *audio_data_rx;
+	struct audio_data *audio_data_tx;
+
+	if (graph == NULL) {
+		LOG_ERR("Graph is NULL");
+		return -EINVAL;
+	}
+
+	if (!graph->started) {
+		LOG_WRN("Graph is not running");
+		return -ECANCELED;
+	}
+
+	/* The modules are in topological order, so the audio data from the feeding module is
+	 * always ready when a module is called.
+	 */
+	for (int i = 0; i < graph->num_modules; i++) {
+		handle = graph->modules[i];
+		audio_data_rx = NULL;
+		audio_data_tx = NULL;
+
+		if (graph->source[i] >= 0) {
+			if (!has_output[graph->source[i]]) {
+				/* The feeding module produced nothing for this frame. */
+				continue;
+			}
+
+			audio_data_rx = &graph->data[graph->source[i]];
+		} else if (handle->description->type != AUDIO_MODULE_TYPE_INPUT) {
+			if (audio_data_in == NULL) {
+				LOG_ERR("No audio data for module %s", handle->name);
+				result = -EINVAL;
+				continue;
+			}
+
+			audio_data_rx = audio_data_in;
+		}
+
+		if (!state_running(handle->state)) {
+			LOG_WRN("Module %s is not running", handle->name);
+			continue;
+		}
+
+		if (handle->description->type != AUDIO_MODULE_TYPE_OUTPUT) {
+			audio_data_tx = &graph->data[i];
+
+			ret = k_mem_slab_alloc(handle->thread.data_slab, &audio_data_tx->data,
+					       K_NO_WAIT);
+			if (ret) {
+				LOG_ERR("No free data buffer for module %s, ret %d", handle->name,
+					ret);
+				result = ret;
+				continue;
+			}
+
+			audio_data_tx->data_size = handle->thread.data_size;
+		}
+
+		ret = handle->description->functions->data_process(
+			(struct audio_module_handle_private *)handle, audio_data_rx, audio_data_tx);
+		if (ret) {
+			if (audio_data_tx != NULL) {
+				k_mem_slab_free(handle->thread.data_slab, audio_data_tx->data);
+			}
+
+			LOG_ERR("Data process error in module %s, ret %d", handle->name, ret);
+			result = ret;
+			continue;
+		}
+
+		if (audio_data_tx == NULL) {
+			continue;
+		}
+
+		/* The graph holds a reference until the frame is done. */
+		atomic_set(data_ref_get(handle, audio_data_tx->data), 1);
+		has_output[i] = true;
+
+		if (handle->use_tx_queue && handle->thread.msg_tx) {
+			atomic_inc(data_ref_get(handle, audio_data_tx->data));
+
+			ret = tx_fifo_put(handle, audio_data_tx);
+			if (ret) {
+				LOG_ERR("Failed to send audio data on module %s TX message queue",
+					handle->name);
+
+				atomic_dec(data_ref_get(handle, audio_data_tx->data));
+				result = ret;
+			}
+		}
+	}
+
+	for (int i = 0; i < graph->num_modules; i++) {
+		if (has_output[i]) {
+			data_ref_put(graph->modules[i], graph->data[i].data);
+		}
+	}
+
+	return result;
+}
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
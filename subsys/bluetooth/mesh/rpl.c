@@ -20,7 +20,96 @@ LOG_MODULE_REGISTER(bt_mesh_rpl);
 
 static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
 
-EMDS_STATIC_ENTRY_DEFINE(rpl_store, CONFIG_BT_MESH_RPL_INDEX, replay_list, sizeof(replay_list));
+EMDS_STATIC_TRACKED_ENTRY_DEFINE(rpl_store, CONFIG_BT_MESH_RPL_INDEX, replay_list,
+				 sizeof(replay_list));
+
+#if defined(CONFIG_BT_MESH_RPL_HASH_LOOKUP)
+/* Open addressing hash table of replay_list entries, keyed by the source address. A slot holds
+ * the entry index + 1, and 0 marks an empty slot. The table is at most half full. Entries are
+ * never removed one by one, instead the table is rebuilt on the next lookup when replay_list is
+ * rearranged. The first lookup after boot builds it from the data restored from Emergency Data
+ * Storage.
+ */
+#define RPL_HASH_SIZE (2 * CONFIG_BT_MESH_CRPL)
+
+BUILD_ASSERT(CONFIG_BT_MESH_CRPL < UINT16_MAX);
+
+static uint16_t rpl_hash[RPL_HASH_SIZE];
+/* Number of used entries at the start of replay_list */
+static uint16_t rpl_cnt;
+static bool rpl_hash_valid;
+
+static uint32_t rpl_hash_home(uint16_t src)
+{
+	return (((uint32_t)src * 0x9E3779B1U) >> 8) % RPL_HASH_SIZE;
+}
+
+static struct bt_mesh_rpl *rpl_hash_find(uint16_t src)
+{
+	uint32_t i = rpl_hash_home(src);
+
+	while (rpl_hash[i]) {
+		struct bt_mesh_rpl *rpl = &replay_list[rpl_hash[i] - 1];
+
+		if (rpl->src == src) {
+			return rpl;
+		}
+
+		if (++i == RPL_HASH_SIZE) {
+			i = 0;
+		}
+	}
+
+	return NULL;
+}
+
+static void rpl_hash_insert(uint16_t src, uint16_t idx)
+{
+	uint32_t i = rpl_hash_home(src);
+
+	while (rpl_hash[i]) {
+		if (++i == RPL_HASH_SIZE) {
+			i = 0;
+		}
+	}
+
+	rpl_hash[i] = idx + 1;
+}
+
+static void rpl_hash_build(void)
+{
+	(void)memset(rpl_hash, 0, sizeof(rpl_hash));
+
+	/* Like the linear lookup, stop at the first empty slot and keep the first entry of a
+	 * duplicated address.
+	 */
+	for (rpl_cnt = 0; rpl_cnt < ARRAY_SIZE(replay_list) && replay_list[rpl_cnt].src;
+	     rpl_cnt++) {
+		if (!rpl_hash_find(replay_list[rpl_cnt].src)) {
+			rpl_hash_insert(replay_list[rpl_cnt].src, rpl_cnt);
+		}
+	}
+
+	rpl_hash_valid = true;
+}
+
+static void rpl_hash_update(struct bt_mesh_rpl *rpl, uint16_t src)
+{
+	uint16_t idx = rpl - replay_list;
+
+	if (rpl->src == src) {
+		return;
+	}
+
+	if (rpl_hash_valid && !rpl->src && idx == rpl_cnt) {
+		rpl_hash_insert(src, idx);
+		rpl_cnt++;
+	} else {
+		/* Entry taken over by another address */
+		rpl_hash_valid = false;
+	}
+}
+#endif /* CONFIG_BT_MESH_RPL_HASH_LOOKUP */
 
 void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		struct bt_mesh_net_rx *rx)
@@ -32,9 +121,49 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		rpl->seg = 0;
 	}
 
+#if defined(CONFIG_BT_MESH_RPL_HASH_LOOKUP)
+	rpl_hash_update(rpl, rx->ctx.addr);
+#endif
+
 	rpl->src = rx->ctx.addr;
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
+
+	emds_entry_dirty_set(&emds_rpl_store);
+}
+
+/* Check a slot that is either empty or used by the source address of the message */
+static bool rpl_slot_check(struct bt_mesh_rpl *rpl, struct bt_mesh_net_rx *rx,
+			   struct bt_mesh_rpl **match)
+{
+	/* Empty slot */
+	if (!rpl->src) {
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
+		}
+
+		return false;
+	}
+
+	/* Existing slot for given address */
+	if (rx->old_iv && !rpl->old_iv) {
+		return true;
+	}
+
+	if ((!rx->old_iv && rpl->old_iv) ||
+	    rpl->seq < rx->seq) {
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
+		}
+
+		return false;
+	} else {
+		return true;
+	}
 }
 
 /* Check the Replay Protection List for a replay attempt. If non-NULL match
@@ -45,7 +174,9 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		struct bt_mesh_rpl **match, bool bridge)
 {
+#if !defined(CONFIG_BT_MESH_RPL_HASH_LOOKUP)
 	int i;
+#endif
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -57,48 +188,48 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		struct bt_mesh_rpl *rpl = &replay_list[i];
+#if defined(CONFIG_BT_MESH_RPL_HASH_LOOKUP)
+	struct bt_mesh_rpl *rpl;
 
-		/* Empty slot */
-		if (!rpl->src) {
-			if (match) {
-				*match = rpl;
-			} else {
-				bt_mesh_rpl_update(rpl, rx);
-			}
+	if (!rpl_hash_valid) {
+		rpl_hash_build();
+	}
 
-			return false;
+	rpl = rpl_hash_find(rx->ctx.addr);
+	if (!rpl) {
+		if (rpl_cnt == ARRAY_SIZE(replay_list)) {
+			LOG_ERR("RPL is full!");
+			return true;
 		}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
+		/* Empty slot */
+		rpl = &replay_list[rpl_cnt];
+	}
 
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				if (match) {
-					*match = rpl;
-				} else {
-					bt_mesh_rpl_update(rpl, rx);
-				}
+	return rpl_slot_check(rpl, rx, match);
+#else
+	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		struct bt_mesh_rpl *rpl = &replay_list[i];
 
-				return false;
-			} else {
-				return true;
-			}
+		/* Empty slot or existing slot for given address */
+		if (!rpl->src || rpl->src == rx->ctx.addr) {
+			return rpl_slot_check(rpl, rx, match);
 		}
 	}
 
 	LOG_ERR("RPL is full!");
 	return true;
+#endif
 }
 
 void bt_mesh_rpl_clear(void)
 {
 	(void)memset(replay_list, 0, sizeof(replay_list));
+	emds_entry_dirty_set(&emds_rpl_store);
+
+#if defined(CONFIG_BT_MESH_RPL_HASH_LOOKUP)
+	rpl_hash_valid = false;
+#endif
 }
 
 void bt_mesh_rpl_reset(void)
@@ -130,6 +261,11 @@ void bt_mesh_rpl_reset(void)
 	}
 
 	(void) memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+	emds_entry_dirty_set(&emds_rpl_store);
+
+#if defined(CONFIG_BT_MESH_RPL_HASH_LOOKUP)
+	rpl_hash_valid = false;
+#endif
 }
 
 void bt_mesh_rpl_pending_store(uint16_t addr)
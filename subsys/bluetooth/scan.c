@@ -9,11 +9,18 @@
 #include <string.h>
 #include <bluetooth/scan.h>
 
+#include "common/bt_str.h"
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(nrf_bt_scan, CONFIG_BT_SCAN_LOG_LEVEL);
 
 #define BT_SCAN_UUID_128_SIZE 16
 
+/* Number of hash slots of a set holding up to _cnt entries. A power of two
+ * at least twice the capacity keeps the probe sequences short.
+ */
+#define HASH_SLOTS(_cnt) BIT(LOG2CEIL(MAX((_cnt), 1)) + 1)
+
 #define MODE_CHECK (BT_SCAN_NAME_FILTER | BT_SCAN_ADDR_FILTER | \
 	BT_SCAN_SHORT_NAME_FILTER | BT_SCAN_APPEARANCE_FILTER | \
 	BT_SCAN_UUID_FILTER | BT_SCAN_MANUFACTURER_DATA_FILTER)
@@ -55,6 +62,11 @@ struct bt_scan_name_filter {
 	 */
 	char target_name[CONFIG_BT_SCAN_NAME_CNT][CONFIG_BT_SCAN_NAME_MAX_LEN];
 
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+	/* Filter indexes sorted by the target name. */
+	uint8_t sorted[CONFIG_BT_SCAN_NAME_CNT];
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
+
 	/* Name filter counter. */
 	uint8_t cnt;
 
@@ -76,6 +88,11 @@ struct bt_scan_short_name_filter {
 		uint8_t min_len;
 	} name[CONFIG_BT_SCAN_SHORT_NAME_CNT];
 
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+	/* Filter indexes sorted by the target name. */
+	uint8_t sorted[CONFIG_BT_SCAN_SHORT_NAME_CNT];
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
+
 	/* Short name filter counter. */
 	uint8_t cnt;
 
@@ -89,6 +106,9 @@ struct bt_scan_addr_filter {
 	/* Addresses advertised by the peripherals. */
 	bt_addr_le_t target_addr[CONFIG_BT_SCAN_ADDRESS_CNT];
 
+	/* Hash slots indexing the target addresses. */
+	uint16_t hash[HASH_SLOTS(CONFIG_BT_SCAN_ADDRESS_CNT)];
+
 	/* Address filter counter. */
 	uint8_t cnt;
 
@@ -120,6 +140,14 @@ struct bt_scan_uuid_filter {
 	 */
 	struct bt_scan_uuid uuid[CONFIG_BT_SCAN_UUID_CNT];
 
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+	/* UUIDs in the 128-bit little-endian form, used as the hash keys. */
+	uint8_t key[CONFIG_BT_SCAN_UUID_CNT][BT_SCAN_UUID_128_SIZE];
+
+	/* Hash slots holding the filter index plus one, or zero if free. */
+	uint8_t hash[HASH_SLOTS(CONFIG_BT_SCAN_UUID_CNT)];
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
+
 	/* UUID filter counter. */
 	uint8_t cnt;
 
@@ -155,6 +183,21 @@ struct bt_scan_manufacturer_data_filter {
 		uint8_t data_len;
 	} manufacturer_data[CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT];
 
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+	/* Filter indexes sorted by the data length and then by the data. */
+	uint8_t sorted[CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT];
+
+	/* Runs of sorted filters with the same data length. */
+	struct {
+		uint8_t len;
+		uint8_t start;
+		uint8_t cnt;
+	} group[CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT];
+
+	/* Number of the data length runs. */
+	uint8_t group_cnt;
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
+
 	/* Name filter counter. */
 	uint8_t cnt;
 
@@ -211,6 +254,9 @@ struct conn_attempts_filter {
 	/* Array of the filtered devices. */
 	struct conn_attempts_device device[CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER_LEN];
 
+	/* Hash slots indexing the filtered devices. */
+	uint16_t hash[HASH_SLOTS(CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER_LEN)];
+
 	/* The oldest device index. */
 	uint32_t oldest_idx;
 
@@ -225,6 +271,9 @@ struct conn_blocklist {
 	/* Array of the blocklist devices. */
 	bt_addr_le_t addr[CONFIG_BT_SCAN_BLOCKLIST_LEN];
 
+	/* Hash slots indexing the blocklist devices. */
+	uint16_t hash[HASH_SLOTS(CONFIG_BT_SCAN_BLOCKLIST_LEN)];
+
 	/* Blocklist device count. */
 	uint32_t count;
 };
@@ -263,6 +312,7 @@ static struct bt_scan {
 	 * the device as connectable if its address is in this cache.
 	 */
 	bt_addr_le_t connectable_cache[CONFIG_BT_SCAN_CONNECTABLE_CACHE_SIZE];
+	uint16_t connectable_cache_hash[HASH_SLOTS(CONFIG_BT_SCAN_CONNECTABLE_CACHE_SIZE)];
 	uint8_t connectable_cache_idx;
 	uint8_t connectable_cache_count;
 
@@ -278,6 +328,152 @@ static struct bt_scan {
 
 } bt_scan;
 
+/* Hashed set of addresses stored in an array owned by one of the filters.
+ * Each hash slot holds the array index of an address plus one, or zero if
+ * the slot is free. Collisions are resolved with linear probing, so lookups
+ * on the advertising report path do not depend on the filter length.
+ */
+struct addr_set {
+	/* Hash slots, the count is a power of two. */
+	uint16_t *slots;
+
+	/* Number of hash slots. */
+	uint16_t slot_cnt;
+
+	/* First address of the array. */
+	const uint8_t *addrs;
+
+	/* Distance in bytes between two consecutive addresses in the array. */
+	size_t stride;
+};
+
+#define ADDR_SET_INIT(_slots, _first_addr, _stride)		\
+	{							\
+		.slots = (_slots),				\
+		.slot_cnt = ARRAY_SIZE(_slots),			\
+		.addrs = (const uint8_t *)(_first_addr),	\
+		.stride = (_stride),				\
+	}
+
+BUILD_ASSERT(CONFIG_BT_SCAN_CONNECTABLE_CACHE_SIZE <= UINT8_MAX);
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+BUILD_ASSERT(HASH_SLOTS(CONFIG_BT_SCAN_UUID_CNT) <= UINT8_MAX + 1);
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
+#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
+BUILD_ASSERT(HASH_SLOTS(CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER_LEN) <= UINT16_MAX);
+#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
+#if CONFIG_BT_SCAN_BLOCKLIST
+BUILD_ASSERT(HASH_SLOTS(CONFIG_BT_SCAN_BLOCKLIST_LEN) <= UINT16_MAX);
+#endif /* CONFIG_BT_SCAN_BLOCKLIST */
+
+static const struct addr_set addr_filter_set =
+	ADDR_SET_INIT(bt_scan.scan_filters.addr.hash,
+		      bt_scan.scan_filters.addr.target_addr,
+		      sizeof(bt_addr_le_t));
+
+static const struct addr_set connectable_cache_set =
+	ADDR_SET_INIT(bt_scan.connectable_cache_hash,
+		      bt_scan.connectable_cache,
+		      sizeof(bt_addr_le_t));
+
+#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
+static const struct addr_set attempts_filter_set =
+	ADDR_SET_INIT(bt_scan.attempts_filter.hash,
+		      &bt_scan.attempts_filter.device[0].addr,
+		      sizeof(struct conn_attempts_device));
+#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
+
+#if CONFIG_BT_SCAN_BLOCKLIST
+static const struct addr_set blocklist_set =
+	ADDR_SET_INIT(bt_scan.blocklist.hash,
+		      bt_scan.blocklist.addr,
+		      sizeof(bt_addr_le_t));
+#endif /* CONFIG_BT_SCAN_BLOCKLIST */
+
+static const bt_addr_le_t *addr_set_addr_get(const struct addr_set *set, uint16_t idx)
+{
+	return (const bt_addr_le_t *)(set->addrs + idx * set->stride);
+}
+
+static uint16_t addr_set_home(const struct addr_set *set, const bt_addr_le_t *addr)
+{
+	/* Fold the address into 32 bits and take the upper half of a
+	 * multiplicative hash, so that addresses differing only in a
+	 * few bits still spread over all slots.
+	 */
+	uint32_t hash = sys_get_le32(&addr->a.val[0]) ^
+			((uint32_t)sys_get_le16(&addr->a.val[4]) << 13) ^
+			addr->type;
+
+	hash *= 0x9e3779b1;
+
+	return (hash >> 16) & (set->slot_cnt - 1);
+}
+
+/* Returns the array index of the address, or a negative value if not found. */
+static int addr_set_find(const struct addr_set *set, const bt_addr_le_t *addr)
+{
+	uint16_t mask = set->slot_cnt - 1;
+
+	for (uint16_t i = addr_set_home(set, addr); set->slots[i] != 0; i = (i + 1) & mask) {
+		uint16_t idx = set->slots[i] - 1;
+
+		if (bt_addr_le_eq(addr_set_addr_get(set, idx), addr)) {
+			return idx;
+		}
+	}
+
+	return -ENOENT;
+}
+
+/* Indexes the address already stored at the given array index. */
+static void addr_set_insert(const struct addr_set *set, uint16_t idx)
+{
+	uint16_t mask = set->slot_cnt - 1;
+	uint16_t i = addr_set_home(set, addr_set_addr_get(set, idx));
+
+	/* The slot count is twice the array size, so there is always a free slot. */
+	while (set->slots[i] != 0) {
+		i = (i + 1) & mask;
+	}
+
+	set->slots[i] = idx + 1;
+}
+
+/* Removes the array index from the set before the address at this index is overwritten. */
+static void addr_set_remove(const struct addr_set *set, uint16_t idx)
+{
+	uint16_t mask = set->slot_cnt - 1;
+	uint16_t i = addr_set_home(set, addr_set_addr_get(set, idx));
+
+	while (set->slots[i] != idx + 1) {
+		if (set->slots[i] == 0) {
+			return;
+		}
+
+		i = (i + 1) & mask;
+	}
+
+	/* Shift the following entries of the probe sequence back so that
+	 * lookups never stop at the freed slot before reaching them.
+	 */
+	for (uint16_t j = (i + 1) & mask; set->slots[j] != 0; j = (j + 1) & mask) {
+		uint16_t home = addr_set_home(set, addr_set_addr_get(set, set->slots[j] - 1));
+
+		if (((j - home) & mask) >= ((j - i) & mask)) {
+			set->slots[i] = set->slots[j];
+			i = j;
+		}
+	}
+
+	set->slots[i] = 0;
+}
+
+static void addr_set_clear(const struct addr_set *set)
+{
+	memset(set->slots, 0, set->slot_cnt * sizeof(set->slots[0]));
+}
+
 static sys_slist_t callback_list;
 
 void bt_scan_cb_register(struct bt_scan_cb *cb)
@@ -341,23 +537,10 @@ static void notify_connecting_error(struct bt_scan_device_info *device_info)
 #endif /* CONFIG_BT_CENTRAL */
 
 #if CONFIG_BT_SCAN_BLOCKLIST
+/* Must be called with the scan_mutex locked. */
 static bool blocklist_device_check(const bt_addr_le_t *addr)
 {
-	bool blocklist_device = false;
-
-	k_mutex_lock(&scan_mutex, K_FOREVER);
-
-	for (size_t i = 0; i < bt_scan.blocklist.count; i++) {
-		if (bt_addr_le_cmp(&bt_scan.blocklist.addr[i], addr) == 0) {
-			blocklist_device = true;
-
-			break;
-		}
-	}
-
-	k_mutex_unlock(&scan_mutex);
-
-	return blocklist_device;
+	return addr_set_find(&blocklist_set, addr) >= 0;
 }
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
@@ -366,8 +549,10 @@ static void attempts_filter_force_add(struct conn_attempts_filter *filter,
 				      const bt_addr_le_t *addr)
 {
 	/* Overwrite the oldest device */
+	addr_set_remove(&attempts_filter_set, filter->oldest_idx);
 	filter->device[filter->oldest_idx].attempts = 0;
 	bt_addr_le_copy(&filter->device[filter->oldest_idx].addr, addr);
+	addr_set_insert(&attempts_filter_set, filter->oldest_idx);
 
 	if (filter->oldest_idx == (ARRAY_SIZE(filter->device) - 1)) {
 		filter->oldest_idx = 0;
@@ -381,28 +566,22 @@ static void attempts_filter_force_add(struct conn_attempts_filter *filter,
 static void scan_attempts_filter_device_add(const bt_addr_le_t *addr)
 {
 	struct conn_attempts_filter *filter = &bt_scan.attempts_filter;
-	char addr_str[BT_ADDR_LE_STR_LEN];
-
-	bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
 
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
 	/* Check if device is already in the filter array. */
-	for (size_t i = 0; i < filter->count; i++) {
-		struct conn_attempts_device *device = &filter->device[i];
-
-		if (bt_addr_le_cmp(addr, &device->addr) == 0) {
-			LOG_DBG("Device %s is already in the filter array",
-				addr_str);
-			goto out;
-		}
+	if (addr_set_find(&attempts_filter_set, addr) >= 0) {
+		LOG_DBG("Device %s is already in the filter array",
+			bt_addr_le_str(addr));
+		goto out;
 	}
 
 	if (filter->count >= ARRAY_SIZE(filter->device)) {
-		LOG_DBG("Force adding %s device filter", addr_str);
+		LOG_DBG("Force adding %s device filter", bt_addr_le_str(addr));
 		attempts_filter_force_add(filter, addr);
 	} else {
 		bt_addr_le_copy(&filter->device[filter->count].addr, addr);
+		addr_set_insert(&attempts_filter_set, filter->count);
 		filter->count++;
 	}
 
@@ -414,71 +593,67 @@ static void device_conn_attempts_count(struct bt_conn *conn)
 {
 	const bt_addr_le_t *addr = bt_conn_get_dst(conn);
 	struct conn_attempts_filter *filter = &bt_scan.attempts_filter;
+	int idx;
 
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
-	for (size_t i = 0; i < filter->count; i++) {
-		struct conn_attempts_device *device = &filter->device[i];
-
-		if (bt_addr_le_cmp(addr, &device->addr) == 0) {
-			if (device->attempts < CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT) {
-				device->attempts++;
-			}
-
-			break;
-		}
+	idx = addr_set_find(&attempts_filter_set, addr);
+	if ((idx >= 0) &&
+	    (filter->device[idx].attempts < CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT)) {
+		filter->device[idx].attempts++;
 	}
 
 	k_mutex_unlock(&scan_mutex);
 }
 
+/* Must be called with the scan_mutex locked. */
 static bool conn_attempts_exceeded(const bt_addr_le_t *addr)
 {
 	struct conn_attempts_filter *filter = &bt_scan.attempts_filter;
-	char addr_str[BT_ADDR_LE_STR_LEN];
-	bool attempts_exceeded = false;
-
-	bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
-
-	k_mutex_lock(&scan_mutex, K_FOREVER);
+	int idx;
 
 	/* Check if the device is in the filter array. */
-	for (size_t i = 0; i < filter->count; i++) {
-		struct conn_attempts_device *device = &filter->device[i];
-
-		if (bt_addr_le_cmp(addr, &device->addr) == 0) {
-			if (device->attempts >= CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT) {
-				LOG_DBG("Connection attempts count for %s exceeded",
-					addr_str);
-				attempts_exceeded = true;
-			}
-
-			break;
-		}
+	idx = addr_set_find(&attempts_filter_set, addr);
+	if ((idx < 0) ||
+	    (filter->device[idx].attempts < CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT)) {
+		return false;
 	}
 
-	k_mutex_unlock(&scan_mutex);
+	/* The address is only formatted if the message is logged. */
+	LOG_DBG("Connection attempts count for %s exceeded", bt_addr_le_str(addr));
 
-	return attempts_exceeded;
+	return true;
 }
 
 #endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
 
 static bool scan_device_filter_check(const bt_addr_le_t *addr)
 {
+	bool allowed = true;
+
+	if (!IS_ENABLED(CONFIG_BT_SCAN_BLOCKLIST) &&
+	    !IS_ENABLED(CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER)) {
+		return true;
+	}
+
+	/* Both lists are checked under a single lock. */
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+
 #if CONFIG_BT_SCAN_BLOCKLIST
 	if (blocklist_device_check(addr)) {
-		return false;
+		allowed = false;
 	}
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
 #if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
-	if (conn_attempts_exceeded(addr)) {
-		return false;
+	if (allowed && conn_attempts_exceeded(addr)) {
+		allowed = false;
 	}
 #endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
 
-	return true;
+	k_mutex_unlock(&scan_mutex);
+
+	return allowed;
 }
 
 #if CONFIG_BT_CENTRAL
@@ -522,19 +697,15 @@ static void scan_connect_with_target(struct bt_scan_control *control,
 static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 			     struct bt_scan_control *control)
 {
-	const bt_addr_le_t *addr =
-			bt_scan.scan_filters.addr.target_addr;
-	uint8_t counter = bt_scan.scan_filters.addr.cnt;
-
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr[i]) == 0) {
-			control->filter_status.addr.addr = &addr[i];
+	int idx = addr_set_find(&addr_filter_set, target_addr);
 
-			return true;
-		}
+	if (idx < 0) {
+		return false;
 	}
 
-	return false;
+	control->filter_status.addr.addr = &bt_scan.scan_filters.addr.target_addr[idx];
+
+	return true;
 }
 
 static bool is_addr_filter_enabled(void)
@@ -558,7 +729,6 @@ static void check_addr(struct bt_scan_control *control,
 
 static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 {
-	char addr[BT_ADDR_LE_STR_LEN];
 	bt_addr_le_t *addr_filter =
 			bt_scan.scan_filters.addr.target_addr;
 	uint8_t counter = bt_scan.scan_filters.addr.cnt;
@@ -569,21 +739,18 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	}
 
 	/* Check for duplicated filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr_filter[i]) == 0) {
-			return 0;
-		}
+	if (addr_set_find(&addr_filter_set, target_addr) >= 0) {
+		return 0;
 	}
 
 	/* Add target address to filter. */
 	bt_addr_le_copy(&addr_filter[counter], target_addr);
+	addr_set_insert(&addr_filter_set, counter);
 
 	LOG_DBG("Filter set on address type %i",
 		addr_filter[counter].type);
 
-	bt_addr_le_to_str(target_addr, addr, sizeof(addr));
-
-	LOG_DBG("Address: %s", addr);
+	LOG_DBG("Address: %s", bt_addr_le_str(target_addr));
 
 	/* Increase the address filter counter. */
 	bt_scan.scan_filters.addr.cnt++;
@@ -598,29 +765,140 @@ static bool adv_name_cmp(const uint8_t *data,
 	return strncmp(target_name, data, data_len) == 0;
 }
 
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+/* Sorted index over the target names of a name filter. An advertised
+ * name matches the targets it is a prefix of, and all such targets are
+ * next to each other in the sorted order.
+ */
+struct name_index {
+	/* First target name. */
+	const char *names;
+
+	/* Distance in bytes between two consecutive target names. */
+	size_t stride;
+
+	/* Maximum length of a target name. */
+	size_t max_len;
+
+	/* Filter indexes sorted by the target name. */
+	uint8_t *sorted;
+};
+
+static const struct name_index name_filter_index = {
+	.names = bt_scan.scan_filters.name.target_name[0],
+	.stride = sizeof(bt_scan.scan_filters.name.target_name[0]),
+	.max_len = CONFIG_BT_SCAN_NAME_MAX_LEN,
+	.sorted = bt_scan.scan_filters.name.sorted,
+};
+
+static const struct name_index short_name_filter_index = {
+	.names = bt_scan.scan_filters.short_name.name[0].target_name,
+	.stride = sizeof(bt_scan.scan_filters.short_name.name[0]),
+	.max_len = CONFIG_BT_SCAN_SHORT_NAME_MAX_LEN,
+	.sorted = bt_scan.scan_filters.short_name.sorted,
+};
+
+static const char *name_index_name_get(const struct name_index *index, uint8_t idx)
+{
+	return index->names + idx * index->stride;
+}
+
+/* Sorts in the filter at the given index, all the filters before it are already sorted. */
+static void name_index_insert(const struct name_index *index, uint8_t idx)
+{
+	const char *name = name_index_name_get(index, idx);
+	uint8_t pos = idx;
+
+	while ((pos > 0) &&
+	       (strncmp(name_index_name_get(index, index->sorted[pos - 1]), name,
+			index->max_len) > 0)) {
+		index->sorted[pos] = index->sorted[pos - 1];
+		pos--;
+	}
+
+	index->sorted[pos] = idx;
+}
+
+/* Returns the sorted position of the first target name that does not
+ * precede the advertised name in its first data_len characters.
+ */
+static uint8_t name_index_lower_bound(const struct name_index *index, uint8_t cnt,
+				      const uint8_t *data, uint8_t data_len)
+{
+	uint8_t low = 0;
+	uint8_t high = cnt;
+
+	while (low < high) {
+		uint8_t mid = low + (high - low) / 2;
+		const char *name = name_index_name_get(index, index->sorted[mid]);
+
+		if (strncmp(name, data, data_len) < 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+static int adv_name_find(const uint8_t *data, uint8_t data_len)
+{
+	const struct bt_scan_name_filter *name_filter =
+			&bt_scan.scan_filters.name;
+	int found = -ENOENT;
+
+	/* Report the first added filter among all the matching ones. */
+	for (uint8_t pos = name_index_lower_bound(&name_filter_index, name_filter->cnt,
+						  data, data_len);
+	     pos < name_filter->cnt; pos++) {
+		uint8_t idx = name_filter->sorted[pos];
+
+		if (!adv_name_cmp(data, data_len, name_filter->target_name[idx])) {
+			break;
+		}
+
+		if ((found < 0) || (idx < found)) {
+			found = idx;
+		}
+	}
+
+	return found;
+}
+#else
+static int adv_name_find(const uint8_t *data, uint8_t data_len)
+{
+	const struct bt_scan_name_filter *name_filter =
+			&bt_scan.scan_filters.name;
+
+	for (size_t i = 0; i < name_filter->cnt; i++) {
+		if (adv_name_cmp(data, data_len, name_filter->target_name[i])) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
+
 static bool adv_name_compare(const struct bt_data *data,
 			     struct bt_scan_control *control)
 {
 	struct bt_scan_name_filter const *name_filter =
 			&bt_scan.scan_filters.name;
-	uint8_t counter = bt_scan.scan_filters.name.cnt;
 	uint8_t data_len = data->data_len;
+	int idx;
 
 	/* Compare the name found with the name filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (adv_name_cmp(data->data,
-				 data_len,
-				 name_filter->target_name[i])) {
-
-			control->filter_status.name.name =
-				name_filter->target_name[i];
-			control->filter_status.name.len = data_len;
-
-			return true;
-		}
+	idx = adv_name_find(data->data, data_len);
+	if (idx < 0) {
+		return false;
 	}
 
-	return false;
+	control->filter_status.name.name = name_filter->target_name[idx];
+	control->filter_status.name.len = data_len;
+
+	return true;
 }
 
 static inline bool is_name_filter_enabled(void)
@@ -666,10 +944,18 @@ static int scan_name_filter_add(const char *name)
 		}
 	}
 
-	/* Add name to filter. */
+	/* Add name to filter. Clear the slot first, as it may hold a longer
+	 * name of a removed filter.
+	 */
+	memset(bt_scan.scan_filters.name.target_name[counter], 0,
+	       sizeof(bt_scan.scan_filters.name.target_name[counter]));
 	memcpy(bt_scan.scan_filters.name.target_name[counter],
 	       name, name_len);
 
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+	name_index_insert(&name_filter_index, counter);
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
+
 	bt_scan.scan_filters.name.cnt++;
 
 	LOG_DBG("Adding filter on %s name", name);
@@ -690,30 +976,68 @@ static bool adv_short_name_cmp(const uint8_t *data,
 	return false;
 }
 
-static bool adv_short_name_compare(const struct bt_data *data,
-				   struct bt_scan_control *control)
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+static int adv_short_name_find(const uint8_t *data, uint8_t data_len)
 {
 	const struct bt_scan_short_name_filter *name_filter =
 			&bt_scan.scan_filters.short_name;
-	uint8_t counter = bt_scan.scan_filters.short_name.cnt;
-	uint8_t data_len = data->data_len;
+	int found = -ENOENT;
 
-	/* Compare the name found with the name filters. */
-	for (size_t i = 0; i < counter; i++) {
-		if (adv_short_name_cmp(data->data,
+	/* Report the first added filter among all the matching ones. */
+	for (uint8_t pos = name_index_lower_bound(&short_name_filter_index, name_filter->cnt,
+						  data, data_len);
+	     pos < name_filter->cnt; pos++) {
+		uint8_t idx = name_filter->sorted[pos];
+
+		if (strncmp(name_filter->name[idx].target_name, data, data_len) != 0) {
+			break;
+		}
+
+		if ((data_len >= name_filter->name[idx].min_len) &&
+		    ((found < 0) || (idx < found))) {
+			found = idx;
+		}
+	}
+
+	return found;
+}
+#else
+static int adv_short_name_find(const uint8_t *data, uint8_t data_len)
+{
+	const struct bt_scan_short_name_filter *name_filter =
+			&bt_scan.scan_filters.short_name;
+
+	for (size_t i = 0; i < name_filter->cnt; i++) {
+		if (adv_short_name_cmp(data,
 				       data_len,
 				       name_filter->name[i].target_name,
 				       name_filter->name[i].min_len)) {
+			return i;
+		}
+	}
 
-			control->filter_status.short_name.name =
-				name_filter->name[i].target_name;
-			control->filter_status.short_name.len = data_len;
+	return -ENOENT;
+}
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
 
-			return true;
-		}
+static bool adv_short_name_compare(const struct bt_data *data,
+				   struct bt_scan_control *control)
+{
+	const struct bt_scan_short_name_filter *name_filter =
+			&bt_scan.scan_filters.short_name;
+	uint8_t data_len = data->data_len;
+	int idx;
+
+	/* Compare the name found with the name filters. */
+	idx = adv_short_name_find(data->data, data_len);
+	if (idx < 0) {
+		return false;
 	}
 
-	return false;
+	control->filter_status.short_name.name = name_filter->name[idx].target_name;
+	control->filter_status.short_name.len = data_len;
+
+	return true;
 }
 
 static inline bool is_short_name_filter_enabled(void)
@@ -764,12 +1088,20 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 		}
 	}
 
-	/* Add name to the filter. */
+	/* Add name to the filter. Clear the slot first, as it may hold
+	 * a longer name of a removed filter.
+	 */
 	short_name_filter->name[counter].min_len = short_name->min_len;
+	memset(short_name_filter->name[counter].target_name, 0,
+	       sizeof(short_name_filter->name[counter].target_name));
 	memcpy(short_name_filter->name[counter].target_name,
 	       short_name->name,
 	       name_len);
 
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+	name_index_insert(&short_name_filter_index, counter);
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
+
 	bt_scan.scan_filters.short_name.cnt++;
 
 	LOG_DBG("Adding filter on %s name", short_name->name);
@@ -777,27 +1109,157 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 	return 0;
 }
 
-static bool find_uuid(const uint8_t *data,
-		      uint8_t data_len,
-		      uint8_t uuid_type,
-		      const struct bt_scan_uuid *target_uuid)
+static uint8_t uuid_len_get(uint8_t uuid_type)
 {
-	uint8_t uuid_len;
-
 	switch (uuid_type) {
 	case BT_UUID_TYPE_16:
-		uuid_len = sizeof(uint16_t);
-		break;
+		return sizeof(uint16_t);
 
 	case BT_UUID_TYPE_32:
-		uuid_len = sizeof(uint32_t);
-		break;
+		return sizeof(uint32_t);
 
 	case BT_UUID_TYPE_128:
-		uuid_len = BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
-		break;
+		return BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
 
 	default:
+		return 0;
+	}
+}
+
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+/* Converts a little-endian UUID of the given type to the 128-bit form,
+ * so that UUIDs of different types compare the same way as with bt_uuid_cmp().
+ */
+static void uuid_key_get(uint8_t uuid_type, const uint8_t *data,
+			 uint8_t key[BT_SCAN_UUID_128_SIZE])
+{
+	/* Bluetooth Base UUID in little-endian order. */
+	static const uint8_t base_uuid[BT_SCAN_UUID_128_SIZE] = {
+		0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00, 0x00, 0x80,
+		0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	};
+	/* Offset of the 16-bit and 32-bit UUID values in the Base UUID. */
+	const size_t offset = 12;
+
+	if (uuid_type == BT_UUID_TYPE_128) {
+		memcpy(key, data, BT_SCAN_UUID_128_SIZE);
+		return;
+	}
+
+	memcpy(key, base_uuid, BT_SCAN_UUID_128_SIZE);
+	memcpy(&key[offset], data, uuid_len_get(uuid_type));
+}
+
+static uint8_t uuid_hash_home(const uint8_t key[BT_SCAN_UUID_128_SIZE])
+{
+	uint32_t hash = sys_get_le32(&key[0]) ^ sys_get_le32(&key[4]) ^
+			sys_get_le32(&key[8]) ^ sys_get_le32(&key[12]);
+
+	hash *= 0x9e3779b1;
+
+	return (hash >> 16) & (ARRAY_SIZE(bt_scan.scan_filters.uuid.hash) - 1);
+}
+
+static int uuid_hash_find(const uint8_t key[BT_SCAN_UUID_128_SIZE])
+{
+	const struct bt_scan_uuid_filter *uuid_filter = &bt_scan.scan_filters.uuid;
+	uint8_t mask = ARRAY_SIZE(uuid_filter->hash) - 1;
+
+	for (uint8_t i = uuid_hash_home(key); uuid_filter->hash[i] != 0; i = (i + 1) & mask) {
+		uint8_t idx = uuid_filter->hash[i] - 1;
+
+		if (memcmp(uuid_filter->key[idx], key, BT_SCAN_UUID_128_SIZE) == 0) {
+			return idx;
+		}
+	}
+
+	return -ENOENT;
+}
+
+static void uuid_hash_insert(uint8_t idx)
+{
+	struct bt_scan_uuid_filter *uuid_filter = &bt_scan.scan_filters.uuid;
+	uint8_t mask = ARRAY_SIZE(uuid_filter->hash) - 1;
+	uint8_t i = uuid_hash_home(uuid_filter->key[idx]);
+
+	/* The slot count is twice the filter count, so there is always a free slot. */
+	while (uuid_filter->hash[i] != 0) {
+		i = (i + 1) & mask;
+	}
+
+	uuid_filter->hash[i] = idx + 1;
+}
+
+static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
+			     struct bt_scan_control *control)
+{
+	const struct bt_scan_uuid_filter *uuid_filter =
+			&bt_scan.scan_filters.uuid;
+	const bool all_filters_mode = bt_scan.scan_filters.all_mode;
+	const uint8_t counter = bt_scan.scan_filters.uuid.cnt;
+	uint8_t uuid_len = uuid_len_get(uuid_type);
+	bool found[CONFIG_BT_SCAN_UUID_CNT];
+	uint8_t uuid_match_cnt = 0;
+
+	if (uuid_len == 0) {
+		return false;
+	}
+
+	memset(found, 0, sizeof(found));
+
+	/* Look up every advertised UUID once, regardless of the filter count. */
+	for (size_t i = 0; i + uuid_len <= data->data_len; i += uuid_len) {
+		uint8_t key[BT_SCAN_UUID_128_SIZE];
+		int idx;
+
+		uuid_key_get(uuid_type, &data->data[i], key);
+
+		idx = uuid_hash_find(key);
+		if (idx >= 0) {
+			found[idx] = true;
+		}
+	}
+
+	/* Report the matches in the filter order. In the multifilter mode,
+	 * stop at the first UUID that is not advertised. Otherwise, only
+	 * one UUID is needed to match.
+	 */
+	for (size_t i = 0; i < counter; i++) {
+		if (found[i]) {
+			control->filter_status.uuid.uuid[uuid_match_cnt] =
+				uuid_filter->uuid[i].uuid;
+
+			uuid_match_cnt++;
+
+			if (!all_filters_mode) {
+				break;
+			}
+		} else if (all_filters_mode) {
+			break;
+		}
+	}
+
+	control->filter_status.uuid.count = uuid_match_cnt;
+
+	/* In the multifilter mode, all UUIDs must be found in
+	 * the advertisement packets.
+	 */
+	if ((all_filters_mode && (uuid_match_cnt == counter)) ||
+	    ((!all_filters_mode) && (uuid_match_cnt > 0))) {
+		return true;
+	}
+
+	return false;
+}
+#else
+static bool find_uuid(const uint8_t *data,
+		      uint8_t data_len,
+		      uint8_t uuid_type,
+		      const struct bt_scan_uuid *target_uuid)
+{
+	uint8_t uuid_len = uuid_len_get(uuid_type);
+
+	if (uuid_len == 0) {
 		return false;
 	}
 
@@ -859,6 +1321,7 @@ static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 
 	return false;
 }
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
 
 static bool is_uuid_filter_enabled(void)
 {
@@ -930,6 +1393,27 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		return -EINVAL;
 	}
 
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+	uint8_t uuid_le[BT_SCAN_UUID_128_SIZE];
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		sys_put_le16(BT_UUID_16(uuid)->val, uuid_le);
+		break;
+
+	case BT_UUID_TYPE_32:
+		sys_put_le32(BT_UUID_32(uuid)->val, uuid_le);
+		break;
+
+	default:
+		memcpy(uuid_le, BT_UUID_128(uuid)->val, sizeof(uuid_le));
+		break;
+	}
+
+	uuid_key_get(uuid->type, uuid_le, bt_scan.scan_filters.uuid.key[counter]);
+	uuid_hash_insert(counter);
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
+
 	bt_scan.scan_filters.uuid.cnt++;
 	LOG_DBG("Added filter on UUID type %x", uuid->type);
 
@@ -1042,30 +1526,135 @@ static bool adv_manufacturer_data_cmp(const uint8_t *data,
 	return true;
 }
 
-static bool adv_manufacturer_data_compare(const struct bt_data *data,
-					  struct bt_scan_control *control)
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+static int manufacturer_data_order(uint8_t a, uint8_t b)
 {
 	const struct bt_scan_manufacturer_data_filter *md_filter =
 		&bt_scan.scan_filters.manufacturer_data;
-	uint8_t counter = bt_scan.scan_filters.manufacturer_data.cnt;
+	uint8_t a_len = md_filter->manufacturer_data[a].data_len;
+	uint8_t b_len = md_filter->manufacturer_data[b].data_len;
 
-	/* Compare the name found with the name filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (adv_manufacturer_data_cmp(data->data,
-				data->data_len,
+	if (a_len != b_len) {
+		return a_len - b_len;
+	}
+
+	return memcmp(md_filter->manufacturer_data[a].data,
+		      md_filter->manufacturer_data[b].data, a_len);
+}
+
+/* Rebuilds the prefix table: the filters sorted by the data length and
+ * then by the data, split into runs of the same length.
+ */
+static void manufacturer_data_compile(void)
+{
+	struct bt_scan_manufacturer_data_filter *md_filter =
+		&bt_scan.scan_filters.manufacturer_data;
+
+	for (uint8_t i = 0; i < md_filter->cnt; i++) {
+		uint8_t pos = i;
+
+		while ((pos > 0) && (manufacturer_data_order(md_filter->sorted[pos - 1], i) > 0)) {
+			md_filter->sorted[pos] = md_filter->sorted[pos - 1];
+			pos--;
+		}
+
+		md_filter->sorted[pos] = i;
+	}
+
+	md_filter->group_cnt = 0;
+
+	for (uint8_t i = 0; i < md_filter->cnt; i++) {
+		uint8_t len = md_filter->manufacturer_data[md_filter->sorted[i]].data_len;
+
+		if ((md_filter->group_cnt == 0) ||
+		    (md_filter->group[md_filter->group_cnt - 1].len != len)) {
+			md_filter->group[md_filter->group_cnt].len = len;
+			md_filter->group[md_filter->group_cnt].start = i;
+			md_filter->group[md_filter->group_cnt].cnt = 0;
+			md_filter->group_cnt++;
+		}
+
+		md_filter->group[md_filter->group_cnt - 1].cnt++;
+	}
+}
+
+static int adv_manufacturer_data_find(const uint8_t *data, uint8_t data_len)
+{
+	const struct bt_scan_manufacturer_data_filter *md_filter =
+		&bt_scan.scan_filters.manufacturer_data;
+	int found = -ENOENT;
+
+	/* Look up the advertised data prefix of every filter length with
+	 * a binary search. Report the first added filter among the matching ones.
+	 */
+	for (uint8_t g = 0; g < md_filter->group_cnt; g++) {
+		uint8_t len = md_filter->group[g].len;
+		uint8_t low = md_filter->group[g].start;
+		uint8_t high = low + md_filter->group[g].cnt;
+
+		if (len > data_len) {
+			break;
+		}
+
+		while (low < high) {
+			uint8_t mid = low + (high - low) / 2;
+			uint8_t idx = md_filter->sorted[mid];
+			int cmp = memcmp(md_filter->manufacturer_data[idx].data, data, len);
+
+			if (cmp == 0) {
+				if ((found < 0) || (idx < found)) {
+					found = idx;
+				}
+
+				break;
+			} else if (cmp < 0) {
+				low = mid + 1;
+			} else {
+				high = mid;
+			}
+		}
+	}
+
+	return found;
+}
+#else
+static int adv_manufacturer_data_find(const uint8_t *data, uint8_t data_len)
+{
+	const struct bt_scan_manufacturer_data_filter *md_filter =
+		&bt_scan.scan_filters.manufacturer_data;
+
+	for (size_t i = 0; i < md_filter->cnt; i++) {
+		if (adv_manufacturer_data_cmp(data,
+				data_len,
 				md_filter->manufacturer_data[i].data,
 				md_filter->manufacturer_data[i].data_len)) {
+			return i;
+		}
+	}
 
-			control->filter_status.manufacturer_data.data =
-				md_filter->manufacturer_data[i].data;
-			control->filter_status.manufacturer_data.len =
-				md_filter->manufacturer_data[i].data_len;
+	return -ENOENT;
+}
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
 
-			return true;
-		}
+static bool adv_manufacturer_data_compare(const struct bt_data *data,
+					  struct bt_scan_control *control)
+{
+	const struct bt_scan_manufacturer_data_filter *md_filter =
+		&bt_scan.scan_filters.manufacturer_data;
+	int idx;
+
+	/* Compare the data found with the manufacturer data filter. */
+	idx = adv_manufacturer_data_find(data->data, data->data_len);
+	if (idx < 0) {
+		return false;
 	}
 
-	return false;
+	control->filter_status.manufacturer_data.data =
+		md_filter->manufacturer_data[idx].data;
+	control->filter_status.manufacturer_data.len =
+		md_filter->manufacturer_data[idx].data_len;
+
+	return true;
 }
 static inline bool is_manufacturer_data_filter_enabled(void)
 {
@@ -1123,6 +1712,10 @@ static int scan_manufacturer_data_filter_add(const struct bt_scan_manufacturer_d
 
 	bt_scan.scan_filters.manufacturer_data.cnt++;
 
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+	manufacturer_data_compile();
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
+
 	LOG_DBG("Adding filter on manufacturer data");
 
 	return 0;
@@ -1242,10 +1835,14 @@ void bt_scan_filter_remove_all(void)
 	struct bt_scan_addr_filter *addr_filter =
 			&bt_scan.scan_filters.addr;
 	addr_filter->cnt = 0;
+	addr_set_clear(&addr_filter_set);
 
 	struct bt_scan_uuid_filter *uuid_filter =
 			&bt_scan.scan_filters.uuid;
 	uuid_filter->cnt = 0;
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+	memset(uuid_filter->hash, 0, sizeof(uuid_filter->hash));
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
 
 	struct bt_scan_appearance_filter *appearance_filter =
 			&bt_scan.scan_filters.appearance;
@@ -1254,6 +1851,9 @@ void bt_scan_filter_remove_all(void)
 	struct bt_scan_manufacturer_data_filter *manufacturer_data_filter =
 		&bt_scan.scan_filters.manufacturer_data;
 	manufacturer_data_filter->cnt = 0;
+#if CONFIG_BT_SCAN_FILTER_COMPILED
+	manufacturer_data_filter->group_cnt = 0;
+#endif /* CONFIG_BT_SCAN_FILTER_COMPILED */
 
 	k_mutex_unlock(&scan_mutex);
 }
@@ -1507,7 +2107,19 @@ static void filter_state_check(struct bt_scan_control *control,
 
 static void connectable_cache_add(const bt_addr_le_t *addr)
 {
+	/* Keep a single entry per advertiser, so that devices advertising at a
+	 * high rate do not evict the others from the cache.
+	 */
+	if (addr_set_find(&connectable_cache_set, addr) >= 0) {
+		return;
+	}
+
+	if (bt_scan.connectable_cache_count == CONFIG_BT_SCAN_CONNECTABLE_CACHE_SIZE) {
+		addr_set_remove(&connectable_cache_set, bt_scan.connectable_cache_idx);
+	}
+
 	bt_addr_le_copy(&bt_scan.connectable_cache[bt_scan.connectable_cache_idx], addr);
+	addr_set_insert(&connectable_cache_set, bt_scan.connectable_cache_idx);
 	bt_scan.connectable_cache_idx =
 		(bt_scan.connectable_cache_idx + 1) % CONFIG_BT_SCAN_CONNECTABLE_CACHE_SIZE;
 	if (bt_scan.connectable_cache_count < CONFIG_BT_SCAN_CONNECTABLE_CACHE_SIZE) {
@@ -1517,12 +2129,7 @@ static void connectable_cache_add(const bt_addr_le_t *addr)
 
 static bool connectable_cache_contains(const bt_addr_le_t *addr)
 {
-	for (size_t i = 0; i < bt_scan.connectable_cache_count; i++) {
-		if (bt_addr_le_cmp(&bt_scan.connectable_cache[i], addr) == 0) {
-			return true;
-		}
-	}
-	return false;
+	return addr_set_find(&connectable_cache_set, addr) >= 0;
 }
 
 static void scan_recv(const struct bt_le_scan_recv_info *info,
@@ -1622,24 +2229,19 @@ int bt_scan_params_set(struct bt_le_scan_param *scan_param)
 int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 {
 	int err = 0;
-	char addr_str[BT_ADDR_LE_STR_LEN];
 
 	if (!addr) {
 		return -EINVAL;
 	}
 
-	bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
-
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
 	/* Check if the device is already on the blocklist. */
-	for (size_t i = 0; i < ARRAY_SIZE(bt_scan.blocklist.addr); i++) {
-		if (bt_addr_le_cmp(&bt_scan.blocklist.addr[i], addr) == 0) {
-			LOG_DBG("Device %s is already on the blocklist",
-				addr_str);
+	if (blocklist_device_check(addr)) {
+		LOG_DBG("Device %s is already on the blocklist",
+			bt_addr_le_str(addr));
 
-			goto out;
-		}
+		goto out;
 	}
 
 	if (bt_scan.blocklist.count >= ARRAY_SIZE(bt_scan.blocklist.addr)) {
@@ -1648,8 +2250,9 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 	} else {
 		bt_addr_le_copy(&bt_scan.blocklist.addr[bt_scan.blocklist.count],
 				addr);
+		addr_set_insert(&blocklist_set, bt_scan.blocklist.count);
 		bt_scan.blocklist.count++;
-		LOG_INF("Device %s added to the scanning blocklist", addr_str);
+		LOG_INF("Device %s added to the scanning blocklist", bt_addr_le_str(addr));
 	}
 
 out:
@@ -145,6 +145,13 @@ bool bl_validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address)
 #include <zephyr/toolchain.h>
 #include <bl_crypto.h>
 #include "bl_validation_internal.h"
+#ifdef CONFIG_SB_VALIDATION_FINGERPRINT
+#include "bl_validation_fingerprint.h"
+#endif
+#ifdef CONFIG_SB_VALIDATION_HASH_STREAM
+#include <ocrypto_constant_time.h>
+#include "bl_validation_stream.h"
+#endif
 
 /* We keep the S0/S1 nomenclature, regardless of core, but partition S0/S1
  * targets differs. Below configuration, currently, addresses nRF5340
@@ -392,8 +399,18 @@ static bool validate_hash(const uint32_t fw_src_address, const uint32_t fw_size,
 		return false;
 	}
 
+#ifdef CONFIG_SB_VALIDATION_HASH_STREAM
+	uint8_t hash[CONFIG_SB_HASH_LEN];
+
+	retval = bl_validation_hash_stream(fw_src_address, fw_size, hash);
+	if (retval == 0 && !ocrypto_constant_time_equal(hash, fw_val_info->hash,
+							 CONFIG_SB_HASH_LEN)) {
+		retval = -EHASHINV;
+	}
+#else
 	retval = bl_sha256_verify((const uint8_t *)fw_src_address, fw_size,
 			fw_val_info->hash);
+#endif
 
 	if (retval != 0) {
 		if (!external) {
@@ -412,6 +429,50 @@ static bool validate_hash(const uint32_t fw_src_address, const uint32_t fw_size,
 #endif
 
 
+static bool validate_contents(uint32_t fw_src_address, const struct fw_info *fwinfo,
+			      const struct fw_validation_info *fw_val_info, bool external)
+{
+#if defined(CONFIG_SB_VALIDATE_FW_SIGNATURE)
+#if defined(CONFIG_SB_LCS_AWARE)
+	if (nrf_lcs_get() == NRF_LCS_ASSEMBLY_AND_TEST) {
+		LOG_WRN("Device is in ASSEMBLY_AND_TEST, skipping signature validation.");
+#ifdef SB_VALIDATION_STRUCT_HAS_HASH
+		return validate_hash(fw_src_address, fwinfo->size, fw_val_info,
+					external);
+#else
+		LOG_ERR("Hash unavailable. Accepting firmware without validation.");
+		return true;
+#endif /* SB_VALIDATION_STRUCT_HAS_HASH */
+	}
+#endif
+	return validate_signature(fw_src_address, fwinfo->size, fw_val_info,
+				external);
+#elif defined(CONFIG_SB_VALIDATE_FW_HASH)
+	return validate_hash(fw_src_address, fwinfo->size, fw_val_info,
+				external);
+#else
+	#error "Validation not specified."
+#endif
+}
+
+#if defined(CONFIG_SB_VALIDATION_FINGERPRINT)
+/* The fingerprint is only used for the bootloader's own validation, and not
+ * when the lifecycle state lets firmware boot without signature validation.
+ */
+static bool fingerprint_allowed(bool external)
+{
+	if (external) {
+		return false;
+	}
+#if defined(CONFIG_SB_LCS_AWARE)
+	if (nrf_lcs_get() == NRF_LCS_ASSEMBLY_AND_TEST) {
+		return false;
+	}
+#endif
+	return true;
+}
+#endif
+
 static bool validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address,
 			      const struct fw_info *fwinfo, bool external)
 {
@@ -469,12 +530,7 @@ static bool validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address,
 	}
 
 #ifdef CONFIG_SB_MONOTONIC_COUNTER_ROLLBACK_PROTECTION
-#if defined(CONFIG_NRFX_NVMC)
-	uint16_t stored_version;
-#elif defined(CONFIG_NRFX_RRAMC)
-	uint32_t stored_version;
-#endif
-
+	counter_t stored_version;
 	int err = get_monotonic_version(&stored_version);
 
 	if (err) {
@@ -550,27 +606,29 @@ static bool validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address,
 		return false;
 	}
 
-#if defined(CONFIG_SB_VALIDATE_FW_SIGNATURE)
-#if defined(CONFIG_SB_LCS_AWARE)
-	if (nrf_lcs_get() == NRF_LCS_ASSEMBLY_AND_TEST) {
-		LOG_WRN("Device is in ASSEMBLY_AND_TEST, skipping signature validation.");
-#ifdef SB_VALIDATION_STRUCT_HAS_HASH
-		return validate_hash(fw_src_address, fwinfo->size, fw_val_info,
-					external);
-#else
-		LOG_ERR("Hash unavailable. Accepting firmware without validation.");
+#if defined(CONFIG_SB_VALIDATION_FINGERPRINT)
+	if (fingerprint_allowed(external)) {
+		if (bl_validation_fingerprint_check(fwinfo, fw_val_info,
+						    sizeof(*fw_val_info))) {
+			LOG_INF("Firmware fingerprint matches, skipping full validation.");
+			return true;
+		}
+
+		if (!validate_contents(fw_src_address, fwinfo, fw_val_info, external)) {
+			return false;
+		}
+
+		int err = bl_validation_fingerprint_store(fwinfo, fw_val_info,
+							  sizeof(*fw_val_info));
+
+		if (err) {
+			LOG_WRN("Cannot store firmware fingerprint: %d", err);
+		}
 		return true;
-#endif /* SB_VALIDATION_STRUCT_HAS_HASH */
 	}
 #endif
-	return validate_signature(fw_src_address, fwinfo->size, fw_val_info,
-				external);
-#elif defined(CONFIG_SB_VALIDATE_FW_HASH)
-	return validate_hash(fw_src_address, fwinfo->size, fw_val_info,
-				external);
-#else
-	#error "Validation not specified."
-#endif
+
+	return validate_contents(fw_src_address, fwinfo, fw_val_info, external);
 }
 
 bool bl_validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address)
@@ -590,6 +648,14 @@ bool bl_validate_firmware_local(uint32_t fw_address, const struct fw_info *fwinf
 void bl_validate_housekeeping(void)
 {
 	bl_root_of_trust_housekeeping();
+
+#if defined(CONFIG_SB_VALIDATION_FINGERPRINT)
+	/* A writable fingerprint would let the firmware skip its own validation */
+	if (bl_validation_fingerprint_lock()) {
+		LOG_ERR("Failed to protect the firmware fingerprint.");
+		k_panic();
+	}
+#endif
 }
 #endif
 
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Fingerprints of validated firmware.
+ *
+ * The fingerprint partition is a log of fixed size records. A record is
+ * appended after every full validation, and the partition is erased when it
+ * is full. Only the last complete record is used, so a full validation of any
+ * firmware invalidates the fingerprints of all other firmware. The magic word
+ * is written last, so a record interrupted by a reset is never used.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stddef.h>
+#include <zephyr/types.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/storage/flash_map.h>
+#include <fw_info.h>
+#include <bl_crypto.h>
+#ifdef CONFIG_SB_MONOTONIC_COUNTER_ROLLBACK_PROTECTION
+#include <bl_storage.h>
+#endif
+#if defined(CONFIG_FPROTECT)
+#include <fprotect.h>
+#endif
+#include "bl_validation_fingerprint.h"
+
+LOG_MODULE_DECLARE(bl_validation, CONFIG_SECURE_BOOT_VALIDATION_LOG_LEVEL);
+
+#define FINGERPRINT_PARTITION_ID	FIXED_PARTITION_ID(sb_fingerprint_partition)
+#define FINGERPRINT_PARTITION_OFFSET	FIXED_PARTITION_OFFSET(sb_fingerprint_partition)
+#define FINGERPRINT_PARTITION_SIZE	FIXED_PARTITION_SIZE(sb_fingerprint_partition)
+
+#define FINGERPRINT_MAGIC		0x46505242 /* "BRPF" */
+#define FINGERPRINT_HASH_LEN		32
+
+struct __packed fingerprint_record {
+	/* The address the firmware is linked for. */
+	uint32_t address;
+
+	/* The size of the firmware. */
+	uint32_t size;
+
+	/* The monotonic counter value when the firmware was validated. */
+	uint32_t counter;
+
+	/* SHA-256 over the firmware info and the validation info. */
+	uint8_t metadata_hash[FINGERPRINT_HASH_LEN];
+
+	/* FINGERPRINT_MAGIC once the record is complete. */
+	uint32_t magic;
+};
+
+BUILD_ASSERT(sizeof(struct fingerprint_record) == 48, "Unexpected fingerprint record size");
+BUILD_ASSERT(FINGERPRINT_PARTITION_SIZE >= sizeof(struct fingerprint_record),
+	     "Fingerprint partition is too small");
+
+#define RECORDS_NUM (FINGERPRINT_PARTITION_SIZE / sizeof(struct fingerprint_record))
+
+static int current_counter(uint32_t *counter)
+{
+#ifdef CONFIG_SB_MONOTONIC_COUNTER_ROLLBACK_PROTECTION
+	counter_t value;
+	int err = get_monotonic_counter(BL_MONOTONIC_COUNTERS_DESC_NSIB, &value);
+
+	if (err) {
+		return err;
+	}
+
+	*counter = value;
+#else
+	*counter = 0;
+#endif
+	return 0;
+}
+
+static int fingerprint_compute(const struct fw_info *fwinfo, const void *val_info,
+			       size_t val_info_len, struct fingerprint_record *record)
+{
+	bl_sha256_ctx_t ctx;
+	uint32_t counter;
+	int err;
+
+	err = bl_crypto_init();
+	if (err) {
+		return err;
+	}
+
+	err = bl_sha256_init(&ctx);
+	if (err) {
+		return err;
+	}
+
+	/* The extension APIs following the firmware info are left out, as they
+	 * are not covered by the validation either.
+	 */
+	err = bl_sha256_update(&ctx, (const uint8_t *)fwinfo, offsetof(struct fw_info, ext_apis));
+	if (err) {
+		return err;
+	}
+
+	err = bl_sha256_update(&ctx, val_info, val_info_len);
+	if (err) {
+		return err;
+	}
+
+	err = bl_sha256_finalize(&ctx, record->metadata_hash);
+	if (err) {
+		return err;
+	}
+
+	err = current_counter(&counter);
+	if (err) {
+		return err;
+	}
+
+	record->address = fwinfo->address;
+	record->size = fwinfo->size;
+	record->counter = counter;
+	record->magic = FINGERPRINT_MAGIC;
+
+	return 0;
+}
+
+static bool record_is_erased(const struct fingerprint_record *record, uint8_t erased_val)
+{
+	const uint8_t *bytes = (const uint8_t *)record;
+
+	for (size_t i = 0; i < sizeof(*record); i++) {
+		if (bytes[i] != erased_val) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/* Find the last complete record and the first free record of the log.
+ * Either index is RECORDS_NUM if there is no such record.
+ */
+static int records_scan(const struct flash_area *fa, struct fingerprint_record *last,
+			size_t *last_idx, size_t *free_idx)
+{
+	const uint8_t erased_val = flash_area_erased_val(fa);
+	struct fingerprint_record record;
+	int err;
+
+	*last_idx = RECORDS_NUM;
+	*free_idx = RECORDS_NUM;
+
+	for (size_t i = 0; i < RECORDS_NUM; i++) {
+		err = flash_area_read(fa, i * sizeof(record), &record, sizeof(record));
+		if (err) {
+			return err;
+		}
+
+		if (record.magic == FINGERPRINT_MAGIC) {
+			*last = record;
+			*last_idx = i;
+		} else if (record_is_erased(&record, erased_val)) {
+			*free_idx = i;
+			break;
+		}
+		/* Otherwise the record was interrupted, skip it. */
+	}
+
+	return 0;
+}
+
+bool bl_validation_fingerprint_check(const struct fw_info *fwinfo, const void *val_info,
+				     size_t val_info_len)
+{
+	const struct flash_area *fa;
+	struct fingerprint_record expected;
+	struct fingerprint_record stored;
+	size_t last_idx;
+	size_t free_idx;
+	bool match = false;
+	int err;
+
+	err = flash_area_open(FINGERPRINT_PARTITION_ID, &fa);
+	if (err) {
+		LOG_ERR("Cannot open fingerprint partition: %d", err);
+		return false;
+	}
+
+	err = records_scan(fa, &stored, &last_idx, &free_idx);
+	flash_area_close(fa);
+
+	if (err) {
+		LOG_ERR("Cannot read fingerprint: %d", err);
+		return false;
+	}
+
+	if (last_idx == RECORDS_NUM) {
+		return false;
+	}
+
+	err = fingerprint_compute(fwinfo, val_info, val_info_len, &expected);
+	if (err) {
+		LOG_ERR("Cannot compute fingerprint: %d", err);
+		return false;
+	}
+
+	match = (memcmp(&expected, &stored, sizeof(expected)) == 0);
+	if (!match) {
+		LOG_INF("Firmware fingerprint doesn't match.");
+	}
+
+	return match;
+}
+
+int bl_validation_fingerprint_store(const struct fw_info *fwinfo, const void *val_info,
+				    size_t val_info_len)
+{
+	const struct flash_area *fa;
+	struct fingerprint_record record;
+	struct fingerprint_record last;
+	size_t last_idx;
+	size_t free_idx;
+	size_t align;
+	off_t offset;
+	int err;
+
+	err = fingerprint_compute(fwinfo, val_info, val_info_len, &record);
+	if (err) {
+		return err;
+	}
+
+	err = flash_area_open(FINGERPRINT_PARTITION_ID, &fa);
+	if (err) {
+		return err;
+	}
+
+	/* The magic word is written in the last write block of the record */
+	align = flash_area_align(fa);
+	if (align == 0 || align > sizeof(record) || (sizeof(record) % align) != 0) {
+		err = -EINVAL;
+		goto out;
+	}
+
+	err = records_scan(fa, &last, &last_idx, &free_idx);
+	if (err) {
+		goto out;
+	}
+
+	if (last_idx != RECORDS_NUM && memcmp(&last, &record, sizeof(record)) == 0) {
+		/* Already recorded */
+		goto out;
+	}
+
+	if (free_idx == RECORDS_NUM) {
+		err = flash_area_erase(fa, 0, fa->fa_size);
+		if (err) {
+			goto out;
+		}
+		free_idx = 0;
+	}
+
+	offset = free_idx * sizeof(record);
+
+	if (sizeof(record) > align) {
+		err = flash_area_write(fa, offset, &record, sizeof(record) - align);
+		if (err) {
+			goto out;
+		}
+	}
+
+	err = flash_area_write(fa, offset + sizeof(record) - align,
+			       (const uint8_t *)&record + sizeof(record) - align, align);
+
+out:
+	flash_area_close(fa);
+	return err;
+}
+
+int bl_validation_fingerprint_lock(void)
+{
+#if defined(CONFIG_FPROTECT)
+	return fprotect_area(FINGERPRINT_PARTITION_OFFSET, FINGERPRINT_PARTITION_SIZE);
+#else
+	return 0;
+#endif
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BL_VALIDATION_FINGERPRINT_H__
+#define BL_VALIDATION_FINGERPRINT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <zephyr/types.h>
+
+struct fw_info;
+
+/**
+ * @brief Check the firmware against the last recorded fingerprint.
+ *
+ * The fingerprint covers the firmware address and size, a hash of the
+ * firmware info and the validation info, and the monotonic counter.
+ * The firmware itself is not read.
+ *
+ * @param[in] fwinfo        Firmware info of the firmware.
+ * @param[in] val_info      Validation info of the firmware.
+ * @param[in] val_info_len  Length of @p val_info.
+ *
+ * @retval true   If the firmware matches the last recorded fingerprint.
+ * @retval false  Otherwise, or if the fingerprint could not be read.
+ */
+bool bl_validation_fingerprint_check(const struct fw_info *fwinfo, const void *val_info,
+				     size_t val_info_len);
+
+/**
+ * @brief Record the fingerprint of a firmware that passed full validation.
+ *
+ * The fingerprints of all other firmware are no longer used after this.
+ *
+ * @param[in] fwinfo        Firmware info of the firmware.
+ * @param[in] val_info      Validation info of the firmware.
+ * @param[in] val_info_len  Length of @p val_info.
+ *
+ * @retval 0  On success.
+ * @return Negative error code from the hash or the flash operations otherwise.
+ */
+int bl_validation_fingerprint_store(const struct fw_info *fwinfo, const void *val_info,
+				    size_t val_info_len);
+
+/**
+ * @brief Protect the fingerprint partition against writes until the next reset.
+ *
+ * @retval 0  On success.
+ * @return Error code from @ref fprotect_area otherwise.
+ */
+int bl_validation_fingerprint_lock(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BL_VALIDATION_FINGERPRINT_H__ */
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <zephyr/types.h>
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/sys/util.h>
+#include <bl_crypto.h>
+#include "bl_validation_stream.h"
+
+BUILD_ASSERT((CONFIG_SB_VALIDATION_HASH_CHUNK_SIZE % 4) == 0,
+	     "Hash chunk size must be word aligned");
+
+/* Not stack allocated because of its size. Word aligned for the hash backends. */
+static uint32_t chunk_buf[CONFIG_SB_VALIDATION_HASH_CHUNK_SIZE / 4];
+
+int bl_validation_hash_stream(uint32_t address, uint32_t size, uint8_t *hash)
+{
+	const struct device *flash_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
+	const off_t base = address - CONFIG_FLASH_BASE_ADDRESS;
+	bl_sha256_ctx_t ctx;
+	uint32_t chunk_len;
+	int err;
+
+	if (!device_is_ready(flash_dev)) {
+		return -ENODEV;
+	}
+
+	err = bl_sha256_init(&ctx);
+	if (err) {
+		return err;
+	}
+
+	for (uint32_t offset = 0; offset < size; offset += chunk_len) {
+		chunk_len = MIN(size - offset, sizeof(chunk_buf));
+
+		err = flash_read(flash_dev, base + offset, chunk_buf, chunk_len);
+		if (err) {
+			return err;
+		}
+
+		err = bl_sha256_update(&ctx, (const uint8_t *)chunk_buf, chunk_len);
+		if (err) {
+			return err;
+		}
+	}
+
+	return bl_sha256_finalize(&ctx, hash);
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BL_VALIDATION_STREAM_H__
+#define BL_VALIDATION_STREAM_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <zephyr/types.h>
+
+/**
+ * @brief Calculate the SHA-256 digest of a flash region.
+ *
+ * The region is read through the flash driver in chunks of
+ * @kconfig{CONFIG_SB_VALIDATION_HASH_CHUNK_SIZE} bytes, and each chunk is
+ * hashed from RAM.
+ *
+ * @param[in]  address  Address of the region.
+ * @param[in]  size     Size of the region.
+ * @param[out] hash     Where to put the digest. Must be at least 32 bytes long.
+ *
+ * @retval 0        On success.
+ * @retval -ENODEV  If the flash device is not ready.
+ * @return Any other error code from the flash driver or the hash functions.
+ */
+int bl_validation_hash_stream(uint32_t address, uint32_t size, uint8_t *hash);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BL_VALIDATION_STREAM_H__ */
@@ -82,6 +82,14 @@ static enum emds_state emds_state = EMDS_STATE_NOT_INITIALIZED;
 static struct emds_snapshot_candidate freshest_snapshot;
 static struct emds_snapshot_candidate allocated_snapshot;
 
+/* The fresh_cnt of the full snapshot the freshest snapshot is based on, and whether all the
+ * snapshots of the chain have been loaded.
+ */
+static uint32_t chain_base_cnt;
+static bool chain_valid;
+/* Allocated snapshot is an incremental snapshot */
+static bool allocated_delta;
+
 static sys_slist_t emds_dynamic_entries;
 static struct emds_partition partition[PARTITIONS_NUM_MAX];
 static emds_store_cb_t app_store_cb;
@@ -173,6 +181,10 @@ int emds_entry_add(struct emds_dynamic_entry *entry)
 		return -ECANCELED;
 	}
 
+	if (entry->entry.id == EMDS_DELTA_HEADER_ID) {
+		return -EINVAL;
+	}
+
 	STRUCT_SECTION_FOREACH(emds_entry, static_entry) {
 		if (static_entry->id == entry->entry.id) {
 			return -EINVAL;
@@ -190,13 +202,52 @@ int emds_entry_add(struct emds_dynamic_entry *entry)
 	return 0;
 }
 
-static int emds_entries_size(size_t *size)
+static bool emds_entry_is_dirty(const struct emds_entry *entry)
+{
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	return !entry->dirty || *entry->dirty;
+#else
+	return true;
+#endif
+}
+
+static void emds_entry_dirty_update(const struct emds_entry *entry, bool dirty)
+{
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	if (entry->dirty) {
+		*entry->dirty = dirty;
+	}
+#endif
+}
+
+static void emds_entries_dirty_set_all(void)
+{
+	if (!IS_ENABLED(CONFIG_EMDS_INCREMENTAL)) {
+		return;
+	}
+
+	STRUCT_SECTION_FOREACH(emds_entry, ch) {
+		emds_entry_dirty_update(ch, true);
+	}
+
+	struct emds_dynamic_entry *ch;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		emds_entry_dirty_update(&ch->entry, true);
+	}
+}
+
+static int emds_entries_size(size_t *size, bool dirty_only)
 {
 	int entries = 0;
 
 	*size = 0;
 
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
+		if (dirty_only && !emds_entry_is_dirty(ch)) {
+			continue;
+		}
+
 		*size += ch->len + sizeof(struct emds_data_entry);
 		entries++;
 	}
@@ -204,6 +255,10 @@ static int emds_entries_size(size_t *size)
 	struct emds_dynamic_entry *ch;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		if (dirty_only && !emds_entry_is_dirty(&ch->entry)) {
+			continue;
+		}
+
 		*size += ch->entry.len + sizeof(struct emds_data_entry);
 		entries++;
 	}
@@ -217,7 +272,7 @@ int emds_store_size_get(size_t *store_size)
 		return -ECANCELED;
 	}
 
-	(void)emds_entries_size(store_size);
+	(void)emds_entries_size(store_size, false);
 
 	return 0;
 }
@@ -239,6 +294,13 @@ int emds_store_time_get(uint32_t *store_time)
 		return rc;
 	}
 
+	/* Only dirty entries and the header are stored in the allocated incremental snapshot */
+	if (IS_ENABLED(CONFIG_EMDS_INCREMENTAL) && emds_state == EMDS_STATE_READY &&
+	    allocated_delta) {
+		(void)emds_entries_size(&store_size, true);
+		store_size += sizeof(struct emds_data_entry) + sizeof(struct emds_delta_header);
+	}
+
 	words = DIV_ROUND_UP(store_size, 4);
 	words += DIV_ROUND_UP(sizeof(struct emds_snapshot_metadata), 4);
 	chunk_handling = DIV_ROUND_UP(store_size, CHUNK_SIZE);
@@ -249,25 +311,23 @@ int emds_store_time_get(uint32_t *store_time)
 	return 0;
 }
 
-static uint8_t *emds_entry_memory_get(struct emds_data_entry *entry)
+static const struct emds_entry *emds_entry_get(uint16_t id)
 {
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
-		if (ch->id == entry->id) {
-			entry->length = MIN(ch->len, entry->length);
-			return ch->data;
+		if (ch->id == id) {
+			return ch;
 		}
 	}
 
 	struct emds_dynamic_entry *ch;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
-		if (ch->entry.id == entry->id) {
-			entry->length = MIN(ch->entry.len, entry->length);
-			return ch->entry.data;
+		if (ch->entry.id == id) {
+			return &ch->entry;
 		}
 	}
 
-	LOG_WRN("Entry with ID %u not found", entry->id);
+	LOG_WRN("Entry with ID %u not found", id);
 	return NULL;
 }
 
@@ -276,8 +336,7 @@ static int emds_read_data(const struct flash_area *fa, struct emds_snapshot_meta
 	struct emds_data_entry entry;
 	off_t data_off = metadata->data_instance_off;
 	int32_t data_len = metadata->data_instance_len;
-	int32_t flash_entry_data_len;
-	uint8_t *data_buf;
+	const struct emds_entry *ch;
 	int rc;
 
 	while (data_len > 0) {
@@ -289,20 +348,113 @@ static int emds_read_data(const struct flash_area *fa, struct emds_snapshot_meta
 
 		data_off += sizeof(entry);
 		data_len -= sizeof(entry);
-		flash_entry_data_len = entry.length;
 
-		data_buf = emds_entry_memory_get(&entry);
+		/* Header of an incremental snapshot is handled by emds_snapshot_base_get() */
+		ch = entry.id == EMDS_DELTA_HEADER_ID ? NULL : emds_entry_get(entry.id);
 
-		if (data_buf) {
-			rc = flash_area_read(fa, data_off, data_buf, entry.length);
+		if (ch) {
+			rc = flash_area_read(fa, data_off, ch->data, MIN(ch->len, entry.length));
 			if (rc) {
 				LOG_ERR("Failed to read data for entry ID %u: %d", entry.id, rc);
 				return -EIO;
 			}
+
+			/* Data in RAM is equal to data in the chain of snapshots */
+			if (ch->len == entry.length) {
+				emds_entry_dirty_update(ch, false);
+			}
+		}
+
+		data_off += entry.length;
+		data_len -= entry.length;
+	}
+
+	return 0;
+}
+
+/* Get the fresh_cnt of the full snapshot the snapshot is based on */
+static int emds_snapshot_base_get(const struct flash_area *fa,
+				  const struct emds_snapshot_metadata *metadata, uint32_t *base_cnt)
+{
+	struct emds_data_entry entry;
+	struct emds_delta_header header;
+	int rc;
+
+	*base_cnt = metadata->fresh_cnt;
+
+	if (metadata->data_instance_len < sizeof(entry) + sizeof(header)) {
+		return 0;
+	}
+
+	rc = flash_area_read(fa, metadata->data_instance_off, &entry, sizeof(entry));
+	if (rc) {
+		LOG_ERR("Failed to read data entry: %d", rc);
+		return -EIO;
+	}
+
+	if (entry.id != EMDS_DELTA_HEADER_ID || entry.length != sizeof(header)) {
+		return 0;
+	}
+
+	rc = flash_area_read(fa, metadata->data_instance_off + sizeof(entry), &header,
+			     sizeof(header));
+	if (rc) {
+		LOG_ERR("Failed to read incremental snapshot header: %d", rc);
+		return -EIO;
+	}
+
+	*base_cnt = header.base_cnt;
+
+	return 0;
+}
+
+/* Load the snapshots of the chain preceding the freshest snapshot, oldest first. Missing
+ * snapshots are skipped, and the chain is marked as invalid to store a full snapshot next time.
+ */
+static int emds_chain_load(void)
+{
+	const struct emds_partition *chain_partition =
+		&partition[freshest_snapshot.partition_index];
+	struct emds_snapshot_candidate link;
+	uint32_t base_cnt;
+	int rc;
+
+	rc = emds_snapshot_base_get(chain_partition->fa, &freshest_snapshot.metadata,
+				    &chain_base_cnt);
+	if (rc) {
+		return rc;
+	}
+
+	chain_valid = chain_base_cnt <= freshest_snapshot.metadata.fresh_cnt;
+
+	for (uint32_t cnt = chain_base_cnt; chain_valid &&
+	     cnt < freshest_snapshot.metadata.fresh_cnt; cnt++) {
+		rc = emds_flash_snapshot_find(chain_partition, cnt, &link);
+		if (rc == -ENOENT) {
+			LOG_WRN("Snapshot with fresh_cnt %u not found", cnt);
+			chain_valid = false;
+			continue;
+		} else if (rc) {
+			return rc;
 		}
 
-		data_off += flash_entry_data_len;
-		data_len -= flash_entry_data_len;
+		rc = emds_snapshot_base_get(chain_partition->fa, &link.metadata, &base_cnt);
+		if (rc) {
+			return rc;
+		}
+
+		if (base_cnt != chain_base_cnt) {
+			LOG_WRN("Snapshot with fresh_cnt %u is not in the chain", cnt);
+			chain_valid = false;
+			continue;
+		}
+
+		LOG_DBG("Loading snapshot with fresh_cnt %u", cnt);
+
+		rc = emds_read_data(chain_partition->fa, &link.metadata);
+		if (rc) {
+			return rc;
+		}
 	}
 
 	return 0;
@@ -311,11 +463,14 @@ static int emds_read_data(const struct flash_area *fa, struct emds_snapshot_meta
 int emds_load(void)
 {
 	struct emds_snapshot_candidate candidate = {0};
+	int rc;
 
 	if (emds_state == EMDS_STATE_NOT_INITIALIZED) {
 		return -ECANCELED;
 	}
 
+	chain_valid = false;
+
 	for (int i = 0; i < PARTITIONS_NUM_MAX; i++) {
 		if (emds_flash_scan_partition(&partition[i], &candidate)) {
 			LOG_ERR("Failed to scan partition: %d", i);
@@ -338,6 +493,14 @@ int emds_load(void)
 	LOG_DBG("Found freshest snapshot in partition %d with fresh_cnt %u",
 		freshest_snapshot.partition_index, freshest_snapshot.metadata.fresh_cnt);
 
+	/* Entries not restored from the snapshots must be stored in the next snapshot */
+	emds_entries_dirty_set_all();
+
+	rc = emds_chain_load();
+	if (rc) {
+		return rc;
+	}
+
 	return emds_read_data(partition[freshest_snapshot.partition_index].fa,
 			      &freshest_snapshot.metadata);
 }
@@ -359,12 +522,21 @@ int emds_prepare(void)
 
 	allocated_snapshot.metadata.fresh_cnt = freshest_snapshot.metadata.fresh_cnt + 1;
 
+	/* Continue the chain, unless it is broken or has reached its maximum length */
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	allocated_delta = chain_valid && (allocated_snapshot.metadata.fresh_cnt - chain_base_cnt <
+					  CONFIG_EMDS_INCREMENTAL_FULL_INTERVAL);
+#endif
+
 	/* First try to allocate snapshot in the same partition where freshest snapshot exists */
 	if (freshest_snapshot.metadata.fresh_cnt > 0) {
 		freshest_partition_idx = freshest_snapshot.partition_index;
-		rc = emds_flash_allocate_snapshot(&partition[freshest_partition_idx],
-						  &freshest_snapshot, &allocated_snapshot,
-						  data_size);
+		rc = emds_flash_allocate_snapshot(
+			&partition[freshest_partition_idx], &freshest_snapshot,
+			&allocated_snapshot,
+			data_size + (allocated_delta ? sizeof(struct emds_data_entry) +
+							       sizeof(struct emds_delta_header)
+						     : 0));
 		if (rc == 0) {
 			allocated_snapshot.partition_index = freshest_partition_idx;
 			emds_state = EMDS_STATE_READY;
@@ -373,6 +545,9 @@ int emds_prepare(void)
 		rc = 0;
 	}
 
+	/* Snapshots of a chain must be in the same partition */
+	allocated_delta = false;
+
 	do {
 		if (idx != freshest_partition_idx) {
 			if (erase_enabled) {
@@ -476,7 +651,11 @@ int emds_store(void)
 		goto unlock_and_exit;
 	}
 
-	if (flash_params_get_erase_cap(partition[idx].fp) & FLASH_ERASE_C_EXPLICIT) {
+	/* With incremental snapshots, the data length is known only after the data is written,
+	 * so the whole metadata is written at the end.
+	 */
+	if (!IS_ENABLED(CONFIG_EMDS_INCREMENTAL) &&
+	    flash_params_get_erase_cap(partition[idx].fp) & FLASH_ERASE_C_EXPLICIT) {
 		LOG_DBG("Writing metadata on offset: 0x%4lx, address : 0x%4lx",
 			 allocated_snapshot.metadata_off,
 			 allocated_snapshot.metadata_off + partition[idx].fa->fa_off);
@@ -485,19 +664,49 @@ int emds_store(void)
 				      offsetof(struct emds_snapshot_metadata, snapshot_crc));
 	}
 
+	if (allocated_delta) {
+		struct emds_delta_header header = {
+			.base_cnt = chain_base_cnt,
+		};
+		struct emds_entry header_entry = {
+			.id = EMDS_DELTA_HEADER_ID,
+			.data = (uint8_t *)&header,
+			.len = sizeof(header),
+		};
+
+		entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, &header_entry);
+	}
+
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
-		entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, ch);
+		if (!allocated_delta || emds_entry_is_dirty(ch)) {
+			entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, ch);
+		}
 	}
 
 	struct emds_dynamic_entry *ch;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
-		entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, &ch->entry);
+		if (!allocated_delta || emds_entry_is_dirty(&ch->entry)) {
+			entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, &ch->entry);
+		}
 	}
 
 	stream_fflush(&partition[idx], &data_off, data_chunk, &wp);
 
-	if (flash_params_get_erase_cap(partition[idx].fp) & FLASH_ERASE_C_EXPLICIT) {
+	if (IS_ENABLED(CONFIG_EMDS_INCREMENTAL)) {
+		allocated_snapshot.metadata.data_instance_len =
+			data_off - allocated_snapshot.metadata.data_instance_off;
+		allocated_snapshot.metadata.metadata_crc = crc32_k_4_2_update(
+			0, (const unsigned char *)&allocated_snapshot.metadata,
+			offsetof(struct emds_snapshot_metadata, metadata_crc));
+		LOG_DBG("Writing metadata on offset: 0x%4lx, address : 0x%4lx, crc : 0x%4x",
+			 allocated_snapshot.metadata_off,
+			 allocated_snapshot.metadata_off + partition[idx].fa->fa_off,
+			 allocated_snapshot.metadata.snapshot_crc);
+		emds_flash_write_data(&partition[idx], allocated_snapshot.metadata_off,
+				      &allocated_snapshot.metadata,
+				      offsetof(struct emds_snapshot_metadata, reserved));
+	} else if (flash_params_get_erase_cap(partition[idx].fp) & FLASH_ERASE_C_EXPLICIT) {
 		LOG_DBG("Writing snapshot crc on offset: 0x%4lx, crc : 0x%4x",
 			 allocated_snapshot.metadata_off +
 					      offsetof(struct emds_snapshot_metadata, snapshot_crc),
@@ -541,6 +750,8 @@ int emds_clear(void)
 	emds_state = EMDS_STATE_INITIALIZED;
 	memset(&freshest_snapshot, 0, sizeof(freshest_snapshot));
 	memset(&allocated_snapshot, 0, sizeof(allocated_snapshot));
+	chain_valid = false;
+	allocated_delta = false;
 	for (int i = 0; i < PARTITIONS_NUM_MAX; i++) {
 		rc = emds_flash_erase_partition(&partition[i]);
 		if (rc) {
@@ -213,6 +213,53 @@ int emds_flash_scan_partition(const struct emds_partition *partition,
 	return 0;
 }
 
+int emds_flash_snapshot_find(const struct emds_partition *partition, uint32_t fresh_cnt,
+			     struct emds_snapshot_candidate *candidate)
+{
+	struct emds_snapshot_metadata cache = {0};
+	const struct flash_area *fa = partition->fa;
+	off_t read_off = fa->fa_size - sizeof(cache);
+	int failures = 0;
+	uint32_t crc;
+	int rc;
+
+	do {
+		rc = flash_area_read(fa, read_off, &cache, sizeof(cache));
+		if (rc) {
+			LOG_ERR("Failed to read snapshot metadata: %d", rc);
+			return -EIO;
+		}
+
+		if (cache.marker != EMDS_SNAPSHOT_METADATA_MARKER) {
+			failures++;
+			continue;
+		}
+
+		crc = crc32_k_4_2_update(0, (const unsigned char *)&cache,
+					 offsetof(struct emds_snapshot_metadata, metadata_crc));
+		if (crc != cache.metadata_crc) {
+			failures++;
+			continue;
+		}
+
+		if (cache.fresh_cnt != fresh_cnt) {
+			continue;
+		}
+
+		if (!cand_snapshot_crc_check(partition, &cache)) {
+			LOG_DBG("Snapshot CRC mismatch at address 0x%04lx",
+				fa->fa_off + cache.data_instance_off);
+			continue;
+		}
+
+		candidate->metadata = cache;
+		candidate->metadata_off = read_off;
+		return 0;
+	} while (metadata_iterator(&read_off, failures));
+
+	return -ENOENT;
+}
+
 int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 				 const struct emds_snapshot_candidate *freshest_snapshot,
 				 struct emds_snapshot_candidate *allocated_snapshot,
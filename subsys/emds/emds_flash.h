@@ -55,6 +55,21 @@ struct emds_data_entry {
 	uint8_t data[];
 } __packed;
 
+/** Data entry ID reserved for the header of an incremental snapshot. */
+#define EMDS_DELTA_HEADER_ID 0xFFFF
+
+/**
+ * @brief Emergency data storage incremental snapshot header
+ *
+ * Data of the first entry of an incremental snapshot, with the entry ID set to
+ * EMDS_DELTA_HEADER_ID. Snapshots without the header are full snapshots.
+ *
+ * @param base_cnt The fresh_cnt of the full snapshot the incremental snapshot is based on.
+ */
+struct emds_delta_header {
+	uint32_t base_cnt;
+} __packed;
+
 /**
  * @brief Emergency data storage metadata structure
  *
@@ -153,6 +168,21 @@ int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 				 struct emds_snapshot_candidate *allocated_snapshot,
 				 size_t data_size);
 
+/**
+ * @brief Find a valid snapshot with the given fresh_cnt in the emergency data storage partition.
+ *
+ * @param partition Pointer to the emergency data storage partition structure.
+ * @param fresh_cnt The fresh_cnt of the snapshot to be found.
+ * @param candidate Pointer to the emergency data storage snapshot candidate structure
+ * that will be filled with the found snapshot metadata.
+ *
+ * @retval 0 on success.
+ * @retval -ENOENT if there is no valid snapshot with the given fresh_cnt.
+ * @retval -EIO if an error occurs during reading.
+ */
+int emds_flash_snapshot_find(const struct emds_partition *partition, uint32_t fresh_cnt,
+			     struct emds_snapshot_candidate *candidate);
+
 /** * @brief Write data to the emergency data storage partition.
  *
  * @param partition Pointer to the emergency data storage partition structure.
@@ -34,6 +34,8 @@ struct nrf_cloud_coap_client {
 };
 
 #define NRF_CLOUD_COAP_PROXY_RSC "proxy"
+#define COAP_D2C_RSC "msg/d2c"
+#define COAP_D2C_BULK_RSC COAP_D2C_RSC "/bulk"
 
 /**
  * @defgroup nrf_cloud_coap_transport nRF CoAP API
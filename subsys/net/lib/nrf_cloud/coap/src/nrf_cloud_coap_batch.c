@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/coap.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_codec.h>
+#include <net/nrf_cloud_defs.h>
+#include <net/nrf_cloud_coap.h>
+#include "nrf_cloud_coap_transport.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(nrf_cloud_coap, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
+
+/* Messages are collected into a JSON array, which is sent to the bulk endpoint with a single
+ * request. While one buffer is being sent, messages are collected into the other one.
+ */
+struct batch_buf {
+	char data[CONFIG_NRF_CLOUD_COAP_BATCH_BUF_SIZE];
+	/* Length of the array without the closing bracket */
+	size_t len;
+	/* Set while the buffer is being sent */
+	atomic_t busy;
+};
+
+static struct batch_buf batch_bufs[2];
+static int batch_idx;
+/* First error reported for a batch since the last flush */
+static int batch_result;
+
+static K_MUTEX_DEFINE(batch_mut);
+/* Given each time a batch is sent */
+static K_SEM_DEFINE(batch_done_sem, 0, 1);
+
+static void batch_sent_cb(const struct coap_client_response_data *data, void *user)
+{
+	struct batch_buf *b = user;
+	int result = data->result_code;
+
+	if ((result >= 0) && (result < COAP_RESPONSE_CODE_BAD_REQUEST) && !data->last_block) {
+		/* Block-wise transfer in progress */
+		return;
+	}
+
+	if ((result == -ETIMEDOUT) && !IS_ENABLED(CONFIG_NRF_CLOUD_COAP_BATCH_CONFIRMABLE)) {
+		/* Response to a NON request might never come */
+		result = 0;
+	}
+
+	if ((result < 0) || (result >= COAP_RESPONSE_CODE_BAD_REQUEST)) {
+		LOG_ERR("Failed to send batch of %zu bytes: %d", b->len + 1, result);
+		if (batch_result == 0) {
+			batch_result = result;
+		}
+	}
+
+	atomic_clear(&b->busy);
+	k_sem_give(&batch_done_sem);
+}
+
+static void batch_buf_wait(struct batch_buf *b)
+{
+	while (atomic_get(&b->busy)) {
+		/* Also completes NON requests that did not get a response in time */
+		(void)nrf_cloud_coap_async_wait(K_NO_WAIT);
+		(void)k_sem_take(&batch_done_sem, K_MSEC(100));
+	}
+}
+
+static int batch_send(void)
+{
+	struct batch_buf *b = &batch_bufs[batch_idx];
+	struct batch_buf *next = &batch_bufs[batch_idx ^ 1];
+	int err;
+
+	if (b->len == 0) {
+		return 0;
+	}
+
+	/* Space for the closing bracket is reserved when messages are added */
+	b->data[b->len] = ']';
+	atomic_set(&b->busy, 1);
+
+	err = nrf_cloud_coap_post_async(COAP_D2C_BULK_RSC, NULL,
+					(const uint8_t *)b->data, b->len + 1,
+					COAP_CONTENT_FORMAT_APP_JSON,
+					IS_ENABLED(CONFIG_NRF_CLOUD_COAP_BATCH_CONFIRMABLE),
+					batch_sent_cb, b);
+	if (err) {
+		/* Keep the messages, so that sending can be retried */
+		LOG_ERR("Failed to send batch: %d", err);
+		atomic_clear(&b->busy);
+		return err;
+	}
+
+	LOG_DBG("Sent batch of %zu bytes", b->len + 1);
+
+	/* Collect the following messages while the batch is being sent */
+	batch_buf_wait(next);
+	next->len = 0;
+	batch_idx ^= 1;
+
+	return 0;
+}
+
+static int batch_append(const char *message, size_t len)
+{
+	struct batch_buf *b = &batch_bufs[batch_idx];
+	int err;
+
+	/* The message is preceded by an opening bracket or a comma and followed by
+	 * the closing bracket.
+	 */
+	if (len + 2 > sizeof(b->data)) {
+		LOG_ERR("Message of %zu bytes does not fit in a batch", len);
+		return -E2BIG;
+	}
+
+	if (b->len + len + 2 > sizeof(b->data)) {
+		err = batch_send();
+		if (err) {
+			return err;
+		}
+		b = &batch_bufs[batch_idx];
+	}
+
+	b->data[b->len] = (b->len == 0) ? '[' : ',';
+	memcpy(&b->data[b->len + 1], message, len);
+	b->len += len + 1;
+
+	return 0;
+}
+
+int nrf_cloud_coap_json_message_queue(const char *message)
+{
+	__ASSERT_NO_MSG(message != NULL);
+
+	int err;
+
+	if (!nrf_cloud_coap_is_connected()) {
+		return -EACCES;
+	}
+
+	k_mutex_lock(&batch_mut, K_FOREVER);
+	err = batch_append(message, strlen(message));
+	k_mutex_unlock(&batch_mut);
+
+	return err;
+}
+
+int nrf_cloud_coap_sensor_queue(const char *app_id, double value, int64_t ts_ms)
+{
+	__ASSERT_NO_MSG(app_id != NULL);
+
+	int err = 0;
+
+	NRF_CLOUD_OBJ_JSON_DEFINE(msg_obj);
+
+	if (!nrf_cloud_coap_is_connected()) {
+		return -EACCES;
+	}
+
+	/* Same message as the one sent by nrf_cloud_coap_sensor_send() in JSON format */
+	err += nrf_cloud_obj_msg_init(&msg_obj, app_id, NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	err += nrf_cloud_obj_ts_add(&msg_obj, ts_ms);
+	err += nrf_cloud_obj_num_add(&msg_obj, NRF_CLOUD_JSON_DATA_KEY, value, false);
+	if (err) {
+		err = -ENOMEM;
+		goto cleanup;
+	}
+
+	err = nrf_cloud_obj_cloud_encode(&msg_obj);
+	if (err) {
+		goto cleanup;
+	}
+
+	k_mutex_lock(&batch_mut, K_FOREVER);
+	err = batch_append(msg_obj.encoded_data.ptr, msg_obj.encoded_data.len);
+	k_mutex_unlock(&batch_mut);
+
+	(void)nrf_cloud_obj_cloud_encoded_free(&msg_obj);
+
+cleanup:
+	(void)nrf_cloud_obj_free(&msg_obj);
+	return err;
+}
+
+int nrf_cloud_coap_queue_flush(void)
+{
+	int err;
+
+	if (!nrf_cloud_coap_is_connected()) {
+		return -EACCES;
+	}
+
+	k_mutex_lock(&batch_mut, K_FOREVER);
+
+	err = batch_send();
+	if (!err) {
+		/* The current buffer is free, wait for the last batch sent */
+		batch_buf_wait(&batch_bufs[batch_idx ^ 1]);
+		err = batch_result;
+		batch_result = 0;
+	}
+
+	k_mutex_unlock(&batch_mut);
+
+	return err;
+}
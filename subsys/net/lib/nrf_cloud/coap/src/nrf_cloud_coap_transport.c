@@ -62,8 +62,19 @@ struct cc_xfer_data {
 	int result_code;
 	struct k_sem *sem;
 	atomic_t used;
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+	/* Request of an asynchronous transfer, kept to cancel it */
+	struct coap_client_request request;
+	/* Time after which an unanswered NON request is cancelled */
+	k_timepoint_t expiry;
+	/* Transfer started with nrf_cloud_coap_post_async() */
+	bool async;
+#endif
 };
 
+/* Bit set in cc_xfer_data.used while an asynchronous transfer has not completed */
+#define XFER_ASYNC_BIT 1
+
 /* Semaphore to be used with internal coap_client requests */
 static K_SEM_DEFINE(cb_sem, 0, 1);
 /* Semaphore to be used when doing authorization with an external coap_client */
@@ -73,6 +84,13 @@ static K_MUTEX_DEFINE(internal_transfer_mut);
 
 static struct nrf_cloud_coap_client internal_cc = {0};
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+/* Number of asynchronous transfers that have not completed yet */
+static atomic_t async_pending;
+/* Given each time an asynchronous transfer completes */
+static K_SEM_DEFINE(async_done_sem, 0, 1);
+#endif
+
 #if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
 static const char *const coap_method_str[] = {
 	NULL,		/* 0 */
@@ -142,6 +160,108 @@ static void xfer_ctx_release(struct cc_xfer_data *ctx)
 	}
 }
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+/* Completion may be reported by coap_client and by a cancellation at the same time,
+ * only the first one to claim the transfer completes it.
+ */
+static bool async_xfer_claim(struct cc_xfer_data *xfer)
+{
+	return atomic_test_and_clear_bit(&xfer->used, XFER_ASYNC_BIT);
+}
+
+static void async_xfer_release(struct cc_xfer_data *xfer)
+{
+	xfer_ctx_release(xfer);
+	atomic_dec(&async_pending);
+	k_sem_give(&async_done_sem);
+}
+
+static void async_xfer_done(struct cc_xfer_data *xfer)
+{
+	if (async_xfer_claim(xfer)) {
+		async_xfer_release(xfer);
+	}
+}
+
+/* Pass a response from coap_client to the user. The final one is passed only if
+ * the transfer has not been completed by an expiry or a cancellation meanwhile.
+ */
+static void async_xfer_response(struct cc_xfer_data *xfer,
+				const struct coap_client_response_data *data)
+{
+	bool final = data->last_block || (data->result_code >= COAP_RESPONSE_CODE_BAD_REQUEST) ||
+		     (data->result_code < 0);
+
+	if (final) {
+		if (!async_xfer_claim(xfer)) {
+			return;
+		}
+	} else if (!atomic_test_bit(&xfer->used, XFER_ASYNC_BIT)) {
+		return;
+	}
+
+	xfer->result_code = data->result_code;
+	if (xfer->cb) {
+		LOG_DBG("Calling user's callback %p", xfer->cb);
+		xfer->cb(data, xfer->user_data);
+	}
+
+	if (final) {
+		async_xfer_release(xfer);
+	}
+}
+
+/* Complete a claimed transfer in the calling thread */
+static void async_xfer_complete(struct cc_xfer_data *xfer, int result)
+{
+	const struct coap_client_response_data data = {
+		.result_code = result,
+		.last_block = true,
+	};
+
+	xfer->result_code = result;
+	if (xfer->cb) {
+		xfer->cb(&data, xfer->user_data);
+	}
+
+	async_xfer_release(xfer);
+}
+
+/* Cancel NON requests that did not get a response in time, so that their coap_client
+ * request slots and transfer contexts can be reused.
+ */
+static void async_xfer_expire(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(xfer_ctx_pool); i++) {
+		struct cc_xfer_data *xfer = &xfer_ctx_pool[i];
+
+		if (!atomic_test_bit(&xfer->used, XFER_ASYNC_BIT) ||
+		    !sys_timepoint_expired(xfer->expiry) || !async_xfer_claim(xfer)) {
+			continue;
+		}
+
+		/* Claimed first, so that a response or the cancellation reported by
+		 * coap_client is not passed to the user.
+		 */
+		LOG_DBG("No response to NON request %s", xfer->request.path);
+		coap_client_cancel_request(&xfer->nrfc_cc->cc, &xfer->request);
+		async_xfer_complete(xfer, -ETIMEDOUT);
+	}
+}
+
+/* Complete the asynchronous transfers of a client whose requests have been cancelled */
+static void async_xfer_cancel(struct nrf_cloud_coap_client *const client)
+{
+	for (int i = 0; i < ARRAY_SIZE(xfer_ctx_pool); i++) {
+		struct cc_xfer_data *xfer = &xfer_ctx_pool[i];
+
+		if ((xfer->nrfc_cc == client) && async_xfer_claim(xfer)) {
+			async_xfer_complete(xfer, -ECANCELED);
+		}
+	}
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_ASYNC */
+
 static struct cc_xfer_data *xfer_data_init(struct nrf_cloud_coap_client *cc,
 					   coap_client_response_cb_t cb,
 					   void *user,
@@ -158,6 +278,9 @@ static struct cc_xfer_data *xfer_data_init(struct nrf_cloud_coap_client *cc,
 	xfer->user_data = user;
 	xfer->result_code = -ECANCELED;
 	xfer->sem = sem;
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+	xfer->async = false;
+#endif
 	return xfer;
 }
 
@@ -480,6 +603,12 @@ static void client_callback(const struct coap_client_response_data *data, void *
 	} else if ((data->result_code >= COAP_RESPONSE_CODE_BAD_REQUEST) && data->payload_len) {
 		LOG_ERR("Unexpected response: %*s", data->payload_len, data->payload);
 	}
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+	if (xfer->async) {
+		async_xfer_response(xfer, data);
+		return;
+	}
+#endif
 	/* Sanitize the xfer struct to ensure callback is valid, in case transfer
 	 * was cancelled or timed out.
 	 */
@@ -501,23 +630,19 @@ static void client_callback(const struct coap_client_response_data *data, void *
 
 BUILD_ASSERT((NRF_CLOUD_COAP_NUM_INTERNAL_OPTIONS + CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS) <=
 		CONFIG_COAP_CLIENT_MAX_EXTRA_OPTIONS);
-static int client_transfer(enum coap_method method,
-			   const char *resource, const char *query,
-			   const uint8_t *buf, size_t buf_len,
-			   enum coap_content_format fmt_out,
-			   enum coap_content_format fmt_in,
-			   bool response_expected,
-			   bool reliable,
-			   struct cc_xfer_data *xfer)
+static int request_init(struct coap_client_request *request,
+			enum coap_method method,
+			const char *resource, const char *query,
+			const uint8_t *buf, size_t buf_len,
+			enum coap_content_format fmt_out,
+			enum coap_content_format fmt_in,
+			bool response_expected,
+			bool reliable,
+			struct cc_xfer_data *xfer)
 {
-	if (xfer == NULL) {
-		return -ENOBUFS;
-	}
-	__ASSERT_NO_MSG(resource != NULL);
+	int err;
 
-	int err = 0;
-	int retry;
-	struct coap_client_request request = {
+	*request = (struct coap_client_request) {
 		.method = method,
 		.confirmable = reliable,
 		.fmt = fmt_out,
@@ -526,12 +651,11 @@ static int client_transfer(enum coap_method method,
 		.cb = client_callback,
 		.user_data = xfer
 	};
-	struct coap_client *const cc = &xfer->nrfc_cc->cc;
 
 	size_t num_internal_options = 0;
 	if (response_expected) {
 		num_internal_options += 1;
-		request.options[0] = (struct coap_client_option) {
+		request->options[0] = (struct coap_client_option) {
 			.code = COAP_OPTION_ACCEPT,
 			.len = 1,
 			.value[0] = fmt_in
@@ -540,32 +664,59 @@ static int client_transfer(enum coap_method method,
 
 	size_t num_user_options = CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS;
 #if (CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS > 0)
-	nrf_cloud_coap_get_user_options(&request.options[num_internal_options], &num_user_options,
-		resource, xfer->user_data);
+	nrf_cloud_coap_get_user_options(&request->options[num_internal_options],
+		&num_user_options, resource, xfer->user_data);
 #endif
 	const size_t total_options = num_internal_options + num_user_options;
 
-	request.num_options = total_options;
+	request->num_options = total_options;
 
 	if (!query) {
-		strncpy(request.path, resource, MAX_PATH_SIZE);
-		request.path[MAX_PATH_SIZE - 1] = '\0';
+		strncpy(request->path, resource, MAX_PATH_SIZE);
+		request->path[MAX_PATH_SIZE - 1] = '\0';
 	} else {
-		err = snprintk(request.path, sizeof(request.path), "%s?%s", resource, query);
-		if ((err <= 0) || (err >= sizeof(request.path))) {
+		err = snprintk(request->path, sizeof(request->path), "%s?%s", resource, query);
+		if ((err <= 0) || (err >= sizeof(request->path))) {
 			/* If we get here, CONFIG_COAP_CLIENT_MAX_PATH_LENGTH needs a bump */
 			LOG_ERR("Could not format string: %s?%s", resource, query);
-			err = -ETXTBSY;
-			goto transfer_end;
+			return -ETXTBSY;
 		}
 	}
 
 #if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
 	LOG_DBG("%s %s %s Content-Format:%s, %zd bytes out, Accept:%s", reliable ? "CON" : "NON",
-		METHOD_NAME(method), request.path, fmt_name(fmt_out), buf_len,
+		METHOD_NAME(method), request->path, fmt_name(fmt_out), buf_len,
 		response_expected ? fmt_name(fmt_in) : "none");
 #endif /* CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG */
 
+	return 0;
+}
+
+static int client_transfer(enum coap_method method,
+			   const char *resource, const char *query,
+			   const uint8_t *buf, size_t buf_len,
+			   enum coap_content_format fmt_out,
+			   enum coap_content_format fmt_in,
+			   bool response_expected,
+			   bool reliable,
+			   struct cc_xfer_data *xfer)
+{
+	if (xfer == NULL) {
+		return -ENOBUFS;
+	}
+	__ASSERT_NO_MSG(resource != NULL);
+
+	int err = 0;
+	int retry;
+	struct coap_client_request request;
+	struct coap_client *const cc = &xfer->nrfc_cc->cc;
+
+	err = request_init(&request, method, resource, query, buf, buf_len, fmt_out, fmt_in,
+			   response_expected, reliable, xfer);
+	if (err) {
+		goto transfer_end;
+	}
+
 	retry = 0;
 	k_sem_reset(xfer->sem);
 	while ((xfer->nrfc_cc->sock >= 0) &&
@@ -628,6 +779,113 @@ transfer_end:
 	return err;
 }
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+static int client_transfer_async(enum coap_method method,
+				 const char *resource, const char *query,
+				 const uint8_t *buf, size_t buf_len,
+				 enum coap_content_format fmt,
+				 bool reliable,
+				 struct cc_xfer_data *xfer)
+{
+	if (xfer == NULL) {
+		return -ENOBUFS;
+	}
+	__ASSERT_NO_MSG(resource != NULL);
+
+	int err;
+	int retry = 0;
+	struct coap_client *const cc = &xfer->nrfc_cc->cc;
+
+	err = request_init(&xfer->request, method, resource, query, buf, buf_len, fmt, fmt,
+			   false, reliable, xfer);
+	if (err) {
+		xfer_ctx_release(xfer);
+		return err;
+	}
+
+	/* The response to a NON request might never come */
+	xfer->expiry = sys_timepoint_calc(reliable ? K_FOREVER : K_SECONDS(NON_RESP_WAIT_S));
+
+	/* From now on, the transfer context is released when the transfer completes */
+	xfer->async = true;
+	atomic_inc(&async_pending);
+	atomic_set_bit(&xfer->used, XFER_ASYNC_BIT);
+
+	while ((xfer->nrfc_cc->sock >= 0) &&
+	       (err = coap_client_req(cc, xfer->nrfc_cc->sock, NULL, &xfer->request, NULL)) ==
+	       -EAGAIN) {
+		if (!nrf_cloud_coap_is_connected()) {
+			err = -EACCES;
+			break;
+		}
+		/* -EAGAIN means all coap_client requests are waiting for a response */
+		if (retry++ > CONFIG_NRF_CLOUD_COAP_MAX_RETRIES) {
+			LOG_ERR("Timeout waiting for CoAP client to be available");
+			err = -ETIMEDOUT;
+			break;
+		}
+		LOG_DBG("CoAP client busy");
+		(void)k_sem_take(&async_done_sem, K_MSEC(500));
+		async_xfer_expire();
+	}
+
+	if (xfer->nrfc_cc->sock < 0) {
+		err = -ENOTCONN;
+	}
+
+	if (err < 0) {
+		LOG_ERR("Error sending CoAP request: %d", err);
+		async_xfer_done(xfer);
+		return err;
+	}
+
+	if (buf_len) {
+		LOG_HEXDUMP_DBG(buf, MIN(64, buf_len), "Sent");
+	}
+
+	return 0;
+}
+
+int nrf_cloud_coap_post_async(const char *resource, const char *query,
+			      const uint8_t *buf, size_t len,
+			      enum coap_content_format fmt, bool reliable,
+			      coap_client_response_cb_t cb, void *user)
+{
+	int err = 0;
+
+	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
+	async_xfer_expire();
+
+	void *xfer = xfer_data_init(&internal_cc, cb, user, NULL);
+
+	err = client_transfer_async(COAP_METHOD_POST, resource, query,
+				    buf, len, fmt, reliable, xfer);
+	k_mutex_unlock(&internal_transfer_mut);
+
+	return err;
+}
+
+int nrf_cloud_coap_async_wait(k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	while (true) {
+		k_mutex_lock(&internal_transfer_mut, K_FOREVER);
+		async_xfer_expire();
+		k_mutex_unlock(&internal_transfer_mut);
+
+		if (atomic_get(&async_pending) == 0) {
+			return 0;
+		}
+		if (sys_timepoint_expired(end)) {
+			return -EAGAIN;
+		}
+
+		(void)k_sem_take(&async_done_sem, K_MSEC(100));
+	}
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_ASYNC */
+
 int nrf_cloud_coap_get(const char *resource, const char *query,
 		       const uint8_t *buf, size_t len,
 		       enum coap_content_format fmt_out,
@@ -900,6 +1158,9 @@ int nrf_cloud_coap_transport_disconnect(struct nrf_cloud_coap_client *const clie
 
 	coap_client_cancel_requests(&client->cc);
 	LOG_DBG("Cancelled requests");
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+	async_xfer_cancel(client);
+#endif
 
 	int tmp;
 	int err = 0;
@@ -1009,6 +1270,9 @@ int nrf_cloud_coap_transport_pause(struct nrf_cloud_coap_client *const client)
 	if (nrfc_dtls_cid_is_active(client->sock) && client->authenticated) {
 		LOG_DBG("Cancelling requests");
 		coap_client_cancel_requests(&client->cc);
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+		async_xfer_cancel(client);
+#endif
 
 		k_mutex_lock(&client->mutex, K_FOREVER);
 		client->cid_saved = false;
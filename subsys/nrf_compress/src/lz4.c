@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Decompression of LZ4 sequences, as created by scripts/nrf_compress/lz4_compress.py.
+ *
+ * The stream starts with a header holding the "NL" magic, the format version and the base 2
+ * logarithm of the window size. It is followed by LZ4 sequences, each made of a token, literals
+ * and a match that copies earlier output. The last sequence has no match.
+ *
+ * The output is decoded into a window buffer that also holds the history for the matches. The
+ * buffer is returned to the caller when it is full and then reused from its start, so the
+ * matches wrap around it.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <nrf_compress/implementation.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_REGISTER(nrf_compress_lz4, CONFIG_NRF_COMPRESS_LOG_LEVEL);
+
+#define LZ4_HEADER_SIZE 4
+#define LZ4_MAGIC_0 'N'
+#define LZ4_MAGIC_1 'L'
+#define LZ4_VERSION 1
+#define LZ4_MIN_WINDOW_LOG 8
+
+#define LZ4_MIN_MATCH 4
+#define LZ4_LENGTH_MORE 15
+#define LZ4_LENGTH_BYTE_MORE 255
+
+#define MAX_LZ4_WINDOW_SIZE CONFIG_NRF_COMPRESS_LZ4_WINDOW_SIZE
+
+BUILD_ASSERT(IS_POWER_OF_TWO(MAX_LZ4_WINDOW_SIZE),
+	     "CONFIG_NRF_COMPRESS_LZ4_WINDOW_SIZE must be a power of two");
+
+enum lz4_state {
+	LZ4_STATE_TOKEN,
+	LZ4_STATE_LITERAL_LENGTH,
+	LZ4_STATE_LITERALS,
+	LZ4_STATE_OFFSET_LOW,
+	LZ4_STATE_OFFSET_HIGH,
+	LZ4_STATE_MATCH_LENGTH,
+	LZ4_STATE_MATCH,
+};
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
+#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
+static uint8_t __aligned(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT) lz4_window[MAX_LZ4_WINDOW_SIZE];
+#else
+static uint8_t lz4_window[MAX_LZ4_WINDOW_SIZE];
+#endif
+#else
+static uint8_t *lz4_window = NULL;
+#endif
+
+static struct {
+	/* Window size of the stream, set from the header */
+	size_t window_size;
+	/* Write position in the window */
+	size_t pos;
+	/* Amount of output available for matches, at most the window size */
+	size_t history;
+	size_t output_limit;
+	bool output_size_known;
+	/* Remaining length of the literals or the match being decoded */
+	uint32_t length;
+	uint16_t offset;
+	uint8_t token;
+	enum lz4_state state;
+	bool header_parsed;
+	/* The first input byte of the next call was already decoded */
+	bool skip_byte;
+} lz4;
+
+static int lz4_reset(void *inst, size_t decompressed_size);
+
+static int lz4_init(void *inst, size_t decompressed_size)
+{
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (lz4_window == NULL) {
+#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
+		lz4_window = (uint8_t *)aligned_alloc(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT,
+						      MAX_LZ4_WINDOW_SIZE);
+#else
+		lz4_window = (uint8_t *)malloc(MAX_LZ4_WINDOW_SIZE);
+#endif
+
+		if (lz4_window == NULL) {
+			LOG_ERR("Failed to allocate LZ4 window (0x%x)", MAX_LZ4_WINDOW_SIZE);
+			return -ENOMEM;
+		}
+	}
+#endif
+
+	return lz4_reset(inst, decompressed_size);
+}
+
+static int lz4_deinit(void *inst)
+{
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (lz4_window != NULL) {
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+		memset(lz4_window, 0x00, MAX_LZ4_WINDOW_SIZE);
+#endif
+
+		free(lz4_window);
+		lz4_window = NULL;
+	}
+#elif defined(CONFIG_NRF_COMPRESS_CLEANUP)
+	memset(lz4_window, 0x00, sizeof(lz4_window));
+#endif
+
+	return lz4_reset(inst, 0);
+}
+
+static int lz4_reset(void *inst, size_t decompressed_size)
+{
+	ARG_UNUSED(inst);
+
+	memset(&lz4, 0x00, sizeof(lz4));
+	lz4.state = LZ4_STATE_TOKEN;
+	lz4.output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
+	lz4.output_size_known = (decompressed_size != 0);
+
+	return 0;
+}
+
+static size_t lz4_bytes_needed(void *inst)
+{
+	ARG_UNUSED(inst);
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (lz4_window == NULL) {
+		return 0;
+	}
+#endif
+
+	return (lz4.header_parsed ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : LZ4_HEADER_SIZE);
+}
+
+static int lz4_header_parse(const uint8_t *input)
+{
+	if (input[0] != LZ4_MAGIC_0 || input[1] != LZ4_MAGIC_1 || input[2] != LZ4_VERSION) {
+		LOG_ERR("Invalid LZ4 header");
+		return -EINVAL;
+	}
+
+	if (input[3] < LZ4_MIN_WINDOW_LOG || input[3] >= 31 ||
+	    BIT(input[3]) > MAX_LZ4_WINDOW_SIZE) {
+		LOG_ERR("Unsupported LZ4 window size (log2 %d), max is 0x%x", input[3],
+			MAX_LZ4_WINDOW_SIZE);
+		return -EINVAL;
+	}
+
+	lz4.window_size = BIT(input[3]);
+	lz4.header_parsed = true;
+
+	return 0;
+}
+
+/* Account for len bytes written at the current window position */
+static int lz4_output(size_t len)
+{
+	if (len > lz4.output_limit) {
+		LOG_ERR("Decompressed data exceeds expected size");
+		return -EINVAL;
+	}
+
+	lz4.output_limit -= len;
+	lz4.pos += len;
+	lz4.history = MIN(lz4.history + len, lz4.window_size);
+
+	return 0;
+}
+
+/* Copy len bytes from offset bytes back in the window, len does not exceed the free space */
+static int lz4_match_copy(size_t len)
+{
+	size_t src = (lz4.pos >= lz4.offset) ? (lz4.pos - lz4.offset) :
+					       (lz4.pos + lz4.window_size - lz4.offset);
+
+	while (len > 0) {
+		size_t run = MIN(len, lz4.window_size - src);
+		uint8_t *dst = &lz4_window[lz4.pos];
+		int rc;
+
+		if (src > lz4.pos || lz4.offset >= run) {
+			memmove(dst, &lz4_window[src], run);
+		} else {
+			/* The match overlaps its own output, repeating the last offset bytes */
+			for (size_t i = 0; i < run; i++) {
+				dst[i] = lz4_window[src + i];
+			}
+		}
+
+		rc = lz4_output(run);
+
+		if (rc) {
+			return rc;
+		}
+
+		src = (src + run == lz4.window_size) ? 0 : (src + run);
+		len -= run;
+	}
+
+	return 0;
+}
+
+/* Decode sequences until the input is used up or the window is full */
+static int lz4_decode(const uint8_t *input, size_t input_size, size_t *consumed)
+{
+	const uint8_t *in = input;
+	const uint8_t *const in_end = input + input_size;
+	int rc = 0;
+
+	while (rc == 0) {
+		size_t space = lz4.window_size - lz4.pos;
+		size_t len;
+
+		switch (lz4.state) {
+		case LZ4_STATE_TOKEN:
+			if (in == in_end) {
+				goto out;
+			}
+
+			lz4.token = *in++;
+			lz4.length = lz4.token >> 4;
+			lz4.state = (lz4.length == LZ4_LENGTH_MORE) ? LZ4_STATE_LITERAL_LENGTH :
+								      LZ4_STATE_LITERALS;
+			break;
+
+		case LZ4_STATE_LITERAL_LENGTH:
+		case LZ4_STATE_MATCH_LENGTH:
+			if (in == in_end) {
+				goto out;
+			}
+
+			if (lz4.length > UINT32_MAX - LZ4_LENGTH_BYTE_MORE) {
+				return -EINVAL;
+			}
+
+			lz4.length += *in;
+
+			if (*in++ != LZ4_LENGTH_BYTE_MORE) {
+				lz4.state = (lz4.state == LZ4_STATE_LITERAL_LENGTH) ?
+					    LZ4_STATE_LITERALS : LZ4_STATE_MATCH;
+			}
+			break;
+
+		case LZ4_STATE_LITERALS:
+			if (lz4.length == 0) {
+				lz4.state = LZ4_STATE_OFFSET_LOW;
+				break;
+			}
+
+			len = MIN(MIN(lz4.length, (size_t)(in_end - in)), space);
+
+			if (len == 0) {
+				goto out;
+			}
+
+			memcpy(&lz4_window[lz4.pos], in, len);
+			in += len;
+			lz4.length -= len;
+			rc = lz4_output(len);
+			break;
+
+		case LZ4_STATE_OFFSET_LOW:
+			if (in == in_end) {
+				goto out;
+			}
+
+			lz4.offset = *in++;
+			lz4.state = LZ4_STATE_OFFSET_HIGH;
+			break;
+
+		case LZ4_STATE_OFFSET_HIGH:
+			if (in == in_end) {
+				goto out;
+			}
+
+			lz4.offset |= (uint16_t)(*in++) << 8;
+
+			if (lz4.offset == 0 || lz4.offset > lz4.history) {
+				LOG_ERR("Invalid LZ4 match offset %d", lz4.offset);
+				return -EINVAL;
+			}
+
+			lz4.length = (lz4.token & 0x0f) + LZ4_MIN_MATCH;
+			lz4.state = ((lz4.token & 0x0f) == LZ4_LENGTH_MORE) ?
+				    LZ4_STATE_MATCH_LENGTH : LZ4_STATE_MATCH;
+			break;
+
+		case LZ4_STATE_MATCH:
+			len = MIN(lz4.length, space);
+
+			if (len == 0) {
+				goto out;
+			}
+
+			lz4.length -= len;
+			rc = lz4_match_copy(len);
+
+			if (lz4.length == 0) {
+				lz4.state = LZ4_STATE_TOKEN;
+			}
+			break;
+		}
+	}
+
+out:
+	*consumed = in - input;
+
+	return rc;
+}
+
+static int lz4_decompress(void *inst, const uint8_t *input, size_t input_size, bool last_part,
+			  uint32_t *offset, uint8_t **output, size_t *output_size)
+{
+	size_t consumed;
+	int rc;
+
+	ARG_UNUSED(inst);
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (lz4_window == NULL) {
+		return -ESRCH;
+	}
+#endif
+
+	if (input == NULL || input_size == 0 || offset == NULL || output == NULL ||
+	    output_size == NULL) {
+		return -EINVAL;
+	}
+
+	*output = NULL;
+	*output_size = 0;
+
+	if (lz4.skip_byte) {
+		input++;
+		input_size--;
+	}
+
+	if (!lz4.header_parsed) {
+		if (input_size < LZ4_HEADER_SIZE) {
+			return -EINVAL;
+		}
+
+		rc = lz4_header_parse(input);
+
+		if (rc == 0) {
+			*offset = LZ4_HEADER_SIZE;
+		}
+
+		return rc;
+	}
+
+	rc = lz4_decode(input, input_size, &consumed);
+
+	if (rc) {
+		return rc;
+	}
+
+	if (lz4.skip_byte) {
+		lz4.skip_byte = false;
+		consumed++;
+		input_size++;
+	}
+
+	if (consumed == input_size && lz4.pos == lz4.window_size &&
+	    lz4.state == LZ4_STATE_MATCH) {
+		/* The window is full in the middle of a match. Report the last input byte as
+		 * unused, so that the caller calls again for the rest of the match.
+		 */
+		consumed--;
+		lz4.skip_byte = true;
+	}
+
+	*offset = consumed;
+
+	if (last_part && consumed == input_size) {
+		/* The stream must end after the literals of a sequence, and with all the
+		 * expected data if its size is known.
+		 */
+		if (lz4.state != LZ4_STATE_OFFSET_LOW ||
+		    (lz4.output_size_known && lz4.output_limit != 0)) {
+			LOG_ERR("LZ4 stream ended unexpectedly");
+			return -EINVAL;
+		}
+	}
+
+	if (lz4.pos == lz4.window_size || last_part) {
+		*output = lz4_window;
+		*output_size = lz4.pos;
+		lz4.pos = 0;
+	}
+
+	return 0;
+}
+
+NRF_COMPRESS_IMPLEMENTATION_DEFINE(lz4, NRF_COMPRESS_TYPE_LZ4, lz4_init, lz4_deinit, lz4_reset,
+				   NULL, lz4_bytes_needed, lz4_decompress);
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PROFILER_BACKEND_H_
+#define _PROFILER_BACKEND_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief Transport used by the Nordic nrf_profiler to exchange data with the host.
+ *
+ * The backend provides three logical channels: event data and system information sent to
+ * the host, and commands received from the host.
+ */
+struct nrf_profiler_backend {
+	/** Initialize the backend. Called once from nrf_profiler_init(). */
+	int (*init)(void);
+
+	/** Send a single event. The event must be either sent as a whole or not at all.
+	 *
+	 * Called from the profiler thread if the event buffer is enabled. Otherwise, called
+	 * from the context that submits the event, with interrupts locked.
+	 *
+	 * @retval 0 If the event was sent.
+	 * @retval -ENOBUFS If there is no space for the event.
+	 */
+	int (*data_send)(const uint8_t *data, size_t len);
+
+	/** Restart the system information. Optional.
+	 *
+	 * Backends that store the information instead of streaming it discard the previously
+	 * sent information here.
+	 */
+	void (*info_begin)(void);
+
+	/** Send a part of the system information. Called from the profiler thread.
+	 *
+	 * @retval 0 If the data was sent.
+	 * @retval -ENOBUFS If there is no space for the data at the moment.
+	 */
+	int (*info_send)(const uint8_t *data, size_t len);
+
+	/** Read a command from the host. Optional.
+	 *
+	 * Without the command channel, profiling starts on initialization and the system
+	 * information is sent again each time a new event type is registered.
+	 *
+	 * @retval 1 If a command was read.
+	 * @retval 0 If no command is pending.
+	 */
+	int (*command_read)(uint8_t *cmd);
+};
+
+/** @brief Backend selected in Kconfig. */
+extern const struct nrf_profiler_backend nrf_profiler_backend;
+
+#endif /* _PROFILER_BACKEND_H_ */
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include "profiler_backend.h"
+#include "profiler_backend_file_bottom.h"
+
+/* Events are written to <prefix>.data and the system information to <prefix>.info,
+ * in the same format as on the RTT data and info channels.
+ */
+#define FILE_PATH_LEN (sizeof(CONFIG_NRF_PROFILER_NORDIC_BACKEND_FILE_PREFIX) + sizeof(".data"))
+
+static int data_fd = -1;
+static int info_fd = -1;
+
+static int file_open(const char *suffix)
+{
+	char path[FILE_PATH_LEN];
+
+	(void)snprintf(path, sizeof(path), "%s%s",
+		       CONFIG_NRF_PROFILER_NORDIC_BACKEND_FILE_PREFIX, suffix);
+
+	return nrf_profiler_file_open(path);
+}
+
+static int file_init(void)
+{
+	data_fd = file_open(".data");
+	if (data_fd < 0) {
+		return data_fd;
+	}
+
+	info_fd = file_open(".info");
+	if (info_fd < 0) {
+		return info_fd;
+	}
+
+	return 0;
+}
+
+static int file_data_send(const uint8_t *data, size_t len)
+{
+	if (data_fd < 0) {
+		return -EBADF;
+	}
+
+	return nrf_profiler_file_write(data_fd, data, len);
+}
+
+static void file_info_begin(void)
+{
+	if (info_fd >= 0) {
+		(void)nrf_profiler_file_truncate(info_fd);
+	}
+}
+
+static int file_info_send(const uint8_t *data, size_t len)
+{
+	if (info_fd < 0) {
+		return -EBADF;
+	}
+
+	return nrf_profiler_file_write(info_fd, data, len);
+}
+
+const struct nrf_profiler_backend nrf_profiler_backend = {
+	.init = file_init,
+	.data_send = file_data_send,
+	.info_begin = file_info_begin,
+	.info_send = file_info_send,
+};
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "profiler_backend_file_bottom.h"
+
+int nrf_profiler_file_open(const char *path)
+{
+	int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+	return (fd < 0) ? -errno : fd;
+}
+
+int nrf_profiler_file_truncate(int fd)
+{
+	if ((ftruncate(fd, 0) < 0) || (lseek(fd, 0, SEEK_SET) < 0)) {
+		return -errno;
+	}
+
+	return 0;
+}
+
+int nrf_profiler_file_write(int fd, const void *data, size_t len)
+{
+	const char *pos = data;
+
+	while (len > 0) {
+		ssize_t ret = write(fd, pos, len);
+
+		if (ret < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return -errno;
+		}
+
+		pos += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
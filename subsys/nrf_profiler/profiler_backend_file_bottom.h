@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PROFILER_BACKEND_FILE_BOTTOM_H_
+#define _PROFILER_BACKEND_FILE_BOTTOM_H_
+
+/* Host side of the file backend. These functions are built with the host C library,
+ * so only basic types can be used in the interface.
+ */
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Create or truncate a file. Return the file descriptor or a negative error code. */
+int nrf_profiler_file_open(const char *path);
+
+/* Discard the content of the file. Return 0 or a negative error code. */
+int nrf_profiler_file_truncate(int fd);
+
+/* Write all the data to the file. Return 0 or a negative error code. */
+int nrf_profiler_file_write(int fd, const void *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PROFILER_BACKEND_FILE_BOTTOM_H_ */
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <zephyr/sys/__assert.h>
+#include <SEGGER_RTT.h>
+#include "profiler_backend.h"
+
+static uint8_t buffer_data[CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE];
+static uint8_t buffer_info[CONFIG_NRF_PROFILER_NORDIC_INFO_BUFFER_SIZE];
+static uint8_t buffer_commands[CONFIG_NRF_PROFILER_NORDIC_COMMAND_BUFFER_SIZE];
+
+static int rtt_init(void)
+{
+	int ret;
+
+	ret = SEGGER_RTT_ConfigUpBuffer(
+		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
+		"Nordic nrf_profiler data",
+		buffer_data,
+		CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE,
+		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+	__ASSERT_NO_MSG(ret >= 0);
+
+	ret = SEGGER_RTT_ConfigUpBuffer(
+		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
+		"Nordic nrf_profiler info",
+		buffer_info,
+		CONFIG_NRF_PROFILER_NORDIC_INFO_BUFFER_SIZE,
+		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+	__ASSERT_NO_MSG(ret >= 0);
+
+	ret = SEGGER_RTT_ConfigDownBuffer(
+		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_COMMANDS,
+		"Nordic nrf_profiler command",
+		buffer_commands,
+		CONFIG_NRF_PROFILER_NORDIC_COMMAND_BUFFER_SIZE,
+		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+	__ASSERT_NO_MSG(ret >= 0);
+
+	return 0;
+}
+
+static int rtt_data_send(const uint8_t *data, size_t len)
+{
+	/* In the SKIP mode, data is written only if it fits in the buffer as a whole. */
+	if (SEGGER_RTT_WriteNoLock(CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
+				   data, len) != len) {
+		return -ENOBUFS;
+	}
+
+	return 0;
+}
+
+static int rtt_info_send(const uint8_t *data, size_t len)
+{
+	if (SEGGER_RTT_WriteNoLock(CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
+				   data, len) != len) {
+		return -ENOBUFS;
+	}
+
+	return 0;
+}
+
+static int rtt_command_read(uint8_t *cmd)
+{
+	return (SEGGER_RTT_Read(CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_COMMANDS,
+				cmd, sizeof(*cmd)) > 0) ? 1 : 0;
+}
+
+const struct nrf_profiler_backend nrf_profiler_backend = {
+	.init = rtt_init,
+	.data_send = rtt_data_send,
+	.info_send = rtt_info_send,
+	.command_read = rtt_command_read,
+};
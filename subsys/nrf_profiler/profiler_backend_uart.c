@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include "profiler_backend.h"
+
+/* Data and information are multiplexed on a single UART. Each frame consists of
+ * the channel ID, the payload, and the CRC-16/CCITT of both (16-bit little-endian).
+ * Frames are delimited by flag octets, and flag and escape octets inside a frame are
+ * escaped as in HDLC, so that the host can find the next frame after connecting in
+ * the middle of one or losing data. Commands are received as single bytes.
+ */
+#define FRAME_CHANNEL_DATA 0
+#define FRAME_CHANNEL_INFO 1
+
+#define HDLC_FLAG   0x7e
+#define HDLC_ESCAPE 0x7d
+#define HDLC_XOR    0x20
+
+static const struct device *const uart_dev = DEVICE_DT_GET(DT_CHOSEN(nordic_profiler_uart));
+
+static int uart_init(void)
+{
+	if (!device_is_ready(uart_dev)) {
+		return -ENODEV;
+	}
+
+	return 0;
+}
+
+static void octet_send(uint8_t byte)
+{
+	if ((byte == HDLC_FLAG) || (byte == HDLC_ESCAPE)) {
+		uart_poll_out(uart_dev, HDLC_ESCAPE);
+		byte ^= HDLC_XOR;
+	}
+
+	uart_poll_out(uart_dev, byte);
+}
+
+static void frame_send(uint8_t channel, const uint8_t *data, size_t len)
+{
+	uint16_t crc = crc16_ccitt(0xffff, &channel, sizeof(channel));
+	uint8_t crc_buf[sizeof(crc)];
+
+	crc = crc16_ccitt(crc, data, len);
+	sys_put_le16(crc, crc_buf);
+
+	uart_poll_out(uart_dev, HDLC_FLAG);
+	octet_send(channel);
+
+	for (size_t i = 0; i < len; i++) {
+		octet_send(data[i]);
+	}
+
+	for (size_t i = 0; i < sizeof(crc_buf); i++) {
+		octet_send(crc_buf[i]);
+	}
+
+	uart_poll_out(uart_dev, HDLC_FLAG);
+}
+
+static int uart_data_send(const uint8_t *data, size_t len)
+{
+	frame_send(FRAME_CHANNEL_DATA, data, len);
+
+	return 0;
+}
+
+static int uart_info_send(const uint8_t *data, size_t len)
+{
+	frame_send(FRAME_CHANNEL_INFO, data, len);
+
+	return 0;
+}
+
+static int uart_command_read(uint8_t *cmd)
+{
+	return (uart_poll_in(uart_dev, cmd) == 0) ? 1 : 0;
+}
+
+const struct nrf_profiler_backend nrf_profiler_backend = {
+	.init = uart_init,
+	.data_send = uart_data_send,
+	.info_send = uart_info_send,
+	.command_read = uart_command_read,
+};
@@ -9,12 +9,11 @@
 #include <zephyr/sys/time_units.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/kernel.h>
-#include <SEGGER_RTT.h>
 #include <nrf_profiler.h>
 #include <string.h>
-#include <nrfx.h>
-
+#include "profiler_backend.h"
 
 enum state {
 	STATE_DISABLED,
@@ -29,7 +28,37 @@ struct nrf_profiler_event_enabled_bm _nrf_profiler_event_enabled_bm;
 static K_SEM_DEFINE(nrf_profiler_sem, 0, 1);
 static atomic_t nrf_profiler_state;
 static uint16_t fatal_error_event_id;
+static atomic_t dropped_events_total;
+
+/* Period of polling the host commands while profiling is not active */
+#define THREAD_PERIOD_INACTIVE K_MSEC(500)
+
+#ifdef CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER
+#define EVENT_BUFFER_COUNT CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER_COUNT
+BUILD_ASSERT(IS_POWER_OF_TWO(EVENT_BUFFER_COUNT),
+	     "Number of events in the event buffer must be a power of two");
+
+/* Events are stored in a bounded multi-producer ring. Every slot holds a sequence number
+ * that tells whether the slot is free for the write at a given position (seq == pos) or
+ * holds an event to be read at a given position (seq == pos + 1). A producer reserves
+ * a slot by advancing the head with compare-and-swap, so that events can be submitted
+ * from any thread or interrupt without locking. The profiler thread is the only consumer.
+ */
+struct event_slot {
+	atomic_t seq;
+	uint16_t len;
+	uint8_t data[CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN];
+};
+
+static struct event_slot event_buffer[EVENT_BUFFER_COUNT];
+static atomic_t event_buffer_head;
+static unsigned long event_buffer_tail;
+/* Events dropped since the last dropped events report */
+static atomic_t dropped_events;
+static uint16_t dropped_events_event_id;
+#else
 static struct k_spinlock lock;
+#endif /* CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER */
 
 enum nordic_command {
 	NORDIC_COMMAND_START	= 1,
@@ -52,10 +81,6 @@ static char *arg_types_encodings[] = {
 
 uint8_t nrf_profiler_num_events;
 
-static uint8_t buffer_data[CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE];
-static uint8_t buffer_info[CONFIG_NRF_PROFILER_NORDIC_INFO_BUFFER_SIZE];
-static uint8_t buffer_commands[CONFIG_NRF_PROFILER_NORDIC_COMMAND_BUFFER_SIZE];
-
 static k_tid_t protocol_thread_id;
 
 static K_THREAD_STACK_DEFINE(nrf_profiler_nordic_stack,
@@ -67,22 +92,18 @@ static int send_info_data(const char *data, size_t data_len)
 	uint8_t retry_cnt = 0;
 	static const uint8_t retry_cnt_max = 100;
 
-	size_t num_bytes_send;
+	int err;
 
-	num_bytes_send = SEGGER_RTT_WriteNoLock(
-				  CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
-				  data, data_len);
+	err = nrf_profiler_backend.info_send((const uint8_t *)data, data_len);
 
-	while (num_bytes_send != data_len) {
+	while (err == -ENOBUFS) {
 		/* Give host time to read the data and free some space
 		 * in the buffer. */
 		k_sleep(K_MSEC(100));
-		num_bytes_send = SEGGER_RTT_WriteNoLock(
-				  CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
-				  data, data_len);
+		err = nrf_profiler_backend.info_send((const uint8_t *)data, data_len);
 
 		/* Avoid being blocked in while loop if host does not read
-		 * the RTT data.
+		 * the data.
 		 */
 		retry_cnt++;
 		if (retry_cnt > retry_cnt_max) {
@@ -90,7 +111,7 @@ static int send_info_data(const char *data, size_t data_len)
 		}
 	}
 
-	return 0;
+	return err;
 }
 
 static int send_system_description(void)
@@ -104,7 +125,7 @@ static int send_system_description(void)
 	static const char * const ev_info_stop = "<ev_info_stop>\n";
 	static const char end_line = '\n';
 
-	__DMB();
+	barrier_dmem_fence_full();
 
 	err = send_info_data(ev_info_start, strlen(ev_info_start));
 	if (err) {
@@ -163,17 +184,150 @@ static int send_system_configuration(void)
 	return err;
 }
 
+static int send_info(void)
+{
+	int err;
+	static const char end_line = '\n';
+
+	if (nrf_profiler_backend.info_begin) {
+		nrf_profiler_backend.info_begin();
+	}
+
+	err = send_system_description();
+	if (err) {
+		return err;
+	}
+
+	err = send_system_configuration();
+	if (err) {
+		return err;
+	}
+
+	return send_info_data(&end_line, 1);
+}
+
+#ifdef CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER
+static void event_buffer_init(void)
+{
+	for (size_t i = 0; i < EVENT_BUFFER_COUNT; i++) {
+		atomic_set(&event_buffer[i].seq, i);
+	}
+}
+
+static bool event_buffer_put(const uint8_t *data, size_t len)
+{
+	unsigned long pos = atomic_get(&event_buffer_head);
+	struct event_slot *slot;
+
+	while (true) {
+		slot = &event_buffer[pos & (EVENT_BUFFER_COUNT - 1)];
+
+		long diff = (long)((unsigned long)atomic_get(&slot->seq) - pos);
+
+		if (diff == 0) {
+			if (atomic_cas(&event_buffer_head, pos, pos + 1)) {
+				break;
+			}
+		} else if (diff < 0) {
+			/* The slot still holds an event that was not sent. */
+			return false;
+		}
+
+		/* Another context has taken the slot, retry with the current head. */
+		pos = atomic_get(&event_buffer_head);
+	}
+
+	memcpy(slot->data, data, len);
+	slot->len = len;
+	/* Publish the event. Atomic store is a full memory barrier. */
+	atomic_set(&slot->seq, pos + 1);
+
+	/* Wake up the profiler thread each time half of the buffer has been filled. */
+	if (((pos & (EVENT_BUFFER_COUNT / 2 - 1)) == 0) && protocol_thread_id) {
+		k_wakeup(protocol_thread_id);
+	}
+
+	return true;
+}
+
+static void event_drop(uint32_t cnt)
+{
+	atomic_add(&dropped_events, cnt);
+	atomic_add(&dropped_events_total, cnt);
+}
+
+static void dropped_events_report(void)
+{
+	uint32_t cnt;
+	struct log_event_buf buf;
+
+	if ((atomic_get(&nrf_profiler_state) != STATE_ACTIVE) ||
+	    !is_profiling_enabled(dropped_events_event_id)) {
+		return;
+	}
+
+	cnt = atomic_set(&dropped_events, 0);
+	if (cnt == 0) {
+		return;
+	}
+
+	nrf_profiler_log_start(&buf);
+	nrf_profiler_log_encode_uint32(&buf, cnt);
+	buf.payload_start[0] = (uint8_t)dropped_events_event_id;
+
+	if (!event_buffer_put(buf.payload_start, buf.payload - buf.payload_start)) {
+		/* Report the events in the next attempt. */
+		atomic_add(&dropped_events, cnt);
+	}
+}
+
+static void event_buffer_drain(void)
+{
+	while (true) {
+		struct event_slot *slot = &event_buffer[event_buffer_tail &
+							(EVENT_BUFFER_COUNT - 1)];
+
+		if ((unsigned long)atomic_get(&slot->seq) != event_buffer_tail + 1) {
+			/* Buffer empty or the event is still being written. */
+			break;
+		}
+
+		if (nrf_profiler_backend.data_send(slot->data, slot->len)) {
+			/* Host does not keep up, retry in the next period. Events that do not
+			 * fit in the buffer in the meantime are dropped.
+			 */
+			break;
+		}
+
+		atomic_set(&slot->seq, event_buffer_tail + EVENT_BUFFER_COUNT);
+		event_buffer_tail++;
+	}
+}
+
+#define THREAD_PERIOD K_MSEC(CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER_DRAIN_PERIOD)
+#else
+#define THREAD_PERIOD THREAD_PERIOD_INACTIVE
+#endif /* CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER */
+
+static void info_update(void)
+{
+	static uint8_t info_events;
+
+	if (!nrf_profiler_backend.command_read && (info_events != nrf_profiler_num_events)) {
+		/* The host cannot request the information, so keep it up to date. */
+		info_events = nrf_profiler_num_events;
+		(void)send_info();
+	}
+}
+
 static void nrf_profiler_nordic_thread_fn(void)
 {
-	int ret_err;
 	uint8_t read_data;
 	enum nordic_command command;
-	static const char end_line = '\n';
 
 	while (atomic_get(&nrf_profiler_state) != STATE_TERMINATED) {
-		if (SEGGER_RTT_Read(
-		     CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_COMMANDS,
-		     &read_data, sizeof(read_data))) {
+		if (nrf_profiler_backend.command_read &&
+		    nrf_profiler_backend.command_read(&read_data)) {
 			command = (enum nordic_command)read_data;
 			switch (command) {
 			case NORDIC_COMMAND_START:
@@ -183,21 +337,29 @@ static void nrf_profiler_nordic_thread_fn(void)
 				atomic_cas(&nrf_profiler_state, STATE_ACTIVE, STATE_INACTIVE);
 				break;
 			case NORDIC_COMMAND_INFO:
-				ret_err = send_system_description();
-				if (ret_err) {
-					break;
-				}
-				ret_err = send_system_configuration();
-				if (!ret_err) {
-					(void)send_info_data(&end_line, 1);
-				}
+				(void)send_info();
 				break;
 			default:
 				break;
 			}
 		}
-		k_sleep(K_MSEC(500));
+
+		info_update();
+
+#ifdef CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER
+		dropped_events_report();
+		event_buffer_drain();
+#endif
+		/* While profiling is stopped, only the host commands need to be polled. */
+		k_sleep((atomic_get(&nrf_profiler_state) == STATE_ACTIVE) ?
+			THREAD_PERIOD : THREAD_PERIOD_INACTIVE);
 	}
+
+#ifdef CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER
+	/* Send the events submitted before the termination. */
+	event_buffer_drain();
+#endif
+	info_update();
 	k_sem_give(&nrf_profiler_sem);
 }
 
@@ -217,35 +379,23 @@ int nrf_profiler_init(void)
 		}
 	}
 
-	if (IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_START_LOGGING_ON_SYSTEM_START)) {
-		atomic_cas(&nrf_profiler_state, STATE_INACTIVE, STATE_ACTIVE);
+	int err = nrf_profiler_backend.init();
+
+	if (err) {
+		atomic_set(&nrf_profiler_state, STATE_DISABLED);
+		k_sched_unlock();
+		return err;
 	}
 
-	int ret;
-
-	ret = SEGGER_RTT_ConfigUpBuffer(
-		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
-		"Nordic nrf_profiler data",
-		buffer_data,
-		CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE,
-		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
-	__ASSERT_NO_MSG(ret >= 0);
-
-	ret = SEGGER_RTT_ConfigUpBuffer(
-		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
-		"Nordic nrf_profiler info",
-		buffer_info,
-		CONFIG_NRF_PROFILER_NORDIC_INFO_BUFFER_SIZE,
-		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
-	__ASSERT_NO_MSG(ret >= 0);
-
-	ret = SEGGER_RTT_ConfigDownBuffer(
-		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_COMMANDS,
-		"Nordic nrf_profiler command",
-		buffer_commands,
-		CONFIG_NRF_PROFILER_NORDIC_COMMAND_BUFFER_SIZE,
-		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
-	__ASSERT_NO_MSG(ret >= 0);
+#ifdef CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER
+	event_buffer_init();
+#endif
+
+	/* Without the command channel, the host cannot start profiling. */
+	if (IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_START_LOGGING_ON_SYSTEM_START) ||
+	    !nrf_profiler_backend.command_read) {
+		atomic_cas(&nrf_profiler_state, STATE_INACTIVE, STATE_ACTIVE);
+	}
 
 	protocol_thread_id =  k_thread_create(&nrf_profiler_nordic_thread,
 			nrf_profiler_nordic_stack,
@@ -258,6 +408,16 @@ int nrf_profiler_init(void)
 	fatal_error_event_id = nrf_profiler_register_event_type("_nrf_profiler_fatal_error_event_",
 							    NULL, NULL, 0);
 
+#ifdef CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER
+	static const char * const dropped_events_args[] = {"count"};
+	static const enum nrf_profiler_arg dropped_events_types[] = {NRF_PROFILER_ARG_U32};
+
+	/* Registering event reporting the number of dropped events */
+	dropped_events_event_id = nrf_profiler_register_event_type(
+					"_nrf_profiler_dropped_events_", dropped_events_args,
+					dropped_events_types, ARRAY_SIZE(dropped_events_args));
+#endif
+
 	k_sched_unlock();
 	return 0;
 }
@@ -319,7 +479,7 @@ uint16_t nrf_profiler_register_event_type(const char *name, const char * const *
 	/* Memory barrier to make sure that data is visible
 	 * before being accessed
 	 */
-	__DMB();
+	barrier_dmem_fence_full();
 	nrf_profiler_num_events++;
 	k_sched_unlock();
 
@@ -394,18 +554,34 @@ void nrf_profiler_log_encode_string(struct log_event_buf *buf, const char *strin
 void nrf_profiler_log_add_mem_address(struct log_event_buf *buf,
 				  const void *mem_address)
 {
-	nrf_profiler_log_encode_uint32(buf, (uint32_t)mem_address);
+	nrf_profiler_log_encode_uint32(buf, (uint32_t)(uintptr_t)mem_address);
+}
+
+uint32_t nrf_profiler_dropped_events_get(void)
+{
+	return atomic_get(&dropped_events_total);
 }
 
-static bool nrf_profiler_RTT_send(struct log_event_buf *buf, uint8_t type_id)
+#ifdef CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER
+void nrf_profiler_log_send(struct log_event_buf *buf, uint16_t event_type_id)
+{
+	__ASSERT_NO_MSG(event_type_id <= UINT8_MAX);
+
+	if (atomic_get(&nrf_profiler_state) == STATE_ACTIVE) {
+		buf->payload_start[0] = event_type_id & UINT8_MAX;
+
+		if (!event_buffer_put(buf->payload_start, buf->payload - buf->payload_start)) {
+			event_drop(1);
+		}
+	}
+}
+#else
+static bool nrf_profiler_backend_send(struct log_event_buf *buf, uint8_t type_id)
 {
 	buf->payload_start[0] = type_id;
 	size_t data_len = buf->payload - buf->payload_start;
 
-	size_t num_bytes_send = SEGGER_RTT_WriteNoLock(
-			CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
-			buf->payload_start, data_len);
-	return (num_bytes_send == data_len);
+	return (nrf_profiler_backend.data_send(buf->payload_start, data_len) == 0);
 }
 
 static void nrf_profiler_fatal_error(void)
@@ -415,7 +591,7 @@ static void nrf_profiler_fatal_error(void)
 	nrf_profiler_log_start(&buf);
 	while (true) {
 		/* Sending Fatal Error event */
-		if (nrf_profiler_RTT_send(&buf, (uint8_t)fatal_error_event_id)) {
+		if (nrf_profiler_backend_send(&buf, (uint8_t)fatal_error_event_id)) {
 			break;
 		}
 	}
@@ -431,9 +607,10 @@ void nrf_profiler_log_send(struct log_event_buf *buf, uint16_t event_type_id)
 
 		k_spinlock_key_t key = k_spin_lock(&lock);
 
-		if (!nrf_profiler_RTT_send(buf, type_id)) {
+		if (!nrf_profiler_backend_send(buf, type_id)) {
 			nrf_profiler_fatal_error();
 		}
 		k_spin_unlock(&lock, key);
 	}
 }
+#endif /* CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER */
@@ -9,16 +9,44 @@
 #include <nrf_rpc/nrf_rpc_uart.h>
 #include <nrf_rpc_errno.h>
 
+#include <string.h>
+
 #include <zephyr/drivers/uart.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/crc.h>
+#include <zephyr/sys/math_extras.h>
 
 LOG_MODULE_REGISTER(nrf_rpc_uart, CONFIG_NRF_RPC_TR_LOG_LEVEL);
 
 #define CRC_SIZE sizeof(uint16_t)
 
+#if defined(CONFIG_NRF_RPC_UART_TX_WINDOW) && (CONFIG_NRF_RPC_UART_TX_WINDOW > 1)
+#define TX_WINDOWED    1
+#define TX_WINDOW_SIZE CONFIG_NRF_RPC_UART_TX_WINDOW
+#define SEQ_SIZE       sizeof(uint8_t)
+
+/* The most significant bit of the sequence field marks a frame that resynchronizes
+ * the receiver. The remaining bits hold the sequence number.
+ */
+#define SEQ_SYNC BIT(7)
+#define SEQ_MASK BIT_MASK(7)
+
+/* Received frames up to this far behind the expected one are duplicates. */
+#define SEQ_HALF BIT(6)
+
+BUILD_ASSERT(TX_WINDOW_SIZE < SEQ_HALF);
+BUILD_ASSERT(TX_WINDOW_SIZE <= sizeof(atomic_t) * BITS_PER_BYTE);
+#else
+#define TX_WINDOWED    0
+#define TX_WINDOW_SIZE 1
+#define SEQ_SIZE       0
+#endif
+
+/* Acknowledgment frame payload: the sequence field, if used, followed by the checksum field. */
+#define ACK_SIZE (SEQ_SIZE + CRC_SIZE)
+
 enum {
 	HDLC_CHAR_ESCAPE = 0x7d,
 	HDLC_CHAR_DELIMITER = 0x7e,
@@ -54,6 +82,41 @@ struct hdlc_decode_ctx {
 	uint16_t capacity;
 };
 
+#if TX_WINDOWED
+struct tx_slot {
+	/* Packet owned by the transport until it is acknowledged. */
+	const uint8_t *data;
+	size_t len;
+
+	/* Time after which the packet is retransmitted. */
+	k_timepoint_t deadline;
+
+	uint16_t crc;
+	uint8_t seq;
+	uint8_t attempts;
+};
+
+enum rx_seq_result {
+	/* Expected packet, pass it to nRF RPC. */
+	RX_SEQ_NEW,
+	/* Packet already received, only acknowledge it again. */
+	RX_SEQ_DUPLICATE,
+	/* Packet following a lost one, drop it without acknowledgment. */
+	RX_SEQ_UNEXPECTED,
+};
+#endif /* TX_WINDOWED */
+
+#if CONFIG_NRF_RPC_UART_RX_QUEUE
+/* Size of a pool block that holds a decoded packet */
+#define RX_PKT_BLOCK_SIZE ROUND_UP(CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE, sizeof(void *))
+
+struct rx_pkt_item {
+	/* Pool block holding the packet, preceded by the sequence field if used */
+	uint8_t *buf;
+	size_t len;
+};
+#endif
+
 struct nrf_rpc_uart {
 	const struct device *uart;
 	nrf_rpc_tr_receive_handler_t receive_callback;
@@ -70,13 +133,43 @@ struct nrf_rpc_uart {
 
 	K_KERNEL_STACK_MEMBER(rx_workq_stack, CONFIG_NRF_RPC_UART_RX_THREAD_STACK_SIZE);
 
+#if CONFIG_NRF_RPC_UART_ASYNC
+	/* RX buffers written by the UART */
+	uint8_t rx_dma_buf[2][CONFIG_NRF_RPC_UART_ASYNC_RX_BUF_SIZE];
+	uint8_t rx_dma_buf_idx;
+
+	/* TX buffers, a frame is encoded into one while the other is being transmitted */
+	uint8_t tx_buf[2][CONFIG_NRF_RPC_UART_ASYNC_TX_BUF_SIZE];
+	uint8_t tx_buf_idx;
+	size_t tx_buf_len;
+
+	/* Available when no TX transfer is in progress */
+	struct k_sem tx_done_sem;
+#endif
+
 	/* HDLC ack decoding state */
 	struct hdlc_decode_ctx rx_ack_ctx;
-	uint8_t rx_ack[CRC_SIZE];
+	uint8_t rx_ack[ACK_SIZE];
 
 	/* HDLC packet decoding state */
 	struct hdlc_decode_ctx rx_pkt_ctx;
+#if CONFIG_NRF_RPC_UART_RX_QUEUE
+	/* Pool block the current packet is decoded into */
+	uint8_t *rx_pkt;
+
+	/* Decoded packets are passed to nRF RPC from a separate work queue */
+	uint8_t rx_pkt_pool[CONFIG_NRF_RPC_UART_RX_PKT_COUNT][RX_PKT_BLOCK_SIZE] __aligned(
+		sizeof(void *));
+	struct k_mem_slab rx_pkt_slab;
+	struct rx_pkt_item rx_pkt_msgq_buf[CONFIG_NRF_RPC_UART_RX_PKT_COUNT];
+	struct k_msgq rx_pkt_msgq;
+	struct k_work rx_deliver_work;
+	struct k_work_q rx_deliver_workq;
+
+	K_KERNEL_STACK_MEMBER(rx_deliver_workq_stack, CONFIG_NRF_RPC_UART_RX_DELIVER_STACK_SIZE);
+#else
 	uint8_t rx_pkt[CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE];
+#endif
 
 	/* Ack waiting semaphore */
 	struct k_sem ack_sem;
@@ -84,10 +177,84 @@ struct nrf_rpc_uart {
 	struct k_mutex ack_tx_lock;
 	struct trx_flips flips;
 
+#if TX_WINDOWED
+	/* Packets sent and not yet released, starting from the oldest one */
+	struct tx_slot tx_window[TX_WINDOW_SIZE];
+	uint8_t tx_head;
+	uint8_t tx_cnt;
+	uint8_t tx_seq;
+
+	/* The next packet must resynchronize the receiver */
+	bool tx_sync;
+
+	/* Window slots visible to the ack handler and slots acknowledged by the peer */
+	atomic_t tx_inflight;
+	atomic_t tx_acked;
+
+	/* Retransmits packets if no further packet is sent */
+	struct k_work_delayable tx_retx_work;
+
+	/* Sequence number expected in the next received packet */
+	uint8_t rx_seq;
+	bool rx_synced;
+	uint16_t last_rx_crc;
+#endif
+
 	/* TX lock */
 	struct k_mutex tx_lock;
 };
 
+#if CONFIG_NRF_RPC_UART_CRC_TABLE
+/* CRC-16/CCITT lookup table, for the reflected polynomial 0x8408 */
+static const uint16_t crc16_table[256] = {
+	0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
+	0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
+	0x1081, 0x0108, 0x3393, 0x221a, 0x56a5, 0x472c, 0x75b7, 0x643e,
+	0x9cc9, 0x8d40, 0xbfdb, 0xae52, 0xdaed, 0xcb64, 0xf9ff, 0xe876,
+	0x2102, 0x308b, 0x0210, 0x1399, 0x6726, 0x76af, 0x4434, 0x55bd,
+	0xad4a, 0xbcc3, 0x8e58, 0x9fd1, 0xeb6e, 0xfae7, 0xc87c, 0xd9f5,
+	0x3183, 0x200a, 0x1291, 0x0318, 0x77a7, 0x662e, 0x54b5, 0x453c,
+	0xbdcb, 0xac42, 0x9ed9, 0x8f50, 0xfbef, 0xea66, 0xd8fd, 0xc974,
+	0x4204, 0x538d, 0x6116, 0x709f, 0x0420, 0x15a9, 0x2732, 0x36bb,
+	0xce4c, 0xdfc5, 0xed5e, 0xfcd7, 0x8868, 0x99e1, 0xab7a, 0xbaf3,
+	0x5285, 0x430c, 0x7197, 0x601e, 0x14a1, 0x0528, 0x37b3, 0x263a,
+	0xdecd, 0xcf44, 0xfddf, 0xec56, 0x98e9, 0x8960, 0xbbfb, 0xaa72,
+	0x6306, 0x728f, 0x4014, 0x519d, 0x2522, 0x34ab, 0x0630, 0x17b9,
+	0xef4e, 0xfec7, 0xcc5c, 0xddd5, 0xa96a, 0xb8e3, 0x8a78, 0x9bf1,
+	0x7387, 0x620e, 0x5095, 0x411c, 0x35a3, 0x242a, 0x16b1, 0x0738,
+	0xffcf, 0xee46, 0xdcdd, 0xcd54, 0xb9eb, 0xa862, 0x9af9, 0x8b70,
+	0x8408, 0x9581, 0xa71a, 0xb693, 0xc22c, 0xd3a5, 0xe13e, 0xf0b7,
+	0x0840, 0x19c9, 0x2b52, 0x3adb, 0x4e64, 0x5fed, 0x6d76, 0x7cff,
+	0x9489, 0x8500, 0xb79b, 0xa612, 0xd2ad, 0xc324, 0xf1bf, 0xe036,
+	0x18c1, 0x0948, 0x3bd3, 0x2a5a, 0x5ee5, 0x4f6c, 0x7df7, 0x6c7e,
+	0xa50a, 0xb483, 0x8618, 0x9791, 0xe32e, 0xf2a7, 0xc03c, 0xd1b5,
+	0x2942, 0x38cb, 0x0a50, 0x1bd9, 0x6f66, 0x7eef, 0x4c74, 0x5dfd,
+	0xb58b, 0xa402, 0x9699, 0x8710, 0xf3af, 0xe226, 0xd0bd, 0xc134,
+	0x39c3, 0x284a, 0x1ad1, 0x0b58, 0x7fe7, 0x6e6e, 0x5cf5, 0x4d7c,
+	0xc60c, 0xd785, 0xe51e, 0xf497, 0x8028, 0x91a1, 0xa33a, 0xb2b3,
+	0x4a44, 0x5bcd, 0x6956, 0x78df, 0x0c60, 0x1de9, 0x2f72, 0x3efb,
+	0xd68d, 0xc704, 0xf59f, 0xe416, 0x90a9, 0x8120, 0xb3bb, 0xa232,
+	0x5ac5, 0x4b4c, 0x79d7, 0x685e, 0x1ce1, 0x0d68, 0x3ff3, 0x2e7a,
+	0xe70e, 0xf687, 0xc41c, 0xd595, 0xa12a, 0xb0a3, 0x8238, 0x93b1,
+	0x6b46, 0x7acf, 0x4854, 0x59dd, 0x2d62, 0x3ceb, 0x0e70, 0x1ff9,
+	0xf78f, 0xe606, 0xd49d, 0xc514, 0xb1ab, 0xa022, 0x92b9, 0x8330,
+	0x7bc7, 0x6a4e, 0x58d5, 0x495c, 0x3de3, 0x2c6a, 0x1ef1, 0x0f78,
+};
+#endif
+
+static uint16_t crc16_calc(uint16_t seed, const uint8_t *data, size_t len)
+{
+#if CONFIG_NRF_RPC_UART_CRC_TABLE
+	for (size_t i = 0; i < len; i++) {
+		seed = (seed >> 8) ^ crc16_table[(seed ^ data[i]) & 0xff];
+	}
+
+	return seed;
+#else
+	return crc16_ccitt(seed, data, len);
+#endif
+}
+
 static void log_hexdump_dbg(const uint8_t *data, size_t length, const char *fmt, ...)
 {
 	if (IS_ENABLED(CONFIG_NRF_RPC_TR_LOG_LEVEL_DBG)) {
@@ -102,15 +269,109 @@ static void log_hexdump_dbg(const uint8_t *data, size_t length, const char *fmt,
 	}
 }
 
-static void send_byte(const struct device *dev, uint8_t byte);
+#if CONFIG_NRF_RPC_UART_ASYNC
+static void tx_buf_flush(struct nrf_rpc_uart *uart_tr)
+{
+	int ret;
+
+	if (uart_tr->tx_buf_len == 0) {
+		return;
+	}
+
+	/* Wait until the other buffer has been transmitted */
+	k_sem_take(&uart_tr->tx_done_sem, K_FOREVER);
+
+	ret = uart_tx(uart_tr->uart, uart_tr->tx_buf[uart_tr->tx_buf_idx], uart_tr->tx_buf_len,
+		      SYS_FOREVER_US);
+	if (ret < 0) {
+		LOG_ERR("Failed to start UART TX: %d", ret);
+		k_sem_give(&uart_tr->tx_done_sem);
+	}
+
+	uart_tr->tx_buf_idx ^= 1;
+	uart_tr->tx_buf_len = 0;
+}
+#endif /* CONFIG_NRF_RPC_UART_ASYNC */
+
+static void tx_octet(struct nrf_rpc_uart *uart_tr, uint8_t byte)
+{
+#if CONFIG_NRF_RPC_UART_ASYNC
+	uart_tr->tx_buf[uart_tr->tx_buf_idx][uart_tr->tx_buf_len++] = byte;
+
+	if (uart_tr->tx_buf_len == sizeof(uart_tr->tx_buf[0])) {
+		tx_buf_flush(uart_tr);
+	}
+#else
+	uart_poll_out(uart_tr->uart, byte);
+#endif
+}
+
+static void send_byte(struct nrf_rpc_uart *uart_tr, uint8_t byte)
+{
+	if (byte == HDLC_CHAR_DELIMITER || byte == HDLC_CHAR_ESCAPE) {
+		tx_octet(uart_tr, HDLC_CHAR_ESCAPE);
+		byte ^= 0x20;
+	}
+
+	tx_octet(uart_tr, byte);
+}
+
+static void frame_start(struct nrf_rpc_uart *uart_tr)
+{
+	tx_octet(uart_tr, HDLC_CHAR_DELIMITER);
+}
+
+static void frame_write(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t length)
+{
+	for (size_t i = 0; i < length; i++) {
+		send_byte(uart_tr, data[i]);
+	}
+}
+
+static void frame_end(struct nrf_rpc_uart *uart_tr)
+{
+	tx_octet(uart_tr, HDLC_CHAR_DELIMITER);
+
+#if CONFIG_NRF_RPC_UART_ASYNC
+	/* Start the transfer, but do not wait for it to complete */
+	tx_buf_flush(uart_tr);
+#endif
+}
+
+#if TX_WINDOWED
+static void tx_window_ack(struct nrf_rpc_uart *uart_tr, uint8_t seq, uint16_t crc)
+{
+	uint32_t pending = atomic_get(&uart_tr->tx_inflight) & ~atomic_get(&uart_tr->tx_acked);
+
+	LOG_DBG(">>> RX ack %02x %04x", seq, crc);
+
+	while (pending) {
+		uint32_t idx = u32_count_trailing_zeros(pending);
+		const struct tx_slot *slot = &uart_tr->tx_window[idx];
+
+		if (slot->seq == seq && slot->crc == crc) {
+			atomic_set_bit(&uart_tr->tx_acked, idx);
+			k_sem_give(&uart_tr->ack_sem);
+			return;
+		}
+
+		pending &= pending - 1;
+	}
+
+	LOG_DBG("Ack %02x %04x does not match any packet in flight", seq, crc);
+}
+#endif /* TX_WINDOWED */
 
 static void ack_rx(struct nrf_rpc_uart *uart_tr)
 {
-	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE) || uart_tr->rx_ack_ctx.len != CRC_SIZE) {
+	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE) || uart_tr->rx_ack_ctx.len != ACK_SIZE) {
 		log_hexdump_dbg(uart_tr->rx_ack, uart_tr->rx_ack_ctx.len, ">>> RX invalid frame");
 		return;
 	}
 
+#if TX_WINDOWED
+	tx_window_ack(uart_tr, uart_tr->rx_ack[0], sys_get_le16(&uart_tr->rx_ack[SEQ_SIZE]));
+#else
 	uint16_t rx_ack = sys_get_le16(uart_tr->rx_ack);
 
 	LOG_DBG(">>> RX ack %04x", rx_ack);
@@ -121,30 +382,201 @@ static void ack_rx(struct nrf_rpc_uart *uart_tr)
 	}
 
 	k_sem_give(&uart_tr->ack_sem);
+#endif
 }
 
-static void ack_tx(struct nrf_rpc_uart *uart_tr, uint16_t ack_pld)
+static void ack_tx(struct nrf_rpc_uart *uart_tr, uint8_t seq, uint16_t ack_pld)
 {
-	uint8_t ack[2];
+	uint8_t ack[ACK_SIZE];
 
 	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
 		return;
 	}
 
-	sys_put_le16(ack_pld, ack);
+#if TX_WINDOWED
+	ack[0] = seq;
+#else
+	ARG_UNUSED(seq);
+#endif
+	sys_put_le16(ack_pld, &ack[SEQ_SIZE]);
+
 	k_mutex_lock(&uart_tr->ack_tx_lock, K_FOREVER);
 	LOG_DBG("<<< TX ack %04x", ack_pld);
 
-	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+	frame_start(uart_tr);
+	frame_write(uart_tr, ack, sizeof(ack));
+	frame_end(uart_tr);
 
-	send_byte(uart_tr->uart, ack[0]);
-	send_byte(uart_tr->uart, ack[1]);
+	k_mutex_unlock(&uart_tr->ack_tx_lock);
+}
 
-	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+#if TX_WINDOWED
+static void tx_slot_send(struct nrf_rpc_uart *uart_tr, struct tx_slot *slot)
+{
+	uint8_t crc[CRC_SIZE];
+
+	sys_put_le16(slot->crc, crc);
+
+	k_mutex_lock(&uart_tr->ack_tx_lock, K_FOREVER);
+
+	frame_start(uart_tr);
+	frame_write(uart_tr, &slot->seq, sizeof(slot->seq));
+	frame_write(uart_tr, slot->data, slot->len);
+	frame_write(uart_tr, crc, sizeof(crc));
+	frame_end(uart_tr);
 
 	k_mutex_unlock(&uart_tr->ack_tx_lock);
+
+	slot->attempts++;
+	slot->deadline = sys_timepoint_calc(K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
 }
 
+static void tx_slot_free(struct nrf_rpc_uart *uart_tr)
+{
+	uint8_t idx = uart_tr->tx_head;
+
+	atomic_clear_bit(&uart_tr->tx_inflight, idx);
+	atomic_clear_bit(&uart_tr->tx_acked, idx);
+	k_free((void *)uart_tr->tx_window[idx].data);
+
+	uart_tr->tx_head = (idx + 1) % TX_WINDOW_SIZE;
+	uart_tr->tx_cnt--;
+}
+
+/* Frees the acknowledged packets from the start of the window. */
+static void tx_window_release(struct nrf_rpc_uart *uart_tr)
+{
+	while (uart_tr->tx_cnt > 0 && atomic_test_bit(&uart_tr->tx_acked, uart_tr->tx_head)) {
+		tx_slot_free(uart_tr);
+	}
+}
+
+/* Handles the acknowledgment timeout of the oldest packet in the window. */
+static int tx_window_timeout(struct nrf_rpc_uart *uart_tr)
+{
+	const struct tx_slot *oldest = &uart_tr->tx_window[uart_tr->tx_head];
+
+	if (oldest->attempts >= CONFIG_NRF_RPC_UART_TX_ATTEMPTS) {
+		LOG_ERR("Packet %02x not acknowledged, dropping %u packets", oldest->seq,
+			uart_tr->tx_cnt);
+
+		while (uart_tr->tx_cnt > 0) {
+			const struct tx_slot *slot = &uart_tr->tx_window[uart_tr->tx_head];
+
+			nrf_rpc_uart_tx_dropped_hook(uart_tr->uart, slot->data, slot->len);
+			tx_slot_free(uart_tr);
+		}
+
+		/* The peer may have missed any of the dropped packets */
+		uart_tr->tx_sync = true;
+
+		return -EPROTO;
+	}
+
+	/*
+	 * Go-back-N: the receiver drops packets following a lost one, so resend the oldest packet
+	 * and all unacknowledged packets sent after it.
+	 */
+	for (uint8_t i = 0; i < uart_tr->tx_cnt; i++) {
+		uint8_t idx = (uart_tr->tx_head + i) % TX_WINDOW_SIZE;
+
+		if (!atomic_test_bit(&uart_tr->tx_acked, idx)) {
+			LOG_WRN("Ack timeout, retransmitting %02x", uart_tr->tx_window[idx].seq);
+			tx_slot_send(uart_tr, &uart_tr->tx_window[idx]);
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Waits until fewer than max_cnt packets are in flight, retransmitting them when needed.
+ * Returns -EPROTO if packets were dropped while waiting.
+ */
+static int tx_window_wait(struct nrf_rpc_uart *uart_tr, uint8_t max_cnt)
+{
+	k_timepoint_t deadline;
+	int err = 0;
+
+	while (true) {
+		tx_window_release(uart_tr);
+
+		if (uart_tr->tx_cnt < max_cnt) {
+			return err;
+		}
+
+		deadline = uart_tr->tx_window[uart_tr->tx_head].deadline;
+
+		if (k_sem_take(&uart_tr->ack_sem, sys_timepoint_timeout(deadline)) == 0) {
+			continue;
+		}
+
+		if (tx_window_timeout(uart_tr)) {
+			err = -EPROTO;
+		}
+	}
+}
+
+static void tx_retx_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct nrf_rpc_uart *uart_tr = CONTAINER_OF(dwork, struct nrf_rpc_uart, tx_retx_work);
+	k_timepoint_t deadline;
+
+	/*
+	 * The work runs on the system work queue, so it must not block it. If the lock is taken,
+	 * a packet is being sent and the sender handles the timeouts while it waits for the window.
+	 */
+	if (k_mutex_lock(&uart_tr->tx_lock, K_NO_WAIT) != 0) {
+		k_work_reschedule(dwork, K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
+		return;
+	}
+
+	tx_window_release(uart_tr);
+
+	if (uart_tr->tx_cnt > 0 &&
+	    sys_timepoint_expired(uart_tr->tx_window[uart_tr->tx_head].deadline)) {
+		(void)tx_window_timeout(uart_tr);
+	}
+
+	if (uart_tr->tx_cnt > 0) {
+		deadline = uart_tr->tx_window[uart_tr->tx_head].deadline;
+		k_work_reschedule(dwork, sys_timepoint_timeout(deadline));
+	}
+
+	k_mutex_unlock(&uart_tr->tx_lock);
+}
+
+static enum rx_seq_result rx_seq_check(struct nrf_rpc_uart *uart_tr, uint8_t seq, uint16_t crc)
+{
+	uint8_t behind;
+
+	if (seq & SEQ_SYNC) {
+		seq &= SEQ_MASK;
+
+		if (uart_tr->rx_synced && seq == ((uart_tr->rx_seq - 1) & SEQ_MASK) &&
+		    crc == uart_tr->last_rx_crc) {
+			return RX_SEQ_DUPLICATE;
+		}
+
+		uart_tr->rx_seq = seq;
+		uart_tr->rx_synced = true;
+	} else if (!uart_tr->rx_synced) {
+		return RX_SEQ_UNEXPECTED;
+	}
+
+	if (seq != uart_tr->rx_seq) {
+		behind = (uart_tr->rx_seq - seq) & SEQ_MASK;
+
+		return (behind <= SEQ_HALF) ? RX_SEQ_DUPLICATE : RX_SEQ_UNEXPECTED;
+	}
+
+	uart_tr->rx_seq = (seq + 1) & SEQ_MASK;
+	uart_tr->last_rx_crc = crc;
+
+	return RX_SEQ_NEW;
+}
+#else
 static uint16_t tx_flip(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
 {
 	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
@@ -180,10 +612,12 @@ static bool rx_flip_check(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
 
 	return true;
 }
+#endif /* TX_WINDOWED */
 
 static bool crc_compare(uint16_t rx_crc, uint16_t calc_crc)
 {
-	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
+	/* Without the sequence field, the sequence bit takes the place of the checksum MSB */
+	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE) && !TX_WINDOWED) {
 		return (rx_crc & 0x7fffu) == (calc_crc & 0x7fffu);
 	}
 
@@ -229,52 +663,186 @@ static void hdlc_decode_byte(struct hdlc_decode_ctx *ctx, uint8_t *out, uint8_t
 	out[ctx->len++] = in;
 }
 
+/* Returns the offset of the first HDLC delimiter, or the first delimiter or escape byte if
+ * @p escape is set, or @p len if there is none. Aligned words are checked for a matching
+ * byte at once.
+ */
+static size_t hdlc_special_find(const uint8_t *in, size_t len, bool escape)
+{
+	const uintptr_t ones = (uintptr_t)-1 / 0xff;
+	const uintptr_t highs = ones << 7;
+	size_t i = 0;
+
+	while (i < len && ((uintptr_t)&in[i] % sizeof(uintptr_t)) != 0) {
+		if (in[i] == HDLC_CHAR_DELIMITER || (escape && in[i] == HDLC_CHAR_ESCAPE)) {
+			return i;
+		}
+		i++;
+	}
+
+	for (; i + sizeof(uintptr_t) <= len; i += sizeof(uintptr_t)) {
+		uintptr_t word = *(const uintptr_t *)&in[i];
+		uintptr_t delim = word ^ (ones * HDLC_CHAR_DELIMITER);
+		uintptr_t esc = word ^ (ones * HDLC_CHAR_ESCAPE);
+		uintptr_t found = (delim - ones) & ~delim;
+
+		if (escape) {
+			found |= (esc - ones) & ~esc;
+		}
+
+		if (found & highs) {
+			break;
+		}
+	}
+
+	for (; i < len; i++) {
+		if (in[i] == HDLC_CHAR_DELIMITER || (escape && in[i] == HDLC_CHAR_ESCAPE)) {
+			break;
+		}
+	}
+
+	return i;
+}
+
+/* Decodes the input up to and including the first byte that changes the decoding state,
+ * and returns the number of consumed bytes. Bytes that need no unescaping are copied in bulk.
+ */
+static size_t hdlc_decode(struct hdlc_decode_ctx *ctx, uint8_t *out, const uint8_t *in,
+			  size_t len)
+{
+	size_t run;
+
+	if (ctx->state == HDLC_STATE_UNSYNC) {
+		run = hdlc_special_find(in, len, false);
+		if (run == len) {
+			return len;
+		}
+	} else if (ctx->state == HDLC_STATE_FRAME) {
+		run = hdlc_special_find(in, len, true);
+		if (run > 0) {
+			if (run > ctx->capacity - ctx->len) {
+				/* Ignore too long frame */
+				ctx->state = HDLC_STATE_UNSYNC;
+				return run;
+			}
+
+			memcpy(&out[ctx->len], in, run);
+			ctx->len += run;
+
+			return run;
+		}
+	} else {
+		run = 0;
+	}
+
+	hdlc_decode_byte(ctx, out, in[run]);
+
+	return run + 1;
+}
+
+#if CONFIG_NRF_RPC_UART_RX_QUEUE
+static void deliver_work_handler(struct k_work *work)
+{
+	struct nrf_rpc_uart *uart_tr = CONTAINER_OF(work, struct nrf_rpc_uart, rx_deliver_work);
+	struct rx_pkt_item item;
+
+	while (k_msgq_get(&uart_tr->rx_pkt_msgq, &item, K_NO_WAIT) == 0) {
+		uart_tr->receive_callback(uart_tr->transport, item.buf + SEQ_SIZE, item.len,
+					  uart_tr->receive_ctx);
+
+		/* nRF RPC does not access the packet after the callback returns */
+		k_mem_slab_free(&uart_tr->rx_pkt_slab, item.buf);
+	}
+}
+#endif
+
+static void rx_pkt_deliver(struct nrf_rpc_uart *uart_tr)
+{
+	size_t len = uart_tr->rx_pkt_ctx.len - SEQ_SIZE;
+
+#if CONFIG_NRF_RPC_UART_RX_QUEUE
+	struct rx_pkt_item item = {
+		.buf = uart_tr->rx_pkt,
+		.len = len,
+	};
+
+	/* The buffer is owned by the delivery work until the packet is passed to nRF RPC */
+	(void)k_msgq_put(&uart_tr->rx_pkt_msgq, &item, K_FOREVER);
+	k_work_submit_to_queue(&uart_tr->rx_deliver_workq, &uart_tr->rx_deliver_work);
+
+	/* Decoding stalls only if all buffers wait for delivery */
+	(void)k_mem_slab_alloc(&uart_tr->rx_pkt_slab, (void **)&uart_tr->rx_pkt, K_FOREVER);
+#else
+	uart_tr->receive_callback(uart_tr->transport, uart_tr->rx_pkt + SEQ_SIZE, len,
+				  uart_tr->receive_ctx);
+#endif
+}
+
+static void rx_frame_process(struct nrf_rpc_uart *uart_tr)
+{
+	uint16_t crc_received;
+	uint16_t crc_calculated;
+
+	/* ACKs are already handled in ISR, so process only normal packets here */
+	if (uart_tr->rx_pkt_ctx.len <= ACK_SIZE) {
+		return;
+	}
+
+	uart_tr->rx_pkt_ctx.len -= CRC_SIZE;
+	crc_received = sys_get_le16(uart_tr->rx_pkt + uart_tr->rx_pkt_ctx.len);
+	crc_calculated = crc16_calc(0xffff, uart_tr->rx_pkt, uart_tr->rx_pkt_ctx.len);
+
+	log_hexdump_dbg(uart_tr->rx_pkt, uart_tr->rx_pkt_ctx.len, ">>> RX packet %04x",
+			crc_received);
+
+	if (!crc_compare(crc_received, crc_calculated)) {
+		LOG_ERR("Invalid packet CRC: calculated %04x but received %04x", crc_calculated,
+			crc_received);
+		return;
+	}
+
+#if TX_WINDOWED
+	uint8_t seq = uart_tr->rx_pkt[0];
+
+	switch (rx_seq_check(uart_tr, seq, crc_received)) {
+	case RX_SEQ_NEW:
+		ack_tx(uart_tr, seq, crc_received);
+		rx_pkt_deliver(uart_tr);
+		break;
+	case RX_SEQ_DUPLICATE:
+		ack_tx(uart_tr, seq, crc_received);
+		LOG_WRN("Duplicate packet %02x", seq);
+		break;
+	case RX_SEQ_UNEXPECTED:
+		LOG_DBG("Unexpected packet %02x, expected %02x", seq, uart_tr->rx_seq);
+		break;
+	}
+#else
+	ack_tx(uart_tr, 0, crc_received);
+
+	if (rx_flip_check(uart_tr, crc_received)) {
+		LOG_WRN("Duplicate packet %04x", crc_received);
+	} else {
+		rx_pkt_deliver(uart_tr);
+	}
+#endif /* TX_WINDOWED */
+}
+
 static void work_handler(struct k_work *work)
 {
 	struct nrf_rpc_uart *uart_tr = CONTAINER_OF(work, struct nrf_rpc_uart, rx_work);
 	uint8_t *data;
 	size_t len;
 	int ret;
-	uint16_t crc_received = 0;
-	uint16_t crc_calculated = 0;
 
 	while (!ring_buf_is_empty(&uart_tr->rx_ringbuf)) {
 		len = ring_buf_get_claim(&uart_tr->rx_ringbuf, &data,
 					 CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE);
-		for (size_t i = 0; i < len; i++) {
-			hdlc_decode_byte(&uart_tr->rx_pkt_ctx, uart_tr->rx_pkt, data[i]);
-
-			if (uart_tr->rx_pkt_ctx.state != HDLC_STATE_FRAME_FOUND) {
-				continue;
-			}
+		for (size_t i = 0; i < len;) {
+			i += hdlc_decode(&uart_tr->rx_pkt_ctx, uart_tr->rx_pkt, &data[i], len - i);
 
-			/* ACKs are already handled in ISR, so process only normal packets here */
-			if (uart_tr->rx_pkt_ctx.len <= CRC_SIZE) {
-				continue;
-			}
-
-			uart_tr->rx_pkt_ctx.len -= CRC_SIZE;
-			crc_received = sys_get_le16(uart_tr->rx_pkt + uart_tr->rx_pkt_ctx.len);
-			crc_calculated =
-				crc16_ccitt(0xffff, uart_tr->rx_pkt, uart_tr->rx_pkt_ctx.len);
-
-			log_hexdump_dbg(uart_tr->rx_pkt, uart_tr->rx_pkt_ctx.len,
-					">>> RX packet %04x", crc_received);
-
-			if (!crc_compare(crc_received, crc_calculated)) {
-				LOG_ERR("Invalid packet CRC: calculated %04x but received %04x",
-					crc_calculated, crc_received);
-				continue;
-			}
-
-			ack_tx(uart_tr, crc_received);
-
-			if (rx_flip_check(uart_tr, crc_received)) {
-				LOG_WRN("Duplicate packet %04x", crc_received);
-			} else {
-				uart_tr->receive_callback(uart_tr->transport, uart_tr->rx_pkt,
-							  uart_tr->rx_pkt_ctx.len,
-							  uart_tr->receive_ctx);
+			if (uart_tr->rx_pkt_ctx.state == HDLC_STATE_FRAME_FOUND) {
+				rx_frame_process(uart_tr);
 			}
 		}
 
@@ -287,8 +855,8 @@ static void work_handler(struct k_work *work)
 
 static void decode_ack(struct nrf_rpc_uart *inst, const uint8_t *in, size_t len)
 {
-	for (size_t i = 0; i < len; i++) {
-		hdlc_decode_byte(&inst->rx_ack_ctx, inst->rx_ack, in[i]);
+	for (size_t i = 0; i < len;) {
+		i += hdlc_decode(&inst->rx_ack_ctx, inst->rx_ack, &in[i], len - i);
 
 		if (inst->rx_ack_ctx.state == HDLC_STATE_FRAME_FOUND) {
 			ack_rx(inst);
@@ -296,6 +864,7 @@ static void decode_ack(struct nrf_rpc_uart *inst, const uint8_t *in, size_t len)
 	}
 }
 
+#if !CONFIG_NRF_RPC_UART_ASYNC
 static void serial_cb(const struct device *uart, void *user_data)
 {
 	struct nrf_rpc_uart *uart_tr = user_data;
@@ -331,6 +900,72 @@ static void serial_cb(const struct device *uart, void *user_data)
 		k_work_submit_to_queue(&uart_tr->rx_workq, &uart_tr->rx_work);
 	}
 }
+#else
+static void rx_dma_enable(struct nrf_rpc_uart *uart_tr)
+{
+	int ret;
+
+	uart_tr->rx_dma_buf_idx = 0;
+
+	ret = uart_rx_enable(uart_tr->uart, uart_tr->rx_dma_buf[0], sizeof(uart_tr->rx_dma_buf[0]),
+			     CONFIG_NRF_RPC_UART_ASYNC_RX_TIMEOUT);
+	if (ret < 0) {
+		LOG_ERR("Failed to enable UART RX: %d", ret);
+	}
+}
+
+static void rx_data_put(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t len)
+{
+	uint32_t written;
+
+	decode_ack(uart_tr, data, len);
+
+	written = ring_buf_put(&uart_tr->rx_ringbuf, data, len);
+	if (written < len) {
+		LOG_WRN("RX ring buffer full");
+	}
+
+	if (written > 0) {
+		k_work_submit_to_queue(&uart_tr->rx_workq, &uart_tr->rx_work);
+	}
+}
+
+static void async_cb(const struct device *uart, struct uart_event *evt, void *user_data)
+{
+	struct nrf_rpc_uart *uart_tr = user_data;
+	int ret;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+		k_sem_give(&uart_tr->tx_done_sem);
+		break;
+	case UART_TX_ABORTED:
+		LOG_WRN("UART TX aborted");
+		k_sem_give(&uart_tr->tx_done_sem);
+		break;
+	case UART_RX_RDY:
+		rx_data_put(uart_tr, evt->data.rx.buf + evt->data.rx.offset, evt->data.rx.len);
+		break;
+	case UART_RX_BUF_REQUEST:
+		uart_tr->rx_dma_buf_idx ^= 1;
+		ret = uart_rx_buf_rsp(uart, uart_tr->rx_dma_buf[uart_tr->rx_dma_buf_idx],
+				      sizeof(uart_tr->rx_dma_buf[0]));
+		if (ret < 0) {
+			LOG_ERR("Failed to provide UART RX buffer: %d", ret);
+		}
+		break;
+	case UART_RX_STOPPED:
+		LOG_WRN("UART RX stopped: %d", evt->data.rx_stop.reason);
+		break;
+	case UART_RX_DISABLED:
+		/* Reception is disabled after an error, so restart it */
+		rx_dma_enable(uart_tr);
+		break;
+	default:
+		break;
+	}
+}
+#endif /* !CONFIG_NRF_RPC_UART_ASYNC */
 
 static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t receive_cb,
 		void *context)
@@ -357,6 +992,16 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 		return -NRF_ENOENT;
 	}
 
+#if CONFIG_NRF_RPC_UART_ASYNC
+	int ret = uart_callback_set(uart_tr->uart, async_cb, uart_tr);
+
+	if (ret < 0) {
+		LOG_ERR("Error setting UART async callback: %d", ret);
+		return -NRF_EIO;
+	}
+
+	k_sem_init(&uart_tr->tx_done_sem, 1, 1);
+#else
 	/* configure interrupt and callback to receive data */
 	int ret = uart_irq_callback_user_data_set(uart_tr->uart, serial_cb, uart_tr);
 
@@ -370,16 +1015,23 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 		}
 		return 0;
 	}
+#endif /* CONFIG_NRF_RPC_UART_ASYNC */
 
 	k_mutex_init(&uart_tr->tx_lock);
 
 	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
 		k_mutex_init(&uart_tr->ack_tx_lock);
-		k_sem_init(&uart_tr->ack_sem, 0, 1);
+		k_sem_init(&uart_tr->ack_sem, 0, TX_WINDOW_SIZE);
 		uart_tr->flips.tx_flip = FLIP_ZERO;
 		uart_tr->flips.rx_flip_any = 1;
 	}
 
+#if TX_WINDOWED
+	k_work_init_delayable(&uart_tr->tx_retx_work, tx_retx_work_handler);
+	/* The receiver does not know the initial sequence number */
+	uart_tr->tx_sync = true;
+#endif
+
 	k_work_queue_init(&uart_tr->rx_workq);
 	k_work_queue_start(&uart_tr->rx_workq, uart_tr->rx_workq_stack,
 			   K_THREAD_STACK_SIZEOF(uart_tr->rx_workq_stack), K_PRIO_PREEMPT(0),
@@ -388,26 +1040,96 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 	k_work_init(&uart_tr->rx_work, work_handler);
 	ring_buf_init(&uart_tr->rx_ringbuf, sizeof(uart_tr->rx_buffer), uart_tr->rx_buffer);
 
+#if CONFIG_NRF_RPC_UART_RX_QUEUE
+	const struct k_work_queue_config deliver_workq_cfg = {.name = "rpc uart deliver"};
+
+	ret = k_mem_slab_init(&uart_tr->rx_pkt_slab, uart_tr->rx_pkt_pool, RX_PKT_BLOCK_SIZE,
+			      CONFIG_NRF_RPC_UART_RX_PKT_COUNT);
+	if (ret < 0) {
+		LOG_ERR("Failed to initialize RX packet pool: %d", ret);
+		return -NRF_ENOMEM;
+	}
+
+	(void)k_mem_slab_alloc(&uart_tr->rx_pkt_slab, (void **)&uart_tr->rx_pkt, K_NO_WAIT);
+	k_msgq_init(&uart_tr->rx_pkt_msgq, (char *)uart_tr->rx_pkt_msgq_buf,
+		    sizeof(struct rx_pkt_item), CONFIG_NRF_RPC_UART_RX_PKT_COUNT);
+
+	k_work_queue_init(&uart_tr->rx_deliver_workq);
+	k_work_queue_start(&uart_tr->rx_deliver_workq, uart_tr->rx_deliver_workq_stack,
+			   K_THREAD_STACK_SIZEOF(uart_tr->rx_deliver_workq_stack),
+			   K_PRIO_PREEMPT(0), &deliver_workq_cfg);
+	k_work_init(&uart_tr->rx_deliver_work, deliver_work_handler);
+#endif
+
 	uart_tr->rx_pkt_ctx.state = HDLC_STATE_UNSYNC;
-	uart_tr->rx_pkt_ctx.capacity = sizeof(uart_tr->rx_pkt);
+	uart_tr->rx_pkt_ctx.capacity = CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE;
 	uart_tr->rx_ack_ctx.state = HDLC_STATE_UNSYNC;
 	uart_tr->rx_ack_ctx.capacity = sizeof(uart_tr->rx_ack);
+#if CONFIG_NRF_RPC_UART_ASYNC
+	rx_dma_enable(uart_tr);
+#else
 	uart_irq_rx_enable(uart_tr->uart);
+#endif
 	nrf_rpc_uart_initialized_hook(uart_tr->uart);
 
 	return 0;
 }
 
-static void send_byte(const struct device *dev, uint8_t byte)
+#if TX_WINDOWED
+static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
 {
-	if (byte == HDLC_CHAR_DELIMITER || byte == HDLC_CHAR_ESCAPE) {
-		uart_poll_out(dev, HDLC_CHAR_ESCAPE);
-		byte ^= 0x20;
+	struct nrf_rpc_uart *uart_tr = transport->ctx;
+	struct tx_slot *slot;
+	uint8_t idx;
+	bool sync;
+	int err;
+
+	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
+
+	/*
+	 * A synchronization frame is sent alone, after all previous packets are acknowledged.
+	 * Packets dropped while waiting were passed by earlier calls, so they are reported through
+	 * nrf_rpc_uart_tx_dropped_hook() and not to this caller. Dropping them requires this packet
+	 * to be sent as a synchronization frame.
+	 */
+	do {
+		sync = uart_tr->tx_sync;
+		(void)tx_window_wait(uart_tr, sync ? 1 : TX_WINDOW_SIZE);
+	} while (sync != uart_tr->tx_sync);
+
+	idx = (uart_tr->tx_head + uart_tr->tx_cnt) % TX_WINDOW_SIZE;
+	slot = &uart_tr->tx_window[idx];
+	slot->data = data;
+	slot->len = length;
+	slot->attempts = 0;
+	slot->seq = uart_tr->tx_seq | (sync ? SEQ_SYNC : 0);
+	slot->crc = crc16_calc(crc16_calc(0xffff, &slot->seq, sizeof(slot->seq)), data, length);
+
+	uart_tr->tx_seq = (uart_tr->tx_seq + 1) & SEQ_MASK;
+	uart_tr->tx_cnt++;
+	atomic_set_bit(&uart_tr->tx_inflight, idx);
+
+	log_hexdump_dbg(data, length, "<<< TX packet %02x %04x", slot->seq, slot->crc);
+
+	tx_slot_send(uart_tr, slot);
+
+	if (sync) {
+		/* This packet is the only one in flight, so a drop applies to it */
+		err = tx_window_wait(uart_tr, 1);
+		if (!err) {
+			uart_tr->tx_sync = false;
+		}
+	} else {
+		err = 0;
+		k_work_schedule(&uart_tr->tx_retx_work,
+				K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
 	}
 
-	uart_poll_out(dev, byte);
-}
+	k_mutex_unlock(&uart_tr->tx_lock);
 
+	return err;
+}
+#else
 static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
 {
 	uint8_t crc[2];
@@ -417,7 +1139,7 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 
 	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
 
-	crc_val = crc16_ccitt(0xffff, data, length);
+	crc_val = crc16_calc(0xffff, data, length);
 	crc_val = tx_flip(uart_tr, crc_val);
 	log_hexdump_dbg(data, length, "<<< TX packet %04x", crc_val);
 
@@ -433,17 +1155,13 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 		k_sem_reset(&uart_tr->ack_sem);
 #endif /* CONFIG_NRF_RPC_UART_RELIABLE */
 
-		uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
-
-		for (size_t i = 0; i < length; i++) {
-			send_byte(uart_tr->uart, data[i]);
-		}
+		frame_start(uart_tr);
+		frame_write(uart_tr, data, length);
 
 		sys_put_le16(crc_val, crc);
-		send_byte(uart_tr->uart, crc[0]);
-		send_byte(uart_tr->uart, crc[1]);
+		frame_write(uart_tr, crc, sizeof(crc));
 
-		uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+		frame_end(uart_tr);
 
 #if CONFIG_NRF_RPC_UART_RELIABLE
 		k_mutex_unlock(&uart_tr->ack_tx_lock);
@@ -463,6 +1181,7 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 
 	return acked ? 0 : -EPROTO;
 }
+#endif /* TX_WINDOWED */
 
 static void *tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
 {
@@ -494,6 +1213,11 @@ __weak void nrf_rpc_uart_initialized_hook(const struct device *uart_dev)
 {
 }
 
+__weak void nrf_rpc_uart_tx_dropped_hook(const struct device *uart_dev, const uint8_t *packet,
+					 size_t len)
+{
+}
+
 const struct nrf_rpc_tr_api nrf_rpc_uart_service_api = {
 	.init = init,
 	.send = send,
@@ -515,3 +1239,8 @@ const struct nrf_rpc_tr_api nrf_rpc_uart_service_api = {
 	};
 
 DT_FOREACH_STATUS_OKAY(nordic_nrf_uarte, NRF_RPC_UART_TRANSPORT_DEFINE);
+
+#if CONFIG_UART_EMUL
+/* Emulated UARTs allow testing the transport without the hardware */
+DT_FOREACH_STATUS_OKAY(zephyr_uart_emul, NRF_RPC_UART_TRANSPORT_DEFINE);
+#endif
@@ -524,6 +524,8 @@ kconfig_check_and_set_base_to_one(PSA_CRYPTO_DRIVER_ALG_PRNG_TEST)
 kconfig_check_and_set_base_to_one(PSA_CRYPTO_DRIVER_IRONSIDE)
 kconfig_check_and_set_base_to_one(PSA_NEED_CRACEN_MULTIPART_WORKAROUNDS)
 kconfig_check_and_set_base_to_one(PSA_NEED_CRACEN_CTR_SIZE_WORKAROUNDS)
+kconfig_check_and_set_base_to_one(CRACEN_SW_GCM_GHASH_TABLE8)
+kconfig_check_and_set_base_to_one(CRACEN_SW_GCM_GHASH_CLMUL)
 kconfig_check_and_set_base_to_one(PSA_NEED_CRACEN_IKG_INTERRUPT_WORKAROUND)
 kconfig_check_and_set_base_to_one(PSA_NEED_CRACEN_RNG_NO_ENTROPY_WORKAROUND)
 kconfig_check_and_set_base_to_one(PSA_NEED_CRACEN_ECC_KEY_GEN_PKE)
@@ -13,12 +13,16 @@
  *
  * We use the algorithm described as Shoup's method with 4-bit tables in
  * [MGV] 4.1, pp. 12-13, to enhance speed without using too much memory.
+ * Shoup's method with 8-bit tables trades 4 KiB of memory per key for
+ * half the number of table lookups. The carry-less multiplication only
+ * keeps H, and runs in constant time without key dependent memory accesses.
  */
 
 /* Copied from mbed TLS, modified to contain GF(2^128) operation only */
 #include <tf_psa_crypto_common.h>
 #include "gcm_ext.h"
 
+#if !defined(CRACEN_SW_GCM_GHASH_CLMUL)
 static inline void gcm_gen_table_rightshift(uint64_t dst[2], const uint64_t src[2])
 {
 	uint8_t *u8Dst = (uint8_t *) dst;
@@ -38,7 +42,7 @@ static inline void gcm_gen_table_rightshift(uint64_t dst[2], const uint64_t src[
  * is the high-order bit of HH corresponds to P^0 and the low-order bit of HL
  * corresponds to P^127.
  */
-int gcm_ext_gen_table(const uint8_t *h, uint64_t H[16][2])
+int gcm_ext_gen_table(const uint8_t *h, uint64_t H[GCM_EXT_HTABLE_SIZE][2])
 {
 	int i, j;
 	const uint64_t *u64h = (const uint64_t *)h;
@@ -55,7 +59,6 @@ int gcm_ext_gen_table(const uint8_t *h, uint64_t H[16][2])
 		gcm_gen_table_rightshift(H[i], H[i*2]);
 	}
 
-	/* Note: only small table implementation is used */
 	/* pack elements of H as 64-bits ints, big-endian */
 	for (i = GCM_EXT_HTABLE_SIZE/2; i > 0; i >>= 1) {
 		MBEDTLS_PUT_UINT64_BE(H[i][0], &H[i][0], 0);
@@ -74,6 +77,70 @@ int gcm_ext_gen_table(const uint8_t *h, uint64_t H[16][2])
 	return 0;
 }
 
+#if defined(CRACEN_SW_GCM_GHASH_TABLE8)
+/*
+ * Shoup's method with 8-bit tables use this table with
+ *      last8[x] = x times P^128
+ * where x and last8[x] are seen as elements of GF(2^128) as in [MGV]
+ */
+static const uint16_t last8[256] =
+{
+	0x0000, 0x01c2, 0x0384, 0x0246, 0x0708, 0x06ca, 0x048c, 0x054e,
+	0x0e10, 0x0fd2, 0x0d94, 0x0c56, 0x0918, 0x08da, 0x0a9c, 0x0b5e,
+	0x1c20, 0x1de2, 0x1fa4, 0x1e66, 0x1b28, 0x1aea, 0x18ac, 0x196e,
+	0x1230, 0x13f2, 0x11b4, 0x1076, 0x1538, 0x14fa, 0x16bc, 0x177e,
+	0x3840, 0x3982, 0x3bc4, 0x3a06, 0x3f48, 0x3e8a, 0x3ccc, 0x3d0e,
+	0x3650, 0x3792, 0x35d4, 0x3416, 0x3158, 0x309a, 0x32dc, 0x331e,
+	0x2460, 0x25a2, 0x27e4, 0x2626, 0x2368, 0x22aa, 0x20ec, 0x212e,
+	0x2a70, 0x2bb2, 0x29f4, 0x2836, 0x2d78, 0x2cba, 0x2efc, 0x2f3e,
+	0x7080, 0x7142, 0x7304, 0x72c6, 0x7788, 0x764a, 0x740c, 0x75ce,
+	0x7e90, 0x7f52, 0x7d14, 0x7cd6, 0x7998, 0x785a, 0x7a1c, 0x7bde,
+	0x6ca0, 0x6d62, 0x6f24, 0x6ee6, 0x6ba8, 0x6a6a, 0x682c, 0x69ee,
+	0x62b0, 0x6372, 0x6134, 0x60f6, 0x65b8, 0x647a, 0x663c, 0x67fe,
+	0x48c0, 0x4902, 0x4b44, 0x4a86, 0x4fc8, 0x4e0a, 0x4c4c, 0x4d8e,
+	0x46d0, 0x4712, 0x4554, 0x4496, 0x41d8, 0x401a, 0x425c, 0x439e,
+	0x54e0, 0x5522, 0x5764, 0x56a6, 0x53e8, 0x522a, 0x506c, 0x51ae,
+	0x5af0, 0x5b32, 0x5974, 0x58b6, 0x5df8, 0x5c3a, 0x5e7c, 0x5fbe,
+	0xe100, 0xe0c2, 0xe284, 0xe346, 0xe608, 0xe7ca, 0xe58c, 0xe44e,
+	0xef10, 0xeed2, 0xec94, 0xed56, 0xe818, 0xe9da, 0xeb9c, 0xea5e,
+	0xfd20, 0xfce2, 0xfea4, 0xff66, 0xfa28, 0xfbea, 0xf9ac, 0xf86e,
+	0xf330, 0xf2f2, 0xf0b4, 0xf176, 0xf438, 0xf5fa, 0xf7bc, 0xf67e,
+	0xd940, 0xd882, 0xdac4, 0xdb06, 0xde48, 0xdf8a, 0xddcc, 0xdc0e,
+	0xd750, 0xd692, 0xd4d4, 0xd516, 0xd058, 0xd19a, 0xd3dc, 0xd21e,
+	0xc560, 0xc4a2, 0xc6e4, 0xc726, 0xc268, 0xc3aa, 0xc1ec, 0xc02e,
+	0xcb70, 0xcab2, 0xc8f4, 0xc936, 0xcc78, 0xcdba, 0xcffc, 0xce3e,
+	0x9180, 0x9042, 0x9204, 0x93c6, 0x9688, 0x974a, 0x950c, 0x94ce,
+	0x9f90, 0x9e52, 0x9c14, 0x9dd6, 0x9898, 0x995a, 0x9b1c, 0x9ade,
+	0x8da0, 0x8c62, 0x8e24, 0x8fe6, 0x8aa8, 0x8b6a, 0x892c, 0x88ee,
+	0x83b0, 0x8272, 0x8034, 0x81f6, 0x84b8, 0x857a, 0x873c, 0x86fe,
+	0xa9c0, 0xa802, 0xaa44, 0xab86, 0xaec8, 0xaf0a, 0xad4c, 0xac8e,
+	0xa7d0, 0xa612, 0xa454, 0xa596, 0xa0d8, 0xa11a, 0xa35c, 0xa29e,
+	0xb5e0, 0xb422, 0xb664, 0xb7a6, 0xb2e8, 0xb32a, 0xb16c, 0xb0ae,
+	0xbbf0, 0xba32, 0xb874, 0xb9b6, 0xbcf8, 0xbd3a, 0xbf7c, 0xbebe,
+};
+
+static void gcm_mult_largetable(uint8_t *output, const uint8_t *x, const uint64_t H[256][2])
+{
+	int i = 0;
+	unsigned char rem;
+	uint64_t u64z[2];
+
+	u64z[0] = H[x[15]][0];
+	u64z[1] = H[x[15]][1];
+
+	for (i = 14; i >= 0; i--) {
+		rem = (unsigned char) u64z[1];
+		u64z[1] = (u64z[0] << 56) | (u64z[1] >> 8);
+		u64z[0] = (u64z[0] >> 8);
+		u64z[0] ^= (uint64_t) last8[rem] << 48;
+		u64z[0] ^= H[x[i]][0];
+		u64z[1] ^= H[x[i]][1];
+	}
+
+	MBEDTLS_PUT_UINT64_BE(u64z[0], output, 0);
+	MBEDTLS_PUT_UINT64_BE(u64z[1], output, 8);
+}
+#else
 /*
  * Shoup's method for multiplication use this table with
  *      last4[x] = x times P^128
@@ -126,14 +193,140 @@ static void gcm_mult_smalltable(uint8_t *output, const uint8_t *x, const uint64_
 	MBEDTLS_PUT_UINT64_BE(u64z[0], output, 0);
 	MBEDTLS_PUT_UINT64_BE(u64z[1], output, 8);
 }
+#endif /* CRACEN_SW_GCM_GHASH_TABLE8 */
+#endif /* !CRACEN_SW_GCM_GHASH_CLMUL */
+
+#if defined(CRACEN_SW_GCM_GHASH_CLMUL)
+/*
+ * Carry-less multiplication of two 64-bit words, low 64 bits of the product.
+ * The operands are split in four interleaved parts with one bit in every
+ * nibble, so that the carries of the integer multiplications fall into bits
+ * that are masked out. No branches or memory accesses depend on the data.
+ */
+static inline uint64_t gcm_bmul64(uint64_t x, uint64_t y)
+{
+	uint64_t x0, x1, x2, x3;
+	uint64_t y0, y1, y2, y3;
+	uint64_t z0, z1, z2, z3;
+
+	x0 = x & 0x1111111111111111;
+	x1 = x & 0x2222222222222222;
+	x2 = x & 0x4444444444444444;
+	x3 = x & 0x8888888888888888;
+	y0 = y & 0x1111111111111111;
+	y1 = y & 0x2222222222222222;
+	y2 = y & 0x4444444444444444;
+	y3 = y & 0x8888888888888888;
+	z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+	z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+	z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+	z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+	z0 &= 0x1111111111111111;
+	z1 &= 0x2222222222222222;
+	z2 &= 0x4444444444444444;
+	z3 &= 0x8888888888888888;
+
+	return z0 | z1 | z2 | z3;
+}
+
+static inline uint64_t gcm_rev64(uint64_t x)
+{
+	x = ((x & 0x5555555555555555) << 1) | ((x >> 1) & 0x5555555555555555);
+	x = ((x & 0x3333333333333333) << 2) | ((x >> 2) & 0x3333333333333333);
+	x = ((x & 0x0F0F0F0F0F0F0F0F) << 4) | ((x >> 4) & 0x0F0F0F0F0F0F0F0F);
+	x = ((x & 0x00FF00FF00FF00FF) << 8) | ((x >> 8) & 0x00FF00FF00FF00FF);
+	x = ((x & 0x0000FFFF0000FFFF) << 16) | ((x >> 16) & 0x0000FFFF0000FFFF);
+
+	return (x << 32) | (x >> 32);
+}
+
+/*
+ * Only H is kept, as two 64-bit big-endian words, in H[0]. H[1] holds the
+ * bit-reversed words, used to compute the high halves of the products.
+ */
+int gcm_ext_gen_table(const uint8_t *h, uint64_t H[GCM_EXT_HTABLE_SIZE][2])
+{
+	H[0][0] = MBEDTLS_GET_UINT64_BE(h, 0);
+	H[0][1] = MBEDTLS_GET_UINT64_BE(h, 8);
+	H[1][0] = gcm_rev64(H[0][0]);
+	H[1][1] = gcm_rev64(H[0][1]);
+
+	return 0;
+}
+
+/*
+ * The 128x128-bit product is computed with Karatsuba over 64-bit words:
+ * three multiplications for the low halves, and three on the bit-reversed
+ * operands for the high halves. GCM uses a bit-reflected representation,
+ * so the 256-bit product is shifted by one bit before the reduction
+ * modulo P(x) = x^128 + x^7 + x^2 + x + 1.
+ */
+static void gcm_mult_clmul(uint8_t *output, const uint8_t *x, const uint64_t H[2][2])
+{
+	uint64_t x0, x1, x2, x0r, x1r, x2r;
+	uint64_t h0, h1, h2, h0r, h1r, h2r;
+	uint64_t z0, z1, z2, z0h, z1h, z2h;
+	uint64_t v0, v1, v2, v3;
+
+	x1 = MBEDTLS_GET_UINT64_BE(x, 0);
+	x0 = MBEDTLS_GET_UINT64_BE(x, 8);
+	x2 = x0 ^ x1;
+	x0r = gcm_rev64(x0);
+	x1r = gcm_rev64(x1);
+	x2r = x0r ^ x1r;
+
+	h1 = H[0][0];
+	h0 = H[0][1];
+	h2 = h0 ^ h1;
+	h1r = H[1][0];
+	h0r = H[1][1];
+	h2r = h0r ^ h1r;
+
+	z0 = gcm_bmul64(x0, h0);
+	z1 = gcm_bmul64(x1, h1);
+	z2 = gcm_bmul64(x2, h2);
+	z0h = gcm_bmul64(x0r, h0r);
+	z1h = gcm_bmul64(x1r, h1r);
+	z2h = gcm_bmul64(x2r, h2r);
+	z2 ^= z0 ^ z1;
+	z2h ^= z0h ^ z1h;
+	z0h = gcm_rev64(z0h) >> 1;
+	z1h = gcm_rev64(z1h) >> 1;
+	z2h = gcm_rev64(z2h) >> 1;
+
+	v0 = z0;
+	v1 = z0h ^ z2;
+	v2 = z1 ^ z2h;
+	v3 = z1h;
+
+	v3 = (v3 << 1) | (v2 >> 63);
+	v2 = (v2 << 1) | (v1 >> 63);
+	v1 = (v1 << 1) | (v0 >> 63);
+	v0 = (v0 << 1);
+
+	v2 ^= v0 ^ (v0 >> 1) ^ (v0 >> 2) ^ (v0 >> 7);
+	v1 ^= (v0 << 63) ^ (v0 << 62) ^ (v0 << 57);
+	v3 ^= v1 ^ (v1 >> 1) ^ (v1 >> 2) ^ (v1 >> 7);
+	v2 ^= (v1 << 63) ^ (v1 << 62) ^ (v1 << 57);
+
+	MBEDTLS_PUT_UINT64_BE(v3, output, 0);
+	MBEDTLS_PUT_UINT64_BE(v2, output, 8);
+}
+#endif /* CRACEN_SW_GCM_GHASH_CLMUL */
 
 /*
- * Sets output to x times H using the precomputed tables.
+ * Sets output to x times H using the precomputed values.
  * x and output are seen as elements of GF(2^128) as in [MGV].
  */
-void gcm_ext_mult(const uint64_t H[16][2], const unsigned char x[16],
+void gcm_ext_mult(const uint64_t H[GCM_EXT_HTABLE_SIZE][2], const unsigned char x[16],
 		  unsigned char output[16])
 {
+#if defined(CRACEN_SW_GCM_GHASH_TABLE8)
+	gcm_mult_largetable(output, x, H);
+#elif defined(CRACEN_SW_GCM_GHASH_CLMUL)
+	gcm_mult_clmul(output, x, H);
+#else
 	gcm_mult_smalltable(output, x, H);
+#endif
 	return;
 }
@@ -27,11 +27,21 @@
 extern "C" {
 #endif
 
-/* Only small Shoup's table is supported now */
+/*
+ * Number of precomputed 128-bit values, depending on the selected implementation:
+ * Shoup's method with 8-bit tables (4 KiB), the carry-less multiplication, which only
+ * keeps H and its bit-reversed words, or Shoup's method with 4-bit tables (256 bytes).
+ */
+#if defined(CRACEN_SW_GCM_GHASH_TABLE8)
+#define GCM_EXT_HTABLE_SIZE 256
+#elif defined(CRACEN_SW_GCM_GHASH_CLMUL)
+#define GCM_EXT_HTABLE_SIZE 2
+#else
 #define GCM_EXT_HTABLE_SIZE 16
+#endif
 
-int gcm_ext_gen_table(const uint8_t *h, uint64_t H[16][2]);
-void gcm_ext_mult(const uint64_t H[16][2], const unsigned char x[16],
+int gcm_ext_gen_table(const uint8_t *h, uint64_t H[GCM_EXT_HTABLE_SIZE][2]);
+void gcm_ext_mult(const uint64_t H[GCM_EXT_HTABLE_SIZE][2], const unsigned char x[16],
 		  unsigned char output[16]);
 
 #ifdef __cplusplus
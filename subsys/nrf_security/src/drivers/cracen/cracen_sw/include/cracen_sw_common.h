@@ -102,6 +102,51 @@ psa_status_t cracen_sw_increment_counter_be(uint8_t *ctr_buf, size_t ctr_buf_siz
 void cracen_sw_encode_value_be(uint8_t *buffer, size_t buffer_size, size_t value,
 			       size_t value_size);
 
+/** @brief Generate AES-CTR keystream for multiple counter blocks.
+ *
+ * The counter blocks are encrypted in a single AES-ECB operation, so the block
+ * cipher setup cost is paid once per call instead of once per block.
+ *
+ * @param[in] blkciph The block cipher struct.
+ * @param[in] key The AES key reference.
+ * @param[in,out] ctr Counter block of the first keystream block. Updated to the
+ *                    counter block following the last one used.
+ * @param[in] counter_start_pos Counter starting position index.
+ * @param[out] keystream Output buffer of @p num_blocks AES blocks.
+ * @param[in] num_blocks Number of blocks, at most CONFIG_CRACEN_SW_AES_CTR_BATCH_BLOCKS.
+ *
+ * @retval PSA_SUCCESS		      The operation completed successfully.
+ * @retval PSA_ERROR_INVALID_ARGUMENT Invalid number of blocks, or the counter overflowed.
+ */
+psa_status_t cracen_sw_aes_ctr_keystream(struct sxblkcipher *blkciph, const struct sxkeyref *key,
+					 uint8_t *ctr, size_t counter_start_pos,
+					 uint8_t *keystream, size_t num_blocks);
+
+/** @brief XOR data with AES-CTR keystream.
+ *
+ * This function is used by software workarounds for CRACEN peripheral. Keystream
+ * left over from a previous call is used first, complete blocks are then processed
+ * in batches of CONFIG_CRACEN_SW_AES_CTR_BATCH_BLOCKS.
+ *
+ * @param[in] blkciph The block cipher struct.
+ * @param[in] key The AES key reference.
+ * @param[in,out] ctr Counter block of the next keystream block.
+ * @param[in] counter_start_pos Counter starting position index.
+ * @param[in,out] keystream Current keystream block.
+ * @param[in,out] keystream_offset Number of bytes of @p keystream already used,
+ *                                 the AES block size when none is left.
+ * @param[in] input Input data.
+ * @param[out] output Output buffer. Can be the same as @p input.
+ * @param[in] length Length of the input data.
+ *
+ * @retval PSA_SUCCESS		      The operation completed successfully.
+ * @retval PSA_ERROR_INVALID_ARGUMENT The counter overflowed.
+ */
+psa_status_t cracen_sw_aes_ctr_xor(struct sxblkcipher *blkciph, const struct sxkeyref *key,
+				   uint8_t *ctr, size_t counter_start_pos, uint8_t *keystream,
+				   size_t *keystream_offset, const uint8_t *input, uint8_t *output,
+				   size_t length);
+
 /** @} */
 
 #endif /* CRACEN_SW_COMMON_H */
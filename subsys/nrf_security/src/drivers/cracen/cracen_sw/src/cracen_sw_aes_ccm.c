@@ -34,6 +34,9 @@
 #define CCM_AAD_SHORT_MAX		0xFF00u
 #define CCM_AAD_MARKER0			0xFFu
 #define CCM_AAD_MARKER1			0xFEu
+/* Data processed per CBC-MAC and CTR pass, sized to match the keystream batch */
+#define CCM_DATA_CHUNK_SIZE		\
+	(CONFIG_CRACEN_SW_AES_CTR_BATCH_BLOCKS * SX_BLKCIPHER_AES_BLK_SZ)
 
 static bool is_nonce_length_valid(size_t nonce_length)
 {
@@ -288,7 +291,8 @@ static void initialize_ctr(cracen_aead_operation_t *operation)
 	if (ccm_ctx->ctr_initialized) {
 		return;
 	}
-	format_ccm_ctr_block(ccm_ctx->ctr_block, operation->nonce_length, operation->nonce, 0);
+	/* Counter 0 is reserved for the tag, so the keystream starts at counter 1 */
+	format_ccm_ctr_block(ccm_ctx->ctr_block, operation->nonce_length, operation->nonce, 1);
 	ccm_ctx->keystream_offset = SX_BLKCIPHER_AES_BLK_SZ;
 	ccm_ctx->ctr_initialized = true;
 }
@@ -358,35 +362,16 @@ static psa_status_t ctr_xor(cracen_aead_operation_t *operation, struct sxblkciph
 			    size_t counter_size)
 {
 	cracen_sw_ccm_context_t *ccm_ctx = &operation->sw_ccm_ctx;
-	psa_status_t status;
-	size_t counter_start_pos = SX_BLKCIPHER_AES_BLK_SZ - counter_size;
 
-	for (size_t i = 0; i < length; i++) {
-		/* Generate new keystream block when current one is exhausted */
-		if (ccm_ctx->keystream_offset >= SX_BLKCIPHER_AES_BLK_SZ) {
-			status = cracen_sw_increment_counter_be(ccm_ctx->ctr_block,
-								SX_BLKCIPHER_AES_BLK_SZ,
-								counter_start_pos);
-			if (status != PSA_SUCCESS) {
-				return status;
-			}
-			status = cracen_sw_aes_primitive(cipher, &operation->keyref,
-							 ccm_ctx->ctr_block, ccm_ctx->keystream);
-			if (status != PSA_SUCCESS) {
-				return status;
-			}
-			ccm_ctx->keystream_offset = 0;
-		}
-		output[i] = input[i] ^ ccm_ctx->keystream[ccm_ctx->keystream_offset++];
-	}
-	return PSA_SUCCESS;
+	return cracen_sw_aes_ctr_xor(cipher, &operation->keyref, ccm_ctx->ctr_block,
+				     SX_BLKCIPHER_AES_BLK_SZ - counter_size, ccm_ctx->keystream,
+				     &ccm_ctx->keystream_offset, input, output, length);
 }
 
 psa_status_t cracen_sw_aes_ccm_update(cracen_aead_operation_t *operation, const uint8_t *input,
 				      size_t input_length, uint8_t *output, size_t output_size,
 				      size_t *output_length)
 {
-	cracen_sw_ccm_context_t *ccm_ctx = &operation->sw_ccm_ctx;
 	struct sxblkcipher cipher;
 	psa_status_t status;
 	size_t processed = 0;
@@ -407,9 +392,7 @@ psa_status_t cracen_sw_aes_ccm_update(cracen_aead_operation_t *operation, const
 	if (operation->dir == CRACEN_ENCRYPT) {
 		/* Encrypt: MAC plaintext, then apply CTR keystream */
 		while (processed < input_length) {
-			size_t chunk_size =
-				MIN(input_length - processed,
-				    SX_BLKCIPHER_AES_BLK_SZ - ccm_ctx->data_partial_len);
+			size_t chunk_size = MIN(input_length - processed, CCM_DATA_CHUNK_SIZE);
 
 			status = accumulate_for_mac(operation, &input[processed], chunk_size,
 						    &cipher);
@@ -430,9 +413,7 @@ psa_status_t cracen_sw_aes_ccm_update(cracen_aead_operation_t *operation, const
 		 * then MAC plaintext
 		 */
 		while (processed < input_length) {
-			size_t chunk_size =
-				MIN(input_length - processed,
-				    SX_BLKCIPHER_AES_BLK_SZ - ccm_ctx->data_partial_len);
+			size_t chunk_size = MIN(input_length - processed, CCM_DATA_CHUNK_SIZE);
 
 			status = ctr_xor(operation, &cipher, &input[processed], &output[processed],
 					 chunk_size, counter_size);
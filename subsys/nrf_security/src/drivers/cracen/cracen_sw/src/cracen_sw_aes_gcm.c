@@ -42,6 +42,11 @@
 
 /* Compute Q (length field size) from nonce length: Q = 16 - nonce_len */
 #define GCM_Q_LEN_FROM_NONCE(nonce_len) (SX_BLKCIPHER_AES_BLK_SZ - (nonce_len))
+/* Data processed per CTR and GHASH pass, sized to match the keystream batch */
+#define GCM_DATA_CHUNK_SIZE (CONFIG_CRACEN_SW_AES_CTR_BATCH_BLOCKS * SX_BLKCIPHER_AES_BLK_SZ)
+
+BUILD_ASSERT(CRACEN_AES_GCM_HTABLE_SIZE == GCM_EXT_HTABLE_SIZE,
+	     "GCM context table does not match the selected GHASH implementation");
 
 static bool is_nonce_length_valid(size_t nonce_length)
 {
@@ -101,6 +106,7 @@ static psa_status_t setup(cracen_aead_operation_t *operation, enum cipher_operat
 	}
 	safe_memzero(operation->unprocessed_input, CRACEN_MAX_AEAD_BLOCK_SIZE);
 	operation->unprocessed_input_bytes = 0;
+	operation->ad_finished = false;
 	operation->alg = PSA_ALG_AEAD_WITH_DEFAULT_LENGTH_TAG(alg);
 	operation->dir = dir;
 	operation->tag_size = tag_size;
@@ -217,7 +223,11 @@ static void initialize_ctr(cracen_aead_operation_t *operation)
 	if (gcm_ctx->ctr_initialized) {
 		return;
 	}
+	/* J0 is reserved for the tag, so the keystream starts at inc32(J0) */
 	generate_gcm_j0(operation, gcm_ctx->ctr_block);
+	(void)cracen_sw_increment_counter_be(gcm_ctx->ctr_block, SX_BLKCIPHER_AES_BLK_SZ,
+					     SX_BLKCIPHER_AES_BLK_SZ -
+						     GCM_Q_LEN_FROM_NONCE(operation->nonce_length));
 	gcm_ctx->keystream_offset = SX_BLKCIPHER_AES_BLK_SZ;
 	gcm_ctx->ctr_initialized = true;
 }
@@ -228,28 +238,10 @@ static psa_status_t ctr_xor(cracen_aead_operation_t *operation, struct sxblkciph
 			    size_t counter_size)
 {
 	cracen_sw_gcm_context_t *gcm_ctx = &operation->sw_gcm_ctx;
-	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-	size_t counter_start_pos = SX_BLKCIPHER_AES_BLK_SZ - counter_size;
-
-	for (size_t i = 0; i < length; i++) {
-		/* Generate new keystream block when current one is exhausted */
-		if (gcm_ctx->keystream_offset >= SX_BLKCIPHER_AES_BLK_SZ) {
-			status = cracen_sw_increment_counter_be(gcm_ctx->ctr_block,
-								SX_BLKCIPHER_AES_BLK_SZ,
-								counter_start_pos);
-			if (status != PSA_SUCCESS) {
-				return status;
-			}
-			status = cracen_sw_aes_primitive(cipher, &operation->keyref,
-							 gcm_ctx->ctr_block, gcm_ctx->keystream);
-			if (status != PSA_SUCCESS) {
-				return status;
-			}
-			gcm_ctx->keystream_offset = 0;
-		}
-		output[i] = input[i] ^ gcm_ctx->keystream[gcm_ctx->keystream_offset++];
-	}
-	return PSA_SUCCESS;
+
+	return cracen_sw_aes_ctr_xor(cipher, &operation->keyref, gcm_ctx->ctr_block,
+				     SX_BLKCIPHER_AES_BLK_SZ - counter_size, gcm_ctx->keystream,
+				     &gcm_ctx->keystream_offset, input, output, length);
 }
 
 /* Finalize any partial data block with zero-padding and update ghash */
@@ -306,23 +298,23 @@ psa_status_t cracen_sw_aes_gcm_update(cracen_aead_operation_t *operation, const
 	size_t processed = 0;
 	size_t counter_size = GCM_Q_LEN_FROM_NONCE(operation->nonce_length);
 
-	operation->ad_finished = true;
-
 	status = initialize_gcm_h(operation, &cipher);
 	if (status != PSA_SUCCESS) {
 		return status;
 	}
 	initialize_ctr(operation);
 
-	finalize_ad_padding(operation);
+	/* Only the AD is padded, a partial data block is kept for the next update */
+	if (!operation->ad_finished) {
+		finalize_ad_padding(operation);
+		operation->ad_finished = true;
+	}
 
 	/* Process data with CTR mode encryption/decryption */
 	if (operation->dir == CRACEN_ENCRYPT) {
 		/* Encrypt: apply CTR keystream. then GHASH */
 		while (processed < input_length) {
-			size_t chunk_size =
-				MIN(input_length - processed,
-				    SX_BLKCIPHER_AES_BLK_SZ - operation->unprocessed_input_bytes);
+			size_t chunk_size = MIN(input_length - processed, GCM_DATA_CHUNK_SIZE);
 
 			status = ctr_xor(operation, &cipher, &input[processed], &output[processed],
 					 chunk_size, counter_size);
@@ -337,9 +329,7 @@ psa_status_t cracen_sw_aes_gcm_update(cracen_aead_operation_t *operation, const
 		 *  then CTR keystream
 		 */
 		while (processed < input_length) {
-			size_t chunk_size =
-				MIN(input_length - processed,
-				    SX_BLKCIPHER_AES_BLK_SZ - operation->unprocessed_input_bytes);
+			size_t chunk_size = MIN(input_length - processed, GCM_DATA_CHUNK_SIZE);
 
 			calc_gcm_ghash(operation, &input[processed], chunk_size);
 			status = ctr_xor(operation, &cipher, &input[processed], &output[processed],
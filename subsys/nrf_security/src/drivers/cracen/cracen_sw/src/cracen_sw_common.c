@@ -10,6 +10,9 @@
 #include <sxsymcrypt/internal.h>
 #include <cracen/statuscodes.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+#include <nrf_security_mem_helpers.h>
+#include <string.h>
 #include <cracen/common.h>
 #include <cracen_sw_common.h>
 
@@ -140,3 +143,106 @@ void cracen_sw_encode_value_be(uint8_t *buffer, size_t buffer_size, size_t value
 		buffer[buffer_size - 1 - i] = value >> (i * 8);
 	}
 }
+
+#if defined(CONFIG_PSA_NEED_CRACEN_CTR_SIZE_WORKAROUNDS)
+static bool is_counter_zero(const uint8_t *ctr, size_t counter_start_pos)
+{
+	uint8_t acc = 0;
+
+	for (size_t i = counter_start_pos; i < SX_BLKCIPHER_AES_BLK_SZ; i++) {
+		acc |= ctr[i];
+	}
+
+	return acc == 0;
+}
+
+psa_status_t cracen_sw_aes_ctr_keystream(struct sxblkcipher *blkciph, const struct sxkeyref *key,
+					 uint8_t *ctr, size_t counter_start_pos,
+					 uint8_t *keystream, size_t num_blocks)
+{
+	uint8_t ctr_blocks[CONFIG_CRACEN_SW_AES_CTR_BATCH_BLOCKS * SX_BLKCIPHER_AES_BLK_SZ];
+	size_t length = num_blocks * SX_BLKCIPHER_AES_BLK_SZ;
+	size_t output_length;
+	psa_status_t status;
+
+	if (num_blocks == 0 || num_blocks > CONFIG_CRACEN_SW_AES_CTR_BATCH_BLOCKS) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	for (size_t i = 0; i < num_blocks; i++) {
+		/* A counter field that does not span the whole block starts from a non-zero
+		 * value and must not wrap around, as the zero counter is used for the tag.
+		 */
+		if (counter_start_pos > 0 && is_counter_zero(ctr, counter_start_pos)) {
+			safe_memzero(ctr_blocks, sizeof(ctr_blocks));
+			return PSA_ERROR_INVALID_ARGUMENT;
+		}
+
+		memcpy(&ctr_blocks[i * SX_BLKCIPHER_AES_BLK_SZ], ctr, SX_BLKCIPHER_AES_BLK_SZ);
+		(void)cracen_sw_increment_counter_be(ctr, SX_BLKCIPHER_AES_BLK_SZ,
+						     counter_start_pos);
+	}
+
+	status = cracen_sw_aes_ecb_encrypt(blkciph, key, ctr_blocks, length, keystream, length,
+					   &output_length);
+
+	safe_memzero(ctr_blocks, sizeof(ctr_blocks));
+	return status;
+}
+
+psa_status_t cracen_sw_aes_ctr_xor(struct sxblkcipher *blkciph, const struct sxkeyref *key,
+				   uint8_t *ctr, size_t counter_start_pos, uint8_t *keystream,
+				   size_t *keystream_offset, const uint8_t *input, uint8_t *output,
+				   size_t length)
+{
+	uint8_t batch[CONFIG_CRACEN_SW_AES_CTR_BATCH_BLOCKS * SX_BLKCIPHER_AES_BLK_SZ];
+	psa_status_t status = PSA_SUCCESS;
+	size_t processed = 0;
+	size_t chunk_size;
+
+	/* Use up the keystream left over from the previous call */
+	chunk_size = MIN(length, SX_BLKCIPHER_AES_BLK_SZ - *keystream_offset);
+	for (size_t i = 0; i < chunk_size; i++) {
+		output[i] = input[i] ^ keystream[*keystream_offset + i];
+	}
+	*keystream_offset += chunk_size;
+	processed += chunk_size;
+
+	/* Complete blocks, multiple counter blocks per block cipher operation */
+	while (length - processed >= SX_BLKCIPHER_AES_BLK_SZ) {
+		size_t num_blocks = MIN((length - processed) / SX_BLKCIPHER_AES_BLK_SZ,
+					CONFIG_CRACEN_SW_AES_CTR_BATCH_BLOCKS);
+
+		chunk_size = num_blocks * SX_BLKCIPHER_AES_BLK_SZ;
+		status = cracen_sw_aes_ctr_keystream(blkciph, key, ctr, counter_start_pos, batch,
+						     num_blocks);
+		if (status != PSA_SUCCESS) {
+			goto exit;
+		}
+
+		for (size_t i = 0; i < chunk_size; i++) {
+			output[processed + i] = input[processed + i] ^ batch[i];
+		}
+		processed += chunk_size;
+	}
+
+	/* Keep the rest of the last keystream block for the next call */
+	if (processed < length) {
+		status = cracen_sw_aes_ctr_keystream(blkciph, key, ctr, counter_start_pos,
+						     keystream, 1);
+		if (status != PSA_SUCCESS) {
+			goto exit;
+		}
+
+		chunk_size = length - processed;
+		for (size_t i = 0; i < chunk_size; i++) {
+			output[processed + i] = input[processed + i] ^ keystream[i];
+		}
+		*keystream_offset = chunk_size;
+	}
+
+exit:
+	safe_memzero(batch, sizeof(batch));
+	return status;
+}
+#endif /* CONFIG_PSA_NEED_CRACEN_CTR_SIZE_WORKAROUNDS */
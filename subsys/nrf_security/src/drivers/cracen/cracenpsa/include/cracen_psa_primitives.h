@@ -193,10 +193,17 @@
 #define CRACEN_WPA3_SAE_CONFIRM_SIZE		(CRACEN_WPA3_SAE_SEND_CONFIRM_SIZE + \
 						 PSA_HASH_LENGTH(PSA_ALG_SHA_256))
 
-/** 4-bit Shoup's table.
- *  The size is defined as 2^4.
+/** Number of precomputed GHASH values of the software GCM.
+ *  2^8 for the 8-bit Shoup's table, H and its bit-reversed words for the
+ *  carry-less multiplication, 2^4 for the 4-bit Shoup's table.
  */
+#if defined(CRACEN_SW_GCM_GHASH_TABLE8)
+#define CRACEN_AES_GCM_HTABLE_SIZE 256
+#elif defined(CRACEN_SW_GCM_GHASH_CLMUL)
+#define CRACEN_AES_GCM_HTABLE_SIZE 2
+#else
 #define CRACEN_AES_GCM_HTABLE_SIZE 16
+#endif
 
 enum cipher_operation {
 	CRACEN_DECRYPT,
@@ -37,13 +37,20 @@ struct settings_zms {
 	uint32_t last_name_id;
 	const struct device *flash_dev;
 #if CONFIG_SETTINGS_ZMS_NAME_CACHE
+	/* Hashes of the setting's name and of its subtree prefix, indexed by
+	 * name ID - ZMS_NAMECNT_ID - 1. A zero name hash marks a free name ID.
+	 */
 	struct {
 		uint32_t name_hash;
-		uint32_t name_id;
+		uint32_t prefix_hash;
 	} cache[CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE];
 
-	uint32_t cache_next;
-	uint32_t cache_total;
+	/* Open-addressed index of name hashes. Each slot holds the cache
+	 * position of a name + 1, or 0 if the slot is empty.
+	 */
+	uint32_t cache_index[2 * CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE];
+
+	/* Cache holds all the names stored below last_name_id */
 	bool loaded;
 #endif
 };
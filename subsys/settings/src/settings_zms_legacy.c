@@ -64,34 +64,154 @@ int settings_zms_dst(struct settings_zms *cf)
 }
 
 #if CONFIG_SETTINGS_ZMS_NAME_CACHE
-#define SETTINGS_ZMS_CACHE_OVFL(cf) ((cf)->cache_total > ARRAY_SIZE((cf)->cache))
+#define SETTINGS_ZMS_CACHE_SIZE	    CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE
+#define SETTINGS_ZMS_INDEX_SIZE	    (2 * CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE)
+#define SETTINGS_ZMS_CACHE_POS(id)  ((id) - ZMS_NAMECNT_ID - 1)
+#define SETTINGS_ZMS_CACHE_ID(pos)  (ZMS_NAMECNT_ID + 1 + (pos))
+#define SETTINGS_ZMS_CACHE_OVFL(cf) ((cf)->last_name_id - ZMS_NAMECNT_ID > SETTINGS_ZMS_CACHE_SIZE)
 
-static void settings_zms_cache_add(struct settings_zms *cf, const char *name, uint32_t name_id)
+/* Number of name components covered by the prefix hash, 16 bits of hash for each */
+#define SETTINGS_ZMS_PREFIX_LEVELS 2
+
+static uint32_t settings_zms_name_hash(const char *name)
 {
 	uint32_t name_hash = sys_hash32(name, strnlen(name, SETTINGS_FULL_NAME_LEN));
 
-	cf->cache[cf->cache_next].name_hash = name_hash;
-	cf->cache[cf->cache_next++].name_id = name_id;
+	/* Zero name hash is reserved for free name IDs */
+	return (name_hash != 0) ? name_hash : 1;
+}
+
+/* The prefix hash holds hashes of the first and of the first two components of the name. A name
+ * can belong to a subtree only if the prefix hashes are equal within the mask of the subtree.
+ */
+static uint32_t settings_zms_prefix_hash(const char *name, uint32_t *mask)
+{
+	static const char separators[] = {SETTINGS_NAME_SEPARATOR, SETTINGS_NAME_END, '\0'};
+	uint32_t prefix_hash = 0;
+	size_t len = 0;
+
+	*mask = 0;
+
+	for (int level = 0; level < SETTINGS_ZMS_PREFIX_LEVELS; level++) {
+		if (level > 0) {
+			if (name[len] != SETTINGS_NAME_SEPARATOR) {
+				break;
+			}
+			len++;
+		}
+
+		len += strcspn(&name[len], separators);
+		prefix_hash |= (sys_hash32(name, len) & 0xffff) << (16 * level);
+		*mask |= 0xffff << (16 * level);
+	}
+
+	return prefix_hash;
+}
+
+static uint32_t settings_zms_index_home(uint32_t name_hash)
+{
+	return name_hash % SETTINGS_ZMS_INDEX_SIZE;
+}
+
+static uint32_t settings_zms_index_next(uint32_t slot)
+{
+	return (slot + 1) % SETTINGS_ZMS_INDEX_SIZE;
+}
+
+static void settings_zms_cache_clear(struct settings_zms *cf)
+{
+	memset(cf->cache, 0, sizeof(cf->cache));
+	memset(cf->cache_index, 0, sizeof(cf->cache_index));
+	cf->loaded = false;
+}
+
+static void settings_zms_cache_remove(struct settings_zms *cf, uint32_t name_id)
+{
+	uint32_t pos = SETTINGS_ZMS_CACHE_POS(name_id);
+	uint32_t slot;
+	uint32_t next;
+
+	if ((pos >= SETTINGS_ZMS_CACHE_SIZE) || (cf->cache[pos].name_hash == 0)) {
+		return;
+	}
+
+	slot = settings_zms_index_home(cf->cache[pos].name_hash);
+	while (cf->cache_index[slot] != pos + 1) {
+		slot = settings_zms_index_next(slot);
+	}
+
+	cf->cache[pos].name_hash = 0;
+	cf->cache[pos].prefix_hash = 0;
+
+	/* Shift the following entries of the probe sequence back, so that the lookup of
+	 * an entry never stops on the freed slot before reaching it.
+	 */
+	next = slot;
+	while (1) {
+		uint32_t home;
+
+		next = settings_zms_index_next(next);
+		if (cf->cache_index[next] == 0) {
+			break;
+		}
+
+		home = settings_zms_index_home(cf->cache[cf->cache_index[next] - 1].name_hash);
+
+		/* Entry can be moved only if its home slot is not cyclically in (slot, next] */
+		if ((slot < next) ? ((home <= slot) || (home > next)) :
+				    ((home <= slot) && (home > next))) {
+			cf->cache_index[slot] = cf->cache_index[next];
+			slot = next;
+		}
+	}
+
+	cf->cache_index[slot] = 0;
+}
+
+static void settings_zms_cache_add(struct settings_zms *cf, const char *name, uint32_t name_id)
+{
+	uint32_t pos = SETTINGS_ZMS_CACHE_POS(name_id);
+	uint32_t prefix_mask;
+	uint32_t slot;
+
+	if (pos >= SETTINGS_ZMS_CACHE_SIZE) {
+		/* Name ID beyond the cache, reported through SETTINGS_ZMS_CACHE_OVFL() */
+		return;
+	}
 
-	cf->cache_next %= CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE;
+	settings_zms_cache_remove(cf, name_id);
+
+	cf->cache[pos].name_hash = settings_zms_name_hash(name);
+	cf->cache[pos].prefix_hash = settings_zms_prefix_hash(name, &prefix_mask);
+
+	/* The index has twice as many slots as the cache, so there is always a free slot */
+	slot = settings_zms_index_home(cf->cache[pos].name_hash);
+	while (cf->cache_index[slot] != 0) {
+		slot = settings_zms_index_next(slot);
+	}
+
+	cf->cache_index[slot] = pos + 1;
 }
 
 static uint32_t settings_zms_cache_match(struct settings_zms *cf, const char *name, char *rdname,
 					 size_t len)
 {
-	uint32_t name_hash = sys_hash32(name, strnlen(name, SETTINGS_FULL_NAME_LEN));
+	uint32_t name_hash = settings_zms_name_hash(name);
+	uint32_t name_id;
+	uint32_t pos;
 	int rc;
 
-	for (int i = 0; i < CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE; i++) {
-		if (cf->cache[i].name_hash != name_hash) {
-			continue;
-		}
+	for (uint32_t slot = settings_zms_index_home(name_hash); cf->cache_index[slot] != 0;
+	     slot = settings_zms_index_next(slot)) {
+		pos = cf->cache_index[slot] - 1;
 
-		if (cf->cache[i].name_id <= ZMS_NAMECNT_ID) {
+		if (cf->cache[pos].name_hash != name_hash) {
 			continue;
 		}
 
-		rc = zms_read(&cf->cf_zms, cf->cache[i].name_id, rdname, len);
+		name_id = SETTINGS_ZMS_CACHE_ID(pos);
+
+		rc = zms_read(&cf->cf_zms, name_id, rdname, len);
 		if (rc < 0) {
 			continue;
 		}
@@ -102,11 +222,33 @@ static uint32_t settings_zms_cache_match(struct settings_zms *cf, const char *na
 			continue;
 		}
 
-		return cf->cache[i].name_id;
+		return name_id;
 	}
 
 	return ZMS_NAMECNT_ID;
 }
+
+/* Get the lowest name ID not in use, valid only if all the names are cached */
+static uint32_t settings_zms_cache_free_id_get(struct settings_zms *cf)
+{
+	for (uint32_t pos = 0; pos < cf->last_name_id - ZMS_NAMECNT_ID; pos++) {
+		if (cf->cache[pos].name_hash == 0) {
+			return SETTINGS_ZMS_CACHE_ID(pos);
+		}
+	}
+
+	return cf->last_name_id + 1;
+}
+
+/* Check if a cached name ID is in use and may belong to the subtree */
+static bool settings_zms_cache_subtree_match(struct settings_zms *cf, uint32_t name_id,
+					     uint32_t prefix_hash, uint32_t prefix_mask)
+{
+	uint32_t pos = SETTINGS_ZMS_CACHE_POS(name_id);
+
+	return (cf->cache[pos].name_hash != 0) &&
+	       (((cf->cache[pos].prefix_hash ^ prefix_hash) & prefix_mask) == 0);
+}
 #endif /* CONFIG_SETTINGS_ZMS_NAME_CACHE */
 
 static int settings_zms_load(struct settings_store *cs, const struct settings_load_arg *arg)
@@ -119,9 +261,19 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 	uint32_t name_id = ZMS_NAMECNT_ID;
 
 #if CONFIG_SETTINGS_ZMS_NAME_CACHE
-	uint32_t cached = 0;
-
-	cf->loaded = false;
+	/* Once all the names are cached, only the name IDs in use that may belong to
+	 * the requested subtree are read from the storage. Otherwise, the cache is
+	 * rebuilt while walking all the name IDs.
+	 */
+	bool cache_valid = cf->loaded && !SETTINGS_ZMS_CACHE_OVFL(cf);
+	uint32_t prefix_hash = 0;
+	uint32_t prefix_mask = 0;
+
+	if (!cache_valid) {
+		settings_zms_cache_clear(cf);
+	} else if (arg && arg->subtree) {
+		prefix_hash = settings_zms_prefix_hash(arg->subtree, &prefix_mask);
+	}
 #endif
 
 	name_id = cf->last_name_id + 1;
@@ -132,11 +284,17 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 		if (name_id == ZMS_NAMECNT_ID) {
 #if CONFIG_SETTINGS_ZMS_NAME_CACHE
 			cf->loaded = true;
-			cf->cache_total = cached;
 #endif
 			break;
 		}
 
+#if CONFIG_SETTINGS_ZMS_NAME_CACHE
+		if (cache_valid &&
+		    !settings_zms_cache_subtree_match(cf, name_id, prefix_hash, prefix_mask)) {
+			continue;
+		}
+#endif
+
 		/* In the ZMS backend, each setting item is stored in two ZMS
 		 * entries one for the setting's name and one with the
 		 * setting's value.
@@ -146,6 +304,9 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 		rc2 = zms_get_data_length(&cf->cf_zms, name_id + ZMS_NAME_ID_OFFSET);
 
 		if ((rc1 <= 0) && (rc2 <= 0)) {
+#if CONFIG_SETTINGS_ZMS_NAME_CACHE
+			settings_zms_cache_remove(cf, name_id);
+#endif
 			/* Settings largest ID in use is invalid due to
 			 * reset, power failure or partition overflow.
 			 * Decrement it and check the next ID in subsequent
@@ -168,6 +329,9 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 			 */
 			zms_delete(&cf->cf_zms, name_id);
 			zms_delete(&cf->cf_zms, name_id + ZMS_NAME_ID_OFFSET);
+#if CONFIG_SETTINGS_ZMS_NAME_CACHE
+			settings_zms_cache_remove(cf, name_id);
+#endif
 
 			if (name_id == cf->last_name_id) {
 				cf->last_name_id--;
@@ -184,8 +348,9 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 		read_fn_arg.id = name_id + ZMS_NAME_ID_OFFSET;
 
 #if CONFIG_SETTINGS_ZMS_NAME_CACHE
-		settings_zms_cache_add(cf, name, name_id);
-		cached++;
+		if (!cache_valid) {
+			settings_zms_cache_add(cf, name, name_id);
+		}
 #endif
 
 		ret = settings_call_set_handler(name, rc2, settings_zms_read_fn, &read_fn_arg,
@@ -233,6 +398,8 @@ static int settings_zms_save(struct settings_store *cs, const char *name, const
 #if CONFIG_SETTINGS_ZMS_NAME_CACHE
 	/* We can skip reading ZMS if we know that the cache wasn't overflowed. */
 	if (cf->loaded && !SETTINGS_ZMS_CACHE_OVFL(cf)) {
+		name_id = ZMS_NAMECNT_ID;
+		write_name_id = settings_zms_cache_free_id_get(cf);
 		goto found;
 	}
 #endif
@@ -288,6 +455,10 @@ found:
 			return rc;
 		}
 
+#if CONFIG_SETTINGS_ZMS_NAME_CACHE
+		settings_zms_cache_remove(cf, name_id);
+#endif
+
 		if (name_id == cf->last_name_id) {
 			cf->last_name_id--;
 			rc = zms_write(&cf->cf_zms, ZMS_NAMECNT_ID, &cf->last_name_id,
@@ -335,9 +506,6 @@ found:
 #if CONFIG_SETTINGS_ZMS_NAME_CACHE
 	if (!name_in_cache) {
 		settings_zms_cache_add(cf, name, write_name_id);
-		if (cf->loaded && !SETTINGS_ZMS_CACHE_OVFL(cf)) {
-			cf->cache_total++;
-		}
 	}
 #endif
 
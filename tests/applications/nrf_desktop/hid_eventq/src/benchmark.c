@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+
+#include "hid_eventq.h"
+#include "ref_hid_eventq.h"
+
+#define BENCH_QUEUE_SIZE	REF_HID_EVENTQ_SIZE_MAX
+#define BENCH_ITERATIONS	20
+#define BENCH_HELD_KEY_ID	0xffff
+
+static struct hid_eventq bench_q;
+static struct hid_eventq_event bench_q_buf[BENCH_QUEUE_SIZE];
+static struct ref_hid_eventq bench_ref_q;
+
+/* Fill the queue with a key press that is never released followed by pairs of key press and
+ * release. Nothing can be dropped, as the oldest key press is not released, so that every
+ * enqueue has to inspect the whole queue before failing.
+ */
+static void bench_queue_fill(void)
+{
+	int err;
+
+	memset(&bench_q, 0, sizeof(bench_q));
+	hid_eventq_init(&bench_q, bench_q_buf, BENCH_QUEUE_SIZE);
+	ref_hid_eventq_init(&bench_ref_q, BENCH_QUEUE_SIZE);
+
+	err = hid_eventq_keypress_enqueue(&bench_q, BENCH_HELD_KEY_ID, true, false);
+	zassert_ok(err);
+	err = ref_hid_eventq_enqueue(&bench_ref_q, 0, BENCH_HELD_KEY_ID, true, false);
+	zassert_ok(err);
+
+	for (uint16_t i = 1; i < BENCH_QUEUE_SIZE; i++) {
+		err = hid_eventq_keypress_enqueue(&bench_q, (i - 1) / 2, (i % 2) != 0,
+						  false);
+		zassert_ok(err);
+		err = ref_hid_eventq_enqueue(&bench_ref_q, 0, (i - 1) / 2, (i % 2) != 0, false);
+		zassert_ok(err);
+	}
+}
+
+static void bench_print(const char *name, uint64_t cycles)
+{
+	TC_PRINT("%s: %llu ns per enqueue to full queue of %d events\n", name,
+		 timing_cycles_to_ns(cycles) / BENCH_ITERATIONS, BENCH_QUEUE_SIZE);
+}
+
+ZTEST(suite_hid_eventq_benchmark, test_bench_full_queue_enqueue)
+{
+	int err = 0;
+	int ref_err = 0;
+	timing_t start;
+	timing_t end;
+	uint64_t ref_cycles;
+	uint64_t new_cycles;
+
+	bench_queue_fill();
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		ref_err = ref_hid_eventq_enqueue(&bench_ref_q, 0, BENCH_HELD_KEY_ID, false, true);
+	}
+	end = timing_counter_get();
+	ref_cycles = timing_cycles_get(&start, &end);
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		err = hid_eventq_keypress_enqueue(&bench_q, BENCH_HELD_KEY_ID, false, true);
+	}
+	end = timing_counter_get();
+	new_cycles = timing_cycles_get(&start, &end);
+
+	zassert_equal(ref_err, -ENOBUFS);
+	zassert_equal(err, -ENOBUFS);
+	zassert_true(hid_eventq_is_full(&bench_q));
+
+	bench_print("list based reference", ref_cycles);
+	bench_print("hid_eventq", new_cycles);
+}
+
+static void *suite_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(suite_hid_eventq_benchmark, NULL, suite_setup, NULL, NULL, suite_teardown);
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/random/random.h>
+
+#include "hid_eventq.h"
+#include "ref_hid_eventq.h"
+
+#define QUEUE_SIZE		8
+#define RANDOM_QUEUE_SIZE	16
+#define RANDOM_KEY_CNT		6
+#define RANDOM_ITERATIONS	5000
+
+static struct hid_eventq q;
+static struct hid_eventq_event q_buf[RANDOM_QUEUE_SIZE];
+static struct ref_hid_eventq ref_q;
+
+static void keypress_enqueue(uint16_t id, bool pressed, bool drop_oldest)
+{
+	zassert_ok(hid_eventq_keypress_enqueue(&q, id, pressed, drop_oldest),
+		   "Keypress not enqueued");
+}
+
+static void keypress_dequeue_check(uint16_t id, bool pressed)
+{
+	uint16_t id_out;
+	bool pressed_out;
+
+	zassert_ok(hid_eventq_keypress_dequeue(&q, &id_out, &pressed_out),
+		   "Keypress not dequeued");
+	zassert_equal(id_out, id, "Invalid key ID");
+	zassert_equal(pressed_out, pressed, "Invalid key state");
+}
+
+static const struct hid_eventq_event *queued_event_get(size_t pos)
+{
+	return &q.buf[(q.head + pos) % q.cnt_max];
+}
+
+ZTEST(suite_hid_eventq, test_fifo_wrap)
+{
+	hid_eventq_init(&q, q_buf, QUEUE_SIZE);
+
+	for (uint16_t i = 0; i < 3 * QUEUE_SIZE; i++) {
+		keypress_enqueue(i, true, false);
+		keypress_enqueue(i, false, false);
+		keypress_dequeue_check(i, true);
+		keypress_dequeue_check(i, false);
+	}
+
+	zassert_true(hid_eventq_is_empty(&q), "Queue not empty");
+}
+
+ZTEST(suite_hid_eventq, test_full)
+{
+	uint16_t id;
+	bool pressed;
+
+	hid_eventq_init(&q, q_buf, QUEUE_SIZE);
+
+	zassert_equal(hid_eventq_keypress_dequeue(&q, &id, &pressed), -ENOENT,
+		      "Dequeued from empty queue");
+
+	for (uint16_t i = 0; i < QUEUE_SIZE; i++) {
+		keypress_enqueue(i, true, false);
+	}
+
+	zassert_true(hid_eventq_is_full(&q), "Queue not full");
+	zassert_equal(hid_eventq_keypress_enqueue(&q, 0, false, false), -ENOBUFS,
+		      "Enqueued to full queue");
+
+	/* No key press has the matching key release, nothing can be dropped. */
+	zassert_equal(hid_eventq_keypress_enqueue(&q, 0, false, true), -ENOBUFS,
+		      "Unpaired key press dropped");
+
+	hid_eventq_reset(&q);
+	zassert_true(hid_eventq_is_empty(&q), "Queue not empty after reset");
+}
+
+ZTEST(suite_hid_eventq, test_drop_oldest_pairs)
+{
+	hid_eventq_init(&q, q_buf, QUEUE_SIZE);
+
+	/* Release of a key pressed before, pair of key 1 and key 2 pressed while the queue is
+	 * full.
+	 */
+	keypress_enqueue(9, false, false);
+	keypress_enqueue(1, true, false);
+	keypress_enqueue(1, false, false);
+	keypress_enqueue(2, true, false);
+	for (uint16_t i = 0; i < QUEUE_SIZE - 4; i++) {
+		keypress_enqueue(3, (i % 2) == 0, false);
+	}
+
+	zassert_true(hid_eventq_is_full(&q), "Queue not full");
+	keypress_enqueue(2, false, true);
+
+	/* Key 2 press must stay, as its release is the newest event. */
+	keypress_dequeue_check(2, true);
+	for (uint16_t i = 0; i < QUEUE_SIZE - 4; i++) {
+		keypress_dequeue_check(3, (i % 2) == 0);
+	}
+	keypress_dequeue_check(2, false);
+	zassert_true(hid_eventq_is_empty(&q), "Queue not empty");
+}
+
+ZTEST(suite_hid_eventq, test_cleanup)
+{
+	int64_t min_ts;
+
+	hid_eventq_init(&q, q_buf, QUEUE_SIZE);
+
+	keypress_enqueue(1, true, false);
+	keypress_enqueue(2, true, false);
+	keypress_enqueue(1, false, false);
+	k_sleep(K_MSEC(5));
+	min_ts = k_uptime_get();
+	keypress_enqueue(2, false, false);
+	keypress_enqueue(3, true, false);
+
+	/* Key 2 release is not stale, so key 2 press cannot be removed. */
+	hid_eventq_cleanup(&q, min_ts);
+	keypress_dequeue_check(1, true);
+
+	/* Only the events before the first unpaired key press are removed. */
+	hid_eventq_cleanup(&q, k_uptime_get() + 1);
+	keypress_dequeue_check(3, true);
+	zassert_true(hid_eventq_is_empty(&q), "Queue not empty");
+}
+
+/* Compare the queue with the list based reference implementation for random keypresses. */
+ZTEST(suite_hid_eventq, test_random_vs_reference)
+{
+	hid_eventq_init(&q, q_buf, RANDOM_QUEUE_SIZE);
+	ref_hid_eventq_init(&ref_q, RANDOM_QUEUE_SIZE);
+
+	for (int i = 0; i < RANDOM_ITERATIONS; i++) {
+		uint32_t rnd = sys_rand32_get();
+		uint16_t id = rnd % RANDOM_KEY_CNT;
+		bool pressed = (rnd & BIT(8)) != 0;
+		int err;
+		int ref_err;
+
+		switch ((rnd >> 9) % 8) {
+		case 0:
+		{
+			uint16_t id_out;
+			uint16_t ref_id_out;
+			bool pressed_out;
+			bool ref_pressed_out;
+
+			err = hid_eventq_keypress_dequeue(&q, &id_out, &pressed_out);
+			ref_err = ref_hid_eventq_dequeue(&ref_q, &ref_id_out, &ref_pressed_out);
+			zassert_equal(err, ref_err, "Different dequeue result");
+			break;
+		}
+
+		case 1:
+		{
+			int64_t min_ts = k_uptime_get() - ((rnd >> 12) % 8);
+
+			hid_eventq_cleanup(&q, min_ts);
+			ref_hid_eventq_cleanup(&ref_q, min_ts);
+			break;
+		}
+
+		case 2:
+			k_sleep(K_MSEC(1));
+			break;
+
+		default:
+			err = hid_eventq_keypress_enqueue(&q, id, pressed, true);
+			ref_err = ref_hid_eventq_enqueue(&ref_q,
+							 queued_event_get(q.cnt - 1)->timestamp,
+							 id, pressed, true);
+			zassert_equal(err, ref_err, "Different enqueue result");
+			break;
+		}
+
+		zassert_equal(q.cnt, ref_q.cnt, "Different number of events");
+		for (size_t pos = 0; pos < q.cnt; pos++) {
+			const struct hid_eventq_event *evt = queued_event_get(pos);
+			const struct ref_hid_eventq_event *ref_evt = &ref_q.events[pos];
+
+			zassert_equal(evt->timestamp, ref_evt->timestamp, "Different timestamp");
+			zassert_equal(evt->key_id, ref_evt->key_id, "Different key ID");
+			zassert_equal(evt->pressed, ref_evt->pressed, "Different key state");
+		}
+	}
+}
+
+static void before_test(void *fixture)
+{
+	memset(&q, 0, sizeof(q));
+}
+
+ZTEST_SUITE(suite_hid_eventq, NULL, NULL, before_test, NULL, NULL);
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+
+#include "ref_hid_eventq.h"
+
+void ref_hid_eventq_init(struct ref_hid_eventq *q, size_t max_queued)
+{
+	__ASSERT_NO_MSG(max_queued <= REF_HID_EVENTQ_SIZE_MAX);
+
+	q->cnt = 0;
+	q->cnt_max = max_queued;
+}
+
+static void region_purge(struct ref_hid_eventq *q, size_t purge_cnt)
+{
+	memmove(&q->events[0], &q->events[purge_cnt],
+		(q->cnt - purge_cnt) * sizeof(q->events[0]));
+	q->cnt -= purge_cnt;
+}
+
+/* Find position of the key release matching the key press, looking before the limit. */
+static int release_pos_get(const struct ref_hid_eventq *q, size_t press_pos, size_t limit)
+{
+	const struct ref_hid_eventq_event *press = &q->events[press_pos];
+	size_t hit_count = 1;
+
+	for (size_t i = press_pos + 1; i < limit; i++) {
+		const struct ref_hid_eventq_event *cur = &q->events[i];
+
+		if (cur->key_id == press->key_id) {
+			hit_count += cur->pressed ? (1) : (-1);
+
+			if (hit_count == 0) {
+				return i;
+			}
+		}
+	}
+
+	return -1;
+}
+
+void ref_hid_eventq_cleanup(struct ref_hid_eventq *q, int64_t min_timestamp)
+{
+	size_t first_valid = q->cnt;
+	size_t purge_cnt = 0;
+	int max_pos = -1;
+
+	for (size_t i = 0; i < q->cnt; i++) {
+		if (q->events[i].timestamp >= min_timestamp) {
+			first_valid = i;
+			break;
+		}
+	}
+
+	for (size_t cur = 0; cur < first_valid; cur++) {
+		if (q->events[cur].pressed) {
+			int release_pos = release_pos_get(q, cur, first_valid);
+
+			if (release_pos < 0) {
+				break;
+			}
+
+			max_pos = MAX(max_pos, release_pos);
+		} else {
+			max_pos = MAX(max_pos, (int)cur);
+		}
+
+		if ((int)cur == max_pos) {
+			purge_cnt = cur + 1;
+		}
+	}
+
+	region_purge(q, purge_cnt);
+}
+
+static void drop_oldest(struct ref_hid_eventq *q)
+{
+	for (size_t i = 0; i < q->cnt; i++) {
+		ref_hid_eventq_cleanup(q, q->events[i].timestamp + 1);
+
+		if (q->cnt < q->cnt_max) {
+			break;
+		}
+	}
+}
+
+int ref_hid_eventq_enqueue(struct ref_hid_eventq *q, int64_t timestamp, uint16_t id, bool pressed,
+			   bool drop_oldest_enabled)
+{
+	if ((q->cnt == q->cnt_max) && drop_oldest_enabled) {
+		drop_oldest(q);
+	}
+
+	if (q->cnt == q->cnt_max) {
+		return -ENOBUFS;
+	}
+
+	q->events[q->cnt].timestamp = timestamp;
+	q->events[q->cnt].key_id = id;
+	q->events[q->cnt].pressed = pressed;
+	q->cnt++;
+
+	return 0;
+}
+
+int ref_hid_eventq_dequeue(struct ref_hid_eventq *q, uint16_t *id, bool *pressed)
+{
+	if (q->cnt == 0) {
+		return -ENOENT;
+	}
+
+	*id = q->events[0].key_id;
+	*pressed = q->events[0].pressed;
+	region_purge(q, 1);
+
+	return 0;
+}
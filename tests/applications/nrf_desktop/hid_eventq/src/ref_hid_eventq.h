@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _REF_HID_EVENTQ_H_
+#define _REF_HID_EVENTQ_H_
+
+#include <zephyr/types.h>
+
+/* Reference model of the HID event queue, implementing the list based eviction algorithm used
+ * before the queue was turned into a ring buffer.
+ */
+
+#define REF_HID_EVENTQ_SIZE_MAX 255
+
+struct ref_hid_eventq_event {
+	int64_t timestamp;
+	uint16_t key_id;
+	bool pressed;
+};
+
+struct ref_hid_eventq {
+	struct ref_hid_eventq_event events[REF_HID_EVENTQ_SIZE_MAX];
+	size_t cnt;
+	size_t cnt_max;
+};
+
+void ref_hid_eventq_init(struct ref_hid_eventq *q, size_t max_queued);
+
+int ref_hid_eventq_enqueue(struct ref_hid_eventq *q, int64_t timestamp, uint16_t id, bool pressed,
+			   bool drop_oldest);
+
+int ref_hid_eventq_dequeue(struct ref_hid_eventq *q, uint16_t *id, bool *pressed);
+
+void ref_hid_eventq_cleanup(struct ref_hid_eventq *q, int64_t min_timestamp);
+
+#endif /* _REF_HID_EVENTQ_H_ */
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/random/random.h>
+
+#include "keys_state.h"
+#include "ref_keys_state.h"
+
+#define BENCH_KEY_CNT		KEYS_MAX_CNT
+#define BENCH_KEY_ID_CNT	256
+#define BENCH_ITERATIONS	20
+
+BUILD_ASSERT(BENCH_KEY_CNT <= BENCH_KEY_ID_CNT);
+
+static struct keys_state bench_ks;
+static struct ref_keys_state bench_ref_ks;
+
+/* Key IDs pressed as a chord, in random order. Keys are released in the same order. */
+static uint16_t bench_ids[BENCH_KEY_CNT];
+
+static void bench_ids_fill(void)
+{
+	uint16_t all_ids[BENCH_KEY_ID_CNT];
+
+	for (size_t i = 0; i < ARRAY_SIZE(all_ids); i++) {
+		all_ids[i] = i;
+	}
+
+	/* Partial Fisher-Yates shuffle. */
+	for (size_t i = 0; i < ARRAY_SIZE(bench_ids); i++) {
+		size_t j = i + (sys_rand32_get() % (ARRAY_SIZE(all_ids) - i));
+		uint16_t tmp = all_ids[i];
+
+		all_ids[i] = all_ids[j];
+		all_ids[j] = tmp;
+		bench_ids[i] = all_ids[i];
+	}
+}
+
+/* Every key press and release is followed by getting the active keys, as done to form a HID
+ * report.
+ */
+static size_t bench_chord(void)
+{
+	uint16_t keys[BENCH_KEY_CNT];
+	size_t total = 0;
+	bool ks_changed;
+	int err;
+
+	for (int pressed = 1; pressed >= 0; pressed--) {
+		for (size_t i = 0; i < ARRAY_SIZE(bench_ids); i++) {
+			err = keys_state_key_update(&bench_ks, bench_ids[i], pressed, &ks_changed);
+			__ASSERT_NO_MSG(!err && ks_changed);
+			total += keys_state_keys_get(&bench_ks, keys, ARRAY_SIZE(keys));
+		}
+	}
+
+	return total;
+}
+
+static size_t bench_ref_chord(void)
+{
+	uint16_t keys[BENCH_KEY_CNT];
+	size_t total = 0;
+	bool ks_changed;
+	int err;
+
+	for (int pressed = 1; pressed >= 0; pressed--) {
+		for (size_t i = 0; i < ARRAY_SIZE(bench_ids); i++) {
+			err = ref_keys_state_key_update(&bench_ref_ks, bench_ids[i], pressed,
+							&ks_changed);
+			__ASSERT_NO_MSG(!err && ks_changed);
+			total += ref_keys_state_keys_get(&bench_ref_ks, keys);
+		}
+	}
+
+	return total;
+}
+
+static void bench_print(const char *name, uint64_t cycles)
+{
+	TC_PRINT("%s: %llu ns per key event with %d keys in chord\n", name,
+		 timing_cycles_to_ns(cycles) / (BENCH_ITERATIONS * 2 * BENCH_KEY_CNT),
+		 BENCH_KEY_CNT);
+}
+
+ZTEST(suite_keys_state_benchmark, test_bench_chord)
+{
+	size_t total = 0;
+	size_t ref_total = 0;
+	timing_t start;
+	timing_t end;
+	uint64_t ref_cycles;
+	uint64_t new_cycles;
+
+	memset(&bench_ks, 0, sizeof(bench_ks));
+	keys_state_init(&bench_ks, BENCH_KEY_CNT);
+	ref_keys_state_init(&bench_ref_ks, BENCH_KEY_CNT);
+	bench_ids_fill();
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		ref_total += bench_ref_chord();
+	}
+	end = timing_counter_get();
+	ref_cycles = timing_cycles_get(&start, &end);
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		total += bench_chord();
+	}
+	end = timing_counter_get();
+	new_cycles = timing_cycles_get(&start, &end);
+
+	zassert_equal(total, ref_total, "Different number of reported keys");
+
+	bench_print("sorted array reference", ref_cycles);
+	bench_print(IS_ENABLED(CONFIG_DESKTOP_KEYS_STATE_BACKEND_BITMAP) ?
+		    "keys_state bitmap backend" : "keys_state array backend", new_cycles);
+}
+
+static void *suite_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(suite_keys_state_benchmark, NULL, suite_setup, NULL, NULL, suite_teardown);
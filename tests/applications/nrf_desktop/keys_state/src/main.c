@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/random/random.h>
+
+#include "keys_state.h"
+#include "ref_keys_state.h"
+
+#define KEY_CNT_MAX		4
+#define RANDOM_KEY_CNT_MAX	16
+#define RANDOM_KEY_ID_CNT	64
+#define RANDOM_ITERATIONS	5000
+
+static struct keys_state ks;
+static struct ref_keys_state ref_ks;
+
+static void key_update(uint16_t id, bool pressed, bool changed)
+{
+	bool ks_changed;
+
+	zassert_ok(keys_state_key_update(&ks, id, pressed, &ks_changed), "Key not updated");
+	zassert_equal(ks_changed, changed, "Invalid keys state change");
+}
+
+static void keys_check(const uint16_t *ids, size_t cnt)
+{
+	uint16_t keys[KEYS_MAX_CNT];
+	size_t key_cnt = keys_state_keys_get(&ks, keys, ARRAY_SIZE(keys));
+
+	zassert_equal(key_cnt, cnt, "Invalid number of active keys");
+	zassert_mem_equal(keys, ids, cnt * sizeof(ids[0]), "Invalid active keys");
+}
+
+ZTEST(suite_keys_state, test_press_cnt)
+{
+	bool ks_changed;
+
+	keys_state_init(&ks, KEY_CNT_MAX);
+
+	key_update(5, true, true);
+	key_update(5, true, false);
+	key_update(5, false, false);
+	keys_check((const uint16_t []){5}, 1);
+
+	key_update(5, false, true);
+	keys_check(NULL, 0);
+
+	zassert_equal(keys_state_key_update(&ks, 5, false, &ks_changed), -ENOENT,
+		      "Released inactive key");
+	zassert_false(ks_changed, "Keys state changed");
+}
+
+ZTEST(suite_keys_state, test_limit)
+{
+	bool ks_changed;
+
+	keys_state_init(&ks, KEY_CNT_MAX);
+
+	for (uint16_t i = 0; i < KEY_CNT_MAX; i++) {
+		key_update(i, true, true);
+	}
+
+	zassert_equal(keys_state_key_update(&ks, KEY_CNT_MAX, true, &ks_changed), -ENOBUFS,
+		      "Exceeded active keys limit");
+	zassert_false(ks_changed, "Keys state changed");
+
+	/* Already active key can still be pressed. */
+	key_update(0, true, false);
+}
+
+ZTEST(suite_keys_state, test_sorted)
+{
+	static const uint16_t ids[] = {3, 40, 77, 200};
+
+	keys_state_init(&ks, KEY_CNT_MAX);
+
+	key_update(200, true, true);
+	key_update(3, true, true);
+	key_update(77, true, true);
+	key_update(40, true, true);
+	keys_check(ids, ARRAY_SIZE(ids));
+
+	keys_state_clear(&ks);
+	keys_check(NULL, 0);
+}
+
+ZTEST(suite_keys_state, test_key_id_range)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_DESKTOP_KEYS_STATE_BACKEND_BITMAP);
+
+#ifdef CONFIG_DESKTOP_KEYS_STATE_BACKEND_BITMAP
+	bool ks_changed;
+
+	keys_state_init(&ks, KEY_CNT_MAX);
+
+	key_update(KEYS_STATE_KEY_ID_CNT - 1, true, true);
+	zassert_equal(keys_state_key_update(&ks, KEYS_STATE_KEY_ID_CNT, true, &ks_changed),
+		      -EINVAL, "Key ID out of range accepted");
+	zassert_false(ks_changed, "Keys state changed");
+#endif
+}
+
+/* Compare the keys state with the sorted array reference for random keypresses. */
+ZTEST(suite_keys_state, test_random_vs_reference)
+{
+	keys_state_init(&ks, RANDOM_KEY_CNT_MAX);
+	ref_keys_state_init(&ref_ks, RANDOM_KEY_CNT_MAX);
+
+	for (int i = 0; i < RANDOM_ITERATIONS; i++) {
+		uint32_t rnd = sys_rand32_get();
+		uint16_t id = rnd % RANDOM_KEY_ID_CNT;
+		bool pressed = (rnd & BIT(8)) != 0;
+		bool ks_changed;
+		bool ref_ks_changed;
+		int err;
+		int ref_err;
+
+		err = keys_state_key_update(&ks, id, pressed, &ks_changed);
+		ref_err = ref_keys_state_key_update(&ref_ks, id, pressed, &ref_ks_changed);
+		zassert_equal(err, ref_err, "Different update result");
+		zassert_equal(ks_changed, ref_ks_changed, "Different keys state change");
+
+		uint16_t ref_keys[REF_KEYS_STATE_KEY_CNT_MAX];
+		size_t ref_cnt = ref_keys_state_keys_get(&ref_ks, ref_keys);
+
+		keys_check(ref_keys, ref_cnt);
+	}
+}
+
+static void before_test(void *fixture)
+{
+	memset(&ks, 0, sizeof(ks));
+}
+
+ZTEST_SUITE(suite_keys_state, NULL, NULL, before_test, NULL, NULL);
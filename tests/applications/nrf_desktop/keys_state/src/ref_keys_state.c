@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/__assert.h>
+
+#include "ref_keys_state.h"
+
+void ref_keys_state_init(struct ref_keys_state *ks, size_t key_cnt_max)
+{
+	__ASSERT_NO_MSG(key_cnt_max <= ARRAY_SIZE(ks->keys));
+
+	memset(ks, 0, sizeof(*ks));
+	ks->cnt_max = key_cnt_max;
+}
+
+int ref_keys_state_key_update(struct ref_keys_state *ks, uint16_t key_id, bool pressed,
+			      bool *ks_changed)
+{
+	size_t idx;
+
+	*ks_changed = false;
+
+	/* Active keys are sorted ascending by key ID. */
+	for (idx = 0; idx < ks->cnt; idx++) {
+		if (key_id <= ks->keys[idx].id) {
+			break;
+		}
+	}
+
+	if ((idx == ks->cnt) || (ks->keys[idx].id != key_id)) {
+		if (!pressed) {
+			return -ENOENT;
+		}
+
+		if (ks->cnt == ks->cnt_max) {
+			return -ENOBUFS;
+		}
+
+		memmove(&ks->keys[idx + 1], &ks->keys[idx],
+			(ks->cnt - idx) * sizeof(ks->keys[0]));
+		ks->keys[idx].id = key_id;
+		ks->keys[idx].press_cnt = 0;
+		ks->cnt++;
+		*ks_changed = true;
+	}
+
+	if (pressed) {
+		ks->keys[idx].press_cnt++;
+	} else if (--ks->keys[idx].press_cnt == 0) {
+		ks->cnt--;
+		memmove(&ks->keys[idx], &ks->keys[idx + 1],
+			(ks->cnt - idx) * sizeof(ks->keys[0]));
+		*ks_changed = true;
+	}
+
+	return 0;
+}
+
+size_t ref_keys_state_keys_get(const struct ref_keys_state *ks, uint16_t *res)
+{
+	for (size_t i = 0; i < ks->cnt; i++) {
+		res[i] = ks->keys[i].id;
+	}
+
+	return ks->cnt;
+}
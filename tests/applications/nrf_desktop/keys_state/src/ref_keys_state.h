@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _REF_KEYS_STATE_H_
+#define _REF_KEYS_STATE_H_
+
+#include <zephyr/types.h>
+
+/* Reference model of the keys state, implementing the sorted array of active keys used by the
+ * array backend.
+ */
+
+#define REF_KEYS_STATE_KEY_CNT_MAX 255
+
+struct ref_active_key {
+	uint16_t id;
+	uint16_t press_cnt;
+};
+
+struct ref_keys_state {
+	struct ref_active_key keys[REF_KEYS_STATE_KEY_CNT_MAX];
+	size_t cnt;
+	size_t cnt_max;
+};
+
+void ref_keys_state_init(struct ref_keys_state *ks, size_t key_cnt_max);
+
+int ref_keys_state_key_update(struct ref_keys_state *ks, uint16_t key_id, bool pressed,
+			      bool *ks_changed);
+
+size_t ref_keys_state_keys_get(const struct ref_keys_state *ks, uint16_t *res);
+
+#endif /* _REF_KEYS_STATE_H_ */
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef HOST_CYCLES_BOTTOM_H_
+#define HOST_CYCLES_BOTTOM_H_
+
+/* Host side of the cycle counter. Simulated time does not advance while the code under
+ * test runs on native_sim, so the host time stamp counter is used instead.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Return the host cycle counter, or nanoseconds if the host has no cycle counter. */
+uint64_t host_cycles_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_CYCLES_BOTTOM_H_ */
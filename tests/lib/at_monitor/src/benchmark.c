@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/timing/timing.h>
+#include <modem/at_monitor.h>
+
+#define BENCH_ITERATIONS 1000
+
+/* Not part of the public API, called by the modem library */
+void at_monitor_dispatch(const char *notif);
+
+/* Monitors registered by the libraries in a typical cellular application */
+AT_MONITOR_ISR(bench_mon_00, "+CEREG", bench_handler);
+AT_MONITOR_ISR(bench_mon_01, "+CGEV", bench_handler);
+AT_MONITOR_ISR(bench_mon_02, "+CSCON", bench_handler);
+AT_MONITOR_ISR(bench_mon_03, "+CMT", bench_handler);
+AT_MONITOR_ISR(bench_mon_04, "+CMS", bench_handler);
+AT_MONITOR_ISR(bench_mon_05, "+CDS", bench_handler);
+AT_MONITOR_ISR(bench_mon_06, "+CEDRXP", bench_handler);
+AT_MONITOR_ISR(bench_mon_07, "+CNEC_ESM", bench_handler);
+AT_MONITOR_ISR(bench_mon_08, "+CESQ", bench_handler);
+AT_MONITOR_ISR(bench_mon_09, "+CIND", bench_handler);
+AT_MONITOR_ISR(bench_mon_10, "+CMTI", bench_handler);
+AT_MONITOR_ISR(bench_mon_11, "+CUSD", bench_handler);
+AT_MONITOR_ISR(bench_mon_12, "+CRING", bench_handler);
+AT_MONITOR_ISR(bench_mon_13, "+CLIP", bench_handler);
+AT_MONITOR_ISR(bench_mon_14, "%XMODEMSLEEP", bench_handler);
+AT_MONITOR_ISR(bench_mon_15, "%XT3412", bench_handler);
+AT_MONITOR_ISR(bench_mon_16, "%XTIME", bench_handler);
+AT_MONITOR_ISR(bench_mon_17, "%XVBATLOWLVL", bench_handler);
+AT_MONITOR_ISR(bench_mon_18, "%RAI", bench_handler);
+AT_MONITOR_ISR(bench_mon_19, "%NCELLMEAS", bench_handler);
+AT_MONITOR_ISR(bench_mon_20, "%MDMEV", bench_handler);
+AT_MONITOR_ISR(bench_mon_21, "%LOCATION", bench_handler);
+AT_MONITOR_ISR(bench_mon_22, "%ENVEVAL", bench_handler);
+AT_MONITOR_ISR(bench_mon_23, "%CESQ", bench_handler);
+AT_MONITOR_ISR(bench_mon_24, "%CELLULARPRFL", bench_handler);
+AT_MONITOR_ISR(bench_mon_25, "%XSIM", bench_handler);
+AT_MONITOR_ISR(bench_mon_26, "%XDATAPRFL", bench_handler);
+AT_MONITOR_ISR(bench_mon_27, "%CONEVAL", bench_handler);
+AT_MONITOR_ISR(bench_mon_28, "%XMONITOR", bench_handler);
+AT_MONITOR_ISR(bench_mon_29, "%PERIODICSEARCHCONF", bench_handler);
+AT_MONITOR_ISR(bench_mon_30, "%XCOEX0", bench_handler);
+AT_MONITOR_ISR(bench_mon_31, "%SHORTSWVER", bench_handler);
+
+static const char * const bench_notif[] = {
+	"+CEREG: 5,\"4400\",\"00011B07\",7,,,\"11100000\",\"11100000\"\r\n",
+	"+CSCON: 0\r\n",
+	"%XMODEMSLEEP: 1,36000\r\n",
+	"%NCELLMEAS: 0,\"00112233\",\"98712\",\"0AB9\",4800,7,63,31,456,4800\r\n",
+	"%SHORTSWVER: nrf9160_1.3.2\r\n",
+	/* Not monitored */
+	"%XUNKNOWN: 1\r\n",
+};
+
+static uint32_t bench_calls;
+
+static void bench_handler(const char *notif)
+{
+	bench_calls++;
+}
+
+static bool ref_has_match(const struct at_monitor_entry *mon, const char *notif)
+{
+	return (mon->filter == ANY || strstr(notif, mon->filter));
+}
+
+/* Linear dispatch over all monitors, as done before the dispatch table */
+static void ref_dispatch(const char *notif)
+{
+	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
+		if (!e->flags.paused && e->flags.direct && ref_has_match(e, notif)) {
+			e->handler(notif);
+		}
+	}
+}
+
+struct bench_args {
+	void (*dispatch)(const char *notif);
+	const char *notif;
+	uint64_t cycles;
+};
+
+static void bench_isr(const void *param)
+{
+	struct bench_args *args = (struct bench_args *)param;
+	timing_t start;
+	timing_t end;
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		args->dispatch(args->notif);
+	}
+	end = timing_counter_get();
+
+	args->cycles = timing_cycles_get(&start, &end);
+}
+
+static uint64_t bench_run(void (*dispatch)(const char *notif), const char *notif)
+{
+	struct bench_args args = {
+		.dispatch = dispatch,
+		.notif = notif,
+	};
+
+	irq_offload(bench_isr, &args);
+
+	return args.cycles;
+}
+
+ZTEST(at_monitor_benchmark, test_bench_dispatch_isr)
+{
+	uint64_t ref_cycles;
+	uint64_t new_cycles;
+	uint32_t ref_calls;
+	size_t cmd_len;
+	int count;
+
+	STRUCT_SECTION_COUNT(at_monitor_entry, &count);
+	TC_PRINT("%d monitors registered\n", count);
+
+	for (size_t i = 0; i < ARRAY_SIZE(bench_notif); i++) {
+		bench_calls = 0;
+		ref_cycles = bench_run(ref_dispatch, bench_notif[i]);
+		ref_calls = bench_calls;
+
+		bench_calls = 0;
+		new_cycles = bench_run(at_monitor_dispatch, bench_notif[i]);
+
+		zassert_equal(bench_calls, ref_calls,
+			      "Monitors called differ from linear dispatch");
+
+		cmd_len = strcspn(bench_notif[i], ":");
+		TC_PRINT("%.*s: linear %llu ns, dispatch table %llu ns\n", (int)cmd_len,
+			 bench_notif[i], timing_cycles_to_ns(ref_cycles) / BENCH_ITERATIONS,
+			 timing_cycles_to_ns(new_cycles) / BENCH_ITERATIONS);
+	}
+}
+
+static void *suite_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(at_monitor_benchmark, NULL, suite_setup, NULL, NULL, suite_teardown);
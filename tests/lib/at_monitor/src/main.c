@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+#include <nrf_modem_at.h>
+#include <modem/at_monitor.h>
+
+#define CALLS_MAX 8
+
+/* Not part of the public API, called by the modem library */
+void at_monitor_dispatch(const char *notif);
+
+static K_SEM_DEFINE(notif_sem, 0, CALLS_MAX);
+
+/* Names of the monitors called, in call order */
+static const char *calls[CALLS_MAX];
+static size_t calls_num;
+static bool called_in_isr;
+static const char *held_notif;
+
+/* Monitors are sorted by name in their linker section */
+AT_MONITOR(mon_order_a, "+TESTA", on_order_a);
+AT_MONITOR(mon_order_b, ANY, on_order_b, PAUSED);
+AT_MONITOR(mon_order_c, "+TESTA", on_order_c);
+AT_MONITOR(mon_substring, "TESTB", on_substring);
+AT_MONITOR(mon_suffix, "%TESTC: 1", on_suffix);
+AT_MONITOR(mon_hold, "+TESTD", on_hold);
+AT_MONITOR(mon_short, "+TES", on_short);
+AT_MONITOR_ISR(mon_isr, "+TESTE", on_isr);
+
+static void call_record(const char *name)
+{
+	if (calls_num < CALLS_MAX) {
+		calls[calls_num++] = name;
+	}
+
+	k_sem_give(&notif_sem);
+}
+
+static void on_order_a(const char *notif)
+{
+	call_record("a");
+}
+
+static void on_order_b(const char *notif)
+{
+	call_record("b");
+}
+
+static void on_order_c(const char *notif)
+{
+	call_record("c");
+}
+
+static void on_substring(const char *notif)
+{
+	call_record("substring");
+}
+
+static void on_suffix(const char *notif)
+{
+	call_record("suffix");
+}
+
+static void on_short(const char *notif)
+{
+	call_record("short");
+}
+
+static void on_hold(const char *notif)
+{
+	at_monitor_notif_hold(notif);
+	held_notif = notif;
+	call_record("hold");
+}
+
+static void on_isr(const char *notif)
+{
+	called_in_isr = k_is_in_isr();
+	call_record("isr");
+}
+
+int nrf_modem_at_notif_handler_set(nrf_modem_at_notif_handler_t callback)
+{
+	return 0;
+}
+
+/* Dispatch a notification and wait for the expected number of monitor calls */
+static void dispatch_and_wait(const char *notif, size_t calls_expected)
+{
+	at_monitor_dispatch(notif);
+
+	for (size_t i = 0; i < calls_expected; i++) {
+		zassert_ok(k_sem_take(&notif_sem, K_SECONDS(1)), "Monitor not called");
+	}
+
+	/* Let the workqueue drain to catch unexpected calls */
+	k_sleep(K_MSEC(10));
+	zassert_equal(calls_num, calls_expected, "Unexpected number of monitor calls");
+}
+
+static void dispatch_isr(const void *notif)
+{
+	at_monitor_dispatch(notif);
+}
+
+ZTEST(at_monitor, test_dispatch_prefix)
+{
+	dispatch_and_wait("+TESTA: 1\r\n", 2);
+	zassert_str_equal(calls[0], "a");
+	zassert_str_equal(calls[1], "c");
+}
+
+ZTEST(at_monitor, test_dispatch_prefix_exact)
+{
+	/* A longer command prefix is another command */
+	dispatch_and_wait("+TESTAB: 1\r\n", 0);
+	dispatch_and_wait("%TESTA: 1\r\n", 0);
+}
+
+ZTEST(at_monitor, test_dispatch_prefix_narrowed)
+{
+	/* Filters with a command prefix used to match anywhere in the notification.
+	 * They now only match notifications starting with the same command prefix.
+	 */
+	dispatch_and_wait("+TES: 1\r\n", 1);
+	zassert_str_equal(calls[0], "short");
+
+	calls_num = 0;
+	dispatch_and_wait("+TESTD: 1\r\n", 1);
+	zassert_str_equal(calls[0], "hold");
+	at_monitor_notif_release(held_notif);
+
+	calls_num = 0;
+	dispatch_and_wait("URC +TESTA: 1\r\n", 0);
+	dispatch_and_wait("\r\n+TESTA: 1\r\n", 0);
+}
+
+ZTEST(at_monitor, test_dispatch_order_with_any)
+{
+	at_monitor_resume(&mon_order_b);
+
+	dispatch_and_wait("+TESTA: 1\r\n", 3);
+	zassert_str_equal(calls[0], "a");
+	zassert_str_equal(calls[1], "b");
+	zassert_str_equal(calls[2], "c");
+
+	at_monitor_pause(&mon_order_b);
+}
+
+ZTEST(at_monitor, test_dispatch_substring)
+{
+	dispatch_and_wait("+TESTB: 1\r\n", 1);
+	zassert_str_equal(calls[0], "substring");
+
+	calls_num = 0;
+	dispatch_and_wait("%TESTB: 1\r\n", 1);
+	zassert_str_equal(calls[0], "substring");
+}
+
+ZTEST(at_monitor, test_dispatch_suffix)
+{
+	dispatch_and_wait("%TESTC: 1,2\r\n", 1);
+	zassert_str_equal(calls[0], "suffix");
+
+	calls_num = 0;
+	dispatch_and_wait("%TESTC: 2,2\r\n", 0);
+}
+
+ZTEST(at_monitor, test_dispatch_paused)
+{
+	at_monitor_pause(&mon_order_a);
+
+	dispatch_and_wait("+TESTA: 1\r\n", 1);
+	zassert_str_equal(calls[0], "c");
+
+	at_monitor_resume(&mon_order_a);
+}
+
+ZTEST(at_monitor, test_dispatch_isr)
+{
+	irq_offload(dispatch_isr, "+TESTE: 1\r\n");
+
+	zassert_ok(k_sem_take(&notif_sem, K_NO_WAIT), "ISR monitor not called");
+	zassert_true(called_in_isr);
+	zassert_str_equal(calls[0], "isr");
+}
+
+ZTEST(at_monitor, test_notif_hold)
+{
+	char notif[] = "+TESTD: 1\r\n";
+
+	dispatch_and_wait(notif, 1);
+	zassert_not_null(held_notif);
+
+	/* The held copy survives other notifications and changes to the source */
+	memset(notif, 0, sizeof(notif));
+	calls_num = 0;
+	dispatch_and_wait("+TESTA: 2\r\n", 2);
+	zassert_str_equal(held_notif, "+TESTD: 1\r\n");
+
+	at_monitor_notif_release(held_notif);
+	held_notif = NULL;
+}
+
+static void test_before(void *fixture)
+{
+	calls_num = 0;
+	called_in_isr = false;
+	k_sem_reset(&notif_sem);
+}
+
+ZTEST_SUITE(at_monitor, NULL, NULL, test_before, NULL, NULL);
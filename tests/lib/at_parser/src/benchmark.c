@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+
+#include <modem/at_parser.h>
+
+#define BENCH_ITERATIONS 100
+#define BENCH_TOKENS_MAX 128
+
+/* Responses with many values, parsed on every measurement cycle */
+static const char * const bench_rsp[] = {
+	"%NCELLMEAS: 0,"
+	/* Current cell */
+	"\"00112233\",\"98712\",\"0AB9\",4800,7,63,31,456,4800,"
+	/* Neighbor cells (17) */
+	"333333,100,101,102,0,333333,103,104,105,0,"
+	"333333,106,107,108,0,333333,109,110,111,0,"
+	"444444,112,113,114,0,444444,115,116,117,0,"
+	"444444,118,119,120,0,444444,121,122,123,0,"
+	"555555,124,125,126,0,555555,127,128,129,0,"
+	"555555,130,131,132,0,555555,133,134,135,0,"
+	"666666,136,137,138,0,666666,139,140,141,0,"
+	"666666,142,143,144,0,666666,145,146,147,0,"
+	"777777,148,149,150,0,"
+	"123456789012\r\nOK\r\n",
+	"%XMONITOR: 1,\"Operator\",\"OP\",\"20065\",\"002F\",7,20,\"0012BEEF\","
+	"334,6200,66,44,\"\",\"11100000\",\"11100000\",\"01001001\"\r\nOK\r\n",
+	"+COPS: (2,\"Operator A\",\"OPA\",\"24201\",7),(1,\"Operator B\",\"OPB\",\"24202\",7),"
+	"(1,\"Operator C\",\"OPC\",\"24203\",9),(3,\"Operator D\",\"OPD\",\"24204\",7),"
+	"(1,\"Operator E\",\"OPE\",\"24205\",9),,(0,1,3,4),(0,1,2)\r\nOK\r\n",
+};
+
+static struct at_parser_token bench_tokens[BENCH_TOKENS_MAX];
+
+/* Read one value by type, returns the number of bytes or the integer value to sink */
+static int64_t bench_index_value_get(const struct at_parser_index *index, size_t i)
+{
+	int err;
+	int64_t num = 0;
+	const char *str;
+	size_t len = 0;
+
+	if (index->tokens[i].type == AT_PARSER_TOKEN_TYPE_INT) {
+		err = at_parser_index_num_get(index, i, &num);
+	} else if (index->tokens[i].type == AT_PARSER_TOKEN_TYPE_EMPTY) {
+		return 0;
+	} else {
+		err = at_parser_index_string_ptr_get(index, i, &str, &len);
+		num = len;
+	}
+
+	zassert_ok(err);
+
+	return num;
+}
+
+static int64_t bench_parser_value_get(struct at_parser *parser, enum at_parser_token_type type,
+				      size_t i)
+{
+	int err;
+	int64_t num = 0;
+	const char *str;
+	size_t len = 0;
+
+	if (type == AT_PARSER_TOKEN_TYPE_INT) {
+		err = at_parser_num_get(parser, i, &num);
+	} else if (type == AT_PARSER_TOKEN_TYPE_EMPTY) {
+		return 0;
+	} else {
+		err = at_parser_string_ptr_get(parser, i, &str, &len);
+		num = len;
+	}
+
+	zassert_ok(err);
+
+	return num;
+}
+
+static void bench_print(const char *rsp, const char *name, size_t count, timing_t start,
+			timing_t end)
+{
+	uint64_t ns = timing_cycles_to_ns(timing_cycles_get(&start, &end)) / BENCH_ITERATIONS;
+	size_t cmd_len = strcspn(rsp, ":");
+
+	TC_PRINT("%.*s, %zu values, %s: %llu ns/response\n", (int)cmd_len, rsp, count, name, ns);
+}
+
+ZTEST(at_parser_benchmark, test_bench_at_parser_index)
+{
+	int ret;
+	timing_t start;
+	timing_t end;
+	struct at_parser parser;
+	struct at_parser_index index;
+	int64_t sum_parser;
+	int64_t sum_index;
+
+	for (size_t r = 0; r < ARRAY_SIZE(bench_rsp); r++) {
+		ret = at_parser_init(&parser, bench_rsp[r]);
+		zassert_ok(ret);
+
+		/* Build once outside the measurement to know the value types */
+		ret = at_parser_index_build(&parser, &index, bench_tokens,
+					    ARRAY_SIZE(bench_tokens));
+		zassert_ok(ret);
+
+		/* Sequential read with the AT parser */
+		sum_parser = 0;
+		start = timing_counter_get();
+		for (int n = 0; n < BENCH_ITERATIONS; n++) {
+			ret = at_parser_init(&parser, bench_rsp[r]);
+			for (size_t i = 0; i < index.count; i++) {
+				sum_parser += bench_parser_value_get(&parser, index.tokens[i].type,
+								     i);
+			}
+		}
+		end = timing_counter_get();
+		bench_print(bench_rsp[r], "at_parser in order", index.count, start, end);
+
+		/* Reverse read with the AT parser, rewinds on every value */
+		start = timing_counter_get();
+		for (int n = 0; n < BENCH_ITERATIONS; n++) {
+			ret = at_parser_init(&parser, bench_rsp[r]);
+			for (size_t i = index.count; i > 0; i--) {
+				sum_parser -= bench_parser_value_get(
+					&parser, index.tokens[i - 1].type, i - 1);
+			}
+		}
+		end = timing_counter_get();
+		bench_print(bench_rsp[r], "at_parser reversed", index.count, start, end);
+
+		/* Reverse read with the token index, including building it */
+		sum_index = 0;
+		start = timing_counter_get();
+		for (int n = 0; n < BENCH_ITERATIONS; n++) {
+			ret = at_parser_init(&parser, bench_rsp[r]);
+			ret = at_parser_index_build(&parser, &index, bench_tokens,
+						    ARRAY_SIZE(bench_tokens));
+			for (size_t i = index.count; i > 0; i--) {
+				sum_index += bench_index_value_get(&index, i - 1);
+			}
+		}
+		end = timing_counter_get();
+		bench_print(bench_rsp[r], "at_parser_index reversed", index.count, start, end);
+
+		zassert_ok(ret);
+		zassert_equal(sum_parser, 0, "Reads in order and reversed differ");
+		zassert_true(sum_index != 0);
+	}
+}
+
+static void *suite_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(at_parser_benchmark, NULL, suite_setup, NULL, NULL, suite_teardown);
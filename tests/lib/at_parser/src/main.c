@@ -2190,4 +2190,210 @@ ZTEST(at_parser, test_at_parser_cmd_next)
 	zassert_equal(num, 6);
 }
 
+ZTEST(at_parser, test_at_parser_index_build_einval)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_index index;
+	struct at_parser_token tokens[8];
+
+	const char *str1 = "+NOTIF: 1,2,3\r\nOK\r\n";
+
+	ret = at_parser_init(&parser, str1);
+	zassert_ok(ret);
+
+	ret = at_parser_index_build(NULL, &index, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_index_build(&parser, NULL, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_index_build(&parser, &index, NULL, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_index_build(&parser, &index, tokens, 0);
+	zassert_equal(ret, -EINVAL);
+}
+
+ZTEST(at_parser, test_at_parser_index_build_eperm)
+{
+	int ret;
+	struct at_parser parser = { 0 };
+	struct at_parser_index index;
+	struct at_parser_token tokens[8];
+
+	ret = at_parser_index_build(&parser, &index, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EPERM);
+}
+
+ZTEST(at_parser, test_at_parser_index_build_enomem)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_index index;
+	struct at_parser_token tokens[3];
+
+	const char *str1 = "+NOTIF: 1,2,3\r\nOK\r\n";
+
+	ret = at_parser_init(&parser, str1);
+	zassert_ok(ret);
+
+	ret = at_parser_index_build(&parser, &index, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -ENOMEM);
+}
+
+ZTEST(at_parser, test_at_parser_index_build_ebadmsg)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_index index;
+	struct at_parser_token tokens[8];
+
+	const char *str1 = "+NOTIF: 1,2,3 4\r\nOK\r\n";
+
+	ret = at_parser_init(&parser, str1);
+	zassert_ok(ret);
+
+	ret = at_parser_index_build(&parser, &index, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EBADMSG);
+}
+
+ZTEST(at_parser, test_at_parser_index_get)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_index index;
+	struct at_parser_token tokens[8];
+	enum at_parser_token_type type;
+	char buffer[32] = { 0 };
+	size_t len;
+	const char *ptr;
+	int32_t num = 0;
+	uint16_t unum = 0;
+
+	ret = at_parser_init(&parser, emptyparamline[1]);
+	zassert_ok(ret);
+
+	ret = at_parser_index_build(&parser, &index, tokens, ARRAY_SIZE(tokens));
+	zassert_ok(ret);
+	zassert_equal(index.count, 6);
+
+	/* Read the values in reverse order, twice. */
+	for (int i = 0; i < 2; i++) {
+		len = sizeof(buffer);
+		ret = at_parser_index_string_get(&index, 5, buffer, &len);
+		zassert_ok(ret);
+		zassert_equal(len, strlen("01101100"));
+		zassert_mem_equal("01101100", buffer, len);
+
+		ret = at_parser_index_string_ptr_get(&index, 4, &ptr, &len);
+		zassert_ok(ret);
+		zassert_equal(len, strlen("10101111"));
+		zassert_mem_equal("10101111", ptr, len);
+
+		ret = at_parser_index_num_get(&index, 3, &num);
+		zassert_equal(ret, -ENODATA);
+
+		ret = at_parser_index_type_get(&index, 2, &type);
+		zassert_ok(ret);
+		zassert_equal(type, AT_PARSER_TOKEN_TYPE_EMPTY);
+
+		ret = at_parser_index_num_get(&index, 1, &num);
+		zassert_ok(ret);
+		zassert_equal(num, 1);
+
+		len = sizeof(buffer);
+		ret = at_parser_index_string_get(&index, 0, buffer, &len);
+		zassert_ok(ret);
+		zassert_mem_equal("+CPSMS", buffer, len);
+	}
+
+	ret = at_parser_index_num_get(&index, 0, &num);
+	zassert_equal(ret, -EOPNOTSUPP);
+
+	ret = at_parser_index_string_get(&index, 1, buffer, &len);
+	zassert_equal(ret, -EOPNOTSUPP);
+
+	len = strlen("01101100");
+	ret = at_parser_index_string_get(&index, 5, buffer, &len);
+	zassert_equal(ret, -ENOMEM);
+
+	ret = at_parser_index_num_get(&index, 6, &num);
+	zassert_equal(ret, -EIO);
+
+	ret = at_parser_index_num_get(&index, 1, (uint16_t *)NULL);
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_index_num_get((struct at_parser_index *)NULL, 1, &unum);
+	zassert_equal(ret, -EINVAL);
+}
+
+ZTEST(at_parser, test_at_parser_index_num_erange)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_index index;
+	struct at_parser_token tokens[4];
+	int16_t num16 = 0;
+	uint32_t unum32 = 0;
+	int64_t num64 = 0;
+
+	const char *str1 = "+NOTIF: -1,70000,-9223372036854775807\r\n";
+
+	ret = at_parser_init(&parser, str1);
+	zassert_ok(ret);
+
+	ret = at_parser_index_build(&parser, &index, tokens, ARRAY_SIZE(tokens));
+	zassert_ok(ret);
+
+	ret = at_parser_index_num_get(&index, 1, &unum32);
+	zassert_equal(ret, -ERANGE);
+
+	ret = at_parser_index_num_get(&index, 2, &num16);
+	zassert_equal(ret, -ERANGE);
+
+	ret = at_parser_index_num_get(&index, 2, &unum32);
+	zassert_ok(ret);
+	zassert_equal(unum32, 70000);
+
+	ret = at_parser_index_num_get(&index, 3, &num64);
+	zassert_ok(ret);
+	zassert_equal(num64, -9223372036854775807LL);
+}
+
+ZTEST(at_parser, test_at_parser_index_multiline)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_index index;
+	struct at_parser_token tokens[8];
+	int32_t num = 0;
+
+	ret = at_parser_init(&parser, multiline[1]);
+	zassert_ok(ret);
+
+	for (int32_t line = 0; line < 3; line++) {
+		ret = at_parser_index_build(&parser, &index, tokens, ARRAY_SIZE(tokens));
+		zassert_ok(ret);
+
+		ret = at_parser_index_num_get(&index, 1, &num);
+		zassert_ok(ret);
+		zassert_equal(num, line);
+
+		ret = at_parser_index_num_get(&index, 2, &num);
+		zassert_ok(ret);
+		zassert_equal(num, 2 * line);
+
+		/* The index stays valid when the parser moves on. */
+		ret = at_parser_cmd_next(&parser);
+		zassert_equal(ret, (line < 2) ? 0 : -EOPNOTSUPP);
+
+		ret = at_parser_index_num_get(&index, 1, &num);
+		zassert_ok(ret);
+		zassert_equal(num, line);
+	}
+
+	zassert_equal(index.count, 7);
+}
+
 ZTEST_SUITE(at_parser, NULL, NULL, NULL, NULL, NULL);
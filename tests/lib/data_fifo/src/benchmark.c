@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <data_fifo.h>
+
+/* Number of FIFOs used in parallel, each with its own producer and consumer thread */
+#define BENCH_PAIRS_NUM	       (4)
+#define BENCH_ELEMENTS_NUM     (8)
+#define BENCH_BLOCK_SIZE       (128)
+#define BENCH_ITEMS_NUM	       (5000)
+#define BENCH_STACK_SIZE       (1024)
+#define BENCH_THREAD_PRIORITY  (5)
+
+K_THREAD_STACK_ARRAY_DEFINE(bench_stack, 2 * BENCH_PAIRS_NUM, BENCH_STACK_SIZE);
+static struct k_thread bench_thread[2 * BENCH_PAIRS_NUM];
+
+DATA_FIFO_DEFINE(bench_fifo0, BENCH_ELEMENTS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_DEFINE(bench_fifo1, BENCH_ELEMENTS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_DEFINE(bench_fifo2, BENCH_ELEMENTS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_DEFINE(bench_fifo3, BENCH_ELEMENTS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_SPSC_DEFINE(bench_spsc0, BENCH_ELEMENTS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_SPSC_DEFINE(bench_spsc1, BENCH_ELEMENTS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_SPSC_DEFINE(bench_spsc2, BENCH_ELEMENTS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_SPSC_DEFINE(bench_spsc3, BENCH_ELEMENTS_NUM, BENCH_BLOCK_SIZE);
+
+static struct data_fifo *bench_fifo[BENCH_PAIRS_NUM] = {&bench_fifo0, &bench_fifo1, &bench_fifo2,
+							&bench_fifo3};
+static struct data_fifo_spsc *bench_spsc[BENCH_PAIRS_NUM] = {&bench_spsc0, &bench_spsc1,
+							     &bench_spsc2, &bench_spsc3};
+
+/* Number of items received out of order, summed over all consumers */
+static atomic_t bench_errors;
+
+static void fifo_producer(void *p1, void *p2, void *p3)
+{
+	int ret;
+	uint32_t *data;
+	struct data_fifo *data_fifo = p1;
+
+	for (uint32_t i = 0; i < BENCH_ITEMS_NUM; i++) {
+		ret = data_fifo_pointer_first_vacant_get(data_fifo, (void **)&data, K_FOREVER);
+		__ASSERT_NO_MSG(ret == 0);
+
+		*data = i;
+
+		ret = data_fifo_block_lock(data_fifo, (void **)&data, sizeof(uint32_t));
+		__ASSERT_NO_MSG(ret == 0);
+	}
+}
+
+static void fifo_consumer(void *p1, void *p2, void *p3)
+{
+	int ret;
+	uint32_t *data;
+	size_t size;
+	struct data_fifo *data_fifo = p1;
+
+	for (uint32_t i = 0; i < BENCH_ITEMS_NUM; i++) {
+		ret = data_fifo_pointer_last_filled_get(data_fifo, (void **)&data, &size,
+							K_FOREVER);
+		__ASSERT_NO_MSG(ret == 0);
+
+		if (*data != i) {
+			atomic_inc(&bench_errors);
+		}
+
+		data_fifo_block_free(data_fifo, data);
+	}
+}
+
+static void spsc_producer(void *p1, void *p2, void *p3)
+{
+	int ret;
+	uint32_t *data;
+	struct data_fifo_spsc *data_fifo = p1;
+
+	for (uint32_t i = 0; i < BENCH_ITEMS_NUM; i++) {
+		while (data_fifo_spsc_reserve(data_fifo, (void **)&data)) {
+			/* Full, let the consumer run */
+			k_yield();
+		}
+
+		*data = i;
+
+		ret = data_fifo_spsc_commit(data_fifo, sizeof(uint32_t));
+		__ASSERT_NO_MSG(ret == 0);
+	}
+}
+
+static void spsc_consumer(void *p1, void *p2, void *p3)
+{
+	int ret;
+	uint32_t *data;
+	size_t size;
+	struct data_fifo_spsc *data_fifo = p1;
+
+	for (uint32_t i = 0; i < BENCH_ITEMS_NUM; i++) {
+		ret = data_fifo_spsc_peek(data_fifo, (void **)&data, &size, K_FOREVER);
+		__ASSERT_NO_MSG(ret == 0);
+
+		if (*data != i) {
+			atomic_inc(&bench_errors);
+		}
+
+		data_fifo_spsc_release(data_fifo);
+	}
+}
+
+/* Runs all producer and consumer pairs in parallel and returns the elapsed cycles */
+static uint64_t bench_run(k_thread_entry_t producer, k_thread_entry_t consumer, void **fifos)
+{
+	timing_t start;
+	timing_t end;
+
+	atomic_set(&bench_errors, 0);
+
+	start = timing_counter_get();
+
+	for (int i = 0; i < BENCH_PAIRS_NUM; i++) {
+		k_thread_create(&bench_thread[2 * i], bench_stack[2 * i], BENCH_STACK_SIZE,
+				consumer, fifos[i], NULL, NULL, BENCH_THREAD_PRIORITY, 0,
+				K_NO_WAIT);
+		k_thread_create(&bench_thread[2 * i + 1], bench_stack[2 * i + 1], BENCH_STACK_SIZE,
+				producer, fifos[i], NULL, NULL, BENCH_THREAD_PRIORITY, 0,
+				K_NO_WAIT);
+	}
+
+	for (int i = 0; i < 2 * BENCH_PAIRS_NUM; i++) {
+		k_thread_join(&bench_thread[i], K_FOREVER);
+	}
+
+	end = timing_counter_get();
+
+	zassert_equal(atomic_get(&bench_errors), 0, "Items received out of order");
+
+	return timing_cycles_get(&start, &end);
+}
+
+static void bench_print(const char *name, uint64_t cycles)
+{
+	TC_PRINT("%s: %d FIFOs, %llu ns/item\n", name, BENCH_PAIRS_NUM,
+		 timing_cycles_to_ns(cycles) / (BENCH_PAIRS_NUM * BENCH_ITEMS_NUM));
+}
+
+ZTEST(suite_data_fifo_benchmark, test_bench_parallel_fifos)
+{
+	int ret;
+	uint64_t fifo_cycles;
+	uint64_t spsc_cycles;
+
+	for (int i = 0; i < BENCH_PAIRS_NUM; i++) {
+		ret = data_fifo_init(bench_fifo[i]);
+		zassert_equal(ret, 0, "init did not return 0");
+
+		data_fifo_spsc_init(bench_spsc[i]);
+	}
+
+	fifo_cycles = bench_run(fifo_producer, fifo_consumer, (void **)bench_fifo);
+	spsc_cycles = bench_run(spsc_producer, spsc_consumer, (void **)bench_spsc);
+
+	for (int i = 0; i < BENCH_PAIRS_NUM; i++) {
+		ret = data_fifo_uninit(bench_fifo[i]);
+		zassert_equal(ret, 0, "deinit did not return 0");
+		zassert_equal(data_fifo_spsc_num_used_get(bench_spsc[i]), 0,
+			      "SPSC FIFO not empty");
+	}
+
+	bench_print("data_fifo", fifo_cycles);
+	bench_print("data_fifo_spsc", spsc_cycles);
+}
+
+static void *suite_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(suite_data_fifo_benchmark, NULL, suite_setup, NULL, NULL, suite_teardown);
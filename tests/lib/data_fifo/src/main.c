@@ -231,4 +231,108 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_size_zero)
 	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
 }
 
+ZTEST(suite_data_fifo, test_data_fifo_spsc_put_get_ok)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+	uint8_t *data_ptr;
+	uint8_t *data_ptr_again;
+	void *data_ptr_read;
+	size_t data_size;
+
+	data_fifo_spsc_init(&data_fifo);
+	zassert_equal(data_fifo.initialized, true, "init did not set initialize flag");
+
+	/* Run several times around the ring */
+	for (uint32_t i = 0; i < 3 * data_fifo.elements_max; i++) {
+		ret = data_fifo_spsc_reserve(&data_fifo, (void **)&data_ptr);
+		zassert_equal(ret, 0, "reserve did not return 0");
+
+		ret = data_fifo_spsc_reserve(&data_fifo, (void **)&data_ptr_again);
+		zassert_equal(ret, 0, "reserve did not return 0");
+		zassert_equal_ptr(data_ptr, data_ptr_again, "reserve twice gave different blocks");
+
+		memset(data_ptr, (uint8_t)i, i + 1);
+
+		ret = data_fifo_spsc_commit(&data_fifo, i + 1);
+		zassert_equal(ret, 0, "commit did not return 0");
+		zassert_equal(data_fifo_spsc_num_used_get(&data_fifo), 1, "num used incorrect");
+
+		ret = data_fifo_spsc_peek(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+		zassert_equal(ret, 0, "peek did not return 0");
+		zassert_equal_ptr(data_ptr_read, data_ptr, "peek gave a different block");
+		zassert_equal(data_size, i + 1, "data size incorrect");
+		zassert_equal(((uint8_t *)data_ptr_read)[i], (uint8_t)i,
+			      "data contents are not identical");
+
+		data_fifo_spsc_release(&data_fifo);
+		zassert_equal(data_fifo_spsc_num_used_get(&data_fifo), 0, "num used incorrect");
+	}
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_put_too_many)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 8, 128);
+
+	int ret;
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	data_fifo_spsc_init(&data_fifo);
+
+	for (uint32_t i = 0; i < data_fifo.elements_max; i++) {
+		ret = data_fifo_spsc_reserve(&data_fifo, (void **)&data_ptr);
+		zassert_equal(ret, 0, "reserve did not return 0");
+		data_ptr[0] = i;
+
+		ret = data_fifo_spsc_commit(&data_fifo, 1);
+		zassert_equal(ret, 0, "commit did not return 0");
+	}
+
+	/* Add one too many elements */
+	ret = data_fifo_spsc_reserve(&data_fifo, (void **)&data_ptr);
+	zassert_equal(ret, -ENOMEM, "reserve did not return -ENOMEM");
+
+	ret = data_fifo_spsc_commit(&data_fifo, 1);
+	zassert_equal(ret, -ENOMEM, "commit did not return -ENOMEM");
+
+	/* Blocks come out in order */
+	for (uint32_t i = 0; i < data_fifo.elements_max; i++) {
+		ret = data_fifo_spsc_peek(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+		zassert_equal(ret, 0, "peek did not return 0");
+		zassert_equal(((uint8_t *)data_ptr_read)[0], i, "blocks out of order");
+
+		data_fifo_spsc_release(&data_fifo);
+	}
+
+	ret = data_fifo_spsc_peek(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+	zassert_equal(ret, -EAGAIN, "peek did not return -EAGAIN");
+
+	ret = data_fifo_spsc_peek(&data_fifo, &data_ptr_read, &data_size, K_MSEC(10));
+	zassert_equal(ret, -EAGAIN, "peek did not return -EAGAIN");
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_bad_size)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 2, 128);
+
+	int ret;
+	uint8_t *data_ptr;
+
+	data_fifo_spsc_init(&data_fifo);
+
+	ret = data_fifo_spsc_reserve(&data_fifo, (void **)&data_ptr);
+	zassert_equal(ret, 0, "reserve did not return 0");
+
+	ret = data_fifo_spsc_commit(&data_fifo, 129);
+	zassert_equal(ret, -ENOMEM, "commit did not return -ENOMEM");
+
+	ret = data_fifo_spsc_commit(&data_fifo, 0);
+	zassert_equal(ret, -EINVAL, "commit did not return -EINVAL");
+
+	zassert_equal(data_fifo_spsc_num_used_get(&data_fifo), 0, "num used incorrect");
+}
+
 ZTEST_SUITE(suite_data_fifo, NULL, NULL, NULL, NULL, NULL);
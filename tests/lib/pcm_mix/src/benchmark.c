@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/random/random.h>
+#include <pcm_mix.h>
+
+/* One 10 ms stereo frame at 48 kHz */
+#define BENCH_NUM_FRAMES 480
+#define BENCH_ITERATIONS 200
+
+static int16_t bench_a[BENCH_NUM_FRAMES * 2];
+static int16_t bench_b[BENCH_NUM_FRAMES * 2];
+static int16_t bench_ref[BENCH_NUM_FRAMES * 2];
+static int32_t bench_a_32[BENCH_NUM_FRAMES * 2];
+static int32_t bench_b_32[BENCH_NUM_FRAMES * 2];
+
+/* Per-sample implementation used before the packed-lane mixer, kept as a reference */
+static void ref_hard_limiter(int32_t *const pcm)
+{
+	if (*pcm < INT16_MIN) {
+		*pcm = INT16_MIN;
+	} else if (*pcm > INT16_MAX) {
+		*pcm = INT16_MAX;
+	}
+}
+
+static void ref_mix_identical(void *const pcm_a, void const *const pcm_b, size_t size_b)
+{
+	int32_t res;
+
+	for (uint32_t i = 0; i < size_b / 2; i++) {
+		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
+
+		ref_hard_limiter(&res);
+
+		((int16_t *)pcm_a)[i] = (int16_t)res;
+	}
+}
+
+static void ref_mix_mono_into_stereo_lr(void *const pcm_a, void const *const pcm_b, size_t size_b)
+{
+	int32_t res;
+
+	for (uint32_t i = 0; i < size_b; i++) {
+		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
+
+		ref_hard_limiter(&res);
+
+		((int16_t *)pcm_a)[i] = (int16_t)res;
+	}
+}
+
+static void bench_buffers_fill(void)
+{
+	sys_rand_get(bench_a, sizeof(bench_a));
+	sys_rand_get(bench_b, sizeof(bench_b));
+	memcpy(bench_ref, bench_a, sizeof(bench_a));
+}
+
+static uint64_t bench_cycles_get(timing_t start, timing_t end)
+{
+	return timing_cycles_get(&start, &end);
+}
+
+/* Prints cycles per sample with two decimals */
+static void bench_print(const char *name, uint64_t cycles, uint32_t samples)
+{
+	uint64_t centi = cycles * 100 / ((uint64_t)samples * BENCH_ITERATIONS);
+
+	TC_PRINT("%s: %llu.%02llu cycles/sample\n", name, centi / 100, centi % 100);
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_bench_stereo_into_stereo)
+{
+	int ret;
+	timing_t start;
+	timing_t end;
+	uint64_t ref_cycles;
+	uint64_t new_cycles;
+
+	bench_buffers_fill();
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		ref_mix_identical(bench_ref, bench_b, sizeof(bench_b));
+	}
+	end = timing_counter_get();
+	ref_cycles = bench_cycles_get(start, end);
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		ret = pcm_mix(bench_a, sizeof(bench_a), bench_b, sizeof(bench_b),
+			      B_STEREO_INTO_A_STEREO);
+	}
+	end = timing_counter_get();
+	new_cycles = bench_cycles_get(start, end);
+
+	zassert_equal(ret, 0);
+	zassert_mem_equal(bench_a, bench_ref, sizeof(bench_a), "Mismatch with reference");
+
+	bench_print("stereo into stereo, reference", ref_cycles, ARRAY_SIZE(bench_a));
+	bench_print("stereo into stereo, pcm_mix", new_cycles, ARRAY_SIZE(bench_a));
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_bench_mono_into_stereo_lr)
+{
+	int ret;
+	timing_t start;
+	timing_t end;
+	uint64_t ref_cycles;
+	uint64_t new_cycles;
+
+	bench_buffers_fill();
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		ref_mix_mono_into_stereo_lr(bench_ref, bench_b, sizeof(bench_b) / 2);
+	}
+	end = timing_counter_get();
+	ref_cycles = bench_cycles_get(start, end);
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		ret = pcm_mix(bench_a, sizeof(bench_a), bench_b, sizeof(bench_b) / 2,
+			      B_MONO_INTO_A_STEREO_LR);
+	}
+	end = timing_counter_get();
+	new_cycles = bench_cycles_get(start, end);
+
+	zassert_equal(ret, 0);
+	zassert_mem_equal(bench_a, bench_ref, sizeof(bench_a), "Mismatch with reference");
+
+	bench_print("mono into stereo LR, reference", ref_cycles, ARRAY_SIZE(bench_a));
+	bench_print("mono into stereo LR, pcm_mix", new_cycles, ARRAY_SIZE(bench_a));
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_bench_s32_gain)
+{
+	int ret;
+	timing_t start;
+	timing_t end;
+	uint64_t new_cycles;
+	struct pcm_mix_cfg cfg = {
+		.pcm_bit_depth = 32,
+		.num_ch_a = 2,
+		.num_ch_b = 2,
+		.ch_mask = BIT(0) | BIT(1),
+		.gain_a = PCM_MIX_GAIN_UNITY,
+		.gain_b = PCM_MIX_GAIN_UNITY / 2,
+	};
+
+	sys_rand_get(bench_a_32, sizeof(bench_a_32));
+	sys_rand_get(bench_b_32, sizeof(bench_b_32));
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		ret = pcm_mix_ext(bench_a_32, sizeof(bench_a_32), bench_b_32, sizeof(bench_b_32),
+				  &cfg);
+	}
+	end = timing_counter_get();
+	new_cycles = bench_cycles_get(start, end);
+
+	zassert_equal(ret, 0);
+
+	bench_print("32-bit stereo with gain, pcm_mix_ext", new_cycles, ARRAY_SIZE(bench_a_32));
+}
+
+static void *suite_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(suite_pcm_mix_benchmark, NULL, suite_setup, NULL, NULL, suite_teardown);
@@ -127,4 +127,130 @@ ZTEST(suite_pcm_mix, test_mono_into_stereo_r)
 	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
 }
 
+ZTEST(suite_pcm_mix, test_mix_ext_s16_stereo_gain)
+{
+	int ret;
+	int16_t sample_a[] = { 100, 100, -100, INT16_MAX };
+	int16_t sample_b[] = { 100, 200, -100, INT16_MAX };
+	int16_t sample_r[] = { 150, 200, -150, INT16_MAX };
+	struct pcm_mix_cfg cfg = {
+		.pcm_bit_depth = 16,
+		.num_ch_a = 2,
+		.num_ch_b = 2,
+		.ch_mask = BIT(0) | BIT(1),
+		.gain_a = PCM_MIX_GAIN_UNITY,
+		.gain_b = PCM_MIX_GAIN_UNITY / 2,
+	};
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b), &cfg);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_ext_s16_mono_into_multi_channel)
+{
+	int ret;
+	int16_t sample_a[] = { 1, 2, 3, 4, 5, 6 };
+	int16_t sample_b[] = { 10, INT16_MIN };
+	int16_t sample_r[] = { 11, 2, 13, INT16_MIN, 5, INT16_MIN };
+	struct pcm_mix_cfg cfg = {
+		.pcm_bit_depth = 16,
+		.num_ch_a = 3,
+		.num_ch_b = 1,
+		.ch_mask = BIT(0) | BIT(2),
+		.gain_a = PCM_MIX_GAIN_UNITY,
+		.gain_b = PCM_MIX_GAIN_UNITY,
+	};
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b), &cfg);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_ext_s24)
+{
+	int ret;
+	/* Packed little endian: 0x7FFFFF, 1, -2 */
+	uint8_t sample_a[] = { 0xFF, 0xFF, 0x7F, 0x01, 0x00, 0x00, 0xFE, 0xFF, 0xFF };
+	/* 1, -1, -0x800000 */
+	uint8_t sample_b[] = { 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80 };
+	/* 0x7FFFFF (clipped), 0, -0x800000 (clipped) */
+	uint8_t sample_r[] = { 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80 };
+	struct pcm_mix_cfg cfg = {
+		.pcm_bit_depth = 24,
+		.num_ch_a = 1,
+		.num_ch_b = 1,
+		.ch_mask = BIT(0),
+		.gain_a = PCM_MIX_GAIN_UNITY,
+		.gain_b = PCM_MIX_GAIN_UNITY,
+	};
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b), &cfg);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(sample_a, sample_r, sizeof(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_ext_s32)
+{
+	int ret;
+	int32_t sample_a[] = { INT32_MAX, INT32_MIN, 1000, -1000 };
+	int32_t sample_b[] = { 1, -1, 24, -24 };
+	int32_t sample_r[] = { INT32_MAX, INT32_MIN, 1024, -1024 };
+	struct pcm_mix_cfg cfg = {
+		.pcm_bit_depth = 32,
+		.num_ch_a = 2,
+		.num_ch_b = 2,
+		.ch_mask = BIT(0) | BIT(1),
+		.gain_a = PCM_MIX_GAIN_UNITY,
+		.gain_b = PCM_MIX_GAIN_UNITY,
+	};
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b), &cfg);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(sample_a, sample_r, sizeof(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_ext_illegal_arguments)
+{
+	int ret;
+	int16_t sample_a[] = { 0, 1, 2, 3 };
+	int16_t sample_r[] = { 0, 1, 2, 3 };
+	struct pcm_mix_cfg cfg = {
+		.pcm_bit_depth = 16,
+		.num_ch_a = 2,
+		.num_ch_b = 1,
+		.ch_mask = BIT(0),
+		.gain_a = PCM_MIX_GAIN_UNITY,
+		.gain_b = PCM_MIX_GAIN_UNITY,
+	};
+
+	/* Invalid bit depth */
+	cfg.pcm_bit_depth = 8;
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_a, sizeof(int16_t), &cfg);
+	ZEQ(ret, -EINVAL);
+	cfg.pcm_bit_depth = 16;
+
+	/* Channel mask outside of the channels in A */
+	cfg.ch_mask = BIT(2);
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_a, sizeof(int16_t), &cfg);
+	ZEQ(ret, -EINVAL);
+	cfg.ch_mask = BIT(0);
+
+	/* Channel count mismatch */
+	cfg.num_ch_b = 3;
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_a, sizeof(int16_t) * 3, &cfg);
+	ZEQ(ret, -EINVAL);
+	cfg.num_ch_b = 1;
+
+	/* Buffer A too small for the mono frames in B */
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_a, sizeof(sample_a), &cfg);
+	ZEQ(ret, -EPERM);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
 ZTEST_SUITE(suite_pcm_mix, NULL, NULL, NULL, NULL, NULL);
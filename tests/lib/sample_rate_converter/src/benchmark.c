@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/timing/timing.h>
+#include <sample_rate_converter.h>
+
+#define BENCH_BLOCKS 100
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+static struct sample_rate_converter_ctx bench_ctx;
+static struct sample_rate_converter_poly_ctx bench_poly_ctx;
+
+/* 10 ms of stereo audio at 48 kHz */
+static int16_t bench_input[480 * 2];
+static int16_t bench_output[481 * 2];
+
+static void bench_input_fill(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(bench_input); i++) {
+		bench_input[i] = (int16_t)((i * 7919) & 0x7FFF) - 0x4000;
+	}
+}
+
+static void bench_print(const char *name, uint64_t cycles, uint64_t output_samples)
+{
+	uint64_t ns = timing_cycles_to_ns(cycles);
+
+	TC_PRINT("%s: %llu cycles/output sample, %llu ksamples/s\n", name,
+		 cycles / output_samples, ns ? output_samples * 1000000 / ns : 0);
+}
+
+ZTEST(suite_sample_rate_converter_benchmark, test_bench_48000_to_16000_mono)
+{
+	int ret;
+	timing_t start;
+	timing_t end;
+	size_t output_written;
+	uint64_t total_out = 0;
+
+	bench_input_fill();
+	sample_rate_converter_open(&bench_ctx);
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_BLOCKS; i++) {
+		ret = sample_rate_converter_process(&bench_ctx, SAMPLE_RATE_FILTER_SIMPLE,
+						    bench_input, 480 * sizeof(int16_t), 48000,
+						    bench_output, sizeof(bench_output),
+						    &output_written, 16000);
+		total_out += output_written / sizeof(int16_t);
+	}
+	end = timing_counter_get();
+
+	zassert_equal(ret, 0, "Sample rate conversion process failed");
+	bench_print("FIR decimator 48k->16k mono", timing_cycles_get(&start, &end), total_out);
+
+	ret = sample_rate_converter_poly_init(&bench_poly_ctx, 48000, 16000, 1);
+	zassert_equal(ret, 0, "Polyphase init failed");
+	total_out = 0;
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_BLOCKS; i++) {
+		ret = sample_rate_converter_poly_process(&bench_poly_ctx, bench_input,
+							 480 * sizeof(int16_t), bench_output,
+							 sizeof(bench_output), &output_written);
+		total_out += output_written / sizeof(int16_t);
+	}
+	end = timing_counter_get();
+
+	zassert_equal(ret, 0, "Polyphase process failed");
+	bench_print("Polyphase 48k->16k mono", timing_cycles_get(&start, &end), total_out);
+}
+
+ZTEST(suite_sample_rate_converter_benchmark, test_bench_44100_to_48000_stereo)
+{
+	int ret;
+	timing_t start;
+	timing_t end;
+	size_t output_written;
+	uint64_t total_out = 0;
+
+	bench_input_fill();
+
+	ret = sample_rate_converter_poly_init(&bench_poly_ctx, 44100, 48000, 2);
+	zassert_equal(ret, 0, "Polyphase init failed");
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_BLOCKS; i++) {
+		ret = sample_rate_converter_poly_process(&bench_poly_ctx, bench_input,
+							 441 * 2 * sizeof(int16_t), bench_output,
+							 sizeof(bench_output), &output_written);
+		total_out += output_written / sizeof(int16_t);
+	}
+	end = timing_counter_get();
+
+	zassert_equal(ret, 0, "Polyphase process failed");
+	bench_print("Polyphase 44.1k->48k stereo", timing_cycles_get(&start, &end), total_out);
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
+
+static void *bench_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void bench_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_benchmark, NULL, bench_setup, NULL, NULL, bench_teardown);
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+#include <sample_rate_converter.h>
+
+static struct sample_rate_converter_poly_ctx poly_ctx;
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+/* Feeds 10 ms blocks of a constant stereo signal and verifies block sizes and DC gain */
+static void poly_dc_verify(uint32_t input_sample_rate, uint32_t output_sample_rate)
+{
+	int ret;
+	size_t input_frames = input_sample_rate / 100;
+	size_t expected_frames = output_sample_rate / 100;
+	int16_t input[input_frames * 2];
+	int16_t output[(expected_frames + 1) * 2];
+	size_t output_written;
+	size_t total_frames = 0;
+
+	ret = sample_rate_converter_poly_init(&poly_ctx, input_sample_rate, output_sample_rate, 2);
+	zassert_equal(ret, 0, "Polyphase init failed");
+
+	for (size_t i = 0; i < input_frames; i++) {
+		input[i * 2] = 10000;
+		input[i * 2 + 1] = -5000;
+	}
+
+	for (int block = 0; block < 10; block++) {
+		ret = sample_rate_converter_poly_process(&poly_ctx, input, sizeof(input), output,
+							 sizeof(output), &output_written);
+		zassert_equal(ret, 0, "Polyphase process failed");
+		zassert_within(output_written / (2 * sizeof(int16_t)), expected_frames, 1,
+			       "Unexpected number of output frames (%d)", output_written);
+
+		total_frames += output_written / (2 * sizeof(int16_t));
+
+		if (block == 0) {
+			/* Filter is still settling on the first block */
+			continue;
+		}
+
+		for (size_t i = 0; i < output_written / sizeof(int16_t); i += 2) {
+			zassert_within(output[i], 10000, 8, "Left channel gain wrong (%d)",
+				       output[i]);
+			zassert_within(output[i + 1], -5000, 8, "Right channel gain wrong (%d)",
+				       output[i + 1]);
+		}
+	}
+
+	zassert_within(total_frames, expected_frames * 10, 1,
+		       "Total number of output frames not as expected (%d)", total_frames);
+}
+
+#define TONE_AMPLITUDE (16000)
+
+/* Feeds 10 ms blocks of a mono tone and returns the peak of the output after settling */
+static int poly_tone_peak_get(uint32_t input_sample_rate, uint32_t output_sample_rate,
+			      uint32_t tone_freq)
+{
+	int ret;
+	size_t input_frames = input_sample_rate / 100;
+	int16_t input[input_frames];
+	int16_t output[output_sample_rate / 100 + 1];
+	size_t output_written;
+	uint32_t n = 0;
+	int peak = 0;
+
+	ret = sample_rate_converter_poly_init(&poly_ctx, input_sample_rate, output_sample_rate, 1);
+	zassert_equal(ret, 0, "Polyphase init failed");
+
+	for (int block = 0; block < 10; block++) {
+		for (size_t i = 0; i < input_frames; i++, n++) {
+			input[i] = (int16_t)(TONE_AMPLITUDE *
+					     sinf(2.0f * 3.14159265f * tone_freq * n /
+						  input_sample_rate));
+		}
+
+		ret = sample_rate_converter_poly_process(&poly_ctx, input, sizeof(input), output,
+							 sizeof(output), &output_written);
+		zassert_equal(ret, 0, "Polyphase process failed");
+
+		if (block == 0) {
+			/* Filter is still settling on the first block */
+			continue;
+		}
+
+		for (size_t i = 0; i < output_written / sizeof(int16_t); i++) {
+			peak = MAX(peak, abs(output[i]));
+		}
+	}
+
+	return peak;
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_alias_rejection)
+{
+	int peak;
+
+	/* Tones above the output Nyquist frequency would alias to 4 kHz and 12 kHz */
+	peak = poly_tone_peak_get(48000, 16000, 12000);
+	zassert_true(peak < TONE_AMPLITUDE / 10, "12 kHz tone not attenuated (%d)", peak);
+
+	peak = poly_tone_peak_get(48000, 32000, 20000);
+	zassert_true(peak < TONE_AMPLITUDE / 10, "20 kHz tone not attenuated (%d)", peak);
+
+	/* A tone in the passband keeps its amplitude */
+	peak = poly_tone_peak_get(48000, 16000, 1000);
+	zassert_within(peak, TONE_AMPLITUDE, TONE_AMPLITUDE / 10, "1 kHz tone attenuated (%d)",
+		       peak);
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_44100_to_48000)
+{
+	poly_dc_verify(44100, 48000);
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_48000_to_44100)
+{
+	poly_dc_verify(48000, 44100);
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_32000_to_48000)
+{
+	poly_dc_verify(32000, 48000);
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_48000_to_32000)
+{
+	poly_dc_verify(48000, 32000);
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_48000_to_16000)
+{
+	poly_dc_verify(48000, 16000);
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_odd_block_sizes)
+{
+	int ret;
+	int16_t input[7] = {0};
+	int16_t output[16];
+	size_t output_written;
+	size_t total_in = 0;
+	size_t total_out = 0;
+
+	ret = sample_rate_converter_poly_init(&poly_ctx, 44100, 48000, 1);
+	zassert_equal(ret, 0, "Polyphase init failed");
+
+	for (size_t len = 1; len <= ARRAY_SIZE(input); len++) {
+		size_t expected = sample_rate_converter_poly_output_size_get(
+			&poly_ctx, len * sizeof(int16_t));
+
+		ret = sample_rate_converter_poly_process(&poly_ctx, input, len * sizeof(int16_t),
+							 output, sizeof(output), &output_written);
+		zassert_equal(ret, 0, "Polyphase process failed");
+		zassert_equal(output_written, expected, "Output size not as reported");
+
+		total_in += len;
+		total_out += output_written / sizeof(int16_t);
+	}
+
+	/* 160/147 output samples per input sample, rounded up */
+	zassert_equal(total_out, DIV_ROUND_UP(total_in * 160, 147),
+		      "Total number of output samples not as expected (%d)", total_out);
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_invalid_init)
+{
+	int ret;
+
+	ret = sample_rate_converter_poly_init(NULL, 44100, 48000, 1);
+	zassert_equal(ret, -EINVAL, "Init did not fail with NULL context");
+
+	ret = sample_rate_converter_poly_init(&poly_ctx, 48000, 48000, 1);
+	zassert_equal(ret, -EINVAL, "Init did not fail with equal sample rates");
+
+	ret = sample_rate_converter_poly_init(&poly_ctx, 44100, 48000, 0);
+	zassert_equal(ret, -EINVAL, "Init did not fail with zero channels");
+
+	ret = sample_rate_converter_poly_init(&poly_ctx, 44100, 48000,
+					      CONFIG_SAMPLE_RATE_CONVERTER_POLY_CHANNELS_MAX + 1);
+	zassert_equal(ret, -EINVAL, "Init did not fail with too many channels");
+
+	/* Reduced ratio 48000/44099 needs more phases than supported */
+	ret = sample_rate_converter_poly_init(&poly_ctx, 44099, 48000, 1);
+	zassert_equal(ret, -EINVAL, "Init did not fail with unsupported ratio");
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_output_size_uninitialized)
+{
+	size_t size;
+
+	size = sample_rate_converter_poly_output_size_get(&poly_ctx, 441 * sizeof(int16_t));
+	zassert_equal(size, 0, "Output size of uninitialized context not zero (%zu)", size);
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_invalid_process_output_too_small)
+{
+	int ret;
+	uint8_t input[441 * 4] = {0};
+	uint8_t output[480 * 4];
+	size_t output_written;
+
+	ret = sample_rate_converter_poly_init(&poly_ctx, 44100, 48000, 1);
+	zassert_equal(ret, 0, "Polyphase init failed");
+
+	ret = sample_rate_converter_poly_process(&poly_ctx, input, sizeof(input), output,
+						 sizeof(output) / 2, &output_written);
+	zassert_equal(ret, -EINVAL, "Process did not fail with too small output buffer");
+}
+
+static void poly_test_setup(void *f)
+{
+	memset(&poly_ctx, 0, sizeof(poly_ctx));
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_poly, NULL, NULL, poly_test_setup, NULL, NULL);
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <app_event_manager.h>
+
+#include "bench_events.h"
+
+#define MODULE bench
+
+/* Backlog of slow events waiting in the system workqueue before each measured event */
+#define BENCH_LOAD_EVENTS	(4)
+#define BENCH_LOAD_US		(500)
+#define BENCH_ITERATIONS	(20)
+#define BENCH_MOTION_EVENTS	(10)
+
+static K_SEM_DEFINE(bench_load_sem, 0, BENCH_LOAD_EVENTS);
+static K_SEM_DEFINE(bench_latency_sem, 0, 1);
+static K_SEM_DEFINE(bench_motion_sem, 0, BENCH_MOTION_EVENTS);
+
+static uint64_t bench_latency_cycles;
+static atomic_t bench_motion_cnt;
+static int32_t bench_motion_dx;
+static int32_t bench_motion_dy;
+
+static void bench_latency_store(timing_t submit_time)
+{
+	timing_t delivery_time = timing_counter_get();
+
+	bench_latency_cycles = timing_cycles_get(&submit_time, &delivery_time);
+	k_sem_give(&bench_latency_sem);
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_bench_load_event(aeh)) {
+		k_busy_wait(BENCH_LOAD_US);
+		k_sem_give(&bench_load_sem);
+		return false;
+	}
+
+	if (is_bench_class0_event(aeh)) {
+		bench_latency_store(cast_bench_class0_event(aeh)->submit_time);
+		return false;
+	}
+
+	if (is_bench_class1_event(aeh)) {
+		bench_latency_store(cast_bench_class1_event(aeh)->submit_time);
+		return false;
+	}
+
+	if (is_bench_class2_event(aeh)) {
+		bench_latency_store(cast_bench_class2_event(aeh)->submit_time);
+		return false;
+	}
+
+	if (is_bench_motion_event(aeh)) {
+		const struct bench_motion_event *event = cast_bench_motion_event(aeh);
+
+		bench_motion_dx += event->dx;
+		bench_motion_dy += event->dy;
+		atomic_inc(&bench_motion_cnt);
+		k_sem_give(&bench_motion_sem);
+		return false;
+	}
+
+	/* Event not handled but subscribed. */
+	__ASSERT_NO_MSG(false);
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, bench_load_event);
+APP_EVENT_SUBSCRIBE(MODULE, bench_class0_event);
+APP_EVENT_SUBSCRIBE(MODULE, bench_class1_event);
+APP_EVENT_SUBSCRIBE(MODULE, bench_class2_event);
+APP_EVENT_SUBSCRIBE(MODULE, bench_motion_event);
+
+static void bench_load_submit(void)
+{
+	for (int i = 0; i < BENCH_LOAD_EVENTS; i++) {
+		struct bench_load_event *event = new_bench_load_event();
+
+		APP_EVENT_SUBMIT(event);
+	}
+}
+
+static void bench_load_wait(void)
+{
+	for (int i = 0; i < BENCH_LOAD_EVENTS; i++) {
+		int err = k_sem_take(&bench_load_sem, K_SECONDS(1));
+
+		zassert_equal(err, 0, "Load event not processed");
+	}
+}
+
+#define BENCH_LATENCY_SUBMIT(ename)				\
+	do {							\
+		struct ename *event = _CONCAT(new_, ename)();	\
+								\
+		event->submit_time = timing_counter_get();	\
+		APP_EVENT_SUBMIT(event);			\
+	} while (0)
+
+/* Measures the latency of an event submitted behind a backlog of class 0 events and returns
+ * the average latency in nanoseconds.
+ */
+static uint64_t bench_class_run(uint8_t prio_class)
+{
+	uint64_t total_ns = 0;
+	uint64_t max_ns = 0;
+
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		uint64_t ns;
+		int err;
+
+		/* Queue the backlog and the measured event before any of them is processed. */
+		k_sched_lock();
+		bench_load_submit();
+
+		switch (prio_class) {
+		case 0:
+			BENCH_LATENCY_SUBMIT(bench_class0_event);
+			break;
+		case 1:
+			BENCH_LATENCY_SUBMIT(bench_class1_event);
+			break;
+		default:
+			BENCH_LATENCY_SUBMIT(bench_class2_event);
+			break;
+		}
+		k_sched_unlock();
+
+		err = k_sem_take(&bench_latency_sem, K_SECONDS(1));
+		zassert_equal(err, 0, "Latency event not delivered");
+
+		ns = timing_cycles_to_ns(bench_latency_cycles);
+		total_ns += ns;
+		max_ns = MAX(max_ns, ns);
+
+		bench_load_wait();
+	}
+
+	TC_PRINT("class %u: avg %llu ns, max %llu ns (backlog of %d x %d us in class 0)\n",
+		 prio_class, total_ns / BENCH_ITERATIONS, max_ns, BENCH_LOAD_EVENTS,
+		 BENCH_LOAD_US);
+
+	return total_ns / BENCH_ITERATIONS;
+}
+
+ZTEST(suite_app_event_manager_benchmark, test_bench_prio_class_latency)
+{
+	uint64_t avg_ns[3];
+
+	if (CONFIG_APP_EVENT_MANAGER_PRIO_CLASS_COUNT < ARRAY_SIZE(avg_ns)) {
+		ztest_test_skip();
+		return;
+	}
+
+	for (uint8_t i = 0; i < ARRAY_SIZE(avg_ns); i++) {
+		avg_ns[i] = bench_class_run(i);
+	}
+
+	zassert_true(avg_ns[1] < avg_ns[0], "Class 1 events wait behind class 0 backlog");
+	zassert_true(avg_ns[2] < avg_ns[0], "Class 2 events wait behind class 0 backlog");
+}
+
+ZTEST(suite_app_event_manager_benchmark, test_coalesce)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE)) {
+		ztest_test_skip();
+		return;
+	}
+
+	atomic_set(&bench_motion_cnt, 0);
+	bench_motion_dx = 0;
+	bench_motion_dy = 0;
+
+	/* Submit all events before the priority class thread can process any of them. */
+	k_sched_lock();
+	for (int i = 0; i < BENCH_MOTION_EVENTS; i++) {
+		struct bench_motion_event *event = new_bench_motion_event();
+
+		event->dx = 1;
+		event->dy = -2;
+		APP_EVENT_SUBMIT(event);
+	}
+	k_sched_unlock();
+
+	int err = k_sem_take(&bench_motion_sem, K_SECONDS(1));
+
+	zassert_equal(err, 0, "Motion event not delivered");
+
+	/* Make sure no further events are delivered. */
+	k_sleep(K_MSEC(10));
+
+	zassert_equal(atomic_get(&bench_motion_cnt), 1, "Pending events were not coalesced");
+	zassert_equal(bench_motion_dx, BENCH_MOTION_EVENTS, "Invalid coalesced dx");
+	zassert_equal(bench_motion_dy, -2 * BENCH_MOTION_EVENTS, "Invalid coalesced dy");
+}
+
+ZTEST(suite_app_event_manager_benchmark, test_listener_disable)
+{
+	const struct event_listener *el = APP_EVENT_LISTENER_ID(MODULE);
+	int err;
+
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_CONTROL)) {
+		ztest_test_skip();
+		return;
+	}
+
+	app_event_manager_listener_enable(el, false);
+	zassert_false(app_event_manager_listener_is_enabled(el), "Listener not disabled");
+
+	BENCH_LATENCY_SUBMIT(bench_class1_event);
+	err = k_sem_take(&bench_latency_sem, K_MSEC(100));
+	zassert_equal(err, -EAGAIN, "Event delivered to disabled listener");
+
+	app_event_manager_listener_enable(el, true);
+	zassert_true(app_event_manager_listener_is_enabled(el), "Listener not enabled");
+
+	BENCH_LATENCY_SUBMIT(bench_class1_event);
+	err = k_sem_take(&bench_latency_sem, K_SECONDS(1));
+	zassert_equal(err, 0, "Event not delivered to enabled listener");
+}
+
+ZTEST(suite_app_event_manager_benchmark, test_listener_stats)
+{
+	const struct event_listener *el = APP_EVENT_LISTENER_ID(MODULE);
+	struct app_event_listener_stats stats;
+
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)) {
+		ztest_test_skip();
+		return;
+	}
+
+	app_event_manager_listener_stats_reset();
+
+	bench_load_submit();
+	bench_load_wait();
+
+	app_event_manager_listener_stats_get(el, &stats);
+
+	zassert_equal(stats.call_cnt, BENCH_LOAD_EVENTS, "Invalid number of calls");
+	zassert_true(k_cyc_to_us_ceil32(stats.max_cycles) >= BENCH_LOAD_US,
+		     "Handler time not measured");
+	zassert_true(stats.total_cycles >= (uint64_t)stats.max_cycles * BENCH_LOAD_EVENTS / 2,
+		     "Invalid total handler time");
+
+	TC_PRINT("listener %s: %u calls, avg %llu us, max %u us\n", el->name, stats.call_cnt,
+		 k_cyc_to_us_floor64(stats.total_cycles / stats.call_cnt),
+		 k_cyc_to_us_floor32(stats.max_cycles));
+}
+
+static void *suite_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(suite_app_event_manager_benchmark, NULL, suite_setup, NULL, NULL, suite_teardown);
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "bench_events.h"
+
+
+static bool bench_motion_event_coalesce(struct app_event_header *pending,
+					const struct app_event_header *aeh)
+{
+	struct bench_motion_event *event = cast_bench_motion_event(pending);
+	const struct bench_motion_event *new_event = cast_bench_motion_event(aeh);
+
+	event->dx = CLAMP(event->dx + new_event->dx, INT16_MIN, INT16_MAX);
+	event->dy = CLAMP(event->dy + new_event->dy, INT16_MIN, INT16_MAX);
+
+	return true;
+}
+
+APP_EVENT_TYPE_DEFINE(bench_load_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
+
+APP_EVENT_TYPE_DEFINE(bench_class0_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
+
+APP_EVENT_TYPE_DEFINE(bench_class1_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE(),
+		  APP_EVENT_PRIO_CLASS(1));
+
+APP_EVENT_TYPE_DEFINE(bench_class2_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE(),
+		  APP_EVENT_PRIO_CLASS(2));
+
+APP_EVENT_TYPE_DEFINE(bench_motion_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE(),
+		  APP_EVENT_PRIO_CLASS(2),
+		  APP_EVENT_COALESCE(bench_motion_event_coalesce));
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _BENCH_EVENTS_H_
+#define _BENCH_EVENTS_H_
+
+/**
+ * @brief Priority Class Benchmark Events
+ * @defgroup bench_events Priority Class Benchmark Events
+ * @{
+ */
+
+#include <zephyr/timing/timing.h>
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Event keeping the system workqueue busy. */
+struct bench_load_event {
+	struct app_event_header header;
+};
+
+APP_EVENT_TYPE_DECLARE(bench_load_event);
+
+/* Events used to measure the submit to delivery latency of a given priority class. */
+#define BENCH_LATENCY_EVENT_DECLARE(ename)		\
+	struct ename {					\
+		struct app_event_header header;		\
+							\
+		timing_t submit_time;			\
+	};						\
+							\
+	APP_EVENT_TYPE_DECLARE(ename)
+
+BENCH_LATENCY_EVENT_DECLARE(bench_class0_event);
+BENCH_LATENCY_EVENT_DECLARE(bench_class1_event);
+BENCH_LATENCY_EVENT_DECLARE(bench_class2_event);
+
+/* Coalescing event accumulating relative motion. */
+struct bench_motion_event {
+	struct app_event_header header;
+
+	int16_t dx;
+	int16_t dy;
+};
+
+APP_EVENT_TYPE_DECLARE(bench_motion_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _BENCH_EVENTS_H_ */
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <errno.h>
+
+#include "audio_module.h"
+#include "audio_module_template.h"
+
+/* Graph under test, three stages with a two-way fan-out after the first stage:
+ *
+ *           +-> B0 -> C0 -> TX FIFO
+ *   TX -> A |
+ *           +-> B1 -> C1 -> TX FIFO
+ */
+#define FANOUT_MODULES_NUM	     (5)
+#define FANOUT_BRANCHES_NUM	     (2)
+#define FANOUT_MSG_QUEUE_SIZE	     (4)
+#define FANOUT_MOD_THREAD_STACK_SIZE (2048)
+#define FANOUT_MOD_THREAD_PRIORITY   (4)
+#define FANOUT_MOD_DATA_SIZE	     (40)
+#define FANOUT_MSG_SIZE		     (sizeof(struct audio_module_message))
+#define FANOUT_FRAMES_NUM	     (200)
+#define FANOUT_RX_TIMEOUT	     (K_MSEC(100))
+
+/* Number of frames in flight through the graph at the same time. Each module holds at most
+ * this many data blocks, so it must not exceed the number of blocks in a data slab.
+ */
+#define FANOUT_PIPELINE_DEPTH (3)
+
+#define MOD_A  (0)
+#define MOD_B0 (1)
+#define MOD_B1 (2)
+#define MOD_C0 (3)
+#define MOD_C1 (4)
+
+K_THREAD_STACK_ARRAY_DEFINE(fanout_stack, FANOUT_MODULES_NUM, FANOUT_MOD_THREAD_STACK_SIZE);
+DATA_FIFO_DEFINE(fanout_fifo_rx0, FANOUT_MSG_QUEUE_SIZE, FANOUT_MSG_SIZE);
+DATA_FIFO_DEFINE(fanout_fifo_rx1, FANOUT_MSG_QUEUE_SIZE, FANOUT_MSG_SIZE);
+DATA_FIFO_DEFINE(fanout_fifo_rx2, FANOUT_MSG_QUEUE_SIZE, FANOUT_MSG_SIZE);
+DATA_FIFO_DEFINE(fanout_fifo_rx3, FANOUT_MSG_QUEUE_SIZE, FANOUT_MSG_SIZE);
+DATA_FIFO_DEFINE(fanout_fifo_rx4, FANOUT_MSG_QUEUE_SIZE, FANOUT_MSG_SIZE);
+DATA_FIFO_DEFINE(fanout_fifo_tx3, FANOUT_MSG_QUEUE_SIZE, FANOUT_MSG_SIZE);
+DATA_FIFO_DEFINE(fanout_fifo_tx4, FANOUT_MSG_QUEUE_SIZE, FANOUT_MSG_SIZE);
+K_MEM_SLAB_DEFINE(fanout_slab0, FANOUT_MOD_DATA_SIZE, FANOUT_MSG_QUEUE_SIZE, 4);
+K_MEM_SLAB_DEFINE(fanout_slab1, FANOUT_MOD_DATA_SIZE, FANOUT_MSG_QUEUE_SIZE, 4);
+K_MEM_SLAB_DEFINE(fanout_slab2, FANOUT_MOD_DATA_SIZE, FANOUT_MSG_QUEUE_SIZE, 4);
+K_MEM_SLAB_DEFINE(fanout_slab3, FANOUT_MOD_DATA_SIZE, FANOUT_MSG_QUEUE_SIZE, 4);
+K_MEM_SLAB_DEFINE(fanout_slab4, FANOUT_MOD_DATA_SIZE, FANOUT_MSG_QUEUE_SIZE, 4);
+
+static struct data_fifo *fanout_fifo_rx[FANOUT_MODULES_NUM] = {
+	&fanout_fifo_rx0, &fanout_fifo_rx1, &fanout_fifo_rx2, &fanout_fifo_rx3, &fanout_fifo_rx4};
+static struct data_fifo *fanout_fifo_tx[FANOUT_MODULES_NUM] = {NULL, NULL, NULL, &fanout_fifo_tx3,
+							       &fanout_fifo_tx4};
+static struct k_mem_slab *fanout_slab[FANOUT_MODULES_NUM] = {
+	&fanout_slab0, &fanout_slab1, &fanout_slab2, &fanout_slab3, &fanout_slab4};
+
+static struct audio_module_handle handle[FANOUT_MODULES_NUM];
+static struct audio_module_template_context context[FANOUT_MODULES_NUM];
+
+/* Frames sent into the graph, they must stay valid until module A has consumed them */
+static uint8_t frames_in[FANOUT_PIPELINE_DEPTH][FANOUT_MOD_DATA_SIZE];
+
+static struct audio_metadata fanout_metadata = {.data_coding = PCM,
+						.data_len_us = 10000,
+						.sample_rate_hz = 48000,
+						.bits_per_sample = 16,
+						.carried_bits_per_sample = 16,
+						.locations = 0x00000003,
+						.ref_ts_us = 0,
+						.data_rx_ts_us = 0,
+						.bad_data = false};
+
+/* Each frame carries its sequence number and the time it entered the graph */
+struct frame_header {
+	uint32_t seq;
+	timing_t sent;
+};
+
+static void fanout_graph_build(void)
+{
+	int ret;
+	char inst_name[CONFIG_AUDIO_MODULE_NAME_SIZE];
+	struct audio_module_parameters mod_parameters;
+	struct audio_module_template_configuration configuration = {
+		.sample_rate_hz = 48000, .bit_depth = 16, .module_description = "Fan-out"};
+
+	for (int i = 0; i < FANOUT_MODULES_NUM; i++) {
+		memset(&handle[i], 0, sizeof(struct audio_module_handle));
+		snprintf(inst_name, sizeof(inst_name), "Fan-out %d", i);
+
+		mod_parameters.description = audio_module_template_description;
+		mod_parameters.thread.stack = fanout_stack[i];
+		mod_parameters.thread.stack_size = FANOUT_MOD_THREAD_STACK_SIZE;
+		mod_parameters.thread.priority = FANOUT_MOD_THREAD_PRIORITY;
+		mod_parameters.thread.data_slab = fanout_slab[i];
+		mod_parameters.thread.data_size = FANOUT_MOD_DATA_SIZE;
+		mod_parameters.thread.msg_rx = fanout_fifo_rx[i];
+		mod_parameters.thread.msg_tx = fanout_fifo_tx[i];
+
+		ret = audio_module_open(
+			&mod_parameters,
+			(const struct audio_module_configuration *const)&configuration,
+			&inst_name[0], (struct audio_module_context *)&context[i], &handle[i]);
+		zassert_equal(ret, 0, "Open function did not return successfully (0): ret %d", ret);
+	}
+
+	ret = audio_module_connect(&handle[MOD_A], &handle[MOD_B0], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+	ret = audio_module_connect(&handle[MOD_A], &handle[MOD_B1], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+	ret = audio_module_connect(&handle[MOD_B0], &handle[MOD_C0], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+	ret = audio_module_connect(&handle[MOD_B1], &handle[MOD_C1], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+	ret = audio_module_connect(&handle[MOD_C0], NULL, true);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+	ret = audio_module_connect(&handle[MOD_C1], NULL, true);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+
+	for (int i = 0; i < FANOUT_MODULES_NUM; i++) {
+		ret = audio_module_start(&handle[i]);
+		zassert_equal(ret, 0, "Start function did not return successfully (0): ret %d",
+			      ret);
+	}
+}
+
+static void fanout_graph_teardown(void)
+{
+	int ret;
+
+	for (int i = 0; i < FANOUT_MODULES_NUM; i++) {
+		ret = audio_module_stop(&handle[i]);
+		zassert_equal(ret, 0, "Stop function did not return successfully (0): ret %d", ret);
+
+		ret = audio_module_close(&handle[i]);
+		zassert_equal(ret, 0, "Close function did not return successfully (0): ret %d",
+			      ret);
+	}
+}
+
+static void frame_send(uint32_t seq)
+{
+	int ret;
+	struct audio_data audio_data_tx;
+	struct frame_header header = {.seq = seq, .sent = timing_counter_get()};
+	uint8_t *frame = frames_in[seq % FANOUT_PIPELINE_DEPTH];
+
+	memset(frame, (uint8_t)seq, FANOUT_MOD_DATA_SIZE);
+	memcpy(frame, &header, sizeof(header));
+
+	audio_data_tx.data = frame;
+	audio_data_tx.data_size = FANOUT_MOD_DATA_SIZE;
+	memcpy(&audio_data_tx.meta, &fanout_metadata, sizeof(struct audio_metadata));
+
+	ret = audio_module_data_tx(&handle[MOD_A], &audio_data_tx, NULL);
+	zassert_equal(ret, 0, "Data TX function did not return successfully (0): ret %d", ret);
+}
+
+/* Receive a frame from one branch, check it and return its latency through the graph in cycles */
+static uint64_t frame_receive(struct audio_module_handle *hdl, uint32_t seq)
+{
+	int ret;
+	timing_t now;
+	struct frame_header header;
+	struct audio_data audio_data_rx;
+	uint8_t frame_out[FANOUT_MOD_DATA_SIZE];
+
+	audio_data_rx.data = frame_out;
+	audio_data_rx.data_size = FANOUT_MOD_DATA_SIZE;
+
+	ret = audio_module_data_rx(hdl, &audio_data_rx, FANOUT_RX_TIMEOUT);
+	zassert_equal(ret, 0, "Data RX function did not return successfully (0): ret %d", ret);
+
+	now = timing_counter_get();
+
+	memcpy(&header, frame_out, sizeof(header));
+	zassert_equal(header.seq, seq, "Frame %d received out of order on %s, expected %d",
+		      header.seq, hdl->name, seq);
+	zassert_equal(frame_out[FANOUT_MOD_DATA_SIZE - 1], (uint8_t)seq,
+		      "Frame %d corrupted on %s", seq, hdl->name);
+	zassert_equal(audio_data_rx.data_size, FANOUT_MOD_DATA_SIZE,
+		      "Frame %d has the wrong size on %s", seq, hdl->name);
+
+	return timing_cycles_get(&header.sent, &now);
+}
+
+ZTEST(suite_audio_module_fanout, test_fanout_throughput_latency)
+{
+	timing_t start;
+	timing_t end;
+	uint64_t total_cycles;
+	uint64_t latency;
+	uint64_t latency_sum = 0;
+	uint64_t latency_max = 0;
+	uint32_t seq_rx = 0;
+
+	fanout_graph_build();
+
+	start = timing_counter_get();
+
+	for (uint32_t seq = 0; seq < FANOUT_FRAMES_NUM; seq++) {
+		frame_send(seq);
+
+		if (seq + 1 - seq_rx < FANOUT_PIPELINE_DEPTH) {
+			continue;
+		}
+
+		/* Both branches must deliver each frame before its input slot is reused */
+		for (int i = 0; i < FANOUT_BRANCHES_NUM; i++) {
+			latency = frame_receive(&handle[MOD_C0 + i], seq_rx);
+			latency_sum += latency;
+			latency_max = MAX(latency_max, latency);
+		}
+
+		seq_rx++;
+	}
+
+	while (seq_rx < FANOUT_FRAMES_NUM) {
+		for (int i = 0; i < FANOUT_BRANCHES_NUM; i++) {
+			latency = frame_receive(&handle[MOD_C0 + i], seq_rx);
+			latency_sum += latency;
+			latency_max = MAX(latency_max, latency);
+		}
+
+		seq_rx++;
+	}
+
+	end = timing_counter_get();
+	total_cycles = timing_cycles_get(&start, &end);
+
+	/* Let the module threads drop their last references */
+	k_sleep(K_MSEC(10));
+
+	for (int i = 0; i < FANOUT_MODULES_NUM; i++) {
+		zassert_equal(k_mem_slab_num_used_get(fanout_slab[i]), 0,
+			      "Module %s leaked %d data blocks", handle[i].name,
+			      k_mem_slab_num_used_get(fanout_slab[i]));
+	}
+
+	TC_PRINT("Fan-out graph: %d frames, %llu ns/frame\n", FANOUT_FRAMES_NUM,
+		 timing_cycles_to_ns(total_cycles) / FANOUT_FRAMES_NUM);
+	TC_PRINT("Fan-out graph latency: average %llu ns, max %llu ns\n",
+		 timing_cycles_to_ns(latency_sum / (FANOUT_FRAMES_NUM * FANOUT_BRANCHES_NUM)),
+		 timing_cycles_to_ns(latency_max));
+
+	fanout_graph_teardown();
+}
+
+static void *suite_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(suite_audio_module_fanout, NULL, suite_setup, NULL, NULL, suite_teardown);
@@ -0,0 +1,394 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <errno.h>
+
+#include "audio_module.h"
+#include "audio_module_template.h"
+
+/* Chain under test: TX -> A -> B -> C -> TX FIFO */
+#define CHAIN_MODULES_NUM	   (3)
+#define CHAIN_MSG_QUEUE_SIZE	   (4)
+#define CHAIN_MOD_THREAD_STACK_SIZE (2048)
+#define CHAIN_MOD_THREAD_PRIORITY  (4)
+#define CHAIN_MOD_DATA_SIZE	   (40)
+#define CHAIN_MSG_SIZE		   (sizeof(struct audio_module_message))
+#define CHAIN_FRAMES_NUM	   (200)
+#define CHAIN_RX_TIMEOUT	   (K_MSEC(100))
+
+K_THREAD_STACK_ARRAY_DEFINE(chain_stack, CHAIN_MODULES_NUM, CHAIN_MOD_THREAD_STACK_SIZE);
+K_THREAD_STACK_DEFINE(graph_stack, CHAIN_MOD_THREAD_STACK_SIZE);
+DATA_FIFO_DEFINE(chain_fifo_rx0, CHAIN_MSG_QUEUE_SIZE, CHAIN_MSG_SIZE);
+DATA_FIFO_DEFINE(chain_fifo_rx1, CHAIN_MSG_QUEUE_SIZE, CHAIN_MSG_SIZE);
+DATA_FIFO_DEFINE(chain_fifo_rx2, CHAIN_MSG_QUEUE_SIZE, CHAIN_MSG_SIZE);
+DATA_FIFO_DEFINE(chain_fifo_tx2, CHAIN_MSG_QUEUE_SIZE, CHAIN_MSG_SIZE);
+K_MEM_SLAB_DEFINE(chain_slab0, CHAIN_MOD_DATA_SIZE, CHAIN_MSG_QUEUE_SIZE, 4);
+K_MEM_SLAB_DEFINE(chain_slab1, CHAIN_MOD_DATA_SIZE, CHAIN_MSG_QUEUE_SIZE, 4);
+K_MEM_SLAB_DEFINE(chain_slab2, CHAIN_MOD_DATA_SIZE, CHAIN_MSG_QUEUE_SIZE, 4);
+
+static struct data_fifo *chain_fifo_rx[CHAIN_MODULES_NUM] = {&chain_fifo_rx0, &chain_fifo_rx1,
+							     &chain_fifo_rx2};
+static struct data_fifo *chain_fifo_tx[CHAIN_MODULES_NUM] = {NULL, NULL, &chain_fifo_tx2};
+static struct k_mem_slab *chain_slab[CHAIN_MODULES_NUM] = {&chain_slab0, &chain_slab1,
+							   &chain_slab2};
+
+static struct audio_module_handle handle[CHAIN_MODULES_NUM];
+static struct audio_module_template_context context[CHAIN_MODULES_NUM];
+static struct audio_module_graph graph;
+static struct k_thread graph_thread_data;
+
+static struct audio_metadata chain_metadata = {.data_coding = PCM,
+					       .data_len_us = 10000,
+					       .sample_rate_hz = 48000,
+					       .bits_per_sample = 16,
+					       .carried_bits_per_sample = 16,
+					       .locations = 0x00000003,
+					       .ref_ts_us = 0,
+					       .data_rx_ts_us = 0,
+					       .bad_data = false};
+
+/* Results of a benchmark run */
+struct chain_result {
+	uint64_t latency_sum;
+	uint64_t latency_max;
+	size_t stack_used;
+};
+
+static void chain_parameters_set(struct audio_module_parameters *mod_parameters, int i)
+{
+	mod_parameters->description = audio_module_template_description;
+	mod_parameters->thread.stack = chain_stack[i];
+	mod_parameters->thread.stack_size = CHAIN_MOD_THREAD_STACK_SIZE;
+	mod_parameters->thread.priority = CHAIN_MOD_THREAD_PRIORITY;
+	mod_parameters->thread.data_slab = chain_slab[i];
+	mod_parameters->thread.data_size = CHAIN_MOD_DATA_SIZE;
+	mod_parameters->thread.msg_rx = chain_fifo_rx[i];
+	mod_parameters->thread.msg_tx = chain_fifo_tx[i];
+}
+
+static void chain_connect(void)
+{
+	int ret;
+
+	for (int i = 0; i < CHAIN_MODULES_NUM - 1; i++) {
+		ret = audio_module_connect(&handle[i], &handle[i + 1], false);
+		zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d",
+			      ret);
+	}
+
+	ret = audio_module_connect(&handle[CHAIN_MODULES_NUM - 1], NULL, true);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+}
+
+static void chain_close(void)
+{
+	int ret;
+
+	for (int i = 0; i < CHAIN_MODULES_NUM; i++) {
+		ret = audio_module_close(&handle[i]);
+		zassert_equal(ret, 0, "Close function did not return successfully (0): ret %d",
+			      ret);
+	}
+}
+
+static void frame_fill(uint8_t *frame, struct audio_data *audio_data_tx, uint32_t seq)
+{
+	memset(frame, (uint8_t)seq, CHAIN_MOD_DATA_SIZE);
+
+	audio_data_tx->data = frame;
+	audio_data_tx->data_size = CHAIN_MOD_DATA_SIZE;
+	memcpy(&audio_data_tx->meta, &chain_metadata, sizeof(struct audio_metadata));
+}
+
+static void frame_check(struct audio_module_handle *hdl, uint32_t seq, k_timeout_t timeout)
+{
+	int ret;
+	uint8_t frame_out[CHAIN_MOD_DATA_SIZE];
+	struct audio_data audio_data_rx = {.data = frame_out, .data_size = sizeof(frame_out)};
+
+	ret = audio_module_data_rx(hdl, &audio_data_rx, timeout);
+	zassert_equal(ret, 0, "Data RX function did not return successfully (0): ret %d", ret);
+	zassert_equal(frame_out[0], (uint8_t)seq, "Frame %d corrupted", seq);
+	zassert_equal(frame_out[CHAIN_MOD_DATA_SIZE - 1], (uint8_t)seq, "Frame %d corrupted",
+		      seq);
+}
+
+static void result_add(struct chain_result *result, timing_t *start, timing_t *end)
+{
+	uint64_t latency = timing_cycles_get(start, end);
+
+	result->latency_sum += latency;
+	result->latency_max = MAX(result->latency_max, latency);
+}
+
+static void threaded_run(struct chain_result *result)
+{
+	int ret;
+	size_t unused;
+	timing_t start;
+	timing_t end;
+	uint8_t frame[CHAIN_MOD_DATA_SIZE];
+	struct audio_data audio_data_tx;
+	struct audio_module_parameters mod_parameters;
+	struct audio_module_template_configuration configuration = {
+		.sample_rate_hz = 48000, .bit_depth = 16, .module_description = "Threaded"};
+
+	for (int i = 0; i < CHAIN_MODULES_NUM; i++) {
+		memset(&handle[i], 0, sizeof(struct audio_module_handle));
+		chain_parameters_set(&mod_parameters, i);
+
+		ret = audio_module_open(
+			&mod_parameters,
+			(const struct audio_module_configuration *const)&configuration,
+			"Threaded", (struct audio_module_context *)&context[i], &handle[i]);
+		zassert_equal(ret, 0, "Open function did not return successfully (0): ret %d", ret);
+	}
+
+	chain_connect();
+
+	for (int i = 0; i < CHAIN_MODULES_NUM; i++) {
+		ret = audio_module_start(&handle[i]);
+		zassert_equal(ret, 0, "Start function did not return successfully (0): ret %d",
+			      ret);
+	}
+
+	for (uint32_t seq = 0; seq < CHAIN_FRAMES_NUM; seq++) {
+		frame_fill(frame, &audio_data_tx, seq);
+
+		start = timing_counter_get();
+
+		ret = audio_module_data_tx(&handle[0], &audio_data_tx, NULL);
+		zassert_equal(ret, 0, "Data TX function did not return successfully (0): ret %d",
+			      ret);
+
+		frame_check(&handle[CHAIN_MODULES_NUM - 1], seq, CHAIN_RX_TIMEOUT);
+
+		end = timing_counter_get();
+		result_add(result, &start, &end);
+	}
+
+	for (int i = 0; i < CHAIN_MODULES_NUM; i++) {
+		ret = k_thread_stack_space_get(handle[i].thread_id, &unused);
+		zassert_equal(ret, 0, "Failed to get stack space: ret %d", ret);
+
+		result->stack_used += CHAIN_MOD_THREAD_STACK_SIZE - unused;
+
+		ret = audio_module_stop(&handle[i]);
+		zassert_equal(ret, 0, "Stop function did not return successfully (0): ret %d", ret);
+	}
+
+	/* Let the module threads drop their last references */
+	k_sleep(K_MSEC(10));
+
+	chain_close();
+}
+
+static void graph_thread(void *p1, void *p2, void *p3)
+{
+	int ret;
+	timing_t start;
+	timing_t end;
+	uint8_t frame[CHAIN_MOD_DATA_SIZE];
+	struct audio_data audio_data_tx;
+	struct chain_result *result = p1;
+
+	for (uint32_t seq = 0; seq < CHAIN_FRAMES_NUM; seq++) {
+		frame_fill(frame, &audio_data_tx, seq);
+
+		start = timing_counter_get();
+
+		ret = audio_module_graph_process(&graph, &audio_data_tx);
+		zassert_equal(ret, 0, "Graph process did not return successfully (0): ret %d",
+			      ret);
+
+		/* The whole chain has run when the call returns */
+		frame_check(&handle[CHAIN_MODULES_NUM - 1], seq, K_NO_WAIT);
+
+		end = timing_counter_get();
+		result_add(result, &start, &end);
+	}
+}
+
+static void graph_run(struct chain_result *result)
+{
+	int ret;
+	size_t unused;
+	k_tid_t tid;
+	struct audio_module_parameters mod_parameters;
+	struct audio_module_template_configuration configuration = {
+		.sample_rate_hz = 48000, .bit_depth = 16, .module_description = "Graph"};
+
+	memset(&graph, 0, sizeof(graph));
+
+	/* Add in reverse order, the graph orders the modules itself */
+	for (int i = CHAIN_MODULES_NUM - 1; i >= 0; i--) {
+		memset(&handle[i], 0, sizeof(struct audio_module_handle));
+		chain_parameters_set(&mod_parameters, i);
+
+		ret = audio_module_graph_add(
+			&graph, &mod_parameters,
+			(const struct audio_module_configuration *const)&configuration, "Graph",
+			(struct audio_module_context *)&context[i], &handle[i]);
+		zassert_equal(ret, 0, "Graph add did not return successfully (0): ret %d", ret);
+	}
+
+	chain_connect();
+
+	ret = audio_module_graph_start(&graph);
+	zassert_equal(ret, 0, "Graph start did not return successfully (0): ret %d", ret);
+
+	/* Run the graph in a thread of the same size as a module thread to measure its stack */
+	tid = k_thread_create(&graph_thread_data, graph_stack, K_THREAD_STACK_SIZEOF(graph_stack),
+			      graph_thread, result, NULL, NULL,
+			      K_PRIO_PREEMPT(CHAIN_MOD_THREAD_PRIORITY), 0, K_NO_WAIT);
+
+	ret = k_thread_join(tid, K_FOREVER);
+	zassert_equal(ret, 0, "Failed to join graph thread: ret %d", ret);
+
+	ret = k_thread_stack_space_get(tid, &unused);
+	zassert_equal(ret, 0, "Failed to get stack space: ret %d", ret);
+
+	result->stack_used = K_THREAD_STACK_SIZEOF(graph_stack) - unused;
+
+	ret = audio_module_graph_stop(&graph);
+	zassert_equal(ret, 0, "Graph stop did not return successfully (0): ret %d", ret);
+
+	for (int i = 0; i < CHAIN_MODULES_NUM; i++) {
+		zassert_equal(k_mem_slab_num_used_get(chain_slab[i]), 0,
+			      "Module %s leaked %d data blocks", handle[i].name,
+			      k_mem_slab_num_used_get(chain_slab[i]));
+	}
+
+	chain_close();
+}
+
+static void result_print(const char *mode, struct chain_result *result, size_t stack_size)
+{
+	TC_PRINT("%s: latency average %llu ns, max %llu ns, stack %zu of %zu bytes\n", mode,
+		 timing_cycles_to_ns(result->latency_sum / CHAIN_FRAMES_NUM),
+		 timing_cycles_to_ns(result->latency_max), result->stack_used, stack_size);
+}
+
+ZTEST(suite_audio_module_graph, test_graph_vs_threaded)
+{
+	struct chain_result threaded = {0};
+	struct chain_result graph_result = {0};
+
+	threaded_run(&threaded);
+	graph_run(&graph_result);
+
+	result_print("Threaded chain", &threaded, CHAIN_MODULES_NUM * CHAIN_MOD_THREAD_STACK_SIZE);
+	result_print("Graph chain", &graph_result, CHAIN_MOD_THREAD_STACK_SIZE);
+}
+
+ZTEST(suite_audio_module_graph, test_graph_fan_in)
+{
+	int ret;
+	struct audio_module_parameters mod_parameters;
+	struct audio_module_template_configuration configuration = {
+		.sample_rate_hz = 48000, .bit_depth = 16, .module_description = "Fan-in"};
+
+	memset(&graph, 0, sizeof(graph));
+
+	for (int i = 0; i < CHAIN_MODULES_NUM; i++) {
+		memset(&handle[i], 0, sizeof(struct audio_module_handle));
+		chain_parameters_set(&mod_parameters, i);
+
+		ret = audio_module_graph_add(
+			&graph, &mod_parameters,
+			(const struct audio_module_configuration *const)&configuration, "Fan-in",
+			(struct audio_module_context *)&context[i], &handle[i]);
+		zassert_equal(ret, 0, "Graph add did not return successfully (0): ret %d", ret);
+	}
+
+	ret = audio_module_connect(&handle[0], &handle[2], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+	ret = audio_module_connect(&handle[1], &handle[2], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_graph_start(&graph);
+	zassert_equal(ret, -ENOTSUP, "Graph start did not return -ENOTSUP (%d): ret %d",
+		      -ENOTSUP, ret);
+
+	chain_close();
+}
+
+ZTEST(suite_audio_module_graph, test_graph_change_while_started)
+{
+	int ret;
+	struct audio_module_parameters mod_parameters;
+	struct audio_module_template_configuration configuration = {
+		.sample_rate_hz = 48000, .bit_depth = 16, .module_description = "Change"};
+
+	memset(&graph, 0, sizeof(graph));
+
+	for (int i = 0; i < CHAIN_MODULES_NUM; i++) {
+		memset(&handle[i], 0, sizeof(struct audio_module_handle));
+		chain_parameters_set(&mod_parameters, i);
+
+		ret = audio_module_graph_add(
+			&graph, &mod_parameters,
+			(const struct audio_module_configuration *const)&configuration, "Change",
+			(struct audio_module_context *)&context[i], &handle[i]);
+		zassert_equal(ret, 0, "Graph add did not return successfully (0): ret %d", ret);
+	}
+
+	chain_connect();
+
+	ret = audio_module_graph_start(&graph);
+	zassert_equal(ret, 0, "Graph start did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_connect(&handle[0], &handle[2], false);
+	zassert_equal(ret, -EBUSY, "Connect did not return -EBUSY (%d): ret %d", -EBUSY, ret);
+	ret = audio_module_disconnect(&handle[0], &handle[1], false);
+	zassert_equal(ret, -EBUSY, "Disconnect did not return -EBUSY (%d): ret %d", -EBUSY, ret);
+	ret = audio_module_close(&handle[1]);
+	zassert_not_equal(ret, 0, "Close of a module in a started graph succeeded");
+
+	ret = audio_module_graph_stop(&graph);
+	zassert_equal(ret, 0, "Graph stop did not return successfully (0): ret %d", ret);
+
+	/* Take the middle module out of the stopped graph */
+	ret = audio_module_disconnect(&handle[0], &handle[1], false);
+	zassert_equal(ret, 0, "Disconnect did not return successfully (0): ret %d", ret);
+	ret = audio_module_disconnect(&handle[1], &handle[2], false);
+	zassert_equal(ret, 0, "Disconnect did not return successfully (0): ret %d", ret);
+	ret = audio_module_close(&handle[1]);
+	zassert_equal(ret, 0, "Close function did not return successfully (0): ret %d", ret);
+	zassert_equal(graph.num_modules, CHAIN_MODULES_NUM - 1,
+		      "Closed module not removed from the graph");
+
+	ret = audio_module_connect(&handle[0], &handle[2], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_graph_start(&graph);
+	zassert_equal(ret, 0, "Graph start did not return successfully (0): ret %d", ret);
+	ret = audio_module_graph_stop(&graph);
+	zassert_equal(ret, 0, "Graph stop did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_close(&handle[0]);
+	zassert_equal(ret, 0, "Close function did not return successfully (0): ret %d", ret);
+	ret = audio_module_close(&handle[2]);
+	zassert_equal(ret, 0, "Close function did not return successfully (0): ret %d", ret);
+	zassert_equal(graph.num_modules, 0, "Closed modules not removed from the graph");
+}
+
+static void *suite_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(suite_audio_module_graph, NULL, suite_setup, NULL, NULL, suite_teardown);
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/random/random.h>
+#include <zephyr/bluetooth/mesh.h>
+#include <mesh/net.h>
+#include <mesh/rpl.h>
+
+#define BENCH_MSG_NUM (20000)
+
+static uint32_t bench_seq[CONFIG_BT_MESH_CRPL];
+
+static bool bench_check(uint16_t src, uint32_t seq)
+{
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = src,
+		.seq = seq,
+		.net_if = BT_MESH_NET_IF_ADV,
+		.local_match = 1,
+	};
+
+	return bt_mesh_rpl_check(&rx, NULL, false);
+}
+
+/* Fill the list with sources spread over the unicast range, and measure messages from random
+ * sources in the list.
+ */
+static void bench_run(uint16_t entries)
+{
+	timing_t start;
+	timing_t end;
+	uint64_t cycles;
+	uint32_t replays = 0;
+
+	bt_mesh_rpl_clear();
+
+	for (uint16_t i = 0; i < entries; i++) {
+		bench_seq[i] = 1;
+		zassert_false(bench_check(i * 7 + 1, bench_seq[i]), "New source rejected");
+	}
+
+	start = timing_counter_get();
+
+	for (uint32_t i = 0; i < BENCH_MSG_NUM; i++) {
+		uint16_t n = sys_rand32_get() % entries;
+
+		/* Every fourth message is a replay */
+		if (i % 4) {
+			bench_seq[n]++;
+		}
+
+		replays += bench_check(n * 7 + 1, bench_seq[n]);
+	}
+
+	end = timing_counter_get();
+
+	zassert_equal(replays, BENCH_MSG_NUM / 4, "Unexpected number of replays");
+
+	cycles = timing_cycles_get(&start, &end);
+	TC_PRINT("%s RPL, %u entries: %llu ns/msg\n",
+		 IS_ENABLED(CONFIG_BT_MESH_RPL_HASH_LOOKUP) ? "Hashed" : "Linear", entries,
+		 timing_cycles_to_ns(cycles) / BENCH_MSG_NUM);
+}
+
+ZTEST(rpl_benchmark, test_bench_check)
+{
+	BUILD_ASSERT(CONFIG_BT_MESH_CRPL >= 1024);
+
+	bench_run(64);
+	bench_run(256);
+	bench_run(1024);
+}
+
+static void *suite_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(rpl_benchmark, NULL, suite_setup, NULL, NULL, suite_teardown);
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/mesh.h>
+#include <mesh/net.h>
+#include <mesh/rpl.h>
+
+static struct bt_mesh_net_rx rx_get(uint16_t src, uint32_t seq, bool old_iv)
+{
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = src,
+		.seq = seq,
+		.old_iv = old_iv,
+		.net_if = BT_MESH_NET_IF_ADV,
+		.local_match = 1,
+	};
+
+	return rx;
+}
+
+static bool rpl_check(uint16_t src, uint32_t seq, bool old_iv)
+{
+	struct bt_mesh_net_rx rx = rx_get(src, seq, old_iv);
+
+	return bt_mesh_rpl_check(&rx, NULL, false);
+}
+
+ZTEST(rpl, test_replay)
+{
+	zassert_false(rpl_check(0x0001, 10, false), "New source rejected");
+	zassert_false(rpl_check(0x0002, 10, false), "New source rejected");
+	zassert_true(rpl_check(0x0001, 10, false), "Replay accepted");
+	zassert_true(rpl_check(0x0001, 9, false), "Old sequence number accepted");
+	zassert_false(rpl_check(0x0001, 11, false), "Newer sequence number rejected");
+	zassert_true(rpl_check(0x0001, 11, false), "Replay accepted");
+	zassert_true(rpl_check(0x0002, 10, false), "Replay accepted");
+}
+
+ZTEST(rpl, test_local_and_unmatched)
+{
+	struct bt_mesh_net_rx rx = rx_get(0x0001, 10, false);
+
+	rx.net_if = BT_MESH_NET_IF_LOCAL;
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, false), "Local message rejected");
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, false), "Local message rejected");
+
+	rx = rx_get(0x0001, 10, false);
+	rx.local_match = 0;
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, false), "Unmatched message rejected");
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, false), "Unmatched message rejected");
+
+	/* Messages from the Subnet Bridge are checked regardless of the local match */
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, true), "Bridged message rejected");
+	zassert_true(bt_mesh_rpl_check(&rx, NULL, true), "Bridged replay accepted");
+}
+
+ZTEST(rpl, test_match)
+{
+	struct bt_mesh_net_rx rx = rx_get(0x0003, 5, false);
+	struct bt_mesh_rpl *match = NULL;
+	struct bt_mesh_rpl *again = NULL;
+
+	zassert_false(bt_mesh_rpl_check(&rx, &match, false), "New source rejected");
+	zassert_not_null(match, "No slot returned");
+
+	/* The slot is not updated until the segmented message is complete */
+	zassert_false(bt_mesh_rpl_check(&rx, &again, false), "Pending source rejected");
+	zassert_equal(match, again, "Different slot returned");
+
+	bt_mesh_rpl_update(match, &rx);
+	zassert_true(bt_mesh_rpl_check(&rx, NULL, false), "Replay accepted");
+
+	/* The next new source gets another slot */
+	rx = rx_get(0x0004, 5, false);
+	zassert_false(bt_mesh_rpl_check(&rx, &again, false), "New source rejected");
+	zassert_not_equal(match, again, "Used slot returned");
+}
+
+ZTEST(rpl, test_full)
+{
+	for (uint16_t i = 0; i < CONFIG_BT_MESH_CRPL; i++) {
+		zassert_false(rpl_check(i + 1, 1, false), "New source rejected");
+	}
+
+	zassert_true(rpl_check(CONFIG_BT_MESH_CRPL + 1, 1, false), "Full list accepted new source");
+
+	for (uint16_t i = 0; i < CONFIG_BT_MESH_CRPL; i++) {
+		zassert_true(rpl_check(i + 1, 1, false), "Replay accepted");
+		zassert_false(rpl_check(i + 1, 2, false), "Newer sequence number rejected");
+	}
+}
+
+ZTEST(rpl, test_iv_update)
+{
+	zassert_false(rpl_check(0x0001, 100, false), "New source rejected");
+	zassert_false(rpl_check(0x0002, 100, false), "New source rejected");
+
+	/* Entries are flagged as old */
+	bt_mesh_rpl_reset();
+
+	zassert_true(rpl_check(0x0001, 100, true), "Replay accepted");
+	zassert_false(rpl_check(0x0002, 1, false), "First message on new IV index rejected");
+	zassert_true(rpl_check(0x0002, 200, true), "Message on old IV index accepted");
+	zassert_false(rpl_check(0x0003, 1, false), "New source rejected");
+
+	/* Old entries are removed, the others are flagged as old */
+	bt_mesh_rpl_reset();
+
+	zassert_false(rpl_check(0x0001, 1, false), "Removed source rejected");
+	zassert_true(rpl_check(0x0002, 1, true), "Replay accepted");
+	zassert_true(rpl_check(0x0003, 1, true), "Replay accepted");
+	zassert_false(rpl_check(0x0003, 2, true), "Newer sequence number rejected");
+	zassert_false(rpl_check(0x0004, 1, false), "New source rejected");
+	zassert_true(rpl_check(0x0004, 1, false), "Replay accepted");
+}
+
+ZTEST(rpl, test_clear)
+{
+	zassert_false(rpl_check(0x0001, 10, false), "New source rejected");
+	bt_mesh_rpl_clear();
+	zassert_false(rpl_check(0x0001, 10, false), "Cleared source rejected");
+}
+
+static void rpl_before(void *fixture)
+{
+	bt_mesh_rpl_clear();
+}
+
+ZTEST_SUITE(rpl, NULL, NULL, rpl_before, NULL, NULL);
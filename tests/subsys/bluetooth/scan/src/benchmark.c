@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/byteorder.h>
+#include <bluetooth/scan.h>
+
+#include "mocks.h"
+
+/* Distinct advertisers in the trace, like a busy gateway environment */
+#define BENCH_ADVERTISERS_NUM (256)
+/* Advertising reports in the trace */
+#define BENCH_REPORTS_NUM     (4096)
+/* Number of times the trace is replayed */
+#define BENCH_ROUNDS	      (8)
+
+#define BENCH_ADDR_GROUP      0x10
+
+struct bench_report {
+	uint16_t advertiser;
+	uint16_t adv_props;
+};
+
+static struct bench_report bench_trace[BENCH_REPORTS_NUM];
+static bt_addr_le_t bench_addr[BENCH_ADVERTISERS_NUM];
+static uint32_t bench_notified;
+
+static const uint8_t bench_ad[] = {
+	0x02, BT_DATA_FLAGS, BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR,
+	0x0b, BT_DATA_NAME_COMPLETE, 'B', 'e', 'n', 'c', 'h', ' ', 'n', 'o', 'd', 'e',
+	0x07, BT_DATA_MANUFACTURER_DATA, 0x59, 0x00, 0x01, 0x02, 0x03, 0x04,
+};
+
+/* Same payload with a service list, the last service matches one of the UUID filters */
+static const uint8_t bench_uuid_ad[] = {
+	0x02, BT_DATA_FLAGS, BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR,
+	0x0b, BT_DATA_NAME_COMPLETE, 'B', 'e', 'n', 'c', 'h', ' ', 'n', 'o', 'd', 'e',
+	0x09, BT_DATA_UUID16_ALL, 0x0a, 0x18, 0x0f, 0x18, 0x1a, 0x18, 0x05, 0x19,
+	0x07, BT_DATA_MANUFACTURER_DATA, 0x59, 0x00, 0x01, 0x02, 0x03, 0x04,
+};
+
+static void bench_filter_match(struct bt_scan_device_info *device_info,
+			       struct bt_scan_filter_match *filter_match,
+			       bool connectable)
+{
+	bench_notified++;
+}
+
+static void bench_filter_no_match(struct bt_scan_device_info *device_info,
+				  bool connectable)
+{
+	bench_notified++;
+}
+
+BT_SCAN_CB_INIT(bench_cb, bench_filter_match, bench_filter_no_match, NULL, NULL);
+
+/* Builds a trace of interleaved advertising packets and scan responses from all advertisers */
+static uint32_t bench_rand(uint32_t *seed)
+{
+	*seed = *seed * 1103515245 + 12345;
+
+	return *seed >> 8;
+}
+
+static void bench_trace_build(void)
+{
+	uint32_t seed = 0x12345678;
+
+	for (uint16_t i = 0; i < BENCH_ADVERTISERS_NUM; i++) {
+		bench_addr[i].type = BT_ADDR_LE_RANDOM;
+		sys_put_le32(bench_rand(&seed), bench_addr[i].a.val);
+		bench_addr[i].a.val[4] = BENCH_ADDR_GROUP;
+		bench_addr[i].a.val[5] = 0xc0 | (i & 0x3f);
+	}
+
+	for (size_t i = 0; i < BENCH_REPORTS_NUM; i += 2) {
+
+		/* Every advertising packet is followed by its scan response */
+		bench_trace[i].advertiser = bench_rand(&seed) % BENCH_ADVERTISERS_NUM;
+		bench_trace[i].adv_props = BT_GAP_ADV_PROP_CONNECTABLE | BT_GAP_ADV_PROP_SCANNABLE;
+		bench_trace[i + 1].advertiser = bench_trace[i].advertiser;
+		bench_trace[i + 1].adv_props = BT_GAP_ADV_PROP_SCANNABLE |
+					       BT_GAP_ADV_PROP_SCAN_RESPONSE;
+	}
+}
+
+static uint64_t bench_replay(const uint8_t *data, size_t len)
+{
+	struct bt_le_scan_recv_info info = {0};
+	timing_t start;
+	timing_t end;
+
+	NET_BUF_SIMPLE_DEFINE(ad, BT_GAP_ADV_MAX_ADV_DATA_LEN);
+
+	bench_notified = 0;
+
+	start = timing_counter_get();
+
+	for (int round = 0; round < BENCH_ROUNDS; round++) {
+		for (size_t i = 0; i < BENCH_REPORTS_NUM; i++) {
+			info.addr = &bench_addr[bench_trace[i].advertiser];
+			info.adv_props = bench_trace[i].adv_props;
+
+			net_buf_simple_reset(&ad);
+			net_buf_simple_add_mem(&ad, data, len);
+
+			mock_scan_cb->recv(&info, &ad);
+		}
+	}
+
+	end = timing_counter_get();
+
+	return timing_cycles_get(&start, &end);
+}
+
+static void bench_print(const char *name, uint64_t cycles)
+{
+	TC_PRINT("%s: %d advertisers, %llu ns/report\n", name, BENCH_ADVERTISERS_NUM,
+		 timing_cycles_to_ns(cycles) / (BENCH_ROUNDS * BENCH_REPORTS_NUM));
+}
+
+ZTEST(bt_scan_benchmark, test_bench_report_processing)
+{
+	uint64_t cycles;
+	int err;
+	uint16_t i = 0;
+
+	/* Lists empty, only the connectable cache is in use */
+	cycles = bench_replay(bench_ad, sizeof(bench_ad));
+	zassert_equal(bench_notified, BENCH_ROUNDS * BENCH_REPORTS_NUM, "Reports dropped");
+	bench_print("empty lists", cycles);
+
+	/* Fill every address-based list with a distinct share of the advertisers */
+	err = bt_scan_filter_enable(BT_SCAN_ADDR_FILTER, false);
+	zassert_ok(err, "Failed to enable filter (err %d)", err);
+
+	for (uint16_t n = 0; n < CONFIG_BT_SCAN_ADDRESS_CNT; n++, i++) {
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &bench_addr[i]);
+		zassert_ok(err, "Failed to add filter (err %d)", err);
+	}
+
+	for (uint16_t n = 0; n < CONFIG_BT_SCAN_BLOCKLIST_LEN; n++, i++) {
+		err = bt_scan_blocklist_device_add(&bench_addr[i]);
+		zassert_ok(err, "Failed to add device (err %d)", err);
+	}
+
+	for (uint16_t n = 0; n < CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER_LEN; n++, i++) {
+		struct bt_conn *conn = mock_conn_get(&bench_addr[i]);
+
+		mock_conn_cb->connected(conn, 0);
+
+		for (int a = 0; a < CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT; a++) {
+			mock_conn_cb->disconnected(conn, BT_HCI_ERR_REMOTE_USER_TERM_CONN);
+		}
+	}
+
+	zassert_true(i <= BENCH_ADVERTISERS_NUM, "Not enough advertisers in the trace");
+
+	cycles = bench_replay(bench_ad, sizeof(bench_ad));
+	zassert_true(bench_notified < BENCH_ROUNDS * BENCH_REPORTS_NUM, "No reports filtered");
+	bench_print("full lists", cycles);
+
+	bt_scan_filter_disable();
+	bt_scan_filter_remove_all();
+	bt_scan_blocklist_clear();
+	bt_scan_conn_attempts_filter_clear();
+}
+
+ZTEST(bt_scan_benchmark, test_bench_content_filters)
+{
+	static char names[CONFIG_BT_SCAN_NAME_CNT][CONFIG_BT_SCAN_NAME_MAX_LEN];
+	static char short_names[CONFIG_BT_SCAN_SHORT_NAME_CNT][CONFIG_BT_SCAN_SHORT_NAME_MAX_LEN];
+	static uint8_t manufacturer_data[CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT][4];
+	uint64_t cycles;
+	int err;
+
+	err = bt_scan_filter_enable(BT_SCAN_NAME_FILTER | BT_SCAN_SHORT_NAME_FILTER |
+				    BT_SCAN_UUID_FILTER | BT_SCAN_MANUFACTURER_DATA_FILTER, false);
+	zassert_ok(err, "Failed to enable filter (err %d)", err);
+
+	/* Fill every content list, only the UUID filter for 0x1905 matches the reports */
+	for (uint16_t n = 0; n < CONFIG_BT_SCAN_NAME_CNT; n++) {
+		snprintk(names[n], sizeof(names[n]), "Sensor %02u", n);
+
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, names[n]);
+		zassert_ok(err, "Failed to add filter (err %d)", err);
+	}
+
+	for (uint16_t n = 0; n < CONFIG_BT_SCAN_SHORT_NAME_CNT; n++) {
+		struct bt_scan_short_name short_name = {
+			.name = short_names[n],
+			.min_len = 4,
+		};
+
+		snprintk(short_names[n], sizeof(short_names[n]), "Tag %02u", n);
+
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_SHORT_NAME, &short_name);
+		zassert_ok(err, "Failed to add filter (err %d)", err);
+	}
+
+	for (uint16_t n = 0; n < CONFIG_BT_SCAN_UUID_CNT; n++) {
+		struct bt_uuid_16 uuid = BT_UUID_INIT_16(0x1900 + n);
+
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, &uuid);
+		zassert_ok(err, "Failed to add filter (err %d)", err);
+	}
+
+	for (uint16_t n = 0; n < CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT; n++) {
+		struct bt_scan_manufacturer_data data = {
+			.data = manufacturer_data[n],
+			.data_len = sizeof(manufacturer_data[n]),
+		};
+
+		sys_put_le16(0x0059, manufacturer_data[n]);
+		sys_put_le16(0x0100 + n, &manufacturer_data[n][2]);
+
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA, &data);
+		zassert_ok(err, "Failed to add filter (err %d)", err);
+	}
+
+	cycles = bench_replay(bench_ad, sizeof(bench_ad));
+	zassert_equal(bench_notified, BENCH_ROUNDS * BENCH_REPORTS_NUM, "Reports dropped");
+	bench_print("full content lists, no match", cycles);
+
+	cycles = bench_replay(bench_uuid_ad, sizeof(bench_uuid_ad));
+	zassert_equal(bench_notified, BENCH_ROUNDS * BENCH_REPORTS_NUM, "Reports dropped");
+	bench_print("full content lists, UUID match", cycles);
+
+	bt_scan_filter_disable();
+	bt_scan_filter_remove_all();
+}
+
+static void *suite_setup(void)
+{
+	bt_scan_init(NULL);
+	bt_scan_cb_register(&bench_cb);
+	bt_scan_filter_remove_all();
+	bt_scan_blocklist_clear();
+	bt_scan_conn_attempts_filter_clear();
+
+	bench_trace_build();
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(bt_scan_benchmark, NULL, suite_setup, NULL, NULL, suite_teardown);
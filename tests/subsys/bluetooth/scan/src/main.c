@@ -0,0 +1,499 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <bluetooth/scan.h>
+
+#include "mocks.h"
+
+#define ADDR_GROUP_FILTER    0x01
+#define ADDR_GROUP_BLOCKLIST 0x02
+#define ADDR_GROUP_ATTEMPTS  0x03
+#define ADDR_GROUP_CACHE     0x04
+#define ADDR_GROUP_OTHER     0x05
+
+static uint32_t match_cnt;
+static uint32_t no_match_cnt;
+static bool last_connectable;
+static const bt_addr_le_t *last_match_addr;
+static struct bt_scan_filter_match last_match;
+
+static void scan_filter_match(struct bt_scan_device_info *device_info,
+			      struct bt_scan_filter_match *filter_match,
+			      bool connectable)
+{
+	match_cnt++;
+	last_connectable = connectable;
+	last_match_addr = filter_match->addr.match ? filter_match->addr.addr : NULL;
+	last_match = *filter_match;
+}
+
+static void scan_filter_no_match(struct bt_scan_device_info *device_info,
+				 bool connectable)
+{
+	no_match_cnt++;
+	last_connectable = connectable;
+}
+
+BT_SCAN_CB_INIT(scan_cb, scan_filter_match, scan_filter_no_match, NULL, NULL);
+
+static void addr_get(bt_addr_le_t *addr, uint8_t group, uint16_t n)
+{
+	addr->type = BT_ADDR_LE_RANDOM;
+	addr->a.val[0] = n & 0xff;
+	addr->a.val[1] = n >> 8;
+	addr->a.val[2] = group;
+	addr->a.val[3] = 0x5a;
+	addr->a.val[4] = 0xa5;
+	/* Random static address. */
+	addr->a.val[5] = 0xc0;
+}
+
+static void report_ad_send(const bt_addr_le_t *addr, uint16_t adv_props,
+			   const uint8_t *data, size_t len)
+{
+	struct bt_le_scan_recv_info info = {
+		.addr = addr,
+		.adv_props = adv_props,
+	};
+
+	NET_BUF_SIMPLE_DEFINE(ad, BT_GAP_ADV_MAX_ADV_DATA_LEN);
+
+	net_buf_simple_add_mem(&ad, data, len);
+
+	zassert_not_null(mock_scan_cb, "Scan callback not registered");
+	mock_scan_cb->recv(&info, &ad);
+}
+
+static void report_send(const bt_addr_le_t *addr, uint16_t adv_props)
+{
+	static const uint8_t flags[] = {0x02, BT_DATA_FLAGS, BT_LE_AD_GENERAL};
+
+	report_ad_send(addr, adv_props, flags, sizeof(flags));
+}
+
+/* Sends a report with a single AD element and returns true if any filter matched. */
+static bool element_matched(uint8_t type, const void *data, uint8_t len)
+{
+	uint8_t ad[BT_GAP_ADV_MAX_ADV_DATA_LEN];
+	bt_addr_le_t addr;
+
+	zassert_true(len + 2 <= sizeof(ad), "AD element too long");
+
+	ad[0] = len + 1;
+	ad[1] = type;
+	memcpy(&ad[2], data, len);
+
+	addr_get(&addr, ADDR_GROUP_OTHER, 0);
+	match_cnt = 0;
+	memset(&last_match, 0, sizeof(last_match));
+
+	report_ad_send(&addr, 0, ad, len + 2);
+
+	return match_cnt > 0;
+}
+
+static bool name_matched(uint8_t type, const char *name)
+{
+	return element_matched(type, name, strlen(name));
+}
+
+/* Returns true if the report from the address generated any callback. */
+static bool report_notified(const bt_addr_le_t *addr, uint16_t adv_props)
+{
+	uint32_t cnt = match_cnt + no_match_cnt;
+
+	report_send(addr, adv_props);
+
+	return (match_cnt + no_match_cnt) != cnt;
+}
+
+ZTEST(bt_scan, test_addr_filter)
+{
+	bt_addr_le_t addr;
+	int err;
+
+	err = bt_scan_filter_enable(BT_SCAN_ADDR_FILTER, false);
+	zassert_ok(err, "Failed to enable filter (err %d)", err);
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_ADDRESS_CNT; i++) {
+		addr_get(&addr, ADDR_GROUP_FILTER, i);
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr);
+		zassert_ok(err, "Failed to add filter %u (err %d)", i, err);
+
+		if (i == 0) {
+			/* Duplicates are accepted without using any space. */
+			err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr);
+			zassert_ok(err, "Duplicated filter rejected (err %d)", err);
+		}
+	}
+
+	addr_get(&addr, ADDR_GROUP_FILTER, CONFIG_BT_SCAN_ADDRESS_CNT);
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr);
+	zassert_equal(err, -ENOMEM, "Unexpected error %d", err);
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_ADDRESS_CNT; i++) {
+		addr_get(&addr, ADDR_GROUP_FILTER, i);
+		match_cnt = 0;
+		last_match_addr = NULL;
+
+		report_send(&addr, 0);
+		zassert_equal(match_cnt, 1, "Address %u not matched", i);
+		zassert_not_null(last_match_addr, "Matched address not reported");
+		zassert_true(bt_addr_le_eq(last_match_addr, &addr), "Wrong address matched");
+	}
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_ADDRESS_CNT; i++) {
+		addr_get(&addr, ADDR_GROUP_OTHER, i);
+		no_match_cnt = 0;
+
+		report_send(&addr, 0);
+		zassert_equal(no_match_cnt, 1, "Address %u matched", i);
+	}
+
+	bt_scan_filter_remove_all();
+
+	addr_get(&addr, ADDR_GROUP_FILTER, 0);
+	no_match_cnt = 0;
+	report_send(&addr, 0);
+	zassert_equal(no_match_cnt, 1, "Removed address matched");
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr);
+	zassert_ok(err, "Failed to add filter (err %d)", err);
+
+	match_cnt = 0;
+	report_send(&addr, 0);
+	zassert_equal(match_cnt, 1, "Address not matched after re-adding");
+}
+
+ZTEST(bt_scan, test_blocklist)
+{
+	bt_addr_le_t addr;
+	int err;
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_BLOCKLIST_LEN; i++) {
+		addr_get(&addr, ADDR_GROUP_BLOCKLIST, i);
+		err = bt_scan_blocklist_device_add(&addr);
+		zassert_ok(err, "Failed to add device %u (err %d)", i, err);
+
+		err = bt_scan_blocklist_device_add(&addr);
+		zassert_ok(err, "Duplicated device rejected (err %d)", err);
+	}
+
+	addr_get(&addr, ADDR_GROUP_BLOCKLIST, CONFIG_BT_SCAN_BLOCKLIST_LEN);
+	err = bt_scan_blocklist_device_add(&addr);
+	zassert_equal(err, -ENOMEM, "Unexpected error %d", err);
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_BLOCKLIST_LEN; i++) {
+		addr_get(&addr, ADDR_GROUP_BLOCKLIST, i);
+		zassert_false(report_notified(&addr, 0), "Blocklisted device %u reported", i);
+
+		addr_get(&addr, ADDR_GROUP_OTHER, i);
+		zassert_true(report_notified(&addr, 0), "Device %u not reported", i);
+	}
+
+	bt_scan_blocklist_clear();
+
+	addr_get(&addr, ADDR_GROUP_BLOCKLIST, 0);
+	zassert_true(report_notified(&addr, 0), "Device not reported after clear");
+}
+
+static void conn_attempts_exhaust(const bt_addr_le_t *addr)
+{
+	mock_conn_cb->connected(mock_conn_get(addr), 0);
+
+	for (int i = 0; i < CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT; i++) {
+		mock_conn_cb->disconnected(mock_conn_get(addr), BT_HCI_ERR_REMOTE_USER_TERM_CONN);
+	}
+}
+
+ZTEST(bt_scan, test_conn_attempts_filter)
+{
+	bt_addr_le_t addr;
+	bt_addr_le_t oldest;
+
+	zassert_not_null(mock_conn_cb, "Connection callbacks not registered");
+
+	addr_get(&oldest, ADDR_GROUP_ATTEMPTS, 0);
+	conn_attempts_exhaust(&oldest);
+	zassert_false(report_notified(&oldest, 0), "Filtered device reported");
+
+	/* A device with attempts left is still reported. */
+	addr_get(&addr, ADDR_GROUP_ATTEMPTS, 1);
+	mock_conn_cb->connected(mock_conn_get(&addr), 0);
+	mock_conn_cb->disconnected(mock_conn_get(&addr), BT_HCI_ERR_REMOTE_USER_TERM_CONN);
+	zassert_true(report_notified(&addr, 0), "Device with attempts left not reported");
+
+	/* Fill the filter so that the oldest device is overwritten. */
+	for (uint16_t i = 2; i <= CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER_LEN; i++) {
+		addr_get(&addr, ADDR_GROUP_ATTEMPTS, i);
+		mock_conn_cb->connected(mock_conn_get(&addr), 0);
+	}
+
+	zassert_true(report_notified(&oldest, 0), "Overwritten device still filtered");
+
+	for (uint16_t i = 2; i <= CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER_LEN; i++) {
+		addr_get(&addr, ADDR_GROUP_ATTEMPTS, i);
+		conn_attempts_exhaust(&addr);
+		zassert_false(report_notified(&addr, 0), "Filtered device %u reported", i);
+	}
+
+	bt_scan_conn_attempts_filter_clear();
+
+	for (uint16_t i = 2; i <= CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER_LEN; i++) {
+		addr_get(&addr, ADDR_GROUP_ATTEMPTS, i);
+		zassert_true(report_notified(&addr, 0), "Device %u filtered after clear", i);
+	}
+}
+
+ZTEST(bt_scan, test_connectable_cache)
+{
+	const uint16_t scan_rsp = BT_GAP_ADV_PROP_SCANNABLE | BT_GAP_ADV_PROP_SCAN_RESPONSE;
+	const uint16_t adv_ind = BT_GAP_ADV_PROP_CONNECTABLE | BT_GAP_ADV_PROP_SCANNABLE;
+	bt_addr_le_t first;
+	bt_addr_le_t addr;
+
+	addr_get(&first, ADDR_GROUP_CACHE, 0);
+
+	report_send(&first, scan_rsp);
+	zassert_false(last_connectable, "Unknown scan response reported as connectable");
+
+	/* Repeated advertising of the same device must not evict the others. */
+	for (int i = 0; i < CONFIG_BT_SCAN_CONNECTABLE_CACHE_SIZE; i++) {
+		report_send(&first, adv_ind);
+		zassert_true(last_connectable, "Connectable advertising not reported");
+	}
+
+	for (uint16_t i = 1; i < CONFIG_BT_SCAN_CONNECTABLE_CACHE_SIZE; i++) {
+		addr_get(&addr, ADDR_GROUP_CACHE, i);
+		report_send(&addr, adv_ind);
+	}
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_CONNECTABLE_CACHE_SIZE; i++) {
+		addr_get(&addr, ADDR_GROUP_CACHE, i);
+		report_send(&addr, scan_rsp);
+		zassert_true(last_connectable, "Scan response %u not connectable", i);
+	}
+
+	/* The oldest entry is evicted by the next advertiser. */
+	addr_get(&addr, ADDR_GROUP_CACHE, CONFIG_BT_SCAN_CONNECTABLE_CACHE_SIZE);
+	report_send(&addr, adv_ind);
+
+	report_send(&first, scan_rsp);
+	zassert_false(last_connectable, "Evicted device reported as connectable");
+
+	for (uint16_t i = 1; i <= CONFIG_BT_SCAN_CONNECTABLE_CACHE_SIZE; i++) {
+		addr_get(&addr, ADDR_GROUP_CACHE, i);
+		report_send(&addr, scan_rsp);
+		zassert_true(last_connectable, "Scan response %u not connectable", i);
+	}
+}
+
+ZTEST(bt_scan, test_name_filter)
+{
+	static const char * const names[] = {"Thingy", "Sensor 2", "Sensor", "Sensor 10"};
+	int err;
+
+	err = bt_scan_filter_enable(BT_SCAN_NAME_FILTER, false);
+	zassert_ok(err, "Failed to enable filter (err %d)", err);
+
+	for (size_t i = 0; i < ARRAY_SIZE(names); i++) {
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, names[i]);
+		zassert_ok(err, "Failed to add filter (err %d)", err);
+	}
+
+	zassert_true(name_matched(BT_DATA_NAME_COMPLETE, "Thingy"), "Name not matched");
+	zassert_equal(strcmp(last_match.name.name, "Thingy"), 0, "Wrong name matched");
+
+	/* The advertised name matches the filters it is a prefix of, and the
+	 * first added one is reported.
+	 */
+	zassert_true(name_matched(BT_DATA_NAME_COMPLETE, "Sensor"), "Name not matched");
+	zassert_equal(strcmp(last_match.name.name, "Sensor 2"), 0, "Wrong name matched");
+	zassert_equal(last_match.name.len, strlen("Sensor"), "Wrong length");
+
+	zassert_true(name_matched(BT_DATA_NAME_COMPLETE, "Sensor 1"), "Name not matched");
+	zassert_equal(strcmp(last_match.name.name, "Sensor 10"), 0, "Wrong name matched");
+
+	zassert_false(name_matched(BT_DATA_NAME_COMPLETE, "Sensor 3"), "Name matched");
+	zassert_false(name_matched(BT_DATA_NAME_COMPLETE, "Thingy 2"), "Name matched");
+	zassert_false(name_matched(BT_DATA_NAME_SHORTENED, "Thingy"), "Short name matched");
+
+	/* A shorter name in a reused filter slot must not keep the old tail. */
+	bt_scan_filter_remove_all();
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Thing");
+	zassert_ok(err, "Failed to add filter (err %d)", err);
+
+	zassert_true(name_matched(BT_DATA_NAME_COMPLETE, "Thing"), "Name not matched");
+	zassert_false(name_matched(BT_DATA_NAME_COMPLETE, "Thingy"), "Removed name matched");
+}
+
+ZTEST(bt_scan, test_short_name_filter)
+{
+	static const struct bt_scan_short_name names[] = {
+		{.name = "Periph", .min_len = 3},
+		{.name = "Per", .min_len = 2},
+		{.name = "Central", .min_len = 4},
+	};
+	int err;
+
+	err = bt_scan_filter_enable(BT_SCAN_SHORT_NAME_FILTER, false);
+	zassert_ok(err, "Failed to enable filter (err %d)", err);
+
+	for (size_t i = 0; i < ARRAY_SIZE(names); i++) {
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_SHORT_NAME, &names[i]);
+		zassert_ok(err, "Failed to add filter (err %d)", err);
+	}
+
+	zassert_true(name_matched(BT_DATA_NAME_SHORTENED, "Peri"), "Name not matched");
+	zassert_equal(strcmp(last_match.short_name.name, "Periph"), 0, "Wrong name matched");
+
+	/* Too short for the first filter. */
+	zassert_true(name_matched(BT_DATA_NAME_SHORTENED, "Pe"), "Name not matched");
+	zassert_equal(strcmp(last_match.short_name.name, "Per"), 0, "Wrong name matched");
+
+	zassert_true(name_matched(BT_DATA_NAME_SHORTENED, "Cent"), "Name not matched");
+	zassert_false(name_matched(BT_DATA_NAME_SHORTENED, "Cen"), "Too short name matched");
+	zassert_false(name_matched(BT_DATA_NAME_SHORTENED, "Peer"), "Name matched");
+}
+
+ZTEST(bt_scan, test_uuid_filter)
+{
+	const struct bt_uuid *uuids[] = {
+		BT_UUID_DECLARE_16(0x180d),
+		BT_UUID_DECLARE_16(0x180f),
+		BT_UUID_DECLARE_32(0x12345678),
+		BT_UUID_DECLARE_128(BT_UUID_128_ENCODE(0x6e400001, 0xb5a3, 0xf393, 0xe0a9,
+						       0xe50e24dcca9e)),
+		/* Environmental Sensing UUID 0x181a in the 128-bit form. */
+		BT_UUID_DECLARE_128(BT_UUID_128_ENCODE(0x0000181a, 0x0000, 0x1000, 0x8000,
+						       0x00805f9b34fb)),
+	};
+	static const uint8_t uuid16_list[] = {0x0f, 0x18, 0x0d, 0x18};
+	static const uint8_t uuid16_other[] = {0x00, 0x18, 0x01, 0x18};
+	static const uint8_t uuid16_cross[] = {0x1a, 0x18};
+	static const uint8_t uuid32[] = {0x78, 0x56, 0x34, 0x12};
+	static const uint8_t uuid128[] = {BT_UUID_128_ENCODE(0x6e400001, 0xb5a3, 0xf393, 0xe0a9,
+							     0xe50e24dcca9e)};
+	int err;
+
+	err = bt_scan_filter_enable(BT_SCAN_UUID_FILTER, false);
+	zassert_ok(err, "Failed to enable filter (err %d)", err);
+
+	for (size_t i = 0; i < ARRAY_SIZE(uuids); i++) {
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, uuids[i]);
+		zassert_ok(err, "Failed to add filter (err %d)", err);
+	}
+
+	/* The first matching filter is reported. */
+	zassert_true(element_matched(BT_DATA_UUID16_ALL, uuid16_list, sizeof(uuid16_list)),
+		     "UUID not matched");
+	zassert_equal(last_match.uuid.count, 1, "Wrong UUID count");
+	zassert_equal(bt_uuid_cmp(last_match.uuid.uuid[0], uuids[0]), 0, "Wrong UUID matched");
+
+	zassert_false(element_matched(BT_DATA_UUID16_ALL, uuid16_other, sizeof(uuid16_other)),
+		      "UUID matched");
+
+	zassert_true(element_matched(BT_DATA_UUID32_ALL, uuid32, sizeof(uuid32)),
+		     "UUID not matched");
+	zassert_equal(bt_uuid_cmp(last_match.uuid.uuid[0], uuids[2]), 0, "Wrong UUID matched");
+
+	zassert_true(element_matched(BT_DATA_UUID128_ALL, uuid128, sizeof(uuid128)),
+		     "UUID not matched");
+	zassert_equal(bt_uuid_cmp(last_match.uuid.uuid[0], uuids[3]), 0, "Wrong UUID matched");
+
+	/* UUIDs of different sizes compare as in bt_uuid_cmp(). */
+	zassert_true(element_matched(BT_DATA_UUID16_SOME, uuid16_cross, sizeof(uuid16_cross)),
+		     "UUID not matched");
+	zassert_equal(bt_uuid_cmp(last_match.uuid.uuid[0], uuids[4]), 0, "Wrong UUID matched");
+
+	/* In the multifilter mode, all UUIDs must be in the element. */
+	bt_scan_filter_remove_all();
+
+	err = bt_scan_filter_enable(BT_SCAN_UUID_FILTER, true);
+	zassert_ok(err, "Failed to enable filter (err %d)", err);
+
+	for (size_t i = 0; i < 2; i++) {
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, uuids[i]);
+		zassert_ok(err, "Failed to add filter (err %d)", err);
+	}
+
+	zassert_true(element_matched(BT_DATA_UUID16_ALL, uuid16_list, sizeof(uuid16_list)),
+		     "UUIDs not matched");
+	zassert_equal(last_match.uuid.count, 2, "Wrong UUID count");
+	zassert_equal(bt_uuid_cmp(last_match.uuid.uuid[0], uuids[0]), 0, "Wrong UUID order");
+	zassert_equal(bt_uuid_cmp(last_match.uuid.uuid[1], uuids[1]), 0, "Wrong UUID order");
+
+	zassert_false(element_matched(BT_DATA_UUID16_ALL, uuid16_list, 2), "UUIDs matched");
+}
+
+ZTEST(bt_scan, test_manufacturer_data_filter)
+{
+	uint8_t nordic_long[] = {0x59, 0x00, 0x01};
+	uint8_t nordic[] = {0x59, 0x00};
+	uint8_t beacon[] = {0x4c, 0x00, 0x02, 0x15};
+	const struct bt_scan_manufacturer_data filters[] = {
+		{.data = nordic_long, .data_len = sizeof(nordic_long)},
+		{.data = nordic, .data_len = sizeof(nordic)},
+		{.data = beacon, .data_len = sizeof(beacon)},
+	};
+	static const uint8_t adv_nordic_long[] = {0x59, 0x00, 0x01, 0x07};
+	static const uint8_t adv_nordic[] = {0x59, 0x00, 0x02};
+	static const uint8_t adv_beacon_short[] = {0x4c, 0x00, 0x02};
+	static const uint8_t adv_beacon[] = {0x4c, 0x00, 0x02, 0x15, 0xaa};
+	int err;
+
+	err = bt_scan_filter_enable(BT_SCAN_MANUFACTURER_DATA_FILTER, false);
+	zassert_ok(err, "Failed to enable filter (err %d)", err);
+
+	for (size_t i = 0; i < ARRAY_SIZE(filters); i++) {
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA, &filters[i]);
+		zassert_ok(err, "Failed to add filter (err %d)", err);
+	}
+
+	/* The filter data is a prefix of the advertised data, the first
+	 * added filter is reported.
+	 */
+	zassert_true(element_matched(BT_DATA_MANUFACTURER_DATA, adv_nordic_long,
+				     sizeof(adv_nordic_long)), "Data not matched");
+	zassert_equal(last_match.manufacturer_data.len, sizeof(nordic_long), "Wrong filter");
+
+	zassert_true(element_matched(BT_DATA_MANUFACTURER_DATA, adv_nordic, sizeof(adv_nordic)),
+		     "Data not matched");
+	zassert_equal(last_match.manufacturer_data.len, sizeof(nordic), "Wrong filter");
+
+	zassert_true(element_matched(BT_DATA_MANUFACTURER_DATA, adv_beacon, sizeof(adv_beacon)),
+		     "Data not matched");
+	zassert_mem_equal(last_match.manufacturer_data.data, beacon, sizeof(beacon),
+			  "Wrong filter");
+
+	zassert_false(element_matched(BT_DATA_MANUFACTURER_DATA, adv_beacon_short,
+				      sizeof(adv_beacon_short)), "Data matched");
+}
+
+static void *bt_scan_setup(void)
+{
+	bt_scan_init(NULL);
+	bt_scan_cb_register(&scan_cb);
+
+	return NULL;
+}
+
+static void bt_scan_before(void *fixture)
+{
+	bt_scan_filter_disable();
+	bt_scan_filter_remove_all();
+	bt_scan_blocklist_clear();
+	bt_scan_conn_attempts_filter_clear();
+
+	match_cnt = 0;
+	no_match_cnt = 0;
+	last_connectable = false;
+	last_match_addr = NULL;
+}
+
+ZTEST_SUITE(bt_scan, NULL, bt_scan_setup, bt_scan_before, NULL, NULL);
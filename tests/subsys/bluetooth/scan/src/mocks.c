@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+
+#include "mocks.h"
+
+struct bt_le_scan_cb *mock_scan_cb;
+struct bt_conn_cb *mock_conn_cb;
+
+int bt_le_scan_cb_register(struct bt_le_scan_cb *cb)
+{
+	mock_scan_cb = cb;
+	return 0;
+}
+
+int bt_conn_cb_register(struct bt_conn_cb *cb)
+{
+	mock_conn_cb = cb;
+	return 0;
+}
+
+const bt_addr_le_t *bt_conn_get_dst(const struct bt_conn *conn)
+{
+	/* The tests pass the peer address as the connection object. */
+	return (const bt_addr_le_t *)conn;
+}
+
+int bt_le_scan_start(const struct bt_le_scan_param *param, bt_le_scan_cb_t cb)
+{
+	return 0;
+}
+
+int bt_le_scan_stop(void)
+{
+	return 0;
+}
+
+void bt_data_parse(struct net_buf_simple *ad,
+		   bool (*func)(struct bt_data *data, void *user_data),
+		   void *user_data)
+{
+	while (ad->len > 1) {
+		struct bt_data data;
+		uint8_t len = net_buf_simple_pull_u8(ad);
+
+		if ((len == 0) || (len > ad->len)) {
+			return;
+		}
+
+		data.type = net_buf_simple_pull_u8(ad);
+		data.data_len = len - 1;
+		data.data = ad->data;
+
+		if (!func(&data, user_data)) {
+			return;
+		}
+
+		net_buf_simple_pull(ad, len - 1);
+	}
+}
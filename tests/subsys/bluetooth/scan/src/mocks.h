@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef MOCKS_H_
+#define MOCKS_H_
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+
+/* Scan callback registered by the scan library. */
+extern struct bt_le_scan_cb *mock_scan_cb;
+
+/* Connection callbacks registered by the scan library. */
+extern struct bt_conn_cb *mock_conn_cb;
+
+/* Connection object whose destination is the given address. */
+static inline struct bt_conn *mock_conn_get(const bt_addr_le_t *addr)
+{
+	return (struct bt_conn *)addr;
+}
+
+#endif /* MOCKS_H_ */
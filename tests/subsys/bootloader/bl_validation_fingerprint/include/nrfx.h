@@ -0,0 +1,12 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Stub of nrfx, which is not available on native_sim. Included by bl_storage.h. */
+
+#ifndef NRFX_H__
+#define NRFX_H__
+
+#endif /* NRFX_H__ */
@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Stub of the RRAMC driver, which selects the word-sized storage types in bl_storage.h.
+ * The storage functions are provided by src/fake_bl_crypto.c.
+ */
+
+#ifndef NRFX_RRAMC_H__
+#define NRFX_RRAMC_H__
+
+#endif /* NRFX_RRAMC_H__ */
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Software SHA-256 stand-in for the bootloader crypto backends, which are not
+ * available on native_sim, and fakes of the monotonic counter, the lifecycle
+ * state and fprotect.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <bl_crypto.h>
+#include <bl_storage.h>
+#include <fprotect.h>
+#include <nrf_lcs/nrf_lcs.h>
+
+#include "fake_bl_crypto.h"
+
+#define SHA256_BLOCK_LEN 64
+
+struct sha256_state {
+	uint32_t h[8];
+	uint64_t len;
+	uint8_t block[SHA256_BLOCK_LEN];
+	size_t block_len;
+	bool finalized;
+};
+
+BUILD_ASSERT(sizeof(struct sha256_state) <= sizeof(bl_sha256_ctx_t),
+	     "SHA-256 state does not fit in bl_sha256_ctx_t");
+
+static const uint32_t k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+	0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+	0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+	0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+	0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+	0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+	0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+	0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+	0xc67178f2,
+};
+
+static size_t hashed_bytes;
+static uint32_t housekeeping_calls;
+static uint32_t monotonic_counter;
+static enum nrf_lcs lcs = NRF_LCS_SECURED;
+
+static struct {
+	int err;
+	bool called;
+	uint32_t start;
+	size_t length;
+} fprotect;
+
+static uint32_t ror(uint32_t x, unsigned int n)
+{
+	return (x >> n) | (x << (32 - n));
+}
+
+static void sha256_block(struct sha256_state *s, const uint8_t *data)
+{
+	uint32_t w[64];
+	uint32_t v[8];
+
+	for (size_t i = 0; i < 16; i++) {
+		w[i] = sys_get_be32(&data[i * 4]);
+	}
+	for (size_t i = 16; i < 64; i++) {
+		uint32_t s0 = ror(w[i - 15], 7) ^ ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+		uint32_t s1 = ror(w[i - 2], 17) ^ ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+
+		w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+	}
+
+	memcpy(v, s->h, sizeof(v));
+	for (size_t i = 0; i < 64; i++) {
+		uint32_t s1 = ror(v[4], 6) ^ ror(v[4], 11) ^ ror(v[4], 25);
+		uint32_t ch = (v[4] & v[5]) ^ (~v[4] & v[6]);
+		uint32_t t1 = v[7] + s1 + ch + k[i] + w[i];
+		uint32_t s0 = ror(v[0], 2) ^ ror(v[0], 13) ^ ror(v[0], 22);
+		uint32_t maj = (v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]);
+
+		memmove(&v[1], &v[0], 7 * sizeof(v[0]));
+		v[4] += t1;
+		v[0] = t1 + s0 + maj;
+	}
+
+	for (size_t i = 0; i < 8; i++) {
+		s->h[i] += v[i];
+	}
+}
+
+static void sha256_init(struct sha256_state *s)
+{
+	static const uint32_t h0[8] = {
+		0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+		0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+	};
+
+	memset(s, 0, sizeof(*s));
+	memcpy(s->h, h0, sizeof(h0));
+}
+
+static void sha256_update(struct sha256_state *s, const uint8_t *data, size_t len)
+{
+	s->len += len;
+	while (len > 0) {
+		size_t n = MIN(len, SHA256_BLOCK_LEN - s->block_len);
+
+		memcpy(&s->block[s->block_len], data, n);
+		s->block_len += n;
+		data += n;
+		len -= n;
+		if (s->block_len == SHA256_BLOCK_LEN) {
+			sha256_block(s, s->block);
+			s->block_len = 0;
+		}
+	}
+}
+
+static void sha256_finalize(struct sha256_state *s, uint8_t *digest)
+{
+	uint64_t bits = s->len * 8;
+	uint8_t pad = 0x80;
+	uint8_t len_be[8];
+
+	sha256_update(s, &pad, 1);
+	pad = 0;
+	while (s->block_len != SHA256_BLOCK_LEN - sizeof(len_be)) {
+		sha256_update(s, &pad, 1);
+	}
+	sys_put_be64(bits, len_be);
+	sha256_update(s, len_be, sizeof(len_be));
+
+	for (size_t i = 0; i < 8; i++) {
+		sys_put_be32(s->h[i], &digest[i * 4]);
+	}
+	s->finalized = true;
+}
+
+void fake_sha256(const uint8_t *data, size_t len, uint8_t *digest)
+{
+	struct sha256_state s;
+
+	sha256_init(&s);
+	sha256_update(&s, data, len);
+	sha256_finalize(&s, digest);
+}
+
+size_t fake_bl_sha256_bytes(void)
+{
+	return hashed_bytes;
+}
+
+void fake_bl_crypto_reset(void)
+{
+	hashed_bytes = 0;
+	housekeeping_calls = 0;
+	memset(&fprotect, 0, sizeof(fprotect));
+}
+
+void fake_monotonic_counter_set(uint32_t value)
+{
+	monotonic_counter = value;
+}
+
+void fake_lcs_set(enum nrf_lcs value)
+{
+	lcs = value;
+}
+
+void fake_fprotect_set_error(int err)
+{
+	fprotect.err = err;
+}
+
+bool fake_fprotect_area_get(uint32_t *start, size_t *length)
+{
+	*start = fprotect.start;
+	*length = fprotect.length;
+	return fprotect.called;
+}
+
+uint32_t fake_bl_housekeeping_calls(void)
+{
+	return housekeeping_calls;
+}
+
+int bl_crypto_init(void)
+{
+	return 0;
+}
+
+int bl_sha256_init(bl_sha256_ctx_t *ctx)
+{
+	if (ctx == NULL) {
+		return -EINVAL;
+	}
+
+	sha256_init((struct sha256_state *)ctx);
+	return 0;
+}
+
+int bl_sha256_update(bl_sha256_ctx_t *ctx, const uint8_t *data, uint32_t data_len)
+{
+	struct sha256_state *s = (struct sha256_state *)ctx;
+
+	if (ctx == NULL) {
+		return -EINVAL;
+	}
+	if (s->finalized) {
+		return -ENOSYS;
+	}
+
+	hashed_bytes += data_len;
+	sha256_update(s, data, data_len);
+	return 0;
+}
+
+int bl_sha256_finalize(bl_sha256_ctx_t *ctx, uint8_t *output)
+{
+	if (ctx == NULL || output == NULL) {
+		return -EINVAL;
+	}
+
+	sha256_finalize((struct sha256_state *)ctx, output);
+	return 0;
+}
+
+int bl_sha256_verify(const uint8_t *data, uint32_t data_len, const uint8_t *expected)
+{
+	bl_sha256_ctx_t ctx;
+	uint8_t digest[SHA256_DIGEST_LEN];
+	int err;
+
+	err = bl_sha256_init(&ctx);
+	if (err) {
+		return err;
+	}
+
+	err = bl_sha256_update(&ctx, data, data_len);
+	if (err) {
+		return err;
+	}
+
+	err = bl_sha256_finalize(&ctx, digest);
+	if (err) {
+		return err;
+	}
+
+	return memcmp(digest, expected, sizeof(digest)) ? -EHASHINV : 0;
+}
+
+void bl_root_of_trust_housekeeping(void)
+{
+	housekeeping_calls++;
+}
+
+int num_monotonic_counter_slots(uint16_t counter_desc, uint16_t *counter_slots)
+{
+	if (counter_desc != BL_MONOTONIC_COUNTERS_DESC_NSIB) {
+		return -EINVAL;
+	}
+
+	*counter_slots = 1;
+	return 0;
+}
+
+int get_monotonic_counter(uint16_t counter_desc, counter_t *counter_value)
+{
+	if (counter_desc != BL_MONOTONIC_COUNTERS_DESC_NSIB) {
+		return -EINVAL;
+	}
+
+	*counter_value = monotonic_counter;
+	return 0;
+}
+
+int set_monotonic_counter(uint16_t counter_desc, counter_t new_counter)
+{
+	if (counter_desc != BL_MONOTONIC_COUNTERS_DESC_NSIB) {
+		return -EINVAL;
+	}
+
+	monotonic_counter = new_counter;
+	return 0;
+}
+
+enum nrf_lcs nrf_lcs_get(void)
+{
+	return lcs;
+}
+
+int fprotect_area(uint32_t start, size_t length)
+{
+	fprotect.called = true;
+	fprotect.start = start;
+	fprotect.length = length;
+	return fprotect.err;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FAKE_BL_CRYPTO_H_
+#define FAKE_BL_CRYPTO_H_
+
+#include <zephyr/types.h>
+#include <nrf_lcs/nrf_lcs.h>
+
+#define SHA256_DIGEST_LEN 32
+
+/* One-shot SHA-256 of a RAM buffer, using the same software implementation. */
+void fake_sha256(const uint8_t *data, size_t len, uint8_t *digest);
+
+/* Number of bytes passed to bl_sha256_update() since the last reset. */
+size_t fake_bl_sha256_bytes(void);
+
+void fake_bl_crypto_reset(void);
+
+/* Value returned by the fake monotonic counter. */
+void fake_monotonic_counter_set(uint32_t value);
+
+/* Value returned by nrf_lcs_get(). */
+void fake_lcs_set(enum nrf_lcs value);
+
+/* Error returned by fprotect_area(), and the last area passed to it. */
+void fake_fprotect_set_error(int err);
+bool fake_fprotect_area_get(uint32_t *start, size_t *length);
+
+/* Number of bl_root_of_trust_housekeeping() calls since the last reset. */
+uint32_t fake_bl_housekeeping_calls(void);
+
+#endif /* FAKE_BL_CRYPTO_H_ */
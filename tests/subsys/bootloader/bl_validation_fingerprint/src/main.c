@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <limits.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/ztest.h>
+#include <fw_info.h>
+#include <bl_validation.h>
+#include <nrf_lcs/nrf_lcs.h>
+
+#include "bl_validation_fingerprint.h"
+#include "bl_validation_stream.h"
+#include "fake_bl_crypto.h"
+
+#define IMAGE_SIZE	   0x10000
+#define VAL_INFO_SIZE	   96
+#define RECORD_SIZE	   48
+#define IMAGE_PARTITION	   slot0_partition
+#define IMAGE_ADDRESS                                                                              \
+	(CONFIG_FLASH_BASE_ADDRESS + FIXED_PARTITION_OFFSET(IMAGE_PARTITION))
+#define FINGERPRINT_SIZE   FIXED_PARTITION_SIZE(sb_fingerprint_partition)
+#define FW_SIZE		   0x4000
+#define FW_INFO_AT	   FW_INFO_OFFSET1
+
+BUILD_ASSERT(FIXED_PARTITION_SIZE(IMAGE_PARTITION) >= IMAGE_SIZE, "Image partition too small");
+BUILD_ASSERT(sizeof(void *) == sizeof(uint32_t), "The validation needs 32-bit addresses");
+
+/* Metadata of a simulated firmware, as found in flash by the bootloader */
+struct test_fw {
+	struct fw_info *info;
+	uint8_t val_info[VAL_INFO_SIZE];
+};
+
+static struct fw_info info_a;
+static struct fw_info info_b;
+static struct test_fw fw_a = {.info = &info_a};
+static struct test_fw fw_b = {.info = &info_b};
+static uint8_t image[IMAGE_SIZE];
+
+/* Validation info as defined in bl_validation.c, with a hash and without a public key */
+struct __packed test_val_info {
+	uint32_t magic[MAGIC_LEN_WORDS];
+	uint32_t address;
+	uint8_t hash[CONFIG_SB_HASH_LEN];
+	uint8_t signature[CONFIG_SB_SIGNATURE_LEN];
+};
+
+/* Firmware validated by bl_validation.c, which reads it through its address.
+ * It is kept in RAM, as the simulated flash is not memory mapped.
+ */
+static struct {
+	uint8_t code[FW_SIZE];
+	struct test_val_info val_info;
+} fw_image __aligned(4);
+
+static K_THREAD_STACK_DEFINE(housekeeping_stack, 2048);
+static struct k_thread housekeeping_thread;
+static volatile bool housekeeping_returned;
+static volatile unsigned int fatal_reason;
+
+static void test_fw_init(struct test_fw *fw, uint32_t address, uint32_t version)
+{
+	memset(fw->info, 0, sizeof(*fw->info));
+	fw->info->address = address;
+	fw->info->boot_address = address;
+	fw->info->size = IMAGE_SIZE;
+	fw->info->total_size = sizeof(*fw->info);
+	fw->info->version = version;
+	fw->info->valid = CONFIG_FW_INFO_VALID_VAL;
+	sys_rand_get(fw->val_info, sizeof(fw->val_info));
+}
+
+static bool check(const struct test_fw *fw)
+{
+	return bl_validation_fingerprint_check(fw->info, fw->val_info, sizeof(fw->val_info));
+}
+
+static void store(const struct test_fw *fw)
+{
+	int err = bl_validation_fingerprint_store(fw->info, fw->val_info, sizeof(fw->val_info));
+
+	zassert_equal(err, 0, "Storing fingerprint failed: %d", err);
+}
+
+/* Full validation of the simulated firmware, as done without a fingerprint */
+static void full_validation(const struct test_fw *fw)
+{
+	uint8_t hash[SHA256_DIGEST_LEN];
+	uint8_t expected[SHA256_DIGEST_LEN];
+	int err;
+
+	err = bl_validation_hash_stream(IMAGE_ADDRESS, fw->info->size, hash);
+	zassert_equal(err, 0, "Streaming hash failed: %d", err);
+
+	fake_sha256(image, fw->info->size, expected);
+	zassert_mem_equal(hash, expected, sizeof(hash));
+}
+
+static uint32_t fw_image_address(void)
+{
+	return (uint32_t)fw_image.code;
+}
+
+static struct fw_info *fw_image_info(void)
+{
+	return (struct fw_info *)&fw_image.code[FW_INFO_AT];
+}
+
+static void fw_image_init(void)
+{
+	const uint32_t info_magic[] = {FIRMWARE_INFO_MAGIC};
+	const uint32_t val_info_magic[] = {VALIDATION_INFO_MAGIC};
+	const uint32_t address = fw_image_address();
+	struct fw_info *info = fw_image_info();
+	uint32_t *vectors = (uint32_t *)fw_image.code;
+
+	sys_rand_get(&fw_image, sizeof(fw_image));
+
+	/* The reset handler follows the firmware info */
+	vectors[1] = address + FW_INFO_AT + sizeof(*info);
+
+	memset(info, 0, sizeof(*info));
+	memcpy(info->magic, info_magic, sizeof(info_magic));
+	info->total_size = sizeof(*info);
+	info->size = FW_SIZE;
+	info->version = 1;
+	info->address = address;
+	info->boot_address = address;
+	info->valid = CONFIG_FW_INFO_VALID_VAL;
+
+	memcpy(fw_image.val_info.magic, val_info_magic, sizeof(val_info_magic));
+	fw_image.val_info.address = address;
+	fake_sha256(fw_image.code, FW_SIZE, fw_image.val_info.hash);
+}
+
+static bool validate_local(void)
+{
+	return bl_validate_firmware_local(fw_image_address(), fw_image_info());
+}
+
+static bool validate_external(void)
+{
+	return bl_validate_firmware(fw_image_address(), fw_image_address());
+}
+
+static bool fw_image_fingerprint_stored(void)
+{
+	return bl_validation_fingerprint_check(fw_image_info(), &fw_image.val_info,
+					       sizeof(fw_image.val_info));
+}
+
+/* Whether the whole firmware was hashed since the last reset of the fake */
+static bool full_hash_done(void)
+{
+	return fake_bl_sha256_bytes() >= FW_SIZE;
+}
+
+void ztest_post_fatal_error_hook(unsigned int reason, const struct arch_esf *esf)
+{
+	ARG_UNUSED(esf);
+
+	fatal_reason = reason;
+}
+
+static void housekeeping_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	ztest_set_fault_valid(true);
+	bl_validate_housekeeping();
+	ztest_set_fault_valid(false);
+	housekeeping_returned = true;
+}
+
+/* Runs the housekeeping in its own thread, which is aborted if it panics */
+static void run_housekeeping(void)
+{
+	housekeeping_returned = false;
+	fatal_reason = UINT_MAX;
+
+	k_thread_create(&housekeeping_thread, housekeeping_stack,
+			K_THREAD_STACK_SIZEOF(housekeeping_stack), housekeeping_entry, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_thread_join(&housekeeping_thread, K_FOREVER);
+}
+
+static void *fingerprint_setup(void)
+{
+	const struct flash_area *fa;
+
+	sys_rand_get(image, sizeof(image));
+
+	zassert_ok(flash_area_open(FIXED_PARTITION_ID(IMAGE_PARTITION), &fa));
+	zassert_ok(flash_area_erase(fa, 0, fa->fa_size));
+	zassert_ok(flash_area_write(fa, 0, image, sizeof(image)));
+	flash_area_close(fa);
+
+	return NULL;
+}
+
+static void fingerprint_before(void *fixture)
+{
+	const struct flash_area *fa;
+
+	ARG_UNUSED(fixture);
+
+	zassert_ok(flash_area_open(FIXED_PARTITION_ID(sb_fingerprint_partition), &fa));
+	zassert_ok(flash_area_erase(fa, 0, fa->fa_size));
+	flash_area_close(fa);
+
+	test_fw_init(&fw_a, IMAGE_ADDRESS, 1);
+	test_fw_init(&fw_b, IMAGE_ADDRESS, 2);
+	fw_image_init();
+	fake_monotonic_counter_set(0);
+	fake_lcs_set(NRF_LCS_SECURED);
+	fake_fprotect_set_error(0);
+	fake_bl_crypto_reset();
+}
+
+ZTEST(bl_validation_fingerprint, test_hash_stream)
+{
+	/* Sizes around and across the chunk size */
+	static const uint32_t sizes[] = {
+		0,
+		1,
+		CONFIG_SB_VALIDATION_HASH_CHUNK_SIZE - 1,
+		CONFIG_SB_VALIDATION_HASH_CHUNK_SIZE,
+		CONFIG_SB_VALIDATION_HASH_CHUNK_SIZE + 1,
+		3 * CONFIG_SB_VALIDATION_HASH_CHUNK_SIZE + 13,
+		IMAGE_SIZE,
+	};
+	uint8_t hash[SHA256_DIGEST_LEN];
+	uint8_t expected[SHA256_DIGEST_LEN];
+
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		zassert_ok(bl_validation_hash_stream(IMAGE_ADDRESS, sizes[i], hash));
+		fake_sha256(image, sizes[i], expected);
+		zassert_mem_equal(hash, expected, sizeof(hash), "Wrong hash of %u bytes",
+				  sizes[i]);
+	}
+}
+
+ZTEST(bl_validation_fingerprint, test_first_boot)
+{
+	zassert_false(check(&fw_a), "Fingerprint found in erased partition");
+
+	full_validation(&fw_a);
+	store(&fw_a);
+
+	zassert_true(check(&fw_a), "Stored fingerprint doesn't match");
+}
+
+ZTEST(bl_validation_fingerprint, test_metadata_change)
+{
+	store(&fw_a);
+	zassert_true(check(&fw_a));
+
+	fw_a.info->version++;
+	zassert_false(check(&fw_a), "Version change not detected");
+	fw_a.info->version--;
+
+	fw_a.info->valid = CONFIG_FW_INFO_VALID_VAL - 1;
+	zassert_false(check(&fw_a), "Invalidation not detected");
+	fw_a.info->valid = CONFIG_FW_INFO_VALID_VAL;
+
+	fw_a.info->size -= 4;
+	zassert_false(check(&fw_a), "Size change not detected");
+	fw_a.info->size += 4;
+
+	fw_a.info->address += 0x1000;
+	zassert_false(check(&fw_a), "Address change not detected");
+	fw_a.info->address -= 0x1000;
+
+	fw_a.val_info[VAL_INFO_SIZE - 1] ^= 0x01;
+	zassert_false(check(&fw_a), "Signature change not detected");
+	fw_a.val_info[VAL_INFO_SIZE - 1] ^= 0x01;
+
+	zassert_true(check(&fw_a), "Restored firmware doesn't match");
+}
+
+ZTEST(bl_validation_fingerprint, test_monotonic_counter)
+{
+	store(&fw_a);
+
+	fake_monotonic_counter_set(3);
+	zassert_false(check(&fw_a), "Counter change not detected");
+
+	store(&fw_a);
+	zassert_true(check(&fw_a));
+}
+
+ZTEST(bl_validation_fingerprint, test_last_record_only)
+{
+	store(&fw_a);
+	store(&fw_b);
+
+	zassert_false(check(&fw_a), "Older fingerprint used");
+	zassert_true(check(&fw_b));
+
+	store(&fw_a);
+	zassert_true(check(&fw_a));
+	zassert_false(check(&fw_b), "Older fingerprint used");
+}
+
+ZTEST(bl_validation_fingerprint, test_log_wrap)
+{
+	const size_t records = FINGERPRINT_SIZE / RECORD_SIZE;
+
+	/* Fill the log and wrap around a few records */
+	for (size_t i = 0; i < records + 5; i++) {
+		store((i % 2) ? &fw_b : &fw_a);
+	}
+
+	zassert_true(check(((records + 4) % 2) ? &fw_b : &fw_a), "Last fingerprint not found");
+	zassert_false(check(((records + 4) % 2) ? &fw_a : &fw_b), "Older fingerprint used");
+}
+
+ZTEST(bl_validation_fingerprint, test_interrupted_record)
+{
+	const struct flash_area *fa;
+	uint8_t partial[RECORD_SIZE - 16];
+
+	store(&fw_a);
+
+	/* A record interrupted before its magic word was written */
+	memset(partial, 0x5a, sizeof(partial));
+	zassert_ok(flash_area_open(FIXED_PARTITION_ID(sb_fingerprint_partition), &fa));
+	zassert_ok(flash_area_write(fa, RECORD_SIZE, partial, sizeof(partial)));
+	flash_area_close(fa);
+
+	zassert_true(check(&fw_a), "Interrupted record hides the last fingerprint");
+
+	store(&fw_b);
+	zassert_true(check(&fw_b), "Fingerprint after interrupted record not found");
+}
+
+ZTEST(bl_validation_fingerprint, test_boot_cost)
+{
+	size_t full_bytes;
+	size_t fingerprint_bytes;
+
+	/* First boot: no fingerprint, the whole image is hashed */
+	zassert_false(check(&fw_a));
+	full_validation(&fw_a);
+	store(&fw_a);
+	full_bytes = fake_bl_sha256_bytes();
+
+	/* Following boots only hash the metadata */
+	fake_bl_crypto_reset();
+	zassert_true(check(&fw_a));
+	fingerprint_bytes = fake_bl_sha256_bytes();
+
+	TC_PRINT("Bytes hashed per boot: %zu without, %zu with a matching fingerprint\n",
+		 full_bytes, fingerprint_bytes);
+
+	zassert_equal(fingerprint_bytes, offsetof(struct fw_info, ext_apis) + VAL_INFO_SIZE);
+	zassert_true(fingerprint_bytes * 100 < full_bytes, "Fingerprint check too expensive");
+}
+
+ZTEST(bl_validation_fingerprint, test_validate_local)
+{
+	/* First boot: the fingerprint is stored after the full validation */
+	zassert_true(validate_local(), "Firmware not valid");
+	zassert_true(full_hash_done(), "Firmware not hashed without a fingerprint");
+	zassert_true(fw_image_fingerprint_stored(), "Fingerprint not stored");
+
+	/* Following boots use the fingerprint */
+	fake_bl_crypto_reset();
+	zassert_true(validate_local(), "Firmware not valid");
+	zassert_false(full_hash_done(), "Firmware hashed despite a matching fingerprint");
+}
+
+ZTEST(bl_validation_fingerprint, test_validate_invalid_not_stored)
+{
+	fw_image.code[FW_SIZE - 1] ^= 0x01;
+
+	zassert_false(validate_local(), "Modified firmware accepted");
+	zassert_true(full_hash_done(), "Firmware not hashed");
+	zassert_false(fw_image_fingerprint_stored(), "Fingerprint of invalid firmware stored");
+
+	/* The rejected firmware must not be accepted on the next boot either */
+	fake_bl_crypto_reset();
+	zassert_false(validate_local(), "Modified firmware accepted");
+	zassert_true(full_hash_done(), "Firmware not hashed");
+}
+
+ZTEST(bl_validation_fingerprint, test_validate_val_info_change)
+{
+	zassert_true(validate_local());
+	zassert_true(fw_image_fingerprint_stored());
+
+	/* A new signature of the same firmware */
+	fw_image.val_info.signature[0] ^= 0x01;
+
+	fake_bl_crypto_reset();
+	zassert_true(validate_local(), "Firmware not valid");
+	zassert_true(full_hash_done(), "Validation info change not detected");
+	zassert_true(fw_image_fingerprint_stored(), "Fingerprint not updated");
+
+	/* A hash that doesn't match the firmware */
+	fw_image.val_info.hash[0] ^= 0x01;
+
+	fake_bl_crypto_reset();
+	zassert_false(validate_local(), "Wrong hash accepted");
+	zassert_true(full_hash_done(), "Validation info change not detected");
+}
+
+ZTEST(bl_validation_fingerprint, test_validate_external)
+{
+	zassert_true(validate_local());
+	zassert_true(fw_image_fingerprint_stored());
+
+	/* External callers always hash the whole firmware */
+	fake_bl_crypto_reset();
+	zassert_true(validate_external(), "Firmware not valid");
+	zassert_true(full_hash_done(), "Fingerprint used for an external validation");
+
+	/* A modified firmware is rejected even though the fingerprint matches */
+	fw_image.code[FW_SIZE - 1] ^= 0x01;
+	zassert_true(fw_image_fingerprint_stored());
+	zassert_false(validate_external(), "Modified firmware accepted");
+}
+
+ZTEST(bl_validation_fingerprint, test_validate_external_not_stored)
+{
+	zassert_true(validate_external(), "Firmware not valid");
+	zassert_false(fw_image_fingerprint_stored(),
+		      "Fingerprint stored by an external validation");
+}
+
+ZTEST(bl_validation_fingerprint, test_validate_assembly_and_test)
+{
+	zassert_true(validate_local());
+	zassert_true(fw_image_fingerprint_stored());
+
+	/* The fingerprint is neither used nor stored in ASSEMBLY_AND_TEST */
+	fake_lcs_set(NRF_LCS_ASSEMBLY_AND_TEST);
+	fw_image.val_info.signature[0] ^= 0x01;
+
+	fake_bl_crypto_reset();
+	zassert_true(validate_local(), "Firmware not valid");
+	zassert_true(full_hash_done(), "Fingerprint used in ASSEMBLY_AND_TEST");
+	zassert_false(fw_image_fingerprint_stored(), "Fingerprint stored in ASSEMBLY_AND_TEST");
+
+	fw_image.val_info.signature[0] ^= 0x01;
+	fw_image.code[FW_SIZE - 1] ^= 0x01;
+	zassert_true(fw_image_fingerprint_stored());
+	zassert_false(validate_local(), "Fingerprint used in ASSEMBLY_AND_TEST");
+}
+
+ZTEST(bl_validation_fingerprint, test_housekeeping)
+{
+	uint32_t start;
+	size_t length;
+
+	run_housekeeping();
+
+	zassert_true(housekeeping_returned, "Housekeeping didn't return");
+	zassert_equal(fake_bl_housekeeping_calls(), 1);
+	zassert_true(fake_fprotect_area_get(&start, &length), "Fingerprint not protected");
+	zassert_equal(start, FIXED_PARTITION_OFFSET(sb_fingerprint_partition));
+	zassert_equal(length, FINGERPRINT_SIZE);
+}
+
+ZTEST(bl_validation_fingerprint, test_housekeeping_lock_failure)
+{
+	fake_fprotect_set_error(-EIO);
+
+	run_housekeeping();
+
+	zassert_false(housekeeping_returned, "Boot continued with a writable fingerprint");
+	zassert_equal(fatal_reason, K_ERR_KERNEL_PANIC, "No panic: %u", fatal_reason);
+}
+
+ZTEST_SUITE(bl_validation_fingerprint, NULL, fingerprint_setup, fingerprint_before, NULL, NULL);
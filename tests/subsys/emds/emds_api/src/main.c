@@ -52,6 +52,7 @@ static struct emds_dynamic_entry d_entries[3] = {
 	{{0x1002, &d_data[1][0], 10}},
 	{{0x1003, &d_data[2][0], 10}},
 };
+static struct emds_dynamic_entry reserved_entry = {{EMDS_DELTA_HEADER_ID, &d_data[0][0], 10}};
 
 static const uint8_t expect_s_data[3][1024] = {
 	{[0 ... 1023] = 0xAA},
@@ -62,6 +63,14 @@ static uint8_t s_data[1024];
 
 EMDS_STATIC_ENTRY_DEFINE(s_entry, 0x100, s_data, sizeof(s_data));
 
+/* Data that does not change after the first store. With incremental snapshots, it is stored only
+ * in full snapshots.
+ */
+static const uint8_t expect_t_data[256] = {[0 ... 255] = 0x5A};
+static uint8_t t_data[256];
+
+EMDS_STATIC_TRACKED_ENTRY_DEFINE(t_entry, 0x101, t_data, sizeof(t_data));
+
 static char *print_state(enum test_states s)
 {
 	switch (s) {
@@ -112,7 +121,8 @@ static void init(void)
 static void add_d_entries(void)
 {
 	int err;
-	uint32_t store_expected = sizeof(s_data) + sizeof(struct emds_data_entry);
+	uint32_t store_expected = sizeof(s_data) + sizeof(t_data) +
+				  2 * sizeof(struct emds_data_entry);
 	uint32_t store_used;
 
 	for (int i = 0; i < ARRAY_SIZE(d_entries); i++) {
@@ -124,6 +134,9 @@ static void add_d_entries(void)
 		zassert_equal(err, -EINVAL, "Entry duplicated");
 	}
 
+	err = emds_entry_add(&reserved_entry);
+	zassert_equal(err, -EINVAL, "Entry with reserved ID added");
+
 	err = emds_store_size_get(&store_used);
 	zassert_equal(err, 0, "Getting store size failed");
 
@@ -135,9 +148,11 @@ static void load_empty_flash(void)
 {
 	uint8_t test_d_data[sizeof(d_data)] = { 0xAC };
 	uint8_t test_s_data[sizeof(s_data)] = { 0xAC };
+	uint8_t test_t_data[sizeof(t_data)] = { 0xAC };
 
 	memcpy(d_data, test_d_data, sizeof(d_data));
 	memcpy(s_data, test_s_data, sizeof(s_data));
+	memcpy(t_data, test_t_data, sizeof(t_data));
 
 	zassert_equal(emds_load(), -ENOENT, "Load failed");
 
@@ -145,12 +160,15 @@ static void load_empty_flash(void)
 			  "Data has changed");
 	zassert_mem_equal(s_data, test_s_data, sizeof(s_data),
 			  "Data has changed");
+	zassert_mem_equal(t_data, test_t_data, sizeof(t_data),
+			  "Data has changed");
 }
 
 static void load_flash(int idx)
 {
 	memset(d_data, 0, sizeof(d_data));
 	memset(s_data, 0, sizeof(s_data));
+	memset(t_data, 0, sizeof(t_data));
 
 	zassert_equal(emds_load(), 0, "Load failed");
 
@@ -158,6 +176,8 @@ static void load_flash(int idx)
 			  "Data has changed");
 	zassert_mem_equal(s_data, &expect_s_data[idx][0], sizeof(s_data),
 			  "Data has changed");
+	zassert_mem_equal(t_data, expect_t_data, sizeof(t_data),
+			  "Data has changed");
 }
 
 static void prepare(void)
@@ -171,13 +191,25 @@ static void prepare(void)
 	zassert_true(emds_is_ready(), "EMDS should be ready");
 }
 
-static void store(int idx)
+/* If delta_expected is set, the store must be an incremental snapshot when
+ * CONFIG_EMDS_INCREMENTAL is enabled.
+ */
+static void store(int idx, bool delta_expected)
 {
+	uint32_t next_store_time_us = 0;
+
 	zassert_true(emds_is_ready(), "Store should be ready to execute");
 
 	memcpy(d_data, &expect_d_data[idx][0][0], sizeof(d_data));
 	memcpy(s_data, &expect_s_data[idx][0], sizeof(s_data));
 
+	if (memcmp(t_data, expect_t_data, sizeof(t_data))) {
+		memcpy(t_data, expect_t_data, sizeof(t_data));
+		emds_entry_dirty_set(&emds_t_entry);
+	}
+
+	zassert_equal(emds_store_time_get(&next_store_time_us), 0, "Getting store time failed");
+
 #if defined(CONFIG_BT) && !defined(CONFIG_BT_LL_SW_SPLIT)
 	/* Disable bluetooth and mpsl scheduler if bluetooth is enabled. */
 	(void) sdc_disable(); // Replace with bt_disable when added.
@@ -198,10 +230,20 @@ static void store(int idx)
 
 	zassert_equal(emds_store_time_get(&estimate_store_time_us), 0, "Getting store time failed");
 
-	printf("Store time: Actual %dus, Worst case:  %dus\n",
-	       store_time_us, estimate_store_time_us);
+	printf("Store time: Actual %dus, Estimate: %dus, Worst case:  %dus\n",
+	       store_time_us, next_store_time_us, estimate_store_time_us);
+
+	zassert_true((store_time_us < next_store_time_us), "Store takes to long time");
+	zassert_true((next_store_time_us <= estimate_store_time_us),
+		     "Estimate exceeds the worst case");
 
-	zassert_true((store_time_us < estimate_store_time_us), "Store takes to long time");
+	if (IS_ENABLED(CONFIG_EMDS_INCREMENTAL) && delta_expected) {
+		zassert_true((next_store_time_us < estimate_store_time_us),
+			     "Incremental snapshot not used");
+	} else if (!IS_ENABLED(CONFIG_EMDS_INCREMENTAL)) {
+		zassert_equal(next_store_time_us, estimate_store_time_us,
+			      "Estimate differs from the worst case");
+	}
 }
 
 static void clear(void)
@@ -288,7 +330,7 @@ ZTEST(empty_flash, test_empty_flash)
 {
 	load_empty_flash();
 	prepare();
-	store(0);
+	store(0, false);
 	load_flash(0);
 }
 
@@ -296,7 +338,7 @@ ZTEST(store_data, test_store_data)
 {
 	load_flash(0);
 	prepare();
-	store(1);
+	store(1, true);
 	load_flash(1);
 }
 
@@ -319,10 +361,11 @@ ZTEST(several_store, test_several_store)
 {
 	load_flash(1);
 	prepare();
-	store(2);
+	store(2, true);
 	load_flash(2);
 	prepare();
-	store(0);
+	/* Might not fit in the partition with the chain */
+	store(0, false);
 	load_flash(0);
 }
 
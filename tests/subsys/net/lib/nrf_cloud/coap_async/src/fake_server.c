@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Replacement for coap_client that answers each request after a simulated
+ * round trip, so that the number of requests in flight and the time the
+ * radio has to stay active can be measured without a network.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/coap.h>
+#include <zephyr/net/coap_client.h>
+
+#include "fake_server.h"
+
+#define BULK_PATH "msg/d2c/bulk"
+#define MSG_KEY	  "\"appId\""
+
+struct fake_req {
+	struct k_work_delayable work;
+	struct coap_client_request *req;
+	bool active;
+};
+
+static struct fake_req reqs[CONFIG_COAP_CLIENT_MAX_REQUESTS];
+static struct fake_server_stats stats;
+static int pending;
+static int64_t radio_start;
+static bool respond = true;
+static struct k_spinlock lock;
+
+static uint32_t messages_count(const uint8_t *payload, size_t len)
+{
+	const size_t key_len = strlen(MSG_KEY);
+	uint32_t count = 0;
+
+	for (size_t i = 0; i + key_len <= len; i++) {
+		if (memcmp(&payload[i], MSG_KEY, key_len) == 0) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/* Must be called with the lock held */
+static void req_finish(struct fake_req *fr)
+{
+	fr->active = false;
+	fr->req = NULL;
+
+	if (--pending == 0) {
+		stats.radio_ms += k_uptime_get() - radio_start;
+	}
+}
+
+static void response_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct fake_req *fr = CONTAINER_OF(dwork, struct fake_req, work);
+	struct coap_client_response_data data = {
+		.last_block = true,
+	};
+	coap_client_response_cb_t cb;
+	void *user_data;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (!fr->active) {
+		k_spin_unlock(&lock, key);
+		return;
+	}
+
+	struct coap_client_request *req = fr->req;
+
+	data.result_code = (strncmp(req->path, "auth", 4) == 0) ? COAP_RESPONSE_CODE_CREATED
+								: COAP_RESPONSE_CODE_CHANGED;
+	stats.requests++;
+	stats.bytes += req->len;
+	stats.messages += messages_count(req->payload, req->len);
+	if ((strcmp(req->path, BULK_PATH) == 0) &&
+	    ((req->len < 2) || (req->payload[0] != '[') || (req->payload[req->len - 1] != ']'))) {
+		stats.malformed++;
+	}
+
+	/* The request can be reused as soon as its callback is called */
+	cb = req->cb;
+	user_data = req->user_data;
+	req_finish(fr);
+	k_spin_unlock(&lock, key);
+
+	if (cb) {
+		cb(&data, user_data);
+	}
+}
+
+int coap_client_init(struct coap_client *client, const char *info)
+{
+	ARG_UNUSED(client);
+	ARG_UNUSED(info);
+
+	for (size_t i = 0; i < ARRAY_SIZE(reqs); i++) {
+		k_work_init_delayable(&reqs[i].work, response_work_handler);
+	}
+
+	return 0;
+}
+
+int coap_client_req(struct coap_client *client, int sock, const struct net_sockaddr *addr,
+		    struct coap_client_request *req, struct coap_transmission_parameters *params)
+{
+	ARG_UNUSED(client);
+	ARG_UNUSED(sock);
+	ARG_UNUSED(addr);
+	ARG_UNUSED(params);
+
+	struct fake_req *fr = NULL;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(reqs); i++) {
+		if (!reqs[i].active) {
+			fr = &reqs[i];
+			break;
+		}
+	}
+
+	if (!fr) {
+		/* Same as coap_client when all requests are waiting for a response */
+		k_spin_unlock(&lock, key);
+		return -EAGAIN;
+	}
+
+	fr->active = true;
+	fr->req = req;
+	if (pending++ == 0) {
+		radio_start = k_uptime_get();
+	}
+	k_spin_unlock(&lock, key);
+
+	if (respond) {
+		k_work_schedule(&fr->work,
+				K_MSEC(FAKE_SERVER_RTT_MS + FAKE_SERVER_TX_MS(req->len)));
+	}
+
+	return 0;
+}
+
+/* Like coap_client, report -ECANCELED to the callback of each cancelled request */
+static void reqs_cancel(struct coap_client_request *req)
+{
+	const struct coap_client_response_data data = {
+		.result_code = -ECANCELED,
+		.last_block = true,
+	};
+	struct coap_client_request *cancelled[ARRAY_SIZE(reqs)];
+	size_t count = 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(reqs); i++) {
+		if (reqs[i].active && ((req == NULL) || (reqs[i].req == req))) {
+			(void)k_work_cancel_delayable(&reqs[i].work);
+			cancelled[count++] = reqs[i].req;
+			req_finish(&reqs[i]);
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	for (size_t i = 0; i < count; i++) {
+		if (cancelled[i]->cb) {
+			cancelled[i]->cb(&data, cancelled[i]->user_data);
+		}
+	}
+}
+
+void coap_client_cancel_request(struct coap_client *client, struct coap_client_request *req)
+{
+	ARG_UNUSED(client);
+
+	reqs_cancel(req);
+}
+
+void coap_client_cancel_requests(struct coap_client *client)
+{
+	ARG_UNUSED(client);
+
+	reqs_cancel(NULL);
+}
+
+void fake_server_reset(void)
+{
+	coap_client_cancel_requests(NULL);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	memset(&stats, 0, sizeof(stats));
+	respond = true;
+	k_spin_unlock(&lock, key);
+}
+
+void fake_server_respond_set(bool value)
+{
+	respond = value;
+}
+
+void fake_server_stats_get(struct fake_server_stats *out)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*out = stats;
+	k_spin_unlock(&lock, key);
+}
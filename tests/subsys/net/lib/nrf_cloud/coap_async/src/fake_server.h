@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FAKE_SERVER_H_
+#define FAKE_SERVER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/* Time between sending a request and receiving its response */
+#define FAKE_SERVER_RTT_MS	  100
+/* Time to transmit the given number of payload bytes */
+#define FAKE_SERVER_TX_MS(bytes) ((bytes) / 16)
+
+struct fake_server_stats {
+	/* Requests answered by the server */
+	uint32_t requests;
+	/* Device messages received, counted in the payloads */
+	uint32_t messages;
+	/* Payload bytes received */
+	size_t bytes;
+	/* Time during which at least one request was waiting for its response */
+	int64_t radio_ms;
+	/* Bulk payloads that were not a JSON array */
+	uint32_t malformed;
+};
+
+/* Reset the statistics, drop pending requests and answer the following requests */
+void fake_server_reset(void);
+
+/* Select whether the server answers requests or ignores them */
+void fake_server_respond_set(bool respond);
+
+void fake_server_stats_get(struct fake_server_stats *stats);
+
+#endif /* FAKE_SERVER_H_ */
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Minimal fakes required to link nrf_cloud_coap_transport.c and
+ * nrf_cloud_coap_batch.c without the rest of the nRF Cloud library.
+ *
+ * The connection is made through nrf_cloud_connect_host(), which returns an
+ * unconnected UDP socket that is never used for transfers, and the
+ * authorization request is answered by the fake server. The shadow and object helpers are only used
+ * by code paths that the tests do not exercise, so they return an error.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_codec.h>
+#include <net/nrf_cloud_coap.h>
+#include <nrf_cloud_codec_internal.h>
+#include <nrf_cloud_mem.h>
+#include <nrf_cloud_dns.h>
+#include <nrfc_dtls.h>
+
+#include <zephyr/logging/log.h>
+/* Registered by nrf_cloud_coap.c in the library */
+LOG_MODULE_REGISTER(nrf_cloud_coap, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
+
+void *nrf_cloud_malloc(size_t size)
+{
+	return malloc(size);
+}
+
+void nrf_cloud_free(void *ptr)
+{
+	free(ptr);
+}
+
+int nrf_cloud_print_details(void)
+{
+	return 0;
+}
+
+int nrf_cloud_codec_init(struct nrf_cloud_os_mem_hooks *hooks)
+{
+	ARG_UNUSED(hooks);
+	return 0;
+}
+
+int nrf_cloud_connect_host(const char *host_name, uint16_t port, struct zsock_addrinfo *hints,
+			   nrf_cloud_connect_host_cb connect_cb)
+{
+	ARG_UNUSED(host_name);
+	ARG_UNUSED(port);
+	ARG_UNUSED(hints);
+	ARG_UNUSED(connect_cb);
+
+	/* Only closed by the transport on disconnection */
+	return zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+}
+
+int nrf_cloud_jwt_generate(uint32_t time_valid_s, char *const jwt_buf, size_t jwt_buf_sz)
+{
+	ARG_UNUSED(time_valid_s);
+	strncpy(jwt_buf, "jwt", jwt_buf_sz);
+	return 0;
+}
+
+int nrfc_dtls_setup(int sock)
+{
+	ARG_UNUSED(sock);
+	return 0;
+}
+
+bool nrfc_dtls_cid_is_active(int sock)
+{
+	ARG_UNUSED(sock);
+	return false;
+}
+
+int nrfc_dtls_session_save(int sock)
+{
+	ARG_UNUSED(sock);
+	return -ENOTSUP;
+}
+
+int nrfc_dtls_session_load(int sock)
+{
+	ARG_UNUSED(sock);
+	return -ENOTSUP;
+}
+
+bool nrfc_keepopen_is_supported(void)
+{
+	return false;
+}
+
+/* -------------------------------------------------------------------------
+ * Shadow and object helpers: not reached by the tests.
+ * -------------------------------------------------------------------------
+ */
+
+void nrf_cloud_device_control_get(struct nrf_cloud_ctrl_data *const ctrl)
+{
+	memset(ctrl, 0, sizeof(*ctrl));
+}
+
+int nrf_cloud_shadow_control_response_encode(struct nrf_cloud_ctrl_data const *const data,
+					     bool accept, struct nrf_cloud_data *const output)
+{
+	ARG_UNUSED(data);
+	ARG_UNUSED(accept);
+	ARG_UNUSED(output);
+	/* Skips the shadow update on connect */
+	return -ENOTSUP;
+}
+
+int nrf_cloud_coap_shadow_state_update(const char *const shadow_json)
+{
+	ARG_UNUSED(shadow_json);
+	return -ENOTSUP;
+}
+
+int nrf_cloud_enabled_info_sections_json_encode(cJSON *const obj, const char *const app_ver)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(app_ver);
+	return -ENOTSUP;
+}
+
+int nrf_cloud_modem_info_json_encode(const struct nrf_cloud_modem_info *const mod_inf,
+				     cJSON *const mod_inf_obj)
+{
+	ARG_UNUSED(mod_inf);
+	ARG_UNUSED(mod_inf_obj);
+	return -ENOTSUP;
+}
+
+int nrf_cloud_obj_init(struct nrf_cloud_obj *const obj)
+{
+	ARG_UNUSED(obj);
+	return -ENOTSUP;
+}
+
+int nrf_cloud_obj_msg_init(struct nrf_cloud_obj *const obj, const char *const app_id,
+			   const char *const msg_type)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(app_id);
+	ARG_UNUSED(msg_type);
+	return -ENOTSUP;
+}
+
+int nrf_cloud_obj_ts_add(struct nrf_cloud_obj *const obj, const int64_t time_ms)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(time_ms);
+	return -ENOTSUP;
+}
+
+int nrf_cloud_obj_num_add(struct nrf_cloud_obj *const obj, const char *const key,
+			  const double val, const bool data_child)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(key);
+	ARG_UNUSED(val);
+	ARG_UNUSED(data_child);
+	return -ENOTSUP;
+}
+
+int nrf_cloud_obj_cloud_encode(struct nrf_cloud_obj *const obj)
+{
+	ARG_UNUSED(obj);
+	return -ENOTSUP;
+}
+
+int nrf_cloud_obj_cloud_encoded_free(struct nrf_cloud_obj *const obj)
+{
+	ARG_UNUSED(obj);
+	return 0;
+}
+
+int nrf_cloud_obj_free(struct nrf_cloud_obj *const obj)
+{
+	ARG_UNUSED(obj);
+	return 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/coap.h>
+#include <net/nrf_cloud_coap.h>
+#include "nrf_cloud_coap_transport.h"
+
+#include "fake_server.h"
+
+#define D2C_PATH	  "msg/d2c"
+#define TEST_MSGS_NUM	  16
+#define BENCH_MSGS_NUM	  64
+#define MSG_SIZE	  64
+#define ASYNC_WAIT	  K_SECONDS(30)
+
+/* Messages sent asynchronously must stay valid until their transfer is complete */
+static char msgs[BENCH_MSGS_NUM][MSG_SIZE];
+static atomic_t cb_count;
+static int cb_result;
+static k_tid_t cb_thread;
+
+static void msgs_init(void)
+{
+	for (int i = 0; i < BENCH_MSGS_NUM; i++) {
+		snprintf(msgs[i], MSG_SIZE,
+			 "{\"appId\":\"TEMP\",\"messageType\":\"DATA\",\"data\":%d}", i);
+	}
+}
+
+static void result_cb(const struct coap_client_response_data *data, void *user)
+{
+	ARG_UNUSED(user);
+
+	cb_result = data->result_code;
+	cb_thread = k_current_get();
+	atomic_inc(&cb_count);
+}
+
+typedef int (*send_fn_t)(int index);
+
+static int send_sync(int index)
+{
+	return nrf_cloud_coap_post(D2C_PATH, NULL, msgs[index], strlen(msgs[index]),
+				   COAP_CONTENT_FORMAT_APP_JSON, true, NULL, NULL);
+}
+
+static int send_async(int index)
+{
+	return nrf_cloud_coap_post_async(D2C_PATH, NULL, msgs[index], strlen(msgs[index]),
+					 COAP_CONTENT_FORMAT_APP_JSON, true, result_cb, NULL);
+}
+
+static int send_batch(int index)
+{
+	return nrf_cloud_coap_json_message_queue(msgs[index]);
+}
+
+static int wait_async(void)
+{
+	return nrf_cloud_coap_async_wait(ASYNC_WAIT);
+}
+
+static int wait_batch(void)
+{
+	return nrf_cloud_coap_queue_flush();
+}
+
+static void bench_run(const char *name, send_fn_t send, int (*wait)(void),
+		      struct fake_server_stats *stats)
+{
+	int64_t start = k_uptime_get();
+	int64_t elapsed;
+
+	for (int i = 0; i < BENCH_MSGS_NUM; i++) {
+		zassert_ok(send(i), "Message %d not sent", i);
+	}
+
+	if (wait) {
+		zassert_ok(wait());
+	}
+
+	elapsed = MAX(k_uptime_get() - start, 1);
+	fake_server_stats_get(stats);
+
+	zassert_equal(stats->messages, BENCH_MSGS_NUM, "%s: %u messages received", name,
+		      stats->messages);
+
+	TC_PRINT("%s: %u requests, %lld msgs/s, radio active %lld ms\n", name, stats->requests,
+		 BENCH_MSGS_NUM * MSEC_PER_SEC / elapsed, stats->radio_ms);
+}
+
+ZTEST(nrf_cloud_coap_async, test_async_callback_once)
+{
+	struct fake_server_stats stats;
+
+	for (int i = 0; i < TEST_MSGS_NUM; i++) {
+		zassert_ok(send_async(i));
+	}
+
+	zassert_ok(nrf_cloud_coap_async_wait(ASYNC_WAIT));
+	zassert_equal(atomic_get(&cb_count), TEST_MSGS_NUM);
+	zassert_equal(cb_result, COAP_RESPONSE_CODE_CHANGED);
+
+	fake_server_stats_get(&stats);
+	zassert_equal(stats.requests, TEST_MSGS_NUM);
+}
+
+ZTEST(nrf_cloud_coap_async, test_async_non_expires)
+{
+	fake_server_respond_set(false);
+
+	zassert_ok(nrf_cloud_coap_post_async(D2C_PATH, NULL, msgs[0], strlen(msgs[0]),
+					     COAP_CONTENT_FORMAT_APP_JSON, false, result_cb,
+					     NULL));
+	zassert_equal(nrf_cloud_coap_async_wait(K_MSEC(100)), -EAGAIN);
+	zassert_ok(nrf_cloud_coap_async_wait(ASYNC_WAIT));
+
+	/* The cancellation reported by coap_client is not passed on */
+	zassert_equal(atomic_get(&cb_count), 1);
+	zassert_equal(cb_result, -ETIMEDOUT);
+	zassert_equal(cb_thread, k_current_get());
+
+	/* The request slot is available again */
+	fake_server_respond_set(true);
+	zassert_ok(send_async(1));
+	zassert_ok(nrf_cloud_coap_async_wait(ASYNC_WAIT));
+	zassert_equal(atomic_get(&cb_count), 2);
+}
+
+ZTEST(nrf_cloud_coap_async, test_async_cancel_once)
+{
+	fake_server_respond_set(false);
+
+	for (int i = 0; i < TEST_MSGS_NUM / 4; i++) {
+		zassert_ok(send_async(i));
+	}
+
+	/* Both coap_client and the transport complete the cancelled requests */
+	zassert_ok(nrf_cloud_coap_disconnect());
+	zassert_equal(atomic_get(&cb_count), TEST_MSGS_NUM / 4);
+	zassert_equal(cb_result, -ECANCELED);
+	zassert_equal(cb_thread, k_current_get());
+	zassert_ok(nrf_cloud_coap_async_wait(K_NO_WAIT));
+
+	fake_server_respond_set(true);
+	zassert_ok(nrf_cloud_coap_connect(NULL));
+	zassert_ok(send_async(0));
+	zassert_ok(nrf_cloud_coap_async_wait(ASYNC_WAIT));
+	zassert_equal(atomic_get(&cb_count), TEST_MSGS_NUM / 4 + 1);
+	zassert_equal(cb_result, COAP_RESPONSE_CODE_CHANGED);
+}
+
+ZTEST(nrf_cloud_coap_async, test_batch_messages)
+{
+	struct fake_server_stats stats;
+
+	for (int i = 0; i < BENCH_MSGS_NUM; i++) {
+		zassert_ok(send_batch(i));
+	}
+
+	zassert_ok(nrf_cloud_coap_queue_flush());
+
+	fake_server_stats_get(&stats);
+	zassert_equal(stats.messages, BENCH_MSGS_NUM);
+	zassert_equal(stats.malformed, 0);
+	zassert_true(stats.requests < BENCH_MSGS_NUM / 4, "%u requests", stats.requests);
+
+	/* Nothing left to send */
+	zassert_ok(nrf_cloud_coap_queue_flush());
+	fake_server_stats_get(&stats);
+	zassert_equal(stats.messages, BENCH_MSGS_NUM);
+}
+
+ZTEST(nrf_cloud_coap_async, test_bench_radio_time)
+{
+	struct fake_server_stats sync_stats;
+	struct fake_server_stats async_stats;
+	struct fake_server_stats batch_stats;
+
+	bench_run("sync", send_sync, NULL, &sync_stats);
+
+	fake_server_reset();
+	bench_run("async", send_async, wait_async, &async_stats);
+
+	fake_server_reset();
+	bench_run("batch", send_batch, wait_batch, &batch_stats);
+
+	zassert_true(async_stats.radio_ms < sync_stats.radio_ms);
+	zassert_true(batch_stats.radio_ms < async_stats.radio_ms);
+}
+
+static void *suite_setup(void)
+{
+	msgs_init();
+
+	zassert_ok(nrf_cloud_coap_init());
+	zassert_ok(nrf_cloud_coap_connect(NULL));
+	zassert_true(nrf_cloud_coap_is_connected());
+
+	return NULL;
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	fake_server_reset();
+	atomic_set(&cb_count, 0);
+	cb_result = 0;
+	cb_thread = NULL;
+}
+
+ZTEST_SUITE(nrf_cloud_coap_async, NULL, suite_setup, test_before, NULL, NULL);
@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""
+Compress a file to raw LZMA2 with the 2 byte header used by imgtool for
+compressed MCUboot images, for comparison with the LZ4 implementation.
+"""
+
+import argparse
+import lzma
+import sys
+from pathlib import Path
+
+
+def dict_size_prop(dict_size: int) -> int:
+    for prop in range(40):
+        if dict_size <= (2 | (prop & 1)) << (prop // 2 + 11):
+            return prop
+    raise ValueError(f'Dictionary size {dict_size} is too large')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, allow_abbrev=False)
+    parser.add_argument('--dict-size', type=int, required=True)
+    parser.add_argument('--pb', type=int, required=True)
+    parser.add_argument('--lc', type=int, required=True)
+    parser.add_argument('--lp', type=int, required=True)
+    parser.add_argument('--preset', type=int, required=True)
+    parser.add_argument('infile', type=Path)
+    parser.add_argument('outfile', type=Path)
+    args = parser.parse_args()
+
+    filters = [{
+        'id': lzma.FILTER_LZMA2,
+        'preset': args.preset,
+        'dict_size': args.dict_size,
+        'pb': args.pb,
+        'lc': args.lc,
+        'lp': args.lp,
+    }]
+    header = bytes([dict_size_prop(args.dict_size), (args.pb * 5 + args.lp) * 9 + args.lc])
+    compressed = lzma.compress(args.infile.read_bytes(), format=lzma.FORMAT_RAW, filters=filters)
+
+    args.outfile.write_bytes(header + compressed)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
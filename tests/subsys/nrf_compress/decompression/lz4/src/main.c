@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <nrf_compress/implementation.h>
+
+#include "host_cycles_bottom.h"
+
+#define LZ4_HEADER_SIZE 4
+#define BENCHMARK_ROUNDS 5
+
+/* Buffers of the LZMA implementation, see subsys/nrf_compress/src/lzma.c */
+#define LZMA_RAM_SIZE                                                                              \
+	(CONFIG_NRF_COMPRESS_LZMA_MAX_DICT_SIZE +                                                  \
+	 sizeof(uint16_t) * (1984 + (0x300 << CONFIG_NRF_COMPRESS_LZMA_MAX_LC_LP)))
+#define LZ4_RAM_SIZE CONFIG_NRF_COMPRESS_LZ4_WINDOW_SIZE
+
+static const uint8_t fw_data[] = {
+#include "fw_data.inc"
+};
+
+static const uint8_t fw_data_lz4[] = {
+#include "fw_data_lz4.inc"
+};
+
+static const uint8_t fw_data_lzma2[] = {
+#include "fw_data_lzma2.inc"
+};
+
+static const uint8_t arm_thumb[] = {
+#include "arm_thumb.inc"
+};
+
+static const uint8_t arm_thumb_lz4[] = {
+#include "arm_thumb_lz4.inc"
+};
+
+static const uint8_t arm_thumb_lzma2[] = {
+#include "arm_thumb_lzma2.inc"
+};
+
+struct sample {
+	const char *name;
+	const uint8_t *raw;
+	size_t raw_size;
+	const uint8_t *lz4;
+	size_t lz4_size;
+	const uint8_t *lzma2;
+	size_t lzma2_size;
+};
+
+#define SAMPLE(_name)                                                                              \
+	{                                                                                          \
+		.name = #_name,                                                                    \
+		.raw = _name, .raw_size = sizeof(_name),                                           \
+		.lz4 = _name##_lz4, .lz4_size = sizeof(_name##_lz4),                               \
+		.lzma2 = _name##_lzma2, .lzma2_size = sizeof(_name##_lzma2),                       \
+	}
+
+static const struct sample samples[] = {
+	SAMPLE(fw_data),
+	SAMPLE(arm_thumb),
+};
+
+static uint8_t modified[sizeof(fw_data_lz4)];
+
+static struct nrf_compress_implementation *lz4_implementation(void)
+{
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZ4);
+	zassert_not_null(implementation, "Expected implementation to not be NULL");
+
+	return implementation;
+}
+
+/* Decompress the whole input in chunks of at most chunk_size bytes after the header, and
+ * compare the output with expected if it is not NULL. The instance must be initialized.
+ */
+static int decompress(struct nrf_compress_implementation *implementation, const uint8_t *input,
+		      size_t input_size, size_t chunk_size, const uint8_t *expected,
+		      size_t *total_output_size)
+{
+	size_t pos = 0;
+	size_t output_pos = 0;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	int rc;
+
+	while (pos < input_size) {
+		size_t needed = implementation->decompress_bytes_needed(NULL);
+		size_t size = MIN(input_size - pos, (pos == 0) ? needed : chunk_size);
+
+		if (needed == 0) {
+			return -ENOMEM;
+		}
+
+		rc = implementation->decompress(NULL, &input[pos], size, pos + size == input_size,
+						&offset, &output, &output_size);
+		if (rc) {
+			return rc;
+		}
+
+		if (offset == 0 && output_size == 0) {
+			/* No progress */
+			return -EIO;
+		}
+
+		if (expected != NULL && output_size > 0 &&
+		    memcmp(output, &expected[output_pos], output_size) != 0) {
+			return -EBADMSG;
+		}
+
+		output_pos += output_size;
+		pos += offset;
+	}
+
+	*total_output_size = output_pos;
+	return 0;
+}
+
+static void decompress_sample(const uint8_t *input, size_t input_size, const uint8_t *raw,
+			      size_t raw_size, size_t decompressed_size, size_t chunk_size)
+{
+	struct nrf_compress_implementation *implementation = lz4_implementation();
+	size_t total_output_size = 0;
+	int rc;
+
+	rc = implementation->init(NULL, decompressed_size);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = decompress(implementation, input, input_size, chunk_size, raw, &total_output_size);
+	zassert_ok(rc, "Expected decompression with %zu byte chunks to be successful: %d",
+		   chunk_size, rc);
+	zassert_equal(total_output_size, raw_size, "Expected decompressed data size to match");
+
+	rc = implementation->deinit(NULL);
+	zassert_ok(rc, "Expected deinit to be successful");
+}
+
+static int decompress_invalid(const uint8_t *input, size_t input_size, size_t decompressed_size)
+{
+	struct nrf_compress_implementation *implementation = lz4_implementation();
+	size_t total_output_size = 0;
+	int rc;
+
+	zassert_ok(implementation->init(NULL, decompressed_size));
+
+	rc = decompress(implementation, input, input_size, CONFIG_NRF_COMPRESS_CHUNK_SIZE, NULL,
+			&total_output_size);
+
+	zassert_ok(implementation->deinit(NULL));
+
+	return rc;
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_valid_implementation_elements)
+{
+	struct nrf_compress_implementation *implementation = lz4_implementation();
+
+	zassert_equal(implementation->id, NRF_COMPRESS_TYPE_LZ4,
+		      "Expected id element to have correct value");
+	zassert_not_equal(implementation->init, NULL, "Expected init element to not be NULL");
+	zassert_not_equal(implementation->deinit, NULL,
+			  "Expected deinit element to not be NULL");
+	zassert_not_equal(implementation->reset, NULL, "Expected reset element to not be NULL");
+	zassert_equal(implementation->compress, NULL, "Expected compress element to be NULL");
+	zassert_not_equal(implementation->decompress_bytes_needed, NULL,
+			  "Expected decompress_bytes_needed element to not be NULL");
+	zassert_not_equal(implementation->decompress, NULL,
+			  "Expected decompress to not be NULL");
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_bytes_needed)
+{
+	struct nrf_compress_implementation *implementation = lz4_implementation();
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	int rc;
+
+	zassert_ok(implementation->init(NULL, sizeof(fw_data)));
+
+	rc = implementation->decompress_bytes_needed(NULL);
+	zassert_equal(rc, LZ4_HEADER_SIZE, "Expected to need 4 bytes for LZ4 header");
+
+	rc = implementation->decompress(NULL, fw_data_lz4, LZ4_HEADER_SIZE, false, &offset,
+					&output, &output_size);
+	zassert_ok(rc, "Expected header decompress to be successful");
+	zassert_equal(offset, LZ4_HEADER_SIZE, "Expected header to be consumed");
+	zassert_equal(output_size, 0, "Expected no output for header");
+
+	rc = implementation->decompress_bytes_needed(NULL);
+	zassert_equal(rc, CONFIG_NRF_COMPRESS_CHUNK_SIZE,
+		      "Expected to need chunk size bytes for LZ4 data");
+
+	zassert_ok(implementation->deinit(NULL));
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_valid_data_decompression)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(samples); i++) {
+		decompress_sample(samples[i].lz4, samples[i].lz4_size, samples[i].raw,
+				  samples[i].raw_size, samples[i].raw_size,
+				  CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+	}
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_small_chunks)
+{
+	/* Sequences and matches split at every possible position */
+	static const size_t chunk_sizes[] = {1, 2, 3, 7, 61};
+
+	for (size_t i = 0; i < ARRAY_SIZE(chunk_sizes); i++) {
+		decompress_sample(fw_data_lz4, sizeof(fw_data_lz4), fw_data, sizeof(fw_data),
+				  sizeof(fw_data), chunk_sizes[i]);
+	}
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_unknown_size)
+{
+	/* The end of the stream is only detected by the last part */
+	decompress_sample(fw_data_lz4, sizeof(fw_data_lz4), fw_data, sizeof(fw_data), 0,
+			  CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_reset)
+{
+	struct nrf_compress_implementation *implementation = lz4_implementation();
+	size_t total_output_size = 0;
+	int rc;
+
+	zassert_ok(implementation->init(NULL, sizeof(fw_data)));
+
+	/* Abort in the middle of the stream and start over */
+	rc = decompress(implementation, fw_data_lz4, sizeof(fw_data_lz4) / 2,
+			CONFIG_NRF_COMPRESS_CHUNK_SIZE, NULL, &total_output_size);
+	zassert_not_equal(rc, 0, "Expected truncated stream to fail");
+
+	zassert_ok(implementation->reset(NULL, sizeof(arm_thumb)));
+
+	rc = decompress(implementation, arm_thumb_lz4, sizeof(arm_thumb_lz4),
+			CONFIG_NRF_COMPRESS_CHUNK_SIZE, arm_thumb, &total_output_size);
+	zassert_ok(rc, "Expected decompression after reset to be successful");
+	zassert_equal(total_output_size, sizeof(arm_thumb),
+		      "Expected decompressed data size to match");
+
+	zassert_ok(implementation->deinit(NULL));
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_invalid_data)
+{
+	int rc;
+
+	/* Truncated stream */
+	rc = decompress_invalid(fw_data_lz4, sizeof(fw_data_lz4) - 1, 0);
+	zassert_not_equal(rc, 0, "Expected truncated stream to fail");
+
+	/* Expected size smaller and larger than the decompressed size */
+	rc = decompress_invalid(fw_data_lz4, sizeof(fw_data_lz4), sizeof(fw_data) - 1);
+	zassert_not_equal(rc, 0, "Expected too small output size to fail");
+
+	rc = decompress_invalid(fw_data_lz4, sizeof(fw_data_lz4), sizeof(fw_data) + 1);
+	zassert_not_equal(rc, 0, "Expected too large output size to fail");
+
+	/* Bad magic and version */
+	memcpy(modified, fw_data_lz4, sizeof(fw_data_lz4));
+	modified[0] ^= 0xff;
+	rc = decompress_invalid(modified, sizeof(modified), 0);
+	zassert_equal(rc, -EINVAL, "Expected invalid magic to fail");
+
+	memcpy(modified, fw_data_lz4, sizeof(fw_data_lz4));
+	modified[2]++;
+	rc = decompress_invalid(modified, sizeof(modified), 0);
+	zassert_equal(rc, -EINVAL, "Expected invalid version to fail");
+
+	/* Window larger than the configured one */
+	memcpy(modified, fw_data_lz4, sizeof(fw_data_lz4));
+	modified[3] = LOG2(CONFIG_NRF_COMPRESS_LZ4_WINDOW_SIZE) + 1;
+	rc = decompress_invalid(modified, sizeof(modified), 0);
+	zassert_equal(rc, -EINVAL, "Expected too large window to fail");
+
+	/* Match before the start of the output */
+	memcpy(modified, fw_data_lz4, LZ4_HEADER_SIZE);
+	modified[LZ4_HEADER_SIZE] = 0x10;
+	modified[LZ4_HEADER_SIZE + 1] = 'a';
+	modified[LZ4_HEADER_SIZE + 2] = 2;
+	modified[LZ4_HEADER_SIZE + 3] = 0;
+	modified[LZ4_HEADER_SIZE + 4] = 0;
+	rc = decompress_invalid(modified, LZ4_HEADER_SIZE + 5, 0);
+	zassert_not_equal(rc, 0, "Expected invalid match offset to fail");
+}
+
+static uint64_t benchmark(enum nrf_compress_types type, const uint8_t *input, size_t input_size,
+			  size_t raw_size)
+{
+	struct nrf_compress_implementation *implementation;
+	uint64_t cycles = UINT64_MAX;
+	size_t total_output_size;
+	uint64_t start;
+	int rc;
+
+	implementation = nrf_compress_implementation_find(type);
+	zassert_not_null(implementation);
+
+	zassert_ok(implementation->init(NULL, raw_size));
+
+	for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+		zassert_ok(implementation->reset(NULL, raw_size));
+
+		start = host_cycles_get();
+		rc = decompress(implementation, input, input_size, CONFIG_NRF_COMPRESS_CHUNK_SIZE,
+				NULL, &total_output_size);
+		cycles = MIN(cycles, host_cycles_get() - start);
+
+		zassert_ok(rc, "Expected benchmark decompression to be successful: %d", rc);
+		zassert_equal(total_output_size, raw_size);
+	}
+
+	zassert_ok(implementation->deinit(NULL));
+
+	return cycles;
+}
+
+static void benchmark_print(const char *name, uint64_t cycles, size_t raw_size,
+			    size_t compressed_size, size_t ram_size)
+{
+	uint32_t cpb_x100 = (uint32_t)(cycles * 100 / raw_size);
+	uint32_t ratio_x1000 = (uint32_t)((uint64_t)compressed_size * 1000 / raw_size);
+
+	TC_PRINT("%6s %7u.%02u cycles per byte, %7zu bytes (%u.%03u), %7zu bytes of RAM\n", name,
+		 cpb_x100 / 100, cpb_x100 % 100, compressed_size, ratio_x1000 / 1000,
+		 ratio_x1000 % 1000, ram_size);
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_benchmark)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(samples); i++) {
+		const struct sample *s = &samples[i];
+		uint64_t lz4_cycles;
+		uint64_t lzma_cycles;
+
+		lz4_cycles = benchmark(NRF_COMPRESS_TYPE_LZ4, s->lz4, s->lz4_size, s->raw_size);
+		lzma_cycles = benchmark(NRF_COMPRESS_TYPE_LZMA, s->lzma2, s->lzma2_size,
+					s->raw_size);
+
+		TC_PRINT("%s: %zu bytes, %zu byte chunks\n", s->name, s->raw_size,
+			 (size_t)CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+		benchmark_print("lz4", lz4_cycles, s->raw_size, s->lz4_size, LZ4_RAM_SIZE);
+		benchmark_print("lzma2", lzma_cycles, s->raw_size, s->lzma2_size, LZMA_RAM_SIZE);
+
+		zassert_true(s->lz4_size < s->raw_size, "Expected LZ4 to compress %s", s->name);
+	}
+}
+
+ZTEST_SUITE(nrf_compress_decompression_lz4, NULL, NULL, NULL, NULL, NULL);
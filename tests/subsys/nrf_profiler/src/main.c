@@ -12,6 +12,17 @@
 #define S_VALUE_START -50
 #define EXAMPLE_STRING "example string"
 
+#ifdef CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER
+/* Events are logged in chunks that fit in the event buffer. The profiler thread empties
+ * the buffer between the chunks, so that no event is dropped.
+ */
+#define EVENTS_PER_CHUNK (CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER_COUNT / 2)
+#define DRAIN_TIME K_MSEC(2 * CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER_DRAIN_PERIOD)
+#else
+#define EVENTS_PER_CHUNK PROFILED_EVENTS_NB
+#define DRAIN_TIME K_NO_WAIT
+#endif
+
 static uint16_t no_data_event_id;
 static uint16_t data_event_id;
 static uint16_t big_event_id;
@@ -63,16 +74,12 @@ static void register_profiler_events(void)
 						    big_event_data_types, 7);
 }
 
-static uint32_t test_performance_core(void (*profiler_func)(struct log_event_buf *buf),
-				      uint16_t event_id)
+static uint32_t log_events(void (*profiler_func)(struct log_event_buf *buf),
+			   uint16_t event_id, size_t events_nb)
 {
-	uint32_t start_time;
-	uint32_t elapsed_ticks;
-	uint32_t elapsed_time_us;
+	uint32_t start_time = k_cycle_get_32();
 
-	/* Profiling no data event */
-	start_time = k_cycle_get_32();
-	for (size_t i = 0; i < PROFILED_EVENTS_NB; i++) {
+	for (size_t i = 0; i < events_nb; i++) {
 		struct log_event_buf buf;
 
 		nrf_profiler_log_start(&buf);
@@ -81,8 +88,29 @@ static uint32_t test_performance_core(void (*profiler_func)(struct log_event_buf
 		}
 		nrf_profiler_log_send(&buf, event_id);
 	}
-	elapsed_ticks = k_cycle_get_32() - start_time;
-	elapsed_time_us = k_cyc_to_us_near32(elapsed_ticks);
+
+	return k_cycle_get_32() - start_time;
+}
+
+static uint32_t test_performance_core(void (*profiler_func)(struct log_event_buf *buf),
+				      uint16_t event_id)
+{
+	uint64_t elapsed_ticks = 0;
+	uint32_t elapsed_time_us;
+
+	for (size_t i = 0; i < PROFILED_EVENTS_NB; i += EVENTS_PER_CHUNK) {
+		elapsed_ticks += log_events(profiler_func, event_id,
+					    MIN(EVENTS_PER_CHUNK, PROFILED_EVENTS_NB - i));
+		/* Sending events to the backend is not included in the measurement. */
+		k_sleep(DRAIN_TIME);
+	}
+
+	zassert_equal(nrf_profiler_dropped_events_get(), 0, "Events were dropped");
+
+	elapsed_time_us = (uint32_t)k_cyc_to_us_near64(elapsed_ticks);
+	printk("Average time per event [ns]: %u\n",
+	       (uint32_t)(k_cyc_to_ns_near64(elapsed_ticks) / PROFILED_EVENTS_NB));
+
 	return elapsed_time_us;
 }
 
@@ -120,4 +148,36 @@ ZTEST(suite_nrf_profiler, test_performance_03)
 	       "Elapsed time [us]: %d\n", PROFILED_EVENTS_NB, elapsed_time_us);
 }
 
+ZTEST(suite_nrf_profiler, test_performance_04)
+{
+	uint32_t elapsed_ticks;
+	uint32_t dropped;
+
+	if (!IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER)) {
+		ztest_test_skip();
+	}
+
+	/* The test thread is cooperative, so the profiler thread cannot empty the buffer
+	 * while the events are logged. Events that do not fit are dropped.
+	 */
+	elapsed_ticks = log_events(profile_data_event, data_event_id,
+				   2 * CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER_COUNT);
+	dropped = nrf_profiler_dropped_events_get();
+
+	printk("Logged %d events with 4-byte data to the event buffer of %d events.\n"
+	       "Dropped events: %u\nAverage time per event [ns]: %u\n",
+	       2 * CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER_COUNT,
+	       CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER_COUNT, dropped,
+	       (uint32_t)(k_cyc_to_ns_near64(elapsed_ticks) /
+			  (2 * CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER_COUNT)));
+
+	zassert_equal(dropped, CONFIG_NRF_PROFILER_NORDIC_EVENT_BUFFER_COUNT,
+		      "Unexpected number of dropped events");
+
+	/* Events are logged again after the buffer is emptied. */
+	k_sleep(DRAIN_TIME);
+	(void)log_events(profile_data_event, data_event_id, EVENTS_PER_CHUNK);
+	zassert_equal(nrf_profiler_dropped_events_get(), dropped, "Events were dropped");
+}
+
 ZTEST_SUITE(suite_nrf_profiler, NULL, test_init, NULL, NULL, NULL);
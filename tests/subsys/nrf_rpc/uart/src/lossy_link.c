@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "lossy_link.h"
+
+#include <string.h>
+
+#include <zephyr/drivers/serial/uart_emul.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#define HDLC_CHAR_ESCAPE    0x7d
+#define HDLC_CHAR_DELIMITER 0x7e
+
+/* Acknowledgment frame payload: the sequence field, if used, followed by the checksum field */
+#if defined(CONFIG_NRF_RPC_UART_TX_WINDOW) && (CONFIG_NRF_RPC_UART_TX_WINDOW > 1)
+#define ACK_SIZE 3
+#else
+#define ACK_SIZE 2
+#endif
+
+/* HDLC-encoded frame without the delimiters, with every octet escaped in the worst case */
+#define FRAME_MAX_SIZE (2 * (CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE + ACK_SIZE))
+
+struct frame {
+	uint8_t data[FRAME_MAX_SIZE];
+	size_t len;
+};
+
+/*
+ * The transport writes a whole frame while holding its lock, so the frames are never interleaved
+ * and the state below is only accessed by one thread at a time.
+ */
+static struct frame tx_frame;
+static struct frame held_frame;
+
+static enum lossy_link_fault fault_type;
+static bool fault_ack;
+static atomic_t fault_count;
+
+static void frame_send(const struct device *uart, const struct frame *frame)
+{
+	static const uint8_t delimiter = HDLC_CHAR_DELIMITER;
+	uint32_t written;
+
+	written = uart_emul_put_rx_data(uart, &delimiter, sizeof(delimiter));
+	written += uart_emul_put_rx_data(uart, frame->data, frame->len);
+	written += uart_emul_put_rx_data(uart, &delimiter, sizeof(delimiter));
+
+	__ASSERT(written == frame->len + 2, "UART RX FIFO full");
+}
+
+static bool frame_is_ack(const struct frame *frame)
+{
+	size_t len = frame->len;
+
+	for (size_t i = 0; i < frame->len; i++) {
+		if (frame->data[i] == HDLC_CHAR_ESCAPE) {
+			len--;
+		}
+	}
+
+	return len == ACK_SIZE;
+}
+
+/* Flips a bit of an octet outside escape sequences, so that the frame keeps its length. */
+static void frame_corrupt(struct frame *frame)
+{
+	for (size_t i = frame->len / 2; i < frame->len; i++) {
+		uint8_t flipped = frame->data[i] ^ BIT(0);
+
+		if (frame->data[i] == HDLC_CHAR_ESCAPE ||
+		    (i > 0 && frame->data[i - 1] == HDLC_CHAR_ESCAPE) ||
+		    flipped == HDLC_CHAR_ESCAPE || flipped == HDLC_CHAR_DELIMITER) {
+			continue;
+		}
+
+		frame->data[i] = flipped;
+		return;
+	}
+
+	__ASSERT(false, "No octet to corrupt");
+}
+
+static bool fault_take(const struct frame *frame)
+{
+	if (atomic_get(&fault_count) == 0 || frame_is_ack(frame) != fault_ack) {
+		return false;
+	}
+
+	atomic_dec(&fault_count);
+
+	return true;
+}
+
+static void frame_process(const struct device *uart, struct frame *frame)
+{
+	if (!fault_take(frame)) {
+		frame_send(uart, frame);
+	} else {
+		switch (fault_type) {
+		case LOSSY_LINK_DROP:
+			break;
+		case LOSSY_LINK_CORRUPT:
+			frame_corrupt(frame);
+			frame_send(uart, frame);
+			break;
+		case LOSSY_LINK_DUPLICATE:
+			frame_send(uart, frame);
+			frame_send(uart, frame);
+			break;
+		case LOSSY_LINK_REORDER:
+			if (held_frame.len == 0) {
+				memcpy(held_frame.data, frame->data, frame->len);
+				held_frame.len = frame->len;
+				return;
+			}
+
+			frame_send(uart, frame);
+			break;
+		}
+	}
+
+	if (held_frame.len > 0) {
+		frame_send(uart, &held_frame);
+		held_frame.len = 0;
+	}
+}
+
+static void tx_data_ready(const struct device *uart, size_t size, void *user_data)
+{
+	uint8_t buf[64];
+	uint32_t len;
+
+	ARG_UNUSED(size);
+	ARG_UNUSED(user_data);
+
+	while ((len = uart_emul_get_tx_data(uart, buf, sizeof(buf))) > 0) {
+		for (uint32_t i = 0; i < len; i++) {
+			if (buf[i] != HDLC_CHAR_DELIMITER) {
+				__ASSERT(tx_frame.len < sizeof(tx_frame.data), "Frame too long");
+				tx_frame.data[tx_frame.len++] = buf[i];
+				continue;
+			}
+
+			/* Each frame starts and ends with a delimiter, so skip empty ones */
+			if (tx_frame.len > 0) {
+				frame_process(uart, &tx_frame);
+				tx_frame.len = 0;
+			}
+		}
+	}
+}
+
+void lossy_link_init(const struct device *uart)
+{
+	uart_emul_callback_tx_data_ready_set(uart, tx_data_ready, NULL);
+}
+
+void lossy_link_fault_set(enum lossy_link_fault fault, uint32_t count, bool ack)
+{
+	fault_type = fault;
+	fault_ack = ack;
+	atomic_set(&fault_count, count);
+}
+
+uint32_t lossy_link_fault_pending(void)
+{
+	return atomic_get(&fault_count);
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef LOSSY_LINK_H_
+#define LOSSY_LINK_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/device.h>
+
+/* Fault applied to a frame passing through the link */
+enum lossy_link_fault {
+	LOSSY_LINK_DROP,
+	LOSSY_LINK_CORRUPT,
+	LOSSY_LINK_DUPLICATE,
+	/* The frame is delivered after the following one */
+	LOSSY_LINK_REORDER,
+};
+
+/* Loops the frames sent over the emulated UART back to its RX. */
+void lossy_link_init(const struct device *uart);
+
+/* Applies the fault to the next count packet frames, or acknowledgment frames if ack is set. */
+void lossy_link_fault_set(enum lossy_link_fault fault, uint32_t count, bool ack);
+
+/* Returns the number of frames that the fault has yet to be applied to. */
+uint32_t lossy_link_fault_pending(void);
+
+#endif /* LOSSY_LINK_H_ */
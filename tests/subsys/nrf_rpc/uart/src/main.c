@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+
+#include <nrf_rpc/nrf_rpc_uart.h>
+
+#include "lossy_link.h"
+
+#define RPC_UART_NODE DT_NODELABEL(rpc_uart)
+
+#define TEST_PACKETS_NUM  (64)
+#define FAULT_PACKETS_NUM (8)
+#define BENCH_PACKETS_NUM (256)
+#define RX_TIMEOUT	  K_MSEC(1000)
+
+/* Time after which the transport gives up sending an unacknowledged packet */
+#define TX_GIVE_UP_TIME                                                                            \
+	K_MSEC(2 * CONFIG_NRF_RPC_UART_ACK_WAITING_TIME * (CONFIG_NRF_RPC_UART_TX_ATTEMPTS + 1))
+
+#if defined(CONFIG_NRF_RPC_UART_TX_WINDOW) && (CONFIG_NRF_RPC_UART_TX_WINDOW > 1)
+#define TX_WINDOW_SIZE CONFIG_NRF_RPC_UART_TX_WINDOW
+#else
+#define TX_WINDOW_SIZE 1
+#endif
+
+#if defined(CONFIG_NRF_RPC_UART_RX_QUEUE)
+#define RX_PKT_COUNT CONFIG_NRF_RPC_UART_RX_PKT_COUNT
+#else
+#define RX_PKT_COUNT 1
+#endif
+
+/* Time for which the slow handler waits to be released */
+#define SLOW_HANDLER_TIMEOUT K_SECONDS(5)
+
+static const struct nrf_rpc_tr *tr = &NRF_RPC_UART_TRANSPORT(RPC_UART_NODE);
+
+static K_SEM_DEFINE(rx_sem, 0, BENCH_PACKETS_NUM);
+static uint32_t rx_expected;
+static atomic_t rx_errors;
+static uint32_t tx_dropped_expected;
+static atomic_t tx_dropped;
+static K_SEM_DEFINE(slow_blocked_sem, 0, 1);
+static K_SEM_DEFINE(slow_release_sem, 0, 1);
+static uint32_t slow_index = UINT32_MAX;
+
+/* Fills the packet with bytes that include the HDLC flag and escape octets */
+static uint8_t packet_byte(uint32_t index, size_t pos)
+{
+	static const uint8_t special[] = {0x7e, 0x7d, 0x5e, 0x5d, 0x00, 0xff};
+
+	if ((pos + index) % 3 == 0) {
+		return special[(pos + index) % ARRAY_SIZE(special)];
+	}
+
+	return (uint8_t)(pos * 31 + index);
+}
+
+static size_t packet_len(uint32_t index)
+{
+	/* Covers lengths shorter than an acknowledgment frame and longer than the TX buffer */
+	return 1 + (index * 37) % 600;
+}
+
+static bool packet_check(uint32_t index, const uint8_t *data, size_t len)
+{
+	if (len != packet_len(index)) {
+		return false;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		if (data[i] != packet_byte(index, i)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void receive_cb(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t len,
+		       void *context)
+{
+	uint32_t index = rx_expected++;
+
+	if (!packet_check(index, data, len)) {
+		atomic_inc(&rx_errors);
+	}
+
+	if (index == slow_index) {
+		k_sem_give(&slow_blocked_sem);
+		(void)k_sem_take(&slow_release_sem, SLOW_HANDLER_TIMEOUT);
+	}
+
+	k_sem_give(&rx_sem);
+}
+
+void nrf_rpc_uart_tx_dropped_hook(const struct device *uart_dev, const uint8_t *packet, size_t len)
+{
+	/* Dropped packets are reported in the order in which they were sent */
+	if (!packet_check(tx_dropped_expected++, packet, len)) {
+		atomic_inc(&rx_errors);
+	}
+
+	atomic_inc(&tx_dropped);
+}
+
+static int packet_send(uint32_t index, size_t len)
+{
+	size_t size = len;
+	uint8_t *buf = tr->api->tx_buf_alloc(tr, &size);
+
+	for (size_t i = 0; i < len; i++) {
+		buf[i] = packet_byte(index, i);
+	}
+
+	return tr->api->send(tr, buf, len);
+}
+
+/* Sends the packets and checks that each one is received once and in order. */
+static void packets_transfer(uint32_t count)
+{
+	uint32_t first = rx_expected;
+
+	for (uint32_t i = 0; i < count; i++) {
+		zassert_ok(packet_send(first + i, packet_len(first + i)));
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		zassert_ok(k_sem_take(&rx_sem, RX_TIMEOUT), "Packet %u not received", i);
+	}
+
+	zassert_equal(rx_expected, first + count);
+	zassert_equal(atomic_get(&rx_errors), 0, "Packets received corrupted or out of order");
+	zassert_equal(k_sem_take(&rx_sem, K_MSEC(100)), -EAGAIN, "Duplicate packet received");
+}
+
+/* Sends the packets through the link with the fault applied to the given frames. */
+static void faulty_transfer(enum lossy_link_fault fault, uint32_t count, bool ack)
+{
+	lossy_link_fault_set(fault, count, ack);
+	packets_transfer(FAULT_PACKETS_NUM);
+	zassert_equal(lossy_link_fault_pending(), 0, "Fault not applied");
+}
+
+ZTEST(nrf_rpc_uart, test_packets_in_order)
+{
+	packets_transfer(TEST_PACKETS_NUM);
+}
+
+ZTEST(nrf_rpc_uart, test_retransmit_dropped)
+{
+	faulty_transfer(LOSSY_LINK_DROP, 1, false);
+	faulty_transfer(LOSSY_LINK_DROP, 2, false);
+}
+
+ZTEST(nrf_rpc_uart, test_retransmit_corrupted)
+{
+	faulty_transfer(LOSSY_LINK_CORRUPT, 1, false);
+}
+
+ZTEST(nrf_rpc_uart, test_retransmit_reordered)
+{
+	faulty_transfer(LOSSY_LINK_REORDER, 1, false);
+}
+
+ZTEST(nrf_rpc_uart, test_duplicate_rejected)
+{
+	faulty_transfer(LOSSY_LINK_DUPLICATE, 2, false);
+}
+
+ZTEST(nrf_rpc_uart, test_ack_lost)
+{
+	/* The sender retransmits the packet, which the receiver must not pass on again */
+	faulty_transfer(LOSSY_LINK_DROP, 1, true);
+	faulty_transfer(LOSSY_LINK_CORRUPT, 1, true);
+}
+
+ZTEST(nrf_rpc_uart, test_resync_after_give_up)
+{
+	uint32_t lost = rx_expected;
+	int err;
+
+	/* Drop all transmission attempts of a single packet */
+	lossy_link_fault_set(LOSSY_LINK_DROP, CONFIG_NRF_RPC_UART_TX_ATTEMPTS, false);
+	tx_dropped_expected = lost;
+	atomic_clear(&tx_dropped);
+
+	err = packet_send(lost, packet_len(lost));
+
+	if (TX_WINDOW_SIZE > 1) {
+		/* The packet is dropped in the background and reported through the hook */
+		zassert_ok(err);
+		k_sleep(TX_GIVE_UP_TIME);
+		zassert_equal(atomic_get(&tx_dropped), 1, "Drop not reported");
+	} else {
+		zassert_equal(err, -EPROTO);
+	}
+
+	zassert_equal(lossy_link_fault_pending(), 0, "Fault not applied");
+	zassert_equal(k_sem_take(&rx_sem, K_NO_WAIT), -EBUSY, "Lost packet received");
+
+	/* The receiver still expects the lost packet, so the next one must resynchronize it */
+	rx_expected = lost + 1;
+	packets_transfer(FAULT_PACKETS_NUM);
+}
+
+ZTEST(nrf_rpc_uart, test_send_after_earlier_drop)
+{
+	uint32_t first = rx_expected;
+	uint32_t next = first + TX_WINDOW_SIZE;
+
+	if (TX_WINDOW_SIZE == 1) {
+		ztest_test_skip();
+	}
+
+	/* Drop all transmission attempts of a full window of packets */
+	lossy_link_fault_set(LOSSY_LINK_DROP, TX_WINDOW_SIZE * CONFIG_NRF_RPC_UART_TX_ATTEMPTS,
+			     false);
+	tx_dropped_expected = first;
+	atomic_clear(&tx_dropped);
+
+	for (uint32_t i = 0; i < TX_WINDOW_SIZE; i++) {
+		zassert_ok(packet_send(first + i, packet_len(first + i)));
+	}
+
+	/*
+	 * The next packet waits for the window and finds out that the earlier ones are dropped.
+	 * The drop is reported through the hook, and the packet is still sent and resynchronizes
+	 * the receiver.
+	 */
+	rx_expected = next;
+	zassert_ok(packet_send(next, packet_len(next)));
+	zassert_equal(atomic_get(&tx_dropped), TX_WINDOW_SIZE, "Drops not reported");
+	zassert_equal(lossy_link_fault_pending(), 0, "Fault not applied");
+
+	zassert_ok(k_sem_take(&rx_sem, RX_TIMEOUT), "Packet not received");
+	zassert_equal(rx_expected, next + 1);
+	zassert_equal(atomic_get(&rx_errors), 0, "Wrong packets received or dropped");
+
+	packets_transfer(FAULT_PACKETS_NUM);
+}
+
+ZTEST(nrf_rpc_uart, test_slow_handler)
+{
+	uint32_t first = rx_expected;
+
+	if (RX_PKT_COUNT == 1) {
+		ztest_test_skip();
+	}
+
+	slow_index = first;
+	atomic_clear(&tx_dropped);
+
+	zassert_ok(packet_send(first, packet_len(first)));
+	zassert_ok(k_sem_take(&slow_blocked_sem, RX_TIMEOUT), "Packet not received");
+
+	/*
+	 * While the handler is blocked, the following packets keep being decoded and acknowledged
+	 * until all the buffers wait for delivery. Otherwise, the sender would give up on them.
+	 */
+	for (uint32_t i = 1; i < RX_PKT_COUNT; i++) {
+		zassert_ok(packet_send(first + i, packet_len(first + i)));
+	}
+
+	k_sleep(TX_GIVE_UP_TIME);
+	zassert_equal(atomic_get(&tx_dropped), 0, "Packets not acknowledged");
+	zassert_equal(rx_expected, first + 1, "Packets delivered before the handler returned");
+
+	slow_index = UINT32_MAX;
+	k_sem_give(&slow_release_sem);
+
+	for (uint32_t i = 0; i < RX_PKT_COUNT; i++) {
+		zassert_ok(k_sem_take(&rx_sem, RX_TIMEOUT), "Packet %u not received", i);
+	}
+
+	zassert_equal(rx_expected, first + RX_PKT_COUNT);
+	zassert_equal(atomic_get(&rx_errors), 0, "Packets received corrupted or out of order");
+
+	packets_transfer(FAULT_PACKETS_NUM);
+}
+
+ZTEST(nrf_rpc_uart, test_bench_throughput)
+{
+	uint32_t first = rx_expected;
+	timing_t start;
+	timing_t end;
+	uint64_t ns;
+
+	start = timing_counter_get();
+
+	for (uint32_t i = 0; i < BENCH_PACKETS_NUM; i++) {
+		zassert_ok(packet_send(first + i, packet_len(first + i)));
+	}
+
+	for (uint32_t i = 0; i < BENCH_PACKETS_NUM; i++) {
+		zassert_ok(k_sem_take(&rx_sem, RX_TIMEOUT), "Packet %u not received", i);
+	}
+
+	end = timing_counter_get();
+	ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+
+	zassert_equal(atomic_get(&rx_errors), 0, "Packets received corrupted or out of order");
+
+	TC_PRINT("TX window %d: %u packets in %llu us\n", TX_WINDOW_SIZE, BENCH_PACKETS_NUM,
+		 ns / NSEC_PER_USEC);
+}
+
+static void *suite_setup(void)
+{
+	lossy_link_init(DEVICE_DT_GET(RPC_UART_NODE));
+
+	zassert_ok(tr->api->init(tr, receive_cb, NULL));
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(nrf_rpc_uart, NULL, suite_setup, NULL, NULL, suite_teardown);
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Replaces the CRACEN common header, which depends on the full CRACEN PSA driver.
+ * Only the declarations used by the software workarounds under test are provided.
+ */
+
+#ifndef CRACEN_COMMON_H
+#define CRACEN_COMMON_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <psa/crypto.h>
+#include <sxsymcrypt/internal.h>
+#include <cracen_psa_primitives.h>
+
+psa_status_t silex_statuscodes_to_psa(int sx_status);
+
+void cracen_xorbytes(uint8_t *a, const uint8_t *b, size_t sz);
+
+psa_status_t cracen_load_keyref(const psa_key_attributes_t *attributes, const uint8_t *key_buffer,
+				size_t key_buffer_size, struct sxkeyref *k);
+
+#endif /* CRACEN_COMMON_H */
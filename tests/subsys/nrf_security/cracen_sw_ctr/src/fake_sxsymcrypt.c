@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Software AES stand-in for the sxsymcrypt block cipher calls used by the CRACEN
+ * software workarounds, together with the CRACEN common helpers they depend on.
+ * The hardware cost is modeled with k_busy_wait(), which advances the simulated
+ * time on native_sim.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <sxsymcrypt/aes.h>
+#include <sxsymcrypt/blkcipher.h>
+#include <sxsymcrypt/internal.h>
+#include <sxsymcrypt/keyref.h>
+#include <cracen/common.h>
+#include <cracen/statuscodes.h>
+
+#include "fake_sxsymcrypt.h"
+
+LOG_MODULE_REGISTER(cracen, CONFIG_CRACEN_LOG_LEVEL);
+
+#define AES_BLK_SZ     16
+#define AES_MAX_ROUNDS 14
+/* Largest chunk the fake accepts in one operation */
+#define FAKE_SX_MAX_SZ 4096
+
+static const uint8_t sbox[256] = {
+	0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab,
+	0x76, 0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4,
+	0x72, 0xc0, 0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71,
+	0xd8, 0x31, 0x15, 0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2,
+	0xeb, 0x27, 0xb2, 0x75, 0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6,
+	0xb3, 0x29, 0xe3, 0x2f, 0x84, 0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb,
+	0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf, 0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45,
+	0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8, 0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5,
+	0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2, 0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44,
+	0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73, 0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a,
+	0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb, 0xe0, 0x32, 0x3a, 0x0a, 0x49,
+	0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79, 0xe7, 0xc8, 0x37, 0x6d,
+	0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08, 0xba, 0x78, 0x25,
+	0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a, 0x70, 0x3e,
+	0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e, 0xe1,
+	0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+	0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb,
+	0x16,
+};
+
+static struct {
+	uint8_t round_keys[(AES_MAX_ROUNDS + 1) * AES_BLK_SZ];
+	size_t rounds;
+	const uint8_t *in;
+	uint8_t *out;
+	bool reserved;
+	uint32_t runs;
+} fake;
+
+static uint8_t xtime(uint8_t x)
+{
+	return (x << 1) ^ ((x & 0x80) ? 0x1b : 0);
+}
+
+static void aes_expand_key(const uint8_t *key, size_t key_sz)
+{
+	size_t nk = key_sz / 4;
+	size_t words = 4 * (nk + 7);
+	uint8_t rcon = 1;
+	uint8_t *w = fake.round_keys;
+
+	fake.rounds = nk + 6;
+	memcpy(w, key, key_sz);
+
+	for (size_t i = nk; i < words; i++) {
+		uint8_t t[4];
+
+		memcpy(t, &w[(i - 1) * 4], 4);
+		if (i % nk == 0) {
+			uint8_t first = t[0];
+
+			t[0] = sbox[t[1]] ^ rcon;
+			t[1] = sbox[t[2]];
+			t[2] = sbox[t[3]];
+			t[3] = sbox[first];
+			rcon = xtime(rcon);
+		} else if (nk > 6 && i % nk == 4) {
+			for (size_t j = 0; j < 4; j++) {
+				t[j] = sbox[t[j]];
+			}
+		}
+		for (size_t j = 0; j < 4; j++) {
+			w[i * 4 + j] = w[(i - nk) * 4 + j] ^ t[j];
+		}
+	}
+}
+
+static void aes_encrypt_block(const uint8_t *in, uint8_t *out)
+{
+	uint8_t s[AES_BLK_SZ];
+
+	for (size_t i = 0; i < AES_BLK_SZ; i++) {
+		s[i] = in[i] ^ fake.round_keys[i];
+	}
+
+	for (size_t round = 1; round <= fake.rounds; round++) {
+		uint8_t t[AES_BLK_SZ];
+
+		/* SubBytes and ShiftRows */
+		for (size_t c = 0; c < 4; c++) {
+			for (size_t r = 0; r < 4; r++) {
+				t[c * 4 + r] = sbox[s[((c + r) % 4) * 4 + r]];
+			}
+		}
+
+		/* MixColumns, except in the last round */
+		if (round < fake.rounds) {
+			for (size_t c = 0; c < 4; c++) {
+				uint8_t *col = &t[c * 4];
+				uint8_t all = col[0] ^ col[1] ^ col[2] ^ col[3];
+				uint8_t first = col[0];
+
+				col[0] ^= all ^ xtime(col[0] ^ col[1]);
+				col[1] ^= all ^ xtime(col[1] ^ col[2]);
+				col[2] ^= all ^ xtime(col[2] ^ col[3]);
+				col[3] ^= all ^ xtime(col[3] ^ first);
+			}
+		}
+
+		for (size_t i = 0; i < AES_BLK_SZ; i++) {
+			s[i] = t[i] ^ fake.round_keys[round * AES_BLK_SZ + i];
+		}
+	}
+
+	memcpy(out, s, AES_BLK_SZ);
+}
+
+uint32_t fake_sx_run_count(void)
+{
+	return fake.runs;
+}
+
+void fake_sx_reset(void)
+{
+	fake.runs = 0;
+}
+
+int sx_hw_reserve(struct sx_dmactl *dma, sx_hw_reserve_flags_t flags)
+{
+	ARG_UNUSED(dma);
+	ARG_UNUSED(flags);
+
+	if (fake.reserved) {
+		return SX_ERR_RETRY;
+	}
+	fake.reserved = true;
+	return SX_OK;
+}
+
+void sx_hw_release(struct sx_dmactl *dma)
+{
+	ARG_UNUSED(dma);
+
+	fake.reserved = false;
+}
+
+int sx_blkcipher_create_aesecb_enc(struct sxblkcipher *c, const struct sxkeyref *key)
+{
+	if (key->sz != 16 && key->sz != 24 && key->sz != 32) {
+		return SX_ERR_INVALID_KEY_SZ;
+	}
+
+	c->key = key;
+	c->textsz = 0;
+	aes_expand_key(key->key, key->sz);
+	return SX_OK;
+}
+
+int sx_blkcipher_create_aesecb_dec(struct sxblkcipher *c, const struct sxkeyref *key)
+{
+	ARG_UNUSED(c);
+	ARG_UNUSED(key);
+
+	/* Only the encryption direction is used by the CTR based modes */
+	return SX_ERR_INCOMPATIBLE_HW;
+}
+
+int sx_blkcipher_crypt(struct sxblkcipher *c, const uint8_t *datain, size_t sz, uint8_t *dataout)
+{
+	if (sz == 0 || (sz % AES_BLK_SZ) != 0) {
+		return SX_ERR_WRONG_SIZE_GRANULARITY;
+	}
+
+	if (sz > FAKE_SX_MAX_SZ) {
+		return SX_ERR_TOO_BIG;
+	}
+
+	c->textsz = sz;
+	fake.in = datain;
+	fake.out = dataout;
+	return SX_OK;
+}
+
+int sx_blkcipher_run(struct sxblkcipher *c)
+{
+	size_t blocks = c->textsz / AES_BLK_SZ;
+
+	for (size_t i = 0; i < blocks; i++) {
+		aes_encrypt_block(&fake.in[i * AES_BLK_SZ], &fake.out[i * AES_BLK_SZ]);
+	}
+
+	fake.runs++;
+	k_busy_wait(FAKE_SX_SETUP_US + blocks * FAKE_SX_BLOCK_US);
+	return SX_OK;
+}
+
+int sx_blkcipher_wait(struct sxblkcipher *c)
+{
+	ARG_UNUSED(c);
+
+	return SX_OK;
+}
+
+psa_status_t silex_statuscodes_to_psa(int sx_status)
+{
+	return (sx_status == SX_OK) ? PSA_SUCCESS : PSA_ERROR_HARDWARE_FAILURE;
+}
+
+void cracen_xorbytes(uint8_t *a, const uint8_t *b, size_t sz)
+{
+	for (size_t i = 0; i < sz; i++) {
+		a[i] ^= b[i];
+	}
+}
+
+/* Only plain AES keys in the key buffer are used by the tests */
+psa_status_t cracen_load_keyref(const psa_key_attributes_t *attributes, const uint8_t *key_buffer,
+				size_t key_buffer_size, struct sxkeyref *k)
+{
+	ARG_UNUSED(attributes);
+
+	memset(k, 0, sizeof(*k));
+	k->key = key_buffer;
+	k->sz = key_buffer_size;
+	return PSA_SUCCESS;
+}
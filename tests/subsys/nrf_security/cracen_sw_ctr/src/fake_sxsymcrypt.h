@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FAKE_SXSYMCRYPT_H_
+#define FAKE_SXSYMCRYPT_H_
+
+#include <stdint.h>
+
+/* Simulated cost of one block cipher operation. Each operation pays a fixed cost for
+ * reserving the hardware, loading the key and the DMA descriptors, and a cost per block.
+ */
+#define FAKE_SX_SETUP_US 8
+#define FAKE_SX_BLOCK_US 1
+
+/* Number of block cipher operations run since the last reset. */
+uint32_t fake_sx_run_count(void);
+void fake_sx_reset(void);
+
+#endif /* FAKE_SXSYMCRYPT_H_ */
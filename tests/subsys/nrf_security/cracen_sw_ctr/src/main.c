@@ -0,0 +1,528 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+#include <zephyr/ztest.h>
+#include <sxsymcrypt/internal.h>
+#include <sxsymcrypt/keyref.h>
+#include <cracen_psa_primitives.h>
+#include <cracen_sw_common.h>
+#include <cracen_sw_aes_ctr.h>
+#include <cracen_sw_aes_ccm.h>
+#include <cracen_sw_aes_gcm.h>
+
+#include "fake_sxsymcrypt.h"
+
+#define AES_BLK_SZ	  16
+#define TEST_BUF_SZ	  4096
+#define THROUGHPUT_ROUNDS 4
+#define SP800_38C_TAG_LEN 8
+
+/* NIST SP 800-38A, F.5.1 CTR-AES128.Encrypt */
+static const uint8_t sp800_38a_key[] = {
+	0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+	0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c,
+};
+
+static const uint8_t sp800_38a_ctr[] = {
+	0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+	0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+};
+
+static const uint8_t sp800_38a_plaintext[] = {
+	0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+	0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+	0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+	0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+	0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+	0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+	0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+	0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10,
+};
+
+static const uint8_t sp800_38a_ciphertext[] = {
+	0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26,
+	0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+	0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff,
+	0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+	0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e,
+	0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+	0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1,
+	0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee,
+};
+
+/* NIST SP 800-38C, C.3 Example 3 */
+static const uint8_t sp800_38c_key[] = {
+	0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+	0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+};
+
+static const uint8_t sp800_38c_nonce[] = {
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+	0x18, 0x19, 0x1a, 0x1b,
+};
+
+static const uint8_t sp800_38c_ad[] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13,
+};
+
+static const uint8_t sp800_38c_plaintext[] = {
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+	0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+};
+
+static const uint8_t sp800_38c_ciphertext[] = {
+	0xe3, 0xb2, 0x01, 0xa9, 0xf5, 0xb7, 0x1a, 0x7a,
+	0x9b, 0x1c, 0xea, 0xec, 0xcd, 0x97, 0xe7, 0x0b,
+	0x61, 0x76, 0xaa, 0xd9, 0xa4, 0x42, 0x8a, 0xa5,
+};
+
+static const uint8_t sp800_38c_tag[] = {
+	0x48, 0x43, 0x92, 0xfb, 0xc1, 0xb0, 0x99, 0x51,
+};
+
+/* GCM test case 4 of the GCM specification referenced by NIST SP 800-38D */
+static const uint8_t sp800_38d_key[] = {
+	0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+	0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+};
+
+static const uint8_t sp800_38d_nonce[] = {
+	0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad,
+	0xde, 0xca, 0xf8, 0x88,
+};
+
+static const uint8_t sp800_38d_ad[] = {
+	0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+	0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+	0xab, 0xad, 0xda, 0xd2,
+};
+
+static const uint8_t sp800_38d_plaintext[] = {
+	0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5,
+	0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+	0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda,
+	0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+	0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53,
+	0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+	0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57,
+	0xba, 0x63, 0x7b, 0x39,
+};
+
+static const uint8_t sp800_38d_ciphertext[] = {
+	0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24,
+	0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+	0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0,
+	0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+	0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c,
+	0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+	0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97,
+	0x3d, 0x58, 0xe0, 0x91,
+};
+
+static const uint8_t sp800_38d_tag[] = {
+	0x5b, 0xc9, 0x4f, 0xbc, 0x32, 0x21, 0xa5, 0xdb,
+	0x94, 0xfa, 0xe9, 0x5a, 0xe7, 0x12, 0x1a, 0x47,
+};
+
+static const struct sxkeyref keyref = {
+	.key = sp800_38a_key,
+	.sz = sizeof(sp800_38a_key),
+};
+
+/* The key attributes are not used by the fake key loading */
+static psa_key_attributes_t key_attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+/* Lengths of the successive calls of the multipart tests, not aligned to the block size */
+static const size_t chunk_lengths[] = {1, 15, 17, 3, 32};
+
+static struct sxblkcipher cipher;
+static uint8_t input[TEST_BUF_SZ];
+static uint8_t output[TEST_BUF_SZ];
+static uint8_t expected[TEST_BUF_SZ];
+
+/* Keystream state of a CTR operation, as kept in the operation contexts */
+struct ctr_state {
+	uint8_t ctr[AES_BLK_SZ];
+	uint8_t keystream[AES_BLK_SZ];
+	size_t keystream_offset;
+};
+
+static void ctr_state_init(struct ctr_state *state, const uint8_t *ctr)
+{
+	memcpy(state->ctr, ctr, AES_BLK_SZ);
+	state->keystream_offset = AES_BLK_SZ;
+}
+
+static psa_status_t ctr_xor_batched(struct ctr_state *state, size_t counter_start_pos,
+				    const uint8_t *in, uint8_t *out, size_t len)
+{
+	return cracen_sw_aes_ctr_xor(&cipher, &keyref, state->ctr, counter_start_pos,
+				     state->keystream, &state->keystream_offset, in, out, len);
+}
+
+/* One block cipher operation per keystream block, as done before the keystream batching */
+static psa_status_t ctr_xor_per_block(struct ctr_state *state, const uint8_t *in, uint8_t *out,
+				      size_t len)
+{
+	psa_status_t status;
+
+	for (size_t i = 0; i < len; i++) {
+		if (state->keystream_offset == AES_BLK_SZ) {
+			status = cracen_sw_aes_primitive(&cipher, &keyref, state->ctr,
+							 state->keystream);
+			if (status != PSA_SUCCESS) {
+				return status;
+			}
+			(void)cracen_sw_increment_counter_be(state->ctr, AES_BLK_SZ, 0);
+			state->keystream_offset = 0;
+		}
+		out[i] = in[i] ^ state->keystream[state->keystream_offset++];
+	}
+
+	return PSA_SUCCESS;
+}
+
+static size_t chunk_length(size_t call, size_t remaining)
+{
+	return MIN(chunk_lengths[call % ARRAY_SIZE(chunk_lengths)], remaining);
+}
+
+typedef psa_status_t (*aead_update_ad_fn)(cracen_aead_operation_t *operation,
+					  const uint8_t *input, size_t input_length);
+typedef psa_status_t (*aead_update_fn)(cracen_aead_operation_t *operation, const uint8_t *input,
+				       size_t input_length, uint8_t *output, size_t output_size,
+				       size_t *output_length);
+
+/* Feeds the additional data and the input to an AEAD operation in chunks */
+static void aead_update_split(cracen_aead_operation_t *operation, aead_update_ad_fn update_ad,
+			      aead_update_fn update, const uint8_t *ad, size_t ad_len,
+			      const uint8_t *in, size_t in_len, uint8_t *out)
+{
+	psa_status_t status;
+	size_t processed = 0;
+	size_t output_length;
+
+	for (size_t call = 0; processed < ad_len; call++) {
+		size_t len = chunk_length(call, ad_len - processed);
+
+		status = update_ad(operation, &ad[processed], len);
+		zassert_equal(status, PSA_SUCCESS, "AD update failed: %d", status);
+		processed += len;
+	}
+
+	processed = 0;
+	for (size_t call = 0; processed < in_len; call++) {
+		size_t len = chunk_length(call, in_len - processed);
+
+		status = update(operation, &in[processed], len, &out[processed], in_len - processed,
+				&output_length);
+		zassert_equal(status, PSA_SUCCESS, "Update failed: %d", status);
+		zassert_equal(output_length, len, "Unexpected output length");
+		processed += len;
+	}
+}
+
+static uint64_t elapsed_us(uint32_t start)
+{
+	return k_cyc_to_us_floor64(k_cycle_get_32() - start);
+}
+
+static void *cracen_sw_ctr_setup(void)
+{
+	sys_rand_get(input, sizeof(input));
+	return NULL;
+}
+
+static void cracen_sw_ctr_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	fake_sx_reset();
+	memset(output, 0, sizeof(output));
+}
+
+ZTEST(cracen_sw_ctr, test_sp800_38a_vector)
+{
+	struct ctr_state state;
+	psa_status_t status;
+
+	ctr_state_init(&state, sp800_38a_ctr);
+	status = ctr_xor_batched(&state, 0, sp800_38a_plaintext, output,
+				 sizeof(sp800_38a_plaintext));
+
+	zassert_equal(status, PSA_SUCCESS, "CTR failed: %d", status);
+	zassert_mem_equal(output, sp800_38a_ciphertext, sizeof(sp800_38a_ciphertext));
+	zassert_equal(fake_sx_run_count(),
+		      DIV_ROUND_UP(sizeof(sp800_38a_plaintext) / AES_BLK_SZ,
+				   CONFIG_CRACEN_SW_AES_CTR_BATCH_BLOCKS),
+		      "Unexpected number of block cipher operations");
+}
+
+ZTEST(cracen_sw_ctr, test_in_place)
+{
+	struct ctr_state state;
+	psa_status_t status;
+
+	memcpy(output, sp800_38a_plaintext, sizeof(sp800_38a_plaintext));
+	ctr_state_init(&state, sp800_38a_ctr);
+	status = ctr_xor_batched(&state, 0, output, output, sizeof(sp800_38a_plaintext));
+
+	zassert_equal(status, PSA_SUCCESS, "CTR failed: %d", status);
+	zassert_mem_equal(output, sp800_38a_ciphertext, sizeof(sp800_38a_ciphertext));
+}
+
+ZTEST(cracen_sw_ctr, test_split_input)
+{
+	struct ctr_state state;
+	psa_status_t status;
+	size_t processed = 0;
+
+	ctr_state_init(&state, sp800_38a_ctr);
+	status = ctr_xor_per_block(&state, input, expected, TEST_BUF_SZ);
+	zassert_equal(status, PSA_SUCCESS, "Reference CTR failed: %d", status);
+
+	/* Chunks of random length, not aligned to the block or the batch size */
+	ctr_state_init(&state, sp800_38a_ctr);
+	while (processed < TEST_BUF_SZ) {
+		size_t len = MIN(sys_rand32_get() % (3 * CONFIG_CRACEN_SW_AES_CTR_BATCH_BLOCKS *
+						     AES_BLK_SZ),
+				 TEST_BUF_SZ - processed);
+
+		status = ctr_xor_batched(&state, 0, &input[processed], &output[processed], len);
+		zassert_equal(status, PSA_SUCCESS, "CTR failed: %d", status);
+		processed += len;
+	}
+
+	zassert_mem_equal(output, expected, TEST_BUF_SZ);
+}
+
+ZTEST(cracen_sw_ctr, test_counter_wrap)
+{
+	struct ctr_state state;
+	psa_status_t status;
+	uint8_t ctr[AES_BLK_SZ];
+
+	/* A counter spanning the whole block wraps around */
+	memset(ctr, 0xff, sizeof(ctr));
+	ctr[AES_BLK_SZ - 1] = 0xfe;
+	ctr_state_init(&state, ctr);
+	status = ctr_xor_batched(&state, 0, input, output, 4 * AES_BLK_SZ);
+	zassert_equal(status, PSA_SUCCESS, "CTR failed: %d", status);
+
+	/* A 32-bit counter field must not reach zero again */
+	ctr_state_init(&state, ctr);
+	status = ctr_xor_batched(&state, AES_BLK_SZ - 4, input, output, 2 * AES_BLK_SZ);
+	zassert_equal(status, PSA_SUCCESS, "CTR failed: %d", status);
+
+	status = ctr_xor_batched(&state, AES_BLK_SZ - 4, input, output, AES_BLK_SZ);
+	zassert_equal(status, PSA_ERROR_INVALID_ARGUMENT, "Counter overflow not detected");
+}
+
+ZTEST(cracen_sw_ctr, test_sp800_38a_multipart)
+{
+	cracen_cipher_operation_t operation = {0};
+	psa_status_t status;
+	size_t processed = 0;
+	size_t output_length;
+
+	status = cracen_sw_aes_ctr_setup(&operation, &key_attributes, sp800_38a_key,
+					 sizeof(sp800_38a_key));
+	zassert_equal(status, PSA_SUCCESS, "Setup failed: %d", status);
+	status = cracen_sw_aes_ctr_set_iv(&operation, sp800_38a_ctr, sizeof(sp800_38a_ctr));
+	zassert_equal(status, PSA_SUCCESS, "Setting the IV failed: %d", status);
+
+	for (size_t call = 0; processed < sizeof(sp800_38a_plaintext); call++) {
+		size_t len = chunk_length(call, sizeof(sp800_38a_plaintext) - processed);
+
+		status = cracen_sw_aes_ctr_update(&operation, &sp800_38a_plaintext[processed], len,
+						  &output[processed], sizeof(output) - processed,
+						  &output_length);
+		zassert_equal(status, PSA_SUCCESS, "Update failed: %d", status);
+		zassert_equal(output_length, len, "Unexpected output length");
+		processed += len;
+	}
+
+	status = cracen_sw_aes_ctr_finish(&operation, &output_length);
+	zassert_equal(status, PSA_SUCCESS, "Finish failed: %d", status);
+	zassert_equal(output_length, 0, "Unexpected output from finish");
+	zassert_mem_equal(output, sp800_38a_ciphertext, sizeof(sp800_38a_ciphertext));
+
+	/* CTR decryption is the same operation */
+	status = cracen_sw_aes_ctr_crypt(&key_attributes, sp800_38a_key, sizeof(sp800_38a_key),
+					 sp800_38a_ctr, sizeof(sp800_38a_ctr),
+					 sp800_38a_ciphertext, sizeof(sp800_38a_ciphertext),
+					 output, sizeof(output), &output_length);
+	zassert_equal(status, PSA_SUCCESS, "Decryption failed: %d", status);
+	zassert_equal(output_length, sizeof(sp800_38a_plaintext), "Unexpected output length");
+	zassert_mem_equal(output, sp800_38a_plaintext, sizeof(sp800_38a_plaintext));
+}
+
+ZTEST(cracen_sw_ctr, test_sp800_38c_ccm)
+{
+	const psa_algorithm_t alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM,
+								    SP800_38C_TAG_LEN);
+	cracen_aead_operation_t operation = {0};
+	uint8_t message[sizeof(sp800_38c_ciphertext) + sizeof(sp800_38c_tag)];
+	uint8_t tag[SX_BLKCIPHER_AES_BLK_SZ];
+	size_t output_length;
+	size_t tag_length;
+	psa_status_t status;
+
+	status = cracen_sw_aes_ccm_encrypt_setup(&operation, &key_attributes, sp800_38c_key,
+						 sizeof(sp800_38c_key), alg);
+	zassert_equal(status, PSA_SUCCESS, "Setup failed: %d", status);
+	status = cracen_sw_aes_ccm_set_lengths(&operation, sizeof(sp800_38c_ad),
+					       sizeof(sp800_38c_plaintext));
+	zassert_equal(status, PSA_SUCCESS, "Setting the lengths failed: %d", status);
+	status = cracen_sw_aes_ccm_set_nonce(&operation, sp800_38c_nonce, sizeof(sp800_38c_nonce));
+	zassert_equal(status, PSA_SUCCESS, "Setting the nonce failed: %d", status);
+
+	aead_update_split(&operation, cracen_sw_aes_ccm_update_ad, cracen_sw_aes_ccm_update,
+			  sp800_38c_ad, sizeof(sp800_38c_ad), sp800_38c_plaintext,
+			  sizeof(sp800_38c_plaintext), output);
+
+	status = cracen_sw_aes_ccm_finish(&operation, NULL, 0, &output_length, tag, sizeof(tag),
+					  &tag_length);
+	zassert_equal(status, PSA_SUCCESS, "Finish failed: %d", status);
+	zassert_equal(tag_length, sizeof(sp800_38c_tag), "Unexpected tag length");
+	zassert_mem_equal(output, sp800_38c_ciphertext, sizeof(sp800_38c_ciphertext));
+	zassert_mem_equal(tag, sp800_38c_tag, sizeof(sp800_38c_tag));
+	cracen_sw_aes_ccm_abort(&operation);
+
+	/* One-shot decryption of the ciphertext followed by the tag */
+	memcpy(message, sp800_38c_ciphertext, sizeof(sp800_38c_ciphertext));
+	memcpy(&message[sizeof(sp800_38c_ciphertext)], sp800_38c_tag, sizeof(sp800_38c_tag));
+	status = cracen_sw_aes_ccm_decrypt(&key_attributes, sp800_38c_key, sizeof(sp800_38c_key),
+					   alg, sp800_38c_nonce, sizeof(sp800_38c_nonce),
+					   sp800_38c_ad, sizeof(sp800_38c_ad), message,
+					   sizeof(message), output, sizeof(output), &output_length);
+	zassert_equal(status, PSA_SUCCESS, "Decryption failed: %d", status);
+	zassert_equal(output_length, sizeof(sp800_38c_plaintext), "Unexpected output length");
+	zassert_mem_equal(output, sp800_38c_plaintext, sizeof(sp800_38c_plaintext));
+
+	message[sizeof(sp800_38c_ciphertext)] ^= 1;
+	status = cracen_sw_aes_ccm_decrypt(&key_attributes, sp800_38c_key, sizeof(sp800_38c_key),
+					   alg, sp800_38c_nonce, sizeof(sp800_38c_nonce),
+					   sp800_38c_ad, sizeof(sp800_38c_ad), message,
+					   sizeof(message), output, sizeof(output), &output_length);
+	zassert_equal(status, PSA_ERROR_INVALID_SIGNATURE, "Modified tag not detected");
+}
+
+ZTEST(cracen_sw_ctr, test_sp800_38d_gcm)
+{
+	cracen_aead_operation_t operation = {0};
+	uint8_t modified[sizeof(sp800_38d_ciphertext)];
+	uint8_t tag[SX_BLKCIPHER_AES_BLK_SZ];
+	size_t output_length;
+	size_t tag_length;
+	psa_status_t status;
+
+	status = cracen_sw_aes_gcm_encrypt_setup(&operation, &key_attributes, sp800_38d_key,
+						 sizeof(sp800_38d_key), PSA_ALG_GCM);
+	zassert_equal(status, PSA_SUCCESS, "Setup failed: %d", status);
+	status = cracen_sw_aes_gcm_set_nonce(&operation, sp800_38d_nonce, sizeof(sp800_38d_nonce));
+	zassert_equal(status, PSA_SUCCESS, "Setting the nonce failed: %d", status);
+
+	aead_update_split(&operation, cracen_sw_aes_gcm_update_ad, cracen_sw_aes_gcm_update,
+			  sp800_38d_ad, sizeof(sp800_38d_ad), sp800_38d_plaintext,
+			  sizeof(sp800_38d_plaintext), output);
+
+	status = cracen_sw_aes_gcm_finish(&operation, NULL, 0, &output_length, tag, sizeof(tag),
+					  &tag_length);
+	zassert_equal(status, PSA_SUCCESS, "Finish failed: %d", status);
+	zassert_equal(tag_length, sizeof(sp800_38d_tag), "Unexpected tag length");
+	zassert_mem_equal(output, sp800_38d_ciphertext, sizeof(sp800_38d_ciphertext));
+	zassert_mem_equal(tag, sp800_38d_tag, sizeof(sp800_38d_tag));
+	cracen_sw_aes_gcm_abort(&operation);
+
+	status = cracen_sw_aes_gcm_decrypt_setup(&operation, &key_attributes, sp800_38d_key,
+						 sizeof(sp800_38d_key), PSA_ALG_GCM);
+	zassert_equal(status, PSA_SUCCESS, "Setup failed: %d", status);
+	status = cracen_sw_aes_gcm_set_nonce(&operation, sp800_38d_nonce, sizeof(sp800_38d_nonce));
+	zassert_equal(status, PSA_SUCCESS, "Setting the nonce failed: %d", status);
+
+	aead_update_split(&operation, cracen_sw_aes_gcm_update_ad, cracen_sw_aes_gcm_update,
+			  sp800_38d_ad, sizeof(sp800_38d_ad), sp800_38d_ciphertext,
+			  sizeof(sp800_38d_ciphertext), output);
+
+	status = cracen_sw_aes_gcm_verify(&operation, NULL, 0, &output_length, sp800_38d_tag,
+					  sizeof(sp800_38d_tag));
+	zassert_equal(status, PSA_SUCCESS, "Verification failed: %d", status);
+	zassert_mem_equal(output, sp800_38d_plaintext, sizeof(sp800_38d_plaintext));
+	cracen_sw_aes_gcm_abort(&operation);
+
+	/* A modified ciphertext must fail the verification */
+	memcpy(modified, sp800_38d_ciphertext, sizeof(modified));
+	modified[sizeof(modified) - 1] ^= 1;
+	status = cracen_sw_aes_gcm_decrypt_setup(&operation, &key_attributes, sp800_38d_key,
+						 sizeof(sp800_38d_key), PSA_ALG_GCM);
+	zassert_equal(status, PSA_SUCCESS, "Setup failed: %d", status);
+	status = cracen_sw_aes_gcm_set_nonce(&operation, sp800_38d_nonce, sizeof(sp800_38d_nonce));
+	zassert_equal(status, PSA_SUCCESS, "Setting the nonce failed: %d", status);
+
+	aead_update_split(&operation, cracen_sw_aes_gcm_update_ad, cracen_sw_aes_gcm_update,
+			  sp800_38d_ad, sizeof(sp800_38d_ad), modified, sizeof(modified), output);
+
+	status = cracen_sw_aes_gcm_verify(&operation, NULL, 0, &output_length, sp800_38d_tag,
+					  sizeof(sp800_38d_tag));
+	zassert_equal(status, PSA_ERROR_INVALID_SIGNATURE, "Modified ciphertext not detected");
+	cracen_sw_aes_gcm_abort(&operation);
+}
+
+ZTEST(cracen_sw_ctr, test_throughput)
+{
+	static const size_t sizes[] = {16, 64, 256, 1024, 4096};
+	struct ctr_state state;
+	psa_status_t status;
+
+	TC_PRINT("%8s %14s %14s\n", "bytes", "per-block MB/s", "batched MB/s");
+
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		uint64_t per_block_us;
+		uint64_t batched_us;
+		uint32_t per_block_rate;
+		uint32_t batched_rate;
+		uint32_t start;
+
+		start = k_cycle_get_32();
+		for (size_t round = 0; round < THROUGHPUT_ROUNDS; round++) {
+			ctr_state_init(&state, sp800_38a_ctr);
+			status = ctr_xor_per_block(&state, input, expected, sizes[i]);
+			zassert_equal(status, PSA_SUCCESS, "Reference CTR failed: %d", status);
+		}
+		per_block_us = elapsed_us(start);
+
+		start = k_cycle_get_32();
+		for (size_t round = 0; round < THROUGHPUT_ROUNDS; round++) {
+			ctr_state_init(&state, sp800_38a_ctr);
+			status = ctr_xor_batched(&state, 0, input, output, sizes[i]);
+			zassert_equal(status, PSA_SUCCESS, "CTR failed: %d", status);
+		}
+		batched_us = elapsed_us(start);
+
+		zassert_mem_equal(output, expected, sizes[i]);
+		zassert_true(per_block_us > 0 && batched_us > 0, "No time elapsed");
+
+		/* One byte per microsecond is one MB/s */
+		per_block_rate = (THROUGHPUT_ROUNDS * sizes[i] * 100) / per_block_us;
+		batched_rate = (THROUGHPUT_ROUNDS * sizes[i] * 100) / batched_us;
+		TC_PRINT("%8zu %11u.%02u %11u.%02u\n", sizes[i], per_block_rate / 100,
+			 per_block_rate % 100, batched_rate / 100, batched_rate % 100);
+
+		if (sizes[i] > AES_BLK_SZ && CONFIG_CRACEN_SW_AES_CTR_BATCH_BLOCKS > 1) {
+			zassert_true(batched_us < per_block_us,
+				     "Batched keystream is not faster for %zu bytes", sizes[i]);
+		}
+	}
+}
+
+ZTEST_SUITE(cracen_sw_ctr, NULL, cracen_sw_ctr_setup, cracen_sw_ctr_before, NULL, NULL);
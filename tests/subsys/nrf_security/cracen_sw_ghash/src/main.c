@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#include "gcm_ext.h"
+#include "host_cycles_bottom.h"
+
+#define GHASH_BLK_SZ	  16
+#define TEST_BUF_SZ	  16384
+#define THROUGHPUT_ROUNDS 8
+
+#if defined(CRACEN_SW_GCM_GHASH_TABLE8)
+#define GHASH_IMPL_NAME "8-bit table"
+#elif defined(CRACEN_SW_GCM_GHASH_CLMUL)
+#define GHASH_IMPL_NAME "carry-less multiplication"
+#else
+#define GHASH_IMPL_NAME "4-bit table"
+#endif
+
+struct ghash_vector {
+	const char *name;
+	uint8_t h[GHASH_BLK_SZ];
+	const uint8_t *aad;
+	size_t aad_len;
+	const uint8_t *ciphertext;
+	size_t ciphertext_len;
+	uint8_t ghash[GHASH_BLK_SZ];
+};
+
+/* The GCM test vectors from [MGV], with the intermediate H and GHASH values */
+static const uint8_t tc2_ciphertext[] = {
+	0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92,
+	0xf3, 0x28, 0xc2, 0xb9, 0x71, 0xb2, 0xfe, 0x78,
+};
+
+static const uint8_t tc3_ciphertext[] = {
+	0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24,
+	0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+	0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0,
+	0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+	0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c,
+	0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+	0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97,
+	0x3d, 0x58, 0xe0, 0x91, 0x47, 0x3f, 0x59, 0x85,
+};
+
+static const uint8_t tc4_aad[] = {
+	0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+	0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+	0xab, 0xad, 0xda, 0xd2,
+};
+
+static const struct ghash_vector vectors[] = {
+	{
+		.name = "Test Case 2",
+		.h = {0x66, 0xe9, 0x4b, 0xd4, 0xef, 0x8a, 0x2c, 0x3b,
+		      0x88, 0x4c, 0xfa, 0x59, 0xca, 0x34, 0x2b, 0x2e},
+		.ciphertext = tc2_ciphertext,
+		.ciphertext_len = sizeof(tc2_ciphertext),
+		.ghash = {0xf3, 0x8c, 0xbb, 0x1a, 0xd6, 0x92, 0x23, 0xdc,
+			  0xc3, 0x45, 0x7a, 0xe5, 0xb6, 0xb0, 0xf8, 0x85},
+	},
+	{
+		.name = "Test Case 3",
+		.h = {0xb8, 0x3b, 0x53, 0x37, 0x08, 0xbf, 0x53, 0x5d,
+		      0x0a, 0xa6, 0xe5, 0x29, 0x80, 0xd5, 0x3b, 0x78},
+		.ciphertext = tc3_ciphertext,
+		.ciphertext_len = sizeof(tc3_ciphertext),
+		.ghash = {0x7f, 0x1b, 0x32, 0xb8, 0x1b, 0x82, 0x0d, 0x02,
+			  0x61, 0x4f, 0x88, 0x95, 0xac, 0x1d, 0x4e, 0xac},
+	},
+	{
+		.name = "Test Case 4",
+		.h = {0xb8, 0x3b, 0x53, 0x37, 0x08, 0xbf, 0x53, 0x5d,
+		      0x0a, 0xa6, 0xe5, 0x29, 0x80, 0xd5, 0x3b, 0x78},
+		.aad = tc4_aad,
+		.aad_len = sizeof(tc4_aad),
+		.ciphertext = tc3_ciphertext,
+		.ciphertext_len = 60,
+		.ghash = {0x69, 0x8e, 0x57, 0xf7, 0x0e, 0x6e, 0xcc, 0x7f,
+			  0xd9, 0x46, 0x3b, 0x72, 0x60, 0xa9, 0xae, 0x5f},
+	},
+};
+
+static uint64_t h_table[GCM_EXT_HTABLE_SIZE][2];
+static uint8_t buf[TEST_BUF_SZ];
+
+static void ghash_update(uint8_t *y, const uint8_t *data, size_t len)
+{
+	uint8_t block[GHASH_BLK_SZ];
+
+	for (size_t i = 0; i < len; i += GHASH_BLK_SZ) {
+		size_t chunk = MIN(len - i, GHASH_BLK_SZ);
+
+		memset(block, 0, sizeof(block));
+		memcpy(block, &data[i], chunk);
+		for (size_t j = 0; j < GHASH_BLK_SZ; j++) {
+			block[j] ^= y[j];
+		}
+		gcm_ext_mult(h_table, block, y);
+	}
+}
+
+static void ghash(const struct ghash_vector *v, uint8_t *y)
+{
+	uint8_t len_block[GHASH_BLK_SZ];
+
+	memset(y, 0, GHASH_BLK_SZ);
+	ghash_update(y, v->aad, v->aad_len);
+	ghash_update(y, v->ciphertext, v->ciphertext_len);
+
+	sys_put_be64((uint64_t)v->aad_len * 8, &len_block[0]);
+	sys_put_be64((uint64_t)v->ciphertext_len * 8, &len_block[8]);
+	ghash_update(y, len_block, sizeof(len_block));
+}
+
+/* Multiplication in GF(2^128), Algorithm 1 of NIST SP 800-38D */
+static void gf128_mult_ref(const uint8_t *x, const uint8_t *y, uint8_t *z)
+{
+	uint8_t v[GHASH_BLK_SZ];
+
+	memcpy(v, y, sizeof(v));
+	memset(z, 0, GHASH_BLK_SZ);
+
+	for (size_t i = 0; i < 128; i++) {
+		bool lsb = v[GHASH_BLK_SZ - 1] & 0x01;
+
+		if (x[i / 8] & (0x80 >> (i % 8))) {
+			for (size_t j = 0; j < GHASH_BLK_SZ; j++) {
+				z[j] ^= v[j];
+			}
+		}
+
+		for (size_t j = GHASH_BLK_SZ - 1; j > 0; j--) {
+			v[j] = (v[j] >> 1) | (v[j - 1] << 7);
+		}
+		v[0] >>= 1;
+		if (lsb) {
+			v[0] ^= 0xe1;
+		}
+	}
+}
+
+ZTEST(cracen_sw_ghash, test_vectors)
+{
+	uint8_t y[GHASH_BLK_SZ];
+
+	for (size_t i = 0; i < ARRAY_SIZE(vectors); i++) {
+		zassert_equal(gcm_ext_gen_table(vectors[i].h, h_table), 0);
+		ghash(&vectors[i], y);
+		zassert_mem_equal(y, vectors[i].ghash, GHASH_BLK_SZ, "%s failed",
+				  vectors[i].name);
+	}
+}
+
+ZTEST(cracen_sw_ghash, test_random_mult)
+{
+	uint8_t h[GHASH_BLK_SZ];
+	uint8_t x[GHASH_BLK_SZ];
+	uint8_t expected[GHASH_BLK_SZ];
+	uint8_t output[GHASH_BLK_SZ];
+
+	for (size_t i = 0; i < 256; i++) {
+		sys_rand_get(h, sizeof(h));
+		sys_rand_get(x, sizeof(x));
+
+		zassert_equal(gcm_ext_gen_table(h, h_table), 0);
+		gcm_ext_mult(h_table, x, output);
+		gf128_mult_ref(x, h, expected);
+
+		zassert_mem_equal(output, expected, GHASH_BLK_SZ, "Wrong product in round %zu", i);
+	}
+}
+
+ZTEST(cracen_sw_ghash, test_throughput)
+{
+	static const size_t sizes[] = {64, 256, 1024, 4096, 16384};
+	uint8_t y[GHASH_BLK_SZ];
+	uint64_t start;
+
+	sys_rand_get(buf, sizeof(buf));
+	zassert_equal(gcm_ext_gen_table(vectors[2].h, h_table), 0);
+
+	start = host_cycles_get();
+	for (size_t round = 0; round < THROUGHPUT_ROUNDS; round++) {
+		zassert_equal(gcm_ext_gen_table(vectors[round % ARRAY_SIZE(vectors)].h, h_table),
+			      0);
+	}
+
+	TC_PRINT("GHASH: %s, %zu bytes of precomputed values\n", GHASH_IMPL_NAME,
+		 sizeof(h_table));
+	TC_PRINT("%8s %12u cycles per key\n", "setup",
+		 (uint32_t)((host_cycles_get() - start) / THROUGHPUT_ROUNDS));
+
+	/* The fastest round is reported, as the host may preempt the test at any time */
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		uint64_t cycles = UINT64_MAX;
+		uint32_t cpb_x100;
+
+		for (size_t round = 0; round < THROUGHPUT_ROUNDS; round++) {
+			memset(y, 0, sizeof(y));
+			start = host_cycles_get();
+			ghash_update(y, buf, sizes[i]);
+			cycles = MIN(cycles, host_cycles_get() - start);
+		}
+
+		cpb_x100 = (uint32_t)((cycles * 100) / sizes[i]);
+		TC_PRINT("%8zu %9u.%02u cycles per byte\n", sizes[i], cpb_x100 / 100,
+			 cpb_x100 % 100);
+	}
+}
+
+ZTEST_SUITE(cracen_sw_ghash, NULL, NULL, NULL, NULL, NULL);
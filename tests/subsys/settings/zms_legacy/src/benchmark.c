@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/settings/settings.h>
+
+/* Numbers of bulk settings stored before each measurement, bulk settings are added to reach the
+ * next number of entries.
+ */
+static const uint16_t bench_entry_cnt[] = {32, 64, 128};
+
+#define BENCH_ENTRY_CNT_MAX 128
+#define BENCH_KEY_CNT	    4
+
+static uint32_t bulk_loaded;
+static uint32_t key_loaded;
+
+static int bench_set(const char *name, size_t len, settings_read_cb read_cb, void *cb_arg,
+		     uint32_t *loaded)
+{
+	uint32_t value;
+
+	if (read_cb(cb_arg, &value, sizeof(value)) != sizeof(value)) {
+		return -EINVAL;
+	}
+
+	(*loaded)++;
+
+	return 0;
+}
+
+static int bulk_set(const char *name, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+	return bench_set(name, len, read_cb, cb_arg, &bulk_loaded);
+}
+
+static int key_set(const char *name, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+	return bench_set(name, len, read_cb, cb_arg, &key_loaded);
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(bench_bulk, "bulk", NULL, bulk_set, NULL, NULL);
+SETTINGS_STATIC_HANDLER_DEFINE(bench_key, "bench/key", NULL, key_set, NULL, NULL);
+
+static void bench_name_get(char *name, size_t len, const char *subtree, uint32_t idx)
+{
+	snprintf(name, len, "%s/%u", subtree, idx);
+}
+
+static uint64_t bench_save(const char *subtree, uint32_t first, uint32_t last)
+{
+	char name[SETTINGS_MAX_NAME_LEN];
+	timing_t start;
+	timing_t end;
+	uint64_t cycles = 0;
+	int err;
+
+	for (uint32_t i = first; i < last; i++) {
+		bench_name_get(name, sizeof(name), subtree, i);
+
+		start = timing_counter_get();
+		err = settings_save_one(name, &i, sizeof(i));
+		end = timing_counter_get();
+
+		zassert_ok(err, "Cannot save %s", name);
+		cycles += timing_cycles_get(&start, &end);
+	}
+
+	return cycles;
+}
+
+static uint64_t bench_load(const char *subtree)
+{
+	timing_t start;
+	timing_t end;
+	int err;
+
+	bulk_loaded = 0;
+	key_loaded = 0;
+
+	start = timing_counter_get();
+	err = subtree ? settings_load_subtree(subtree) : settings_load();
+	end = timing_counter_get();
+
+	zassert_ok(err, "Cannot load settings");
+
+	return timing_cycles_get(&start, &end);
+}
+
+ZTEST(suite_settings_zms_legacy_benchmark, test_bench_entry_cnt)
+{
+	uint32_t stored = 0;
+	uint64_t cycles;
+
+	/* Settings subtree with a small number of entries, loaded among the bulk settings. */
+	bench_save("bench/key", 0, BENCH_KEY_CNT);
+
+	for (size_t i = 0; i < ARRAY_SIZE(bench_entry_cnt); i++) {
+		uint16_t entry_cnt = bench_entry_cnt[i];
+
+		cycles = bench_save("bulk", stored, entry_cnt);
+		TC_PRINT("%u entries: save new %llu us/entry\n", entry_cnt,
+			 timing_cycles_to_ns(cycles) / (1000 * (entry_cnt - stored)));
+		stored = entry_cnt;
+
+		cycles = bench_load(NULL);
+		zassert_equal(bulk_loaded, entry_cnt, "Invalid number of loaded entries");
+		zassert_equal(key_loaded, BENCH_KEY_CNT, "Invalid number of loaded entries");
+		TC_PRINT("%u entries: load all %llu us\n", entry_cnt,
+			 timing_cycles_to_ns(cycles) / 1000);
+
+		cycles = bench_load("bench/key");
+		zassert_equal(bulk_loaded, 0, "Loaded entries outside of subtree");
+		zassert_equal(key_loaded, BENCH_KEY_CNT, "Invalid number of loaded entries");
+		TC_PRINT("%u entries: load subtree of %u entries %llu us\n", entry_cnt,
+			 BENCH_KEY_CNT, timing_cycles_to_ns(cycles) / 1000);
+
+		cycles = bench_save("bulk", 0, 1);
+		TC_PRINT("%u entries: update oldest %llu us\n", entry_cnt,
+			 timing_cycles_to_ns(cycles) / 1000);
+	}
+}
+
+static void *suite_setup(void)
+{
+	char name[SETTINGS_MAX_NAME_LEN];
+	int err;
+
+	err = settings_subsys_init();
+	zassert_ok(err, "Cannot initialize settings");
+
+	/* Remove settings left in the flash by a previous run. */
+	for (uint32_t i = 0; i < BENCH_ENTRY_CNT_MAX; i++) {
+		bench_name_get(name, sizeof(name), "bulk", i);
+		(void)settings_delete(name);
+
+		if (i < BENCH_KEY_CNT) {
+			bench_name_get(name, sizeof(name), "bench/key", i);
+			(void)settings_delete(name);
+		}
+	}
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void suite_teardown(void *fixture)
+{
+	timing_stop();
+}
+
+ZTEST_SUITE(suite_settings_zms_legacy_benchmark, NULL, suite_setup, NULL, NULL, suite_teardown);
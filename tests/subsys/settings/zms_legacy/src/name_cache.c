@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/hash_function.h>
+
+/* Number of settings stored in the "cache" subtree, so that their home slots in the name index
+ * collide and form probe sequences.
+ */
+#define CACHE_ENTRY_CNT 64
+
+/* Characters of the two-character names searched for a name hash collision */
+static const char coll_chars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+#define COLL_CHAR_CNT  (sizeof(coll_chars) - 1)
+#define COLL_NAME_CNT  (COLL_CHAR_CNT * COLL_CHAR_CNT)
+#define COLL_NAME_SIZE sizeof("coll/xx")
+
+static uint32_t cache_value[CACHE_ENTRY_CNT];
+static uint8_t cache_loaded[CACHE_ENTRY_CNT];
+static uint32_t cache_invalid;
+
+static char coll_name[2][COLL_NAME_SIZE];
+static uint32_t coll_value[2];
+static uint8_t coll_loaded[2];
+
+static int cache_set(const char *name, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+	char *end;
+	unsigned long idx = strtoul(name, &end, 10);
+
+	if ((*end != '\0') || (idx >= CACHE_ENTRY_CNT) ||
+	    (read_cb(cb_arg, &cache_value[idx], sizeof(cache_value[idx])) !=
+	     sizeof(cache_value[idx]))) {
+		cache_invalid++;
+		return 0;
+	}
+
+	cache_loaded[idx]++;
+
+	return 0;
+}
+
+static int coll_set(const char *name, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(coll_name); i++) {
+		/* Handler is given the name without the "coll/" prefix */
+		if (strcmp(name, &coll_name[i][sizeof("coll/") - 1]) == 0) {
+			if (read_cb(cb_arg, &coll_value[i], sizeof(coll_value[i])) ==
+			    sizeof(coll_value[i])) {
+				coll_loaded[i]++;
+				return 0;
+			}
+		}
+	}
+
+	cache_invalid++;
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(test_cache, "cache", NULL, cache_set, NULL, NULL);
+SETTINGS_STATIC_HANDLER_DEFINE(test_coll, "coll", NULL, coll_set, NULL, NULL);
+
+static void cache_name_get(char *name, size_t len, uint32_t idx)
+{
+	snprintf(name, len, "cache/%u", idx);
+}
+
+static void cache_save(uint32_t idx, uint32_t value)
+{
+	char name[SETTINGS_MAX_NAME_LEN];
+
+	cache_name_get(name, sizeof(name), idx);
+	zassert_ok(settings_save_one(name, &value, sizeof(value)), "Cannot save %s", name);
+}
+
+static void cache_delete(uint32_t idx)
+{
+	char name[SETTINGS_MAX_NAME_LEN];
+
+	cache_name_get(name, sizeof(name), idx);
+	zassert_ok(settings_delete(name), "Cannot delete %s", name);
+}
+
+static void cache_load(const char *subtree)
+{
+	memset(cache_value, 0, sizeof(cache_value));
+	memset(cache_loaded, 0, sizeof(cache_loaded));
+	memset(coll_value, 0, sizeof(coll_value));
+	memset(coll_loaded, 0, sizeof(coll_loaded));
+	cache_invalid = 0;
+
+	zassert_ok(subtree ? settings_load_subtree(subtree) : settings_load(),
+		   "Cannot load settings");
+	zassert_equal(cache_invalid, 0, "Unexpected setting loaded");
+}
+
+/* Checks that each setting is loaded once with its value, or not at all if deleted */
+static void cache_verify(const uint32_t *expected, const bool *deleted)
+{
+	for (uint32_t i = 0; i < CACHE_ENTRY_CNT; i++) {
+		if (deleted[i]) {
+			zassert_equal(cache_loaded[i], 0, "Deleted setting %u loaded", i);
+		} else {
+			zassert_equal(cache_loaded[i], 1, "Setting %u loaded %u times", i,
+				      cache_loaded[i]);
+			zassert_equal(cache_value[i], expected[i], "Setting %u has value %u", i,
+				      cache_value[i]);
+		}
+	}
+}
+
+static void coll_save(size_t i, uint32_t value)
+{
+	zassert_ok(settings_save_one(coll_name[i], &value, sizeof(value)), "Cannot save %s",
+		   coll_name[i]);
+}
+
+/* Finds two names whose hashes collide, so that they share one name index probe sequence */
+static bool coll_names_find(void)
+{
+	static uint32_t hash[COLL_NAME_CNT];
+	char name[COLL_NAME_SIZE];
+
+	for (size_t i = 0; i < COLL_NAME_CNT; i++) {
+		snprintf(name, sizeof(name), "coll/%c%c", coll_chars[i / COLL_CHAR_CNT],
+			 coll_chars[i % COLL_CHAR_CNT]);
+		hash[i] = sys_hash32(name, strlen(name));
+
+		for (size_t j = 0; j < i; j++) {
+			if (hash[j] == hash[i]) {
+				snprintf(coll_name[0], sizeof(coll_name[0]), "coll/%c%c",
+					 coll_chars[j / COLL_CHAR_CNT],
+					 coll_chars[j % COLL_CHAR_CNT]);
+				strcpy(coll_name[1], name);
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+ZTEST(suite_settings_zms_legacy_name_cache, test_delete_and_resave)
+{
+	uint32_t expected[CACHE_ENTRY_CNT];
+	bool deleted[CACHE_ENTRY_CNT] = {false};
+
+	for (uint32_t i = 0; i < CACHE_ENTRY_CNT; i++) {
+		expected[i] = i;
+		cache_save(i, expected[i]);
+	}
+
+	/* Loading all the settings populates the name cache */
+	cache_load(NULL);
+	cache_verify(expected, deleted);
+
+	/* Deleting from the middle of probe sequences shifts the following index entries */
+	for (uint32_t i = 0; i < CACHE_ENTRY_CNT; i += 3) {
+		cache_delete(i);
+		deleted[i] = true;
+	}
+
+	cache_load(NULL);
+	cache_verify(expected, deleted);
+
+	/* Settings left in the shifted entries are found and updated in place */
+	for (uint32_t i = 0; i < CACHE_ENTRY_CNT; i++) {
+		if (!deleted[i]) {
+			expected[i] = 1000 + i;
+			cache_save(i, expected[i]);
+		}
+	}
+
+	cache_load(NULL);
+	cache_verify(expected, deleted);
+
+	/* Settings saved again reuse the freed name IDs */
+	for (uint32_t i = 0; i < CACHE_ENTRY_CNT; i += 3) {
+		expected[i] = 2000 + i;
+		cache_save(i, expected[i]);
+		deleted[i] = false;
+	}
+
+	cache_load(NULL);
+	cache_verify(expected, deleted);
+}
+
+ZTEST(suite_settings_zms_legacy_name_cache, test_reload_populated_cache)
+{
+	uint32_t expected[CACHE_ENTRY_CNT];
+	bool deleted[CACHE_ENTRY_CNT] = {false};
+
+	for (uint32_t i = 0; i < CACHE_ENTRY_CNT; i++) {
+		expected[i] = 3000 + i;
+		cache_save(i, expected[i]);
+	}
+
+	/* The first load populates the cache and the following ones use it */
+	for (int load = 0; load < 3; load++) {
+		cache_load(NULL);
+		cache_verify(expected, deleted);
+	}
+
+	cache_load("cache");
+	cache_verify(expected, deleted);
+
+	/* Settings outside of the subtree are skipped */
+	cache_load("bench/key");
+	for (uint32_t i = 0; i < CACHE_ENTRY_CNT; i++) {
+		zassert_equal(cache_loaded[i], 0, "Setting %u loaded outside of subtree", i);
+	}
+
+	/* Changes made after the cache was populated are visible to the next load */
+	cache_delete(CACHE_ENTRY_CNT - 1);
+	deleted[CACHE_ENTRY_CNT - 1] = true;
+	expected[0] = 4000;
+	cache_save(0, expected[0]);
+
+	cache_load("cache");
+	cache_verify(expected, deleted);
+}
+
+ZTEST(suite_settings_zms_legacy_name_cache, test_hash_collision)
+{
+	if (!coll_names_find()) {
+		ztest_test_skip();
+	}
+
+	TC_PRINT("Colliding names: %s %s\n", coll_name[0], coll_name[1]);
+
+	coll_save(0, 1);
+	coll_save(1, 2);
+
+	cache_load(NULL);
+	zassert_equal(coll_loaded[0], 1);
+	zassert_equal(coll_loaded[1], 1);
+	zassert_equal(coll_value[0], 1);
+	zassert_equal(coll_value[1], 2);
+
+	/* Updating one of the names does not update the other one with the same hash */
+	coll_save(1, 3);
+
+	cache_load("coll");
+	zassert_equal(coll_loaded[0], 1);
+	zassert_equal(coll_loaded[1], 1);
+	zassert_equal(coll_value[0], 1);
+	zassert_equal(coll_value[1], 3);
+
+	/* The other name is still found after the first one is deleted */
+	zassert_ok(settings_delete(coll_name[0]));
+	coll_save(1, 4);
+
+	cache_load("coll");
+	zassert_equal(coll_loaded[0], 0, "Deleted setting loaded");
+	zassert_equal(coll_loaded[1], 1);
+	zassert_equal(coll_value[1], 4);
+
+	zassert_ok(settings_delete(coll_name[1]));
+}
+
+static void *suite_setup(void)
+{
+	zassert_ok(settings_subsys_init(), "Cannot initialize settings");
+
+	return NULL;
+}
+
+static void cache_before(void *fixture)
+{
+	char name[SETTINGS_MAX_NAME_LEN];
+
+	/* Remove settings left by a previous test or run */
+	for (uint32_t i = 0; i < CACHE_ENTRY_CNT; i++) {
+		cache_name_get(name, sizeof(name), i);
+		(void)settings_delete(name);
+	}
+
+	if (coll_names_find()) {
+		(void)settings_delete(coll_name[0]);
+		(void)settings_delete(coll_name[1]);
+	}
+}
+
+ZTEST_SUITE(suite_settings_zms_legacy_name_cache, NULL, suite_setup, cache_before, NULL, NULL);